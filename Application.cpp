@@ -1,26 +1,250 @@
 #include "Application.h"
 #include "imgui/imgui.h"
 #include "classes/TicTacToe.h"
+#include "classes/ConnectFour.h"
+#include "classes/Chess.h"
+#include "classes/Gomoku.h"
+#include "classes/Qubic.h"
+#include "classes/UltimateTicTacToe.h"
+#include "classes/Checkers.h"
+#include "classes/Othello.h"
+#include "classes/Hex.h"
+#include "classes/MNK.h"
+#include "classes/TicTacToe4x4.h"
+#include "classes/SaveGame.h"
+#include "classes/GameJournal.h"
+#include "classes/GameArchive.h"
 #include "Logger.h"
 
-#include <fstream>
+#include <cstdlib>
 #include <string>
 
 // Implementation notes:
 // - Logger is initialized in GameStartUp() and rendered in RenderGame().
-// - Save/Load uses a simple 9-character board state string stored in a file.
-// - Winner/draw display and reset controls are shown in the Settings window.
+// - Save/Load writes versioned, checksummed binary slots (see classes/SaveGame.h)
+//   on a background I/O thread; results are picked up once per frame.
+// - Every finished turn is appended to an autosave journal; GameStartUp() replays
+//   it so a game in progress survives a crash.
+// - Finished games are streamed into a game archive (see classes/GameArchive.h).
+// - Winner/draw display, reset controls and the choice of game are shown in the
+//   Settings window.
 
 namespace ClassGame {
         //
         // our global variables
         //
-        TicTacToe *game = nullptr;
+        Game *game = nullptr;
+        int gameType = 0;
         bool gameOver = false;
         int gameWinner = -1;
 
-        // Save/load stays in Application.cpp so TicTacToe.cpp only contains game rules.
-        static const char* kSaveFilePath = "tictactoe_save.txt";
+        // Save/load stays out of TicTacToe.cpp so it only contains game rules.
+        SaveGameIO *saveIO = nullptr;
+        int saveSlot = 0;
+
+        GameJournal *journal = nullptr;
+        static const char* kJournalFilePath = "tictactoe_journal.bin";
+
+        GameArchiveWriter *archive = nullptr;
+        static const char* kArchiveFilePath = "tictactoe_games.tga";
+
+        //
+        // the games that can be played, in the order of the Settings combo
+        //
+        static const char* kGameNames[] = { "Tic Tac Toe", "Connect Four", "Chess", "Gomoku", "Qubic", "Ultimate Tic Tac Toe", "Checkers", "Othello", "Hex", "m,n,k (multiplayer)", "Tic Tac Toe 4x4" };
+        static const int kGameCount = IM_ARRAYSIZE(kGameNames);
+
+        static Game *CreateGame(int type)
+        {
+            switch (type)
+            {
+                case 1:
+                    return new ConnectFour();
+                case 2:
+                    return new Chess();
+                case 3:
+                    return new Gomoku();
+                case 4:
+                    return new Qubic();
+                case 5:
+                    return new UltimateTicTacToe();
+                case 6:
+                    return new Checkers();
+                case 7:
+                    return new Othello();
+                case 8:
+                    return new Hex();
+                case 9:
+                    return new MNK();
+                case 10:
+                    return new TicTacToe4x4();
+                default:
+                    return new TicTacToe();
+            }
+        }
+
+        //
+        // which game a saved board belongs to, boards are told apart by their size
+        //
+        static int GameTypeForBoard(const std::string &board)
+        {
+            for (int type = 0; type < kGameCount; ++type)
+            {
+                Game *candidate = CreateGame(type);
+                const bool match = candidate->initialStateString().size() == board.size();
+                delete candidate;
+                if (match)
+                    return type;
+            }
+            return 0;
+        }
+
+        //
+        // write the current game to the archive, the moves are the codes each
+        // game recorded with its turns (see Game::kPassMoveCode); a game with a
+        // turn that has none, e.g. one restored from the journal, isn't archived
+        //
+        static void ArchiveGame(uint8_t result)
+        {
+            if (!archive || !archive->isOpen() || game->_turns.size() < 2)
+                return;
+
+            std::vector<uint8_t> moves;
+            moves.reserve(game->_turns.size());
+            for (size_t i = 1; i < game->_turns.size(); ++i)
+            {
+                const std::string &code = game->_turns[i]->_move;
+                char *end = nullptr;
+                const long value = std::strtol(code.c_str(), &end, 10);
+                if (code.empty() || *end != '\0' || value < 0 || value > 255)
+                {
+                    Logger::GetInstance().Log(LogLevel::Warning, "Game not archived, a turn has no move recorded");
+                    return;
+                }
+                moves.push_back(static_cast<uint8_t>(value));
+            }
+            const uint8_t cells = static_cast<uint8_t>(game->initialStateString().size());
+            archive->addGame(static_cast<uint64_t>(game->_gameNumber), result, cells, moves.data(), moves.size());
+        }
+
+        //
+        // set gameOver / gameWinner from the current board, archiving the game
+        // when it has just ended (restored and loaded games were archived already)
+        //
+        static void CheckForGameOver(bool archiveResult = true)
+        {
+            const bool wasOver = gameOver;
+            Player *winner = game->checkForWinner();
+            if (winner)
+            {
+                gameOver = true;
+                gameWinner = winner->playerNumber();
+                Logger::GetInstance().Log(LogLevel::Info, "Winner Detected.");
+            }
+            if (game->checkForDraw()) {
+                gameOver = true;
+                gameWinner = -1;
+                Logger::GetInstance().Log(LogLevel::Warning, "Draw Detected.");
+            }
+            if (gameOver && !wasOver && archiveResult)
+                ArchiveGame(gameWinner >= 0 ? static_cast<uint8_t>(gameWinner + 1) : GameArchiveFormat::kResultDraw);
+        }
+
+        //
+        // restart the journal with every turn of the current game,
+        // used when the board changes without going through endTurn (loads)
+        //
+        static void JournalWholeGame()
+        {
+            journal->beginGame(game->_gameNumber);
+            for (size_t i = 1; i < game->_turns.size(); ++i)
+                journal->appendTurn(game->_gameNumber, static_cast<unsigned int>(i), game->_turns[i]->_boardState);
+        }
+
+        //
+        // put the last game found in the journal back on the board
+        //
+        static void RestoreFromJournal(const JournalGame &saved)
+        {
+            const JournalTurn &last = saved.turns.back();
+            if (last.boardState.size() != game->initialStateString().size())
+                return;
+
+            game->setStateString(last.boardState);
+            for (size_t i = 1; i < game->_turns.size(); ++i)
+                delete game->_turns[i];
+            game->_turns.resize(1);
+            for (const JournalTurn &entry : saved.turns)
+            {
+                Turn *turn = new Turn;
+                turn->_game = game;
+                turn->_status = kTurnFinished;
+                turn->_boardState = entry.boardState;
+                turn->_date = static_cast<int>(entry.turnNo);
+                turn->_gameNumber = saved.gameNumber;
+                game->_turns.push_back(turn);
+            }
+            game->_gameNumber = saved.gameNumber;
+            game->_gameOptions.currentTurnNo = last.turnNo;
+            CheckForGameOver(false);
+            Logger::GetInstance().Log(LogLevel::Info, "Restored game in progress from the autosave journal");
+        }
+
+        //
+        // apply any save/load jobs the I/O thread has finished
+        //
+        static void PollSaveResults()
+        {
+            SaveGameIO::Result result;
+            while (saveIO && saveIO->poll(result))
+            {
+                const std::string slotName = "slot " + std::to_string(result.slot + 1);
+                if (!result.ok)
+                {
+                    Logger::GetInstance().Log(LogLevel::Error, result.error);
+                    continue;
+                }
+                if (result.type == SaveGameIO::kSave)
+                {
+                    Logger::GetInstance().Log(LogLevel::Info, "Saved game state to " + slotName);
+                    continue;
+                }
+                if (SaveGame::apply(*game, result.data))
+                {
+                    gameOver = false;
+                    gameWinner = -1;
+                    CheckForGameOver(false);
+                    JournalWholeGame();
+                    Logger::GetInstance().Log(LogLevel::Info, "Loaded game state from " + slotName);
+                }
+                else
+                {
+                    Logger::GetInstance().Log(LogLevel::Warning, "Save in " + slotName + " does not match this game");
+                }
+            }
+        }
+
+        //
+        // replace the current game with a fresh game of another type,
+        // the game number carries on
+        //
+        static void SwitchGame(int type)
+        {
+            const int nextGameNumber = game->_gameNumber + 1;
+            game->stopGame();
+            delete game;
+
+            gameType = type;
+            game = CreateGame(type);
+            game->setUpBoard();
+            game->_gameNumber = nextGameNumber;
+            game->_turns[0]->_gameNumber = nextGameNumber;
+            gameOver = false;
+            gameWinner = -1;
+            journal->beginGame(game->_gameNumber);
+
+            Logger::GetInstance().Log(LogLevel::Info, std::string(kGameNames[type]) + " started");
+        }
 
         //
         // game starting point
@@ -30,10 +254,50 @@ namespace ClassGame {
         {
             Logger::GetInstance().Initialize("GameLog.txt");
 
-            game = new TicTacToe();
+            // replay the autosave journal first, it decides which game to start with
+            JournalGame saved;
+            bool restored = GameJournal::replay(kJournalFilePath, saved) && !saved.turns.empty();
+            if (restored)
+                gameType = GameTypeForBoard(saved.turns.back().boardState);
+
+            game = CreateGame(gameType);
             game->setUpBoard();
 
-            Logger::GetInstance().Log(LogLevel::Info, "TicTacToe started");
+            saveIO = new SaveGameIO();
+
+            // game numbers carry on from the games already archived
+            archive = new GameArchiveWriter();
+            std::string archiveError;
+            if (archive->open(kArchiveFilePath, archiveError))
+                game->_gameNumber = static_cast<int>(archive->nextGameNumber());
+            else
+                Logger::GetInstance().Log(LogLevel::Warning, "Game archive unavailable: " + archiveError);
+
+            // the journal is replayed before it's reopened for appends
+            if (restored)
+                RestoreFromJournal(saved);
+
+            journal = new GameJournal();
+            if (!journal->open(kJournalFilePath))
+                Logger::GetInstance().Log(LogLevel::Warning, "Autosave journal could not be opened");
+            else if (!restored)
+                journal->beginGame(game->_gameNumber);
+
+            Logger::GetInstance().Log(LogLevel::Info, std::string(kGameNames[gameType]) + " started");
+        }
+
+        //
+        // called once by main.cpp after the render loop exits
+        //
+        void GameShutDown()
+        {
+            // an unfinished game is kept in the journal, the archive only gets its index written
+            if (archive)
+                archive->close();
+            if (journal)
+                journal->close();
+            delete saveIO;      // waits for queued saves
+            saveIO = nullptr;
         }
 
         //
@@ -110,53 +374,32 @@ namespace ClassGame {
                 if (!game->getCurrentPlayer()) return;
                 
                 ImGui::Begin("Settings");
+                int selectedGame = gameType;
+                ImGui::SetNextItemWidth(150);
+                if (ImGui::Combo("Game", &selectedGame, kGameNames, kGameCount) && selectedGame != gameType)
+                    SwitchGame(selectedGame);
                 ImGui::Text("Current Player Number: %d", game->getCurrentPlayer()->playerNumber());
                 ImGui::Text("Current Board State: %s", game->stateString().c_str());
+                game->drawSettings();
 
                 // Save / Load
-                // The save file stores a 9-character state string such as "102020001".
+                // Each slot holds the board, turn history, options and players.
+                // The disk work happens on the SaveGameIO thread.
+                PollSaveResults();
+
+                const char* slots[kSaveSlotCount] = { "Slot 1", "Slot 2", "Slot 3" };
+                ImGui::SetNextItemWidth(100);
+                ImGui::Combo("##SaveSlot", &saveSlot, slots, kSaveSlotCount);
+                ImGui::SameLine();
                 if (ImGui::Button("Save Game"))
-                {
-                    std::ofstream out(kSaveFilePath, std::ios::out | std::ios::trunc);
-                    if (out.is_open())
-                    {
-                        out << game->stateString();
-                        out.close();
-                        Logger::GetInstance().Log(LogLevel::Info, "Saved game state");
-                    }
-                    else
-                    {
-                        Logger::GetInstance().Log(LogLevel::Error, "Failed to open save file for writing");
-                    }
-                }
+                    saveIO->requestSave(saveSlot, SaveGame::capture(*game));
                 ImGui::SameLine();
-
                 if (ImGui::Button("Load Game"))
+                    saveIO->requestLoad(saveSlot);
+                if (saveIO->busy())
                 {
-                    std::ifstream in(kSaveFilePath);
-                    std::string s;
-
-                    if (in.is_open())
-                    {
-                        in >> s;
-                        in.close();
-
-                        if (s.size() == 9)
-                        {
-                            game->setStateString(s);
-                            gameOver = false;
-                            gameWinner = -1;
-                            Logger::GetInstance().Log(LogLevel::Info, "Loaded game state");
-                        }
-                        else
-                        {
-                            Logger::GetInstance().Log(LogLevel::Warning, "Save file did not contain a valid 9-character state");
-                        }
-                    }
-                    else
-                    {
-                Logger::GetInstance().Log(LogLevel::Error, "Failed to open save file for reading");
-                    }
+                    ImGui::SameLine();
+                    ImGui::TextUnformatted("(working...)");
                 }
 
                 if (gameOver) {
@@ -167,10 +410,14 @@ namespace ClassGame {
                         ImGui::Text("Winner: Draw");
 
                     if (ImGui::Button("Reset Game")) {
+                        const int nextGameNumber = game->_gameNumber + 1;
                         game->stopGame();
                         game->setUpBoard();
+                        game->_gameNumber = nextGameNumber;
+                        game->_turns[0]->_gameNumber = nextGameNumber;
                         gameOver = false;
                         gameWinner = -1;
+                        journal->beginGame(game->_gameNumber);
 
                         Logger::GetInstance().Log(LogLevel::Info, "Game reset");
                     }
@@ -185,21 +432,12 @@ namespace ClassGame {
 
         //
         // end turn is called by the game code at the end of each turn
-        // this is where we check for a winner
+        // this is where we journal the turn and check for a winner
         //
         void EndOfTurn() 
         {
-            Player *winner = game->checkForWinner();
-            if (winner)
-            {
-                gameOver = true;
-                gameWinner = winner->playerNumber();
-                Logger::GetInstance().Log(LogLevel::Info, "Winner Detected.");
-            }
-            if (game->checkForDraw()) {
-                gameOver = true;
-                gameWinner = -1;
-                Logger::GetInstance().Log(LogLevel::Warning, "Draw Detected.");
-            }
+            // only copies a small record into memory, the journal thread does the disk work
+            journal->appendTurn(game->_gameNumber, game->getCurrentTurnNo(), game->stateString());
+            CheckForGameOver();
         }
 }
@@ -2,6 +2,7 @@
 
 namespace ClassGame {
     void GameStartUp();
+    void GameShutDown();
     void RenderGame();
     void EndOfTurn();
 }
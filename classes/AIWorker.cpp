@@ -0,0 +1,46 @@
+#include "AIWorker.h"
+
+AIWorker::AIWorker() : _stop(false), _done(false), _move(-1)
+{
+}
+
+AIWorker::~AIWorker()
+{
+    cancel();
+}
+
+void AIWorker::start(Job job, std::chrono::milliseconds budget)
+{
+    cancel();
+    _stop = false;
+    _done = false;
+    _move = -1;
+    _deadline = std::chrono::steady_clock::now() + budget;
+    _thread = std::thread([this, job]() {
+        _move = job(_stop);
+        _done.store(true, std::memory_order_release);
+    });
+}
+
+bool AIWorker::poll(int &move)
+{
+    if (!busy())
+        return false;
+    if (!_done.load(std::memory_order_acquire))
+    {
+        if (std::chrono::steady_clock::now() >= _deadline)
+            _stop = true;
+        return false;
+    }
+    _thread.join();
+    move = _move;
+    return true;
+}
+
+void AIWorker::cancel()
+{
+    if (!busy())
+        return;
+    _stop = true;
+    _thread.join();
+}
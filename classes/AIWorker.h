@@ -0,0 +1,42 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <thread>
+
+//
+// runs an AI search on its own thread so the render loop keeps going
+//
+// updateAI() starts a job the first frame it's the AI's turn and calls
+// poll() on every frame after that until the move comes back. once the time
+// budget runs out poll() raises the stop flag, the job is expected to notice
+// and return the best move it has so far.
+//
+class AIWorker
+{
+public:
+    // the job gets the stop flag to watch and returns the move to play
+    typedef std::function<int(const std::atomic<bool> &stop)> Job;
+
+    AIWorker();
+    ~AIWorker();
+
+    // start a search, a search that's still running is cancelled first
+    void        start(Job job, std::chrono::milliseconds budget);
+    // true once, when the started search has a move ready
+    bool        poll(int &move);
+    // stop the search and throw its result away, waits for the thread
+    void        cancel();
+    // a new time budget for the running search, counted from now
+    void        setBudget(std::chrono::milliseconds budget) { _deadline = std::chrono::steady_clock::now() + budget; }
+
+    // started and the result not picked up yet
+    bool        busy() const { return _thread.joinable(); }
+
+private:
+    std::thread                             _thread;
+    std::atomic<bool>                       _stop;
+    std::atomic<bool>                       _done;
+    int                                     _move;
+    std::chrono::steady_clock::time_point   _deadline;
+};
@@ -0,0 +1,133 @@
+#include "BatchWinCheck.h"
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+#include <immintrin.h>
+#endif
+
+BatchWinCheck::BatchWinCheck(const uint64_t *lines, size_t count, uint64_t cells) : _lines(lines, lines + count),
+    _cells(cells)
+{
+}
+
+BatchWinCheck BatchWinCheck::rows(int width, int height, int k)
+{
+    static const int kDirections[4][2] = { { 1, 0 }, { 0, 1 }, { 1, 1 }, { 1, -1 } };
+    std::vector<uint64_t> lines;
+    for (int row = 0; row < height; ++row)
+    {
+        for (int col = 0; col < width; ++col)
+        {
+            for (const int *d : kDirections)
+            {
+                const int endCol = col + d[0] * (k - 1);
+                const int endRow = row + d[1] * (k - 1);
+                if (endCol < 0 || endCol >= width || endRow < 0 || endRow >= height)
+                    continue;
+                uint64_t line = 0;
+                for (int i = 0; i < k; ++i)
+                    line |= uint64_t(1) << ((row + d[1] * i) * width + col + d[0] * i);
+                lines.push_back(line);
+            }
+        }
+    }
+    const int cells = width * height;
+    return BatchWinCheck(lines.data(), lines.size(), cells >= 64 ? ~uint64_t(0) : (uint64_t(1) << cells) - 1);
+}
+
+const char *BatchWinCheck::kernelName()
+{
+#if defined(__AVX2__)
+    return "AVX2";
+#elif defined(__SSE4_1__)
+    return "SSE4.1";
+#else
+    return "portable";
+#endif
+}
+
+void BatchWinCheck::evaluatePortable(const uint64_t *first, const uint64_t *second, size_t count, int8_t *results) const
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        bool firstWins = false, secondWins = false;
+        for (uint64_t line : _lines)
+        {
+            firstWins |= (first[i] & line) == line;
+            secondWins |= (second[i] & line) == line;
+        }
+        results[i] = firstWins ? 0 : secondWins ? 1 : ((first[i] | second[i]) & _cells) == _cells ? kDraw : kPlaying;
+    }
+}
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+//
+// the SIMD kernels leave a lane all ones for a player with a line, the
+// results come out of the lanes' sign bits
+//
+static inline int8_t laneResult(int firstBits, int secondBits, int fullBits, int lane)
+{
+    if (firstBits >> lane & 1)
+        return 0;
+    if (secondBits >> lane & 1)
+        return 1;
+    return fullBits >> lane & 1 ? BatchWinCheck::kDraw : BatchWinCheck::kPlaying;
+}
+#endif
+
+void BatchWinCheck::evaluate(const uint64_t *first, const uint64_t *second, size_t count, int8_t *results) const
+{
+    size_t i = 0;
+#if defined(__AVX2__)
+    const __m256i cells = _mm256_set1_epi64x(static_cast<long long>(_cells));
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256i a0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first + i));
+        const __m256i a1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first + i + 4));
+        const __m256i b0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(second + i));
+        const __m256i b1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(second + i + 4));
+        __m256i wa0 = _mm256_setzero_si256(), wa1 = wa0, wb0 = wa0, wb1 = wa0;
+        for (uint64_t mask : _lines)
+        {
+            const __m256i line = _mm256_set1_epi64x(static_cast<long long>(mask));
+            wa0 = _mm256_or_si256(wa0, _mm256_cmpeq_epi64(_mm256_and_si256(a0, line), line));
+            wa1 = _mm256_or_si256(wa1, _mm256_cmpeq_epi64(_mm256_and_si256(a1, line), line));
+            wb0 = _mm256_or_si256(wb0, _mm256_cmpeq_epi64(_mm256_and_si256(b0, line), line));
+            wb1 = _mm256_or_si256(wb1, _mm256_cmpeq_epi64(_mm256_and_si256(b1, line), line));
+        }
+        const __m256i full0 = _mm256_cmpeq_epi64(_mm256_and_si256(_mm256_or_si256(a0, b0), cells), cells);
+        const __m256i full1 = _mm256_cmpeq_epi64(_mm256_and_si256(_mm256_or_si256(a1, b1), cells), cells);
+        const int firstBits = _mm256_movemask_pd(_mm256_castsi256_pd(wa0)) | _mm256_movemask_pd(_mm256_castsi256_pd(wa1)) << 4;
+        const int secondBits = _mm256_movemask_pd(_mm256_castsi256_pd(wb0)) | _mm256_movemask_pd(_mm256_castsi256_pd(wb1)) << 4;
+        const int fullBits = _mm256_movemask_pd(_mm256_castsi256_pd(full0)) | _mm256_movemask_pd(_mm256_castsi256_pd(full1)) << 4;
+        for (int lane = 0; lane < 8; ++lane)
+            results[i + lane] = laneResult(firstBits, secondBits, fullBits, lane);
+    }
+#elif defined(__SSE4_1__)
+    const __m128i cells = _mm_set1_epi64x(static_cast<long long>(_cells));
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128i a0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first + i));
+        const __m128i a1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first + i + 2));
+        const __m128i b0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(second + i));
+        const __m128i b1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(second + i + 2));
+        __m128i wa0 = _mm_setzero_si128(), wa1 = wa0, wb0 = wa0, wb1 = wa0;
+        for (uint64_t mask : _lines)
+        {
+            const __m128i line = _mm_set1_epi64x(static_cast<long long>(mask));
+            wa0 = _mm_or_si128(wa0, _mm_cmpeq_epi64(_mm_and_si128(a0, line), line));
+            wa1 = _mm_or_si128(wa1, _mm_cmpeq_epi64(_mm_and_si128(a1, line), line));
+            wb0 = _mm_or_si128(wb0, _mm_cmpeq_epi64(_mm_and_si128(b0, line), line));
+            wb1 = _mm_or_si128(wb1, _mm_cmpeq_epi64(_mm_and_si128(b1, line), line));
+        }
+        const __m128i full0 = _mm_cmpeq_epi64(_mm_and_si128(_mm_or_si128(a0, b0), cells), cells);
+        const __m128i full1 = _mm_cmpeq_epi64(_mm_and_si128(_mm_or_si128(a1, b1), cells), cells);
+        const int firstBits = _mm_movemask_pd(_mm_castsi128_pd(wa0)) | _mm_movemask_pd(_mm_castsi128_pd(wa1)) << 2;
+        const int secondBits = _mm_movemask_pd(_mm_castsi128_pd(wb0)) | _mm_movemask_pd(_mm_castsi128_pd(wb1)) << 2;
+        const int fullBits = _mm_movemask_pd(_mm_castsi128_pd(full0)) | _mm_movemask_pd(_mm_castsi128_pd(full1)) << 2;
+        for (int lane = 0; lane < 4; ++lane)
+            results[i + lane] = laneResult(firstBits, secondBits, fullBits, lane);
+    }
+#endif
+    // whatever doesn't fill a block
+    evaluatePortable(first + i, second + i, count - i, results + i);
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+//
+// win and draw status for many boards of the same game at once
+//
+// any game whose board fits in 64 cells and is won by filling a line can be
+// checked with the lines as bit masks: a player has a line when their
+// stones and'ed with it give it back. checking one board at a time spends
+// most of its time getting to the next board, so the boards come in as a
+// structure of arrays instead, the first player's stones for every board in
+// one array and the second's in another, and each line is tested against
+// several boards in one go.
+//
+// with AVX2 (where the compiler targets it, see USE_AVX2) four boards sit in
+// the lanes of a 256-bit register, with SSE4.1 (USE_SSE41) two in a 128-bit
+// one, and two registers of each player go through the lines together so
+// the compares don't wait on each other. evaluatePortable() does the same
+// one board at a time and is always there to check the others against.
+//
+// the result for a board is the player with a line, kDraw when every cell is
+// taken and nobody has one, otherwise kPlaying. a board where both players
+// have a line, which no game gets to, counts as the first player's.
+//
+class BatchWinCheck
+{
+public:
+    static const int8_t kPlaying = -1;
+    static const int8_t kDraw = 2;
+
+    // the lines, and the cells the board has
+    BatchWinCheck(const uint64_t *lines, size_t count, uint64_t cells);
+    // every row, column and diagonal of k cells on a width x height board,
+    // cell row * width + column like MNKPosition and TicTacToeSolver
+    static BatchWinCheck rows(int width, int height, int k);
+
+    // a result per board, for boards first[i] / second[i]
+    void        evaluate(const uint64_t *first, const uint64_t *second, size_t count, int8_t *results) const;
+    void        evaluatePortable(const uint64_t *first, const uint64_t *second, size_t count, int8_t *results) const;
+
+    size_t      lineCount() const { return _lines.size(); }
+    // which of the kernels evaluate() was built with
+    static const char *kernelName();
+
+private:
+    std::vector<uint64_t>   _lines;
+    uint64_t                _cells;
+};
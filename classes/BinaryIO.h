@@ -0,0 +1,82 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+//
+// little-endian helpers for the binary file formats (saves, journal, archives)
+// values are written byte by byte so files are portable between platforms
+//
+
+class ByteWriter
+{
+public:
+    ByteWriter(std::vector<uint8_t> &out) : _out(out) {}
+
+    void u8(uint8_t v) { _out.push_back(v); }
+    void u16(uint16_t v) { for (int i = 0; i < 2; ++i) _out.push_back(uint8_t(v >> (8 * i))); }
+    void u32(uint32_t v) { for (int i = 0; i < 4; ++i) _out.push_back(uint8_t(v >> (8 * i))); }
+    void u64(uint64_t v) { for (int i = 0; i < 8; ++i) _out.push_back(uint8_t(v >> (8 * i))); }
+    void i32(int32_t v) { u32(static_cast<uint32_t>(v)); }
+    void bytes(const void *data, size_t size)
+    {
+        const uint8_t *p = static_cast<const uint8_t *>(data);
+        _out.insert(_out.end(), p, p + size);
+    }
+    // strings are stored as a u16 length followed by the raw characters
+    void str(const std::string &s)
+    {
+        u16(static_cast<uint16_t>(s.size()));
+        bytes(s.data(), s.size());
+    }
+    size_t size() const { return _out.size(); }
+
+private:
+    std::vector<uint8_t> &_out;
+};
+
+//
+// bounds checked reader: once a read runs off the end every later read fails
+// and ok() returns false, so callers can check once at the end
+//
+class ByteReader
+{
+public:
+    ByteReader(const uint8_t *data, size_t size) : _data(data), _size(size), _pos(0), _ok(true) {}
+
+    uint8_t  u8() { uint8_t v = 0; read(&v, 1); return v; }
+    uint16_t u16() { uint8_t b[2] = {}; read(b, 2); return uint16_t(b[0] | (b[1] << 8)); }
+    uint32_t u32()
+    {
+        uint8_t b[4] = {};
+        read(b, 4);
+        return uint32_t(b[0]) | (uint32_t(b[1]) << 8) | (uint32_t(b[2]) << 16) | (uint32_t(b[3]) << 24);
+    }
+    uint64_t u64() { uint64_t lo = u32(); uint64_t hi = u32(); return lo | (hi << 32); }
+    int32_t  i32() { return static_cast<int32_t>(u32()); }
+    std::string str()
+    {
+        uint16_t len = u16();
+        if (!_ok || _pos + len > _size) { _ok = false; return std::string(); }
+        std::string s(reinterpret_cast<const char *>(_data + _pos), len);
+        _pos += len;
+        return s;
+    }
+    void read(void *dst, size_t size)
+    {
+        if (!_ok || _pos + size > _size) { _ok = false; std::memset(dst, 0, size); return; }
+        std::memcpy(dst, _data + _pos, size);
+        _pos += size;
+    }
+
+    bool   ok() const { return _ok; }
+    size_t position() const { return _pos; }
+    size_t remaining() const { return _ok ? _size - _pos : 0; }
+
+private:
+    const uint8_t *_data;
+    size_t         _size;
+    size_t         _pos;
+    bool           _ok;
+};
@@ -0,0 +1,328 @@
+#include "Checkers.h"
+
+#include <algorithm>
+
+// how long the AI thinks about each move
+static const std::chrono::milliseconds kThinkTime(1000);
+
+Checkers::Checkers() : _jumpFrom(-1), _jumpAt(-1), _jumped(0)
+{
+}
+
+Checkers::~Checkers()
+{
+    _ai.cancel();
+}
+
+Bit* Checkers::PieceForPlayer(int playerNumber, bool king)
+{
+    Bit *bit = new Bit();
+    bit->LoadTextureFromFile(playerNumber == 0 ? "red.png" : "yellow.png");
+    bit->setOwner(getPlayerAt(playerNumber));
+    bit->setGameTag(playerNumber + (king ? 2 : 0));
+    if (king)
+        bit->setColor(0.55f, 0.55f, 0.55f, 1.0f);
+    return bit;
+}
+
+//
+// setup the game board, this is called once at the start of the game
+//
+void Checkers::setUpBoard()
+{
+    setNumberOfPlayers(2);
+    setAIPlayer(1);
+
+    _gameOptions.rowX = 8;
+    _gameOptions.rowY = 8;
+
+    // the sprites are 100x100, the holder's game tag is its dark square number
+    const float cellSize = 100.0f;
+    for (int row = 0; row < 8; ++row)
+    {
+        for (int col = 0; col < 8; ++col)
+        {
+            ImVec2 pos(col * cellSize, row * cellSize);
+            _grid[row][col].initHolder(pos, "square.png", col, row);
+            _grid[row][col].setGameTag(CheckersPosition::squareAt(row, col));
+            if (CheckersPosition::squareAt(row, col) < 0)
+                _grid[row][col].setColor(1.0f, 0.95f, 0.85f, 1.0f);
+            else
+                _grid[row][col].setColor(0.6f, 0.45f, 0.3f, 1.0f);
+        }
+    }
+
+    _position = CheckersPosition();
+    _keyHistory.assign(1, _position.key());
+    _jumpFrom = -1;
+    syncBoard();
+
+    // the table is big, only allocate it once
+    if (!_search)
+        _search = std::make_unique<CheckersSearch>();
+    else
+        _search->clear();
+
+    startGame();
+}
+
+void Checkers::syncBoard()
+{
+    // a jump under way has the piece on its landing square so far
+    uint32_t pieces[2] = { _position.pieces(0), _position.pieces(1) };
+    uint32_t kings = _position.kings(0) | _position.kings(1);
+    if (_jumpFrom >= 0 && _jumpFrom != _jumpAt)
+    {
+        const uint32_t moved = (1u << _jumpFrom) | (1u << _jumpAt);
+        pieces[_position.sideToMove()] ^= moved;
+        if (kings & (1u << _jumpFrom))
+            kings ^= moved;
+    }
+
+    for (int sq = 0; sq < CheckersPosition::kSquares; ++sq)
+    {
+        Square &square = squareAt(sq);
+        const uint32_t bit = 1u << sq;
+        const int player = (pieces[0] & bit) ? 0 : (pieces[1] & bit) ? 1 : -1;
+        const int tag = player + (kings & bit ? 2 : 0);
+        Bit *b = square.bit();
+        if (b && player >= 0 && b->gameTag() == tag)
+            continue;
+        if (b)
+            square.destroyBit();
+        if (player < 0)
+            continue;
+        Bit *placeBit = PieceForPlayer(player, tag >= 2);
+        placeBit->setPosition(square.getPosition());
+        square.setBit(placeBit);
+    }
+}
+
+//
+// only the side to move may pick up a piece, and only one that has somewhere
+// to go; with a capture on the board that's only the pieces that can capture
+//
+bool Checkers::canBitMoveFrom(Bit *bit, BitHolder *src)
+{
+    if (!bit || src->gameTag() < 0 || (bit->gameTag() & 1) != _position.sideToMove())
+        return false;
+    if (getCurrentPlayer()->playerNumber() != _position.sideToMove())
+        return false;
+    // part way through a multi-jump only the jumping piece can go on
+    if (_jumpFrom >= 0)
+        return src->gameTag() == _jumpAt;
+
+    CheckersMoveList list;
+    _position.generate(list);
+    return std::any_of(list.begin(), list.end(), [src](const CheckersMove &m) { return m.from == src->gameTag(); });
+}
+
+bool Checkers::canBitMoveFromTo(Bit* bit, BitHolder*src, BitHolder*dst)
+{
+    if (dst->gameTag() < 0)
+        return false;
+    const int from = _jumpFrom >= 0 ? _jumpFrom : src->gameTag();
+    CheckersMove move;
+    return _position.jumpOver(from, src->gameTag(), _jumped, dst->gameTag()) >= 0 ||
+           completedMove(src->gameTag(), dst->gameTag(), move) > 0;
+}
+
+//
+// a drop one jump away is taken as that jump, and finishes the move if
+// there's only one way to go on from there; any other drop has to be the end
+// of exactly one route
+//
+void Checkers::bitMovedFromTo(Bit *bit, BitHolder *src, BitHolder *dst)
+{
+    const int from = _jumpFrom >= 0 ? _jumpFrom : src->gameTag();
+    const int over = _position.jumpOver(from, src->gameTag(), _jumped, dst->gameTag());
+    if (over >= 0)
+    {
+        const uint32_t captured = _jumped | (1u << over);
+        CheckersMoveList list;
+        _position.finishCaptures(list, from, dst->gameTag(), captured);
+        const bool oneWay = std::all_of(list.begin(), list.end(), [&list](const CheckersMove &m) {
+            return m.to == list.moves[0].to && m.captures == list.moves[0].captures;
+        });
+        if (list.size > 0 && oneWay)
+        {
+            playMove(list.moves[0]);
+            return;
+        }
+        _jumpFrom = from;
+        _jumpAt = dst->gameTag();
+        _jumped = captured;
+        return;
+    }
+
+    CheckersMove move;
+    if (completedMove(src->gameTag(), dst->gameTag(), move) > 0)
+        playMove(move);
+    else
+    {
+        // put the sprites back the way the position has them
+        syncBoard();
+    }
+}
+
+int Checkers::completedMove(int square, int to, CheckersMove &move) const
+{
+    CheckersMoveList list;
+    if (_jumpFrom >= 0)
+        _position.finishCaptures(list, _jumpFrom, square, _jumped);
+    else
+        _position.generate(list);
+    const int from = _jumpFrom >= 0 ? _jumpFrom : square;
+    int found = 0;
+    for (const CheckersMove &m : list)
+    {
+        if (m.from != from || m.to != to)
+            continue;
+        if (found && m.captures != move.captures)
+            return -1;
+        move = m;
+        found = 1;
+    }
+    return found;
+}
+
+void Checkers::playMove(const CheckersMove &move)
+{
+    // the archive keeps the move's place in the generated list, which fits a byte
+    CheckersMoveList list;
+    _position.generate(list);
+    const CheckersMove *found = std::find_if(list.moves, list.moves + list.size, [&](const CheckersMove &m) {
+        return m.from == move.from && m.to == move.to && m.captures == move.captures;
+    });
+    _lastMoveCode = static_cast<int>(found - list.moves);
+
+    _jumpFrom = -1;
+    _position.makeMove(move);
+    _keyHistory.push_back(_position.key());
+    syncBoard();
+    endTurn();
+}
+
+//
+// free all the memory used by the game on the heap
+//
+void Checkers::stopGame()
+{
+    _ai.cancel();
+    for (int row = 0; row < 8; ++row)
+    {
+        for (int col = 0; col < 8; ++col)
+        {
+            _grid[row][col].destroyBit();
+        }
+    }
+}
+
+Player* Checkers::checkForWinner()
+{
+    // the side to move loses when it has nothing left to move
+    CheckersMoveList list;
+    _position.generate(list);
+    return list.size == 0 ? getPlayerAt(_position.sideToMove() ^ 1) : nullptr;
+}
+
+bool Checkers::checkForDraw()
+{
+    if (_position.quietPlies() >= CheckersSearch::kDrawPlies)
+        return true;
+
+    // the same position three times with the same side to move
+    int repeats = 1;
+    const int last = static_cast<int>(_keyHistory.size()) - 1;
+    for (int i = 4; i <= std::min(_position.quietPlies(), last); i += 2)
+    {
+        if (_keyHistory[last - i] == _position.key() && ++repeats == 3)
+            return true;
+    }
+    return false;
+}
+
+//
+// state strings
+//
+std::string Checkers::initialStateString()
+{
+    return "yyyyyyyyyyyy00000000rrrrrrrrrrrrr";
+}
+
+std::string Checkers::stateString() const
+{
+    std::string state;
+    state.reserve(CheckersPosition::kSquares + 1);
+    for (int sq = 0; sq < CheckersPosition::kSquares; ++sq)
+    {
+        const uint32_t bit = 1u << sq;
+        char c = '0';
+        if (_position.pieces(0) & bit)
+            c = (_position.kings(0) & bit) ? 'R' : 'r';
+        else if (_position.pieces(1) & bit)
+            c = (_position.kings(1) & bit) ? 'Y' : 'y';
+        state.push_back(c);
+    }
+    state.push_back(_position.sideToMove() == 0 ? 'r' : 'y');
+    return state;
+}
+
+void Checkers::setStateString(const std::string &s)
+{
+    if (s.size() != CheckersPosition::kSquares + 1)
+        return;
+
+    uint32_t pieces[2] = { 0, 0 };
+    uint32_t kings = 0;
+    for (int sq = 0; sq < CheckersPosition::kSquares; ++sq)
+    {
+        const char c = s[sq];
+        const uint32_t bit = 1u << sq;
+        if (c == 'r' || c == 'R')
+            pieces[0] |= bit;
+        else if (c == 'y' || c == 'Y')
+            pieces[1] |= bit;
+        if (c == 'R' || c == 'Y')
+            kings |= bit;
+    }
+
+    stopGame();
+    _position = CheckersPosition(pieces[0], pieces[1], kings, s[CheckersPosition::kSquares] == 'y' ? 1 : 0);
+    _keyHistory.assign(1, _position.key());
+    _jumpFrom = -1;
+    syncBoard();
+
+    // the current player has to be the side to move
+    if ((_gameOptions.currentTurnNo & 1) != static_cast<unsigned int>(_position.sideToMove()))
+        _gameOptions.currentTurnNo++;
+}
+
+//
+// called every frame while it's the AI's turn: the first call starts the
+// search on the worker thread, later calls play the move once it's ready
+//
+void Checkers::updateAI()
+{
+    if (checkForWinner() || checkForDraw())
+        return;
+
+    if (!_ai.busy())
+    {
+        const CheckersPosition position = _position;
+        const std::vector<uint64_t> keys = _keyHistory;
+        CheckersSearch *search = _search.get();
+        _ai.start([search, position, keys](const std::atomic<bool> &stop) {
+            return search->search(position, kThinkTime, 64, &stop, keys).move;
+        }, kThinkTime);
+        return;
+    }
+
+    int move;
+    if (!_ai.poll(move) || move < 0)
+        return;
+    CheckersMoveList list;
+    _position.generate(list);
+    if (move < list.size)
+        playMove(list.moves[move]);
+}
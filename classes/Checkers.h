@@ -0,0 +1,80 @@
+#pragma once
+#include "Game.h"
+#include "Square.h"
+#include "AIWorker.h"
+#include "CheckersPosition.h"
+#include "CheckersSearch.h"
+
+#include <memory>
+#include <vector>
+
+//
+// checkers (english draughts), red against yellow on the dark squares
+//
+// pieces are dragged from square to square, a multi-jump straight to the
+// square it ends on; the jumped pieces come off and men are crowned by
+// bringing the sprites in line with CheckersPosition after each move. kings
+// are drawn darker since there's no sprite for them.
+//
+// a multi-jump can also be dragged one jump at a time, which is the only way
+// to pick between two routes that end on the same square: the piece waits on
+// each landing square, with the jumped pieces still on the board, until the
+// move can only end one way.
+//
+// the state string is 33 characters: the 32 dark squares left-to-right,
+// top-to-bottom ('0' empty, 'r' / 'y' for red and yellow men, 'R' / 'Y' for
+// kings), then whose move it is ('r' or 'y').
+//
+// the AI plays yellow with CheckersSearch on an AIWorker thread, thinking
+// for a fixed time per move.
+//
+class Checkers : public Game
+{
+public:
+    Checkers();
+    ~Checkers();
+
+    // set up the board
+    void        setUpBoard() override;
+
+    Player*     checkForWinner() override;
+    bool        checkForDraw() override;
+    std::string initialStateString() override;
+    std::string stateString() const override;
+    void        setStateString(const std::string &s) override;
+    bool        canBitMoveFrom(Bit*bit, BitHolder *src) override;
+    bool        canBitMoveFromTo(Bit* bit, BitHolder*src, BitHolder*dst) override;
+    void        bitMovedFromTo(Bit *bit, BitHolder *src, BitHolder *dst) override;
+    void        stopGame() override;
+
+    void        updateAI() override;
+    bool        gameHasAI() override { return true; }
+    BitHolder &getHolderAt(const int x, const int y) override { return _grid[y][x]; }
+
+private:
+    // the bit's game tag is the player plus 2 for a king
+    Bit *       PieceForPlayer(int playerNumber, bool king);
+    Square &    squareAt(int square) { return _grid[CheckersPosition::rowOf(square)][CheckersPosition::colOf(square)]; }
+    // make the sprites on the board match _position
+    void        syncBoard();
+    // play a legal move for the side to move and hand the turn over
+    void        playMove(const CheckersMove &move);
+    // the move a drop from "square" onto "to" finishes, taking the jump under
+    // way into account: 1 with the move, 0 if there's none, -1 if routes
+    // jumping different pieces end there
+    int         completedMove(int square, int to, CheckersMove &move) const;
+
+    // row 0 at the top, the light squares hold nothing and have a game tag of -1
+    Square              _grid[8][8];
+    CheckersPosition    _position;
+    // the key of every position in the game so far, for repetitions
+    std::vector<uint64_t>           _keyHistory;
+    AIWorker                        _ai;
+    std::unique_ptr<CheckersSearch> _search;
+    // a human multi-jump taken a jump at a time: the square it started on
+    // (-1 when there's none under way), where the piece stands now and the
+    // pieces it has jumped
+    int                             _jumpFrom;
+    int                             _jumpAt;
+    uint32_t                        _jumped;
+};
@@ -0,0 +1,229 @@
+#include "CheckersPosition.h"
+
+//
+// the dark squares by row parity and by where they sit in their row
+//
+static const uint32_t kEvenRows = 0x0F0F0F0Fu;
+static const uint32_t kOddRows = 0xF0F0F0F0u;
+static const uint32_t kFirstInRow = 0x11111111u;
+static const uint32_t kLastInRow = 0x88888888u;
+
+static constexpr std::array<std::array<int8_t, CheckersPosition::kDirections>, CheckersPosition::kSquares> buildNeighbours()
+{
+    constexpr int kRowStep[4] = { -1, -1, 1, 1 };
+    constexpr int kColStep[4] = { -1, 1, -1, 1 };
+    std::array<std::array<int8_t, CheckersPosition::kDirections>, CheckersPosition::kSquares> table{};
+    for (int square = 0; square < CheckersPosition::kSquares; ++square)
+    {
+        const int row = square / 4;
+        const int col = (square % 4) * 2 + (row & 1 ? 0 : 1);
+        for (int d = 0; d < 4; ++d)
+        {
+            const int r = row + kRowStep[d];
+            const int c = col + kColStep[d];
+            table[square][d] = static_cast<int8_t>(r < 0 || r > 7 || c < 0 || c > 7 ? -1 : r * 4 + c / 2);
+        }
+    }
+    return table;
+}
+
+const std::array<std::array<int8_t, CheckersPosition::kDirections>, CheckersPosition::kSquares> CheckersPosition::kNeighbours = buildNeighbours();
+
+//
+// zobrist keys by player, man or king, and square, from a fixed splitmix64 stream
+//
+struct CheckersZobrist
+{
+    uint64_t    pieces[2][2][CheckersPosition::kSquares];
+    uint64_t    side;
+};
+
+static constexpr CheckersZobrist buildZobrist()
+{
+    CheckersZobrist keys{};
+    uint64_t state = 0x3C6EF372FE94F82Bull;
+    auto next = [&state]() {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    };
+    for (int player = 0; player < 2; ++player)
+        for (int kind = 0; kind < 2; ++kind)
+            for (int square = 0; square < CheckersPosition::kSquares; ++square)
+                keys.pieces[player][kind][square] = next();
+    keys.side = next();
+    return keys;
+}
+
+static constexpr CheckersZobrist kZobrist = buildZobrist();
+
+CheckersPosition::CheckersPosition() : CheckersPosition(0xFFF00000u, 0x00000FFFu, 0, 0)
+{
+}
+
+CheckersPosition::CheckersPosition(uint32_t first, uint32_t second, uint32_t kings, int sideToMove) :
+    _pieces{ first, second & ~first }, _kings(kings & (first | second)), _side(sideToMove & 1), _quiet(0), _key(0)
+{
+    computeKey();
+}
+
+void CheckersPosition::computeKey()
+{
+    _key = _side ? kZobrist.side : 0;
+    for (int player = 0; player < 2; ++player)
+    {
+        for (uint32_t b = _pieces[player]; b; b &= b - 1)
+        {
+            const int square = std::countr_zero(b);
+            _key ^= kZobrist.pieces[player][(_kings >> square) & 1][square];
+        }
+    }
+}
+
+uint32_t CheckersPosition::step(uint32_t squares, int direction)
+{
+    switch (direction)
+    {
+        case 0:
+            return ((squares & kEvenRows) >> 4) | ((squares & kOddRows & ~kFirstInRow) >> 5);
+        case 1:
+            return ((squares & kEvenRows & ~kLastInRow) >> 3) | ((squares & kOddRows) >> 4);
+        case 2:
+            return ((squares & kEvenRows) << 4) | ((squares & kOddRows & ~kFirstInRow) << 3);
+        default:
+            return ((squares & kEvenRows & ~kLastInRow) << 5) | ((squares & kOddRows) << 4);
+    }
+}
+
+bool CheckersPosition::hasCaptures() const
+{
+    const uint32_t opponent = _pieces[_side ^ 1];
+    const uint32_t open = empty();
+    const int manFirst = firstManDirection();
+    for (int d = 0; d < kDirections; ++d)
+    {
+        const uint32_t movers = (d == manFirst || d == manFirst + 1) ? _pieces[_side] : kings(_side);
+        if (step(step(movers, d) & opponent, d) & open)
+            return true;
+    }
+    return false;
+}
+
+void CheckersPosition::generate(CheckersMoveList &list) const
+{
+    list.size = 0;
+    if (hasCaptures())
+    {
+        for (uint32_t b = _pieces[_side]; b; b &= b - 1)
+        {
+            const int square = std::countr_zero(b);
+            addCaptures(list, square, square, 0, (_kings >> square) & 1);
+        }
+        return;
+    }
+
+    // simple moves a direction at a time, the square moved from is one step back
+    const uint32_t open = empty();
+    const int manFirst = firstManDirection();
+    for (int d = 0; d < kDirections; ++d)
+    {
+        const uint32_t movers = (d == manFirst || d == manFirst + 1) ? _pieces[_side] : kings(_side);
+        for (uint32_t targets = step(movers, d) & open; targets; targets &= targets - 1)
+        {
+            const int to = std::countr_zero(targets);
+            list.add(kNeighbours[to][3 - d], to, 0);
+        }
+    }
+}
+
+//
+// follow every jump the piece that started on "from" can make from "square";
+// a sequence is added once it can't go any further. jumped pieces stay on the
+// board until the move is over, so they can't be jumped twice or landed on.
+//
+void CheckersPosition::addCaptures(CheckersMoveList &list, int from, int square, uint32_t captured, bool king) const
+{
+    const uint32_t opponent = _pieces[_side ^ 1];
+    const uint32_t blocked = occupied() & ~(1u << from);
+    const int first = king ? 0 : firstManDirection();
+    const int last = king ? kDirections : first + 2;
+    bool extended = false;
+    for (int d = first; d < last; ++d)
+    {
+        const int over = kNeighbours[square][d];
+        if (over < 0 || !(opponent & ~captured & (1u << over)))
+            continue;
+        const int landing = kNeighbours[over][d];
+        if (landing < 0 || (blocked & (1u << landing)))
+            continue;
+
+        extended = true;
+        if (!king && (crowningRow(_side) & (1u << landing)))
+        {
+            // crowned, which ends the move
+            if (list.size < CheckersMoveList::kCapacity)
+                list.add(from, landing, captured | (1u << over));
+        }
+        else
+            addCaptures(list, from, landing, captured | (1u << over), king);
+    }
+    if (!extended && captured && list.size < CheckersMoveList::kCapacity)
+        list.add(from, square, captured);
+}
+
+void CheckersPosition::makeMove(const CheckersMove &move)
+{
+    const int other = _side ^ 1;
+    const uint32_t fromBit = 1u << move.from;
+    const uint32_t toBit = 1u << move.to;
+    const bool king = _kings & fromBit;
+    const bool crowned = !king && (toBit & crowningRow(_side));
+
+    _key ^= kZobrist.pieces[_side][king][move.from] ^ kZobrist.pieces[_side][king || crowned][move.to];
+    _pieces[_side] ^= fromBit | toBit;
+    if (king)
+        _kings ^= fromBit | toBit;
+    else if (crowned)
+        _kings |= toBit;
+
+    for (uint32_t b = move.captures; b; b &= b - 1)
+    {
+        const int square = std::countr_zero(b);
+        _key ^= kZobrist.pieces[other][(_kings >> square) & 1][square];
+    }
+    _pieces[other] &= ~move.captures;
+    _kings &= ~move.captures;
+
+    _quiet = (move.captures || !king) ? 0 : _quiet + 1;
+    _side = other;
+    _key ^= kZobrist.side;
+}
+
+int CheckersPosition::jumpOver(int from, int square, uint32_t captured, int to) const
+{
+    const bool king = (_kings >> from) & 1;
+    // a man crowned on the way has finished its move
+    if (!king && captured && (crowningRow(_side) & (1u << square)))
+        return -1;
+    const uint32_t opponent = _pieces[_side ^ 1] & ~captured;
+    const uint32_t blocked = occupied() & ~(1u << from);
+    const int first = king ? 0 : firstManDirection();
+    const int last = king ? kDirections : first + 2;
+    for (int d = first; d < last; ++d)
+    {
+        const int over = kNeighbours[square][d];
+        if (over >= 0 && (opponent & (1u << over)) && kNeighbours[over][d] == to && !(blocked & (1u << to)))
+            return over;
+    }
+    return -1;
+}
+
+void CheckersPosition::finishCaptures(CheckersMoveList &list, int from, int square, uint32_t captured) const
+{
+    const bool king = (_kings >> from) & 1;
+    if (!king && captured && (crowningRow(_side) & (1u << square)))
+        list.add(from, square, captured);
+    else
+        addCaptures(list, from, square, captured, king);
+}
@@ -0,0 +1,105 @@
+#pragma once
+#include <array>
+#include <bit>
+#include <cstdint>
+
+//
+// headless checkers (english draughts) position
+//
+// the 32 dark squares are one bit each, numbered 0..31 left-to-right,
+// top-to-bottom, four to a row. on even rows the dark squares are columns
+// 1, 3, 5, 7 and on odd rows 0, 2, 4, 6. every player has a uint32_t of
+// pieces and one more holds which of all of them are kings.
+//
+// player 0 starts on the bottom three rows and moves first, player 1 on the
+// top three. men move and capture diagonally forward, kings both ways, one
+// square at a time. capturing is mandatory and a capture goes on for as long
+// as the same piece can keep jumping; a man that reaches the far row is
+// crowned and that ends the move. the side with no move left loses.
+//
+// stepping a whole bitboard one square in a direction is two shifts with
+// masks for the row parity and the edge squares, which is how simple moves
+// and "can anything capture" are found without looking at pieces one at a
+// time. capture sequences are followed square by square with a neighbour
+// table.
+//
+struct CheckersMove
+{
+    uint32_t    captures;       // the squares of the pieces jumped, 0 for a simple move
+    uint8_t     from;
+    uint8_t     to;
+};
+
+struct CheckersMoveList
+{
+    // more than any real position has, multi-jumps by kings included
+    static const int kCapacity = 128;
+
+    CheckersMove    moves[kCapacity];
+    int             size = 0;
+
+    void                add(int from, int to, uint32_t captures) { moves[size++] = { captures, static_cast<uint8_t>(from), static_cast<uint8_t>(to) }; }
+    const CheckersMove *begin() const { return moves; }
+    const CheckersMove *end() const { return moves + size; }
+};
+
+class CheckersPosition
+{
+public:
+    static const int kSquares = 32;
+    // up-left, up-right, down-left, down-right
+    static const int kDirections = 4;
+
+    // the starting position
+    CheckersPosition();
+    // any position: the pieces of each player, which of them are kings, the side to move
+    CheckersPosition(uint32_t first, uint32_t second, uint32_t kings, int sideToMove);
+
+    int         sideToMove() const { return _side; }
+    uint32_t    pieces(int player) const { return _pieces[player]; }
+    uint32_t    men(int player) const { return _pieces[player] & ~_kings; }
+    uint32_t    kings(int player) const { return _pieces[player] & _kings; }
+    uint32_t    occupied() const { return _pieces[0] | _pieces[1]; }
+    uint32_t    empty() const { return ~occupied(); }
+    // plies since the last capture or man move
+    int         quietPlies() const { return _quiet; }
+    uint64_t    key() const { return _key; }
+
+    // every legal move, only the captures if there are any
+    void        generate(CheckersMoveList &list) const;
+    bool        hasCaptures() const;
+    void        makeMove(const CheckersMove &move);
+    // a multi-jump a jump at a time, for picking between routes that end on
+    // the same square: the piece that started on "from" stands on "square"
+    // with the pieces in "captured" jumped so far (from and 0 before the
+    // first jump). jumpOver() is the piece it jumps landing on "to", -1 if
+    // that's not a jump it can make; finishCaptures() adds every way the
+    // move can end from there, just stopping if it can't jump again
+    int         jumpOver(int from, int square, uint32_t captured, int to) const;
+    void        finishCaptures(CheckersMoveList &list, int from, int square, uint32_t captured) const;
+
+    // the bitboard moved one square in a direction, squares that fall off the board are dropped
+    static uint32_t step(uint32_t squares, int direction);
+    // the square one step away, -1 off the board
+    static int  neighbour(int square, int direction) { return kNeighbours[square][direction]; }
+    // the dark square at a row and column, -1 for a light one
+    static int  squareAt(int row, int col) { return ((row + col) & 1) ? row * 4 + col / 2 : -1; }
+    static int  rowOf(int square) { return square / 4; }
+    static int  colOf(int square) { return (square % 4) * 2 + ((square / 4) & 1 ? 0 : 1); }
+    // the row a player's men are crowned on
+    static uint32_t crowningRow(int player) { return player == 0 ? 0x0000000Fu : 0xF0000000u; }
+
+private:
+    static const std::array<std::array<int8_t, kDirections>, kSquares> kNeighbours;
+
+    // directions the side to move's men go in
+    int         firstManDirection() const { return _side == 0 ? 0 : 2; }
+    void        addCaptures(CheckersMoveList &list, int from, int square, uint32_t captured, bool king) const;
+    void        computeKey();
+
+    uint32_t    _pieces[2];
+    uint32_t    _kings;
+    int         _side;
+    int         _quiet;
+    uint64_t    _key;
+};
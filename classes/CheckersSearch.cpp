@@ -0,0 +1,233 @@
+#include "CheckersSearch.h"
+
+#include <algorithm>
+#include <cstring>
+
+static const int kManValue = 100;
+static const int kKingValue = 140;
+
+CheckersSearch::CheckersSearch(size_t tableEntries) : _nodes(0), _stop(nullptr), _aborted(false), _hasDeadline(false),
+    _rootBest(-1)
+{
+    // a power of two so the key's low bits pick the slot
+    size_t size = 1;
+    while (size * 2 <= tableEntries)
+        size *= 2;
+    _table.resize(size);
+    _mask = size - 1;
+    clear();
+}
+
+void CheckersSearch::clear()
+{
+    std::fill(_table.begin(), _table.end(), Entry{ 0, 0, 0, 0, 0 });
+    std::memset(_history, 0, sizeof(_history));
+}
+
+//
+// men gain a little for every row they've come forward and more for staying
+// on the back row, which keeps the other side from crowning; kings are worth
+// more in the middle of the board. the side ahead in material likes the
+// board emptier, so trading down wins endgames instead of drifting.
+//
+int CheckersSearch::evaluate(const CheckersPosition &position)
+{
+    static const uint32_t kCentre = 0x00666600u;
+    static const uint32_t kBackRow[2] = { 0xF0000000u, 0x0000000Fu };
+
+    int material[2];
+    int score[2];
+    for (int player = 0; player < 2; ++player)
+    {
+        const uint32_t men = position.men(player);
+        const uint32_t kings = position.kings(player);
+        material[player] = std::popcount(men) * kManValue + std::popcount(kings) * kKingValue;
+        score[player] = material[player] + std::popcount(men & kBackRow[player]) * 8 + std::popcount(kings & kCentre) * 6;
+        for (uint32_t b = men & ~kBackRow[player]; b; b &= b - 1)
+        {
+            const int row = CheckersPosition::rowOf(std::countr_zero(b));
+            score[player] += (player == 0 ? 7 - row : row) * 3;
+        }
+    }
+
+    const int side = position.sideToMove();
+    int value = score[side] - score[side ^ 1];
+    const int pieces = std::popcount(position.occupied());
+    if (material[0] != material[1])
+        value += (material[side] > material[side ^ 1] ? 1 : -1) * (24 - pieces) * 4;
+    return value;
+}
+
+bool CheckersSearch::isRepetition(const CheckersPosition &position) const
+{
+    // only king moves since, so only that far back with the same side to move
+    const int last = static_cast<int>(_keys.size()) - 1;
+    const int limit = std::min(position.quietPlies(), last);
+    for (int i = 4; i <= limit; i += 2)
+    {
+        if (_keys[last - i] == position.key())
+            return true;
+    }
+    return false;
+}
+
+void CheckersSearch::checkTime()
+{
+    if ((_stop && _stop->load(std::memory_order_relaxed)) ||
+        (_hasDeadline && std::chrono::steady_clock::now() >= _deadline))
+        _aborted = true;
+}
+
+CheckersSearchResult CheckersSearch::search(const CheckersPosition &position, std::chrono::milliseconds budget, int maxDepth,
+                                            const std::atomic<bool> *stop, const std::vector<uint64_t> &keyHistory)
+{
+    const auto start = std::chrono::steady_clock::now();
+    CheckersSearchResult result;
+    _nodes = 0;
+    _stop = stop;
+    _aborted = false;
+    _hasDeadline = budget.count() > 0;
+    _deadline = start + budget;
+    _keys = keyHistory;
+    if (_keys.empty() || _keys.back() != position.key())
+        _keys.push_back(position.key());
+    // older searches count for less in the move ordering
+    for (auto &row : _history)
+        for (int &h : row)
+            h /= 2;
+
+    CheckersMoveList list;
+    position.generate(list);
+    if (list.size == 0)
+    {
+        result.score = -kWin;
+        return result;
+    }
+    result.move = 0;
+    if (list.size == 1)
+        return result;
+
+    for (int depth = 1; depth <= maxDepth; ++depth)
+    {
+        _rootBest = -1;
+        const int score = negamax(position, depth, -kInfinite, kInfinite, 0);
+        if (_aborted)
+            break;
+        result.move = _rootBest;
+        result.score = score;
+        result.depth = depth;
+        // a won or lost game won't change with more depth
+        if (std::abs(score) >= kWin - kMaxPly)
+            break;
+        // the next iteration would most likely not finish
+        if (_hasDeadline && std::chrono::steady_clock::now() - start > budget / 2)
+            break;
+    }
+    result.nodes = _nodes;
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+int CheckersSearch::negamax(const CheckersPosition &position, int depth, int alpha, int beta, int ply)
+{
+    if ((++_nodes & 1023) == 0)
+        checkTime();
+    if (_aborted)
+        return 0;
+
+    if (ply > 0 && (position.quietPlies() >= kDrawPlies || isRepetition(position)))
+        return 0;
+
+    CheckersMoveList list;
+    position.generate(list);
+    if (list.size == 0)
+        return -(kWin - ply);
+
+    const bool capturing = list.moves[0].captures != 0;
+    if ((depth <= 0 && !capturing) || ply >= kMaxPly - 1)
+        return evaluate(position);
+
+    // win scores are stored relative to this node so they mean the same from any ply
+    Entry &entry = _table[position.key() & _mask];
+    int ttMove = -1;
+    if (entry.key == position.key())
+    {
+        if (entry.move < list.size)
+            ttMove = entry.move;
+        int stored = entry.score;
+        if (stored >= kWin - kMaxPly)
+            stored -= ply;
+        else if (stored <= -kWin + kMaxPly)
+            stored += ply;
+        if (ply > 0 && entry.depth >= depth &&
+            (entry.bound == kExact || (entry.bound == kLower && stored >= beta) || (entry.bound == kUpper && stored <= alpha)))
+            return stored;
+    }
+
+    // the table move, then the biggest captures, then by history
+    int scores[CheckersMoveList::kCapacity];
+    for (int i = 0; i < list.size; ++i)
+    {
+        const CheckersMove &m = list.moves[i];
+        scores[i] = i == ttMove ? 1 << 30 : std::popcount(m.captures) * (1 << 24) + _history[m.from][m.to];
+    }
+
+    // forced replies and captures past the horizon don't use up depth
+    const int nextDepth = (list.size == 1 || depth <= 0) ? depth : depth - 1;
+    const int originalAlpha = alpha;
+    int bestScore = -kInfinite;
+    int bestMove = 0;
+    _keys.push_back(position.key());
+    for (int n = 0; n < list.size; ++n)
+    {
+        // the best move not tried yet, the list stays in generate() order for the table and the caller
+        int pick = 0;
+        for (int i = 1; i < list.size; ++i)
+        {
+            if (scores[i] > scores[pick])
+                pick = i;
+        }
+        scores[pick] = -1;
+        const CheckersMove &move = list.moves[pick];
+
+        CheckersPosition next = position;
+        next.makeMove(move);
+        const int score = -negamax(next, nextDepth, -beta, -alpha, ply + 1);
+        if (_aborted)
+            break;
+
+        if (score > bestScore)
+        {
+            bestScore = score;
+            bestMove = pick;
+        }
+        if (score > alpha)
+        {
+            alpha = score;
+            if (alpha >= beta)
+            {
+                if (!move.captures)
+                    _history[move.from][move.to] += depth * depth;
+                break;
+            }
+        }
+    }
+    _keys.pop_back();
+    if (_aborted)
+        return 0;
+
+    if (ply == 0)
+        _rootBest = bestMove;
+
+    int stored = bestScore;
+    if (stored >= kWin - kMaxPly)
+        stored += ply;
+    else if (stored <= -kWin + kMaxPly)
+        stored -= ply;
+    entry.key = position.key();
+    entry.score = static_cast<int16_t>(stored);
+    entry.depth = static_cast<int8_t>(std::max(depth, 0));
+    entry.bound = static_cast<uint8_t>(bestScore <= originalAlpha ? kUpper : bestScore >= beta ? kLower : kExact);
+    entry.move = static_cast<uint8_t>(bestMove);
+    return bestScore;
+}
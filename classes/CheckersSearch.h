@@ -0,0 +1,85 @@
+#pragma once
+#include "CheckersPosition.h"
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+struct CheckersSearchResult
+{
+    int         move = -1;          // index in CheckersPosition::generate()'s list, -1 with no moves
+    int         score = 0;          // for the side to move, see CheckersSearch::kWin
+    int         depth = 0;          // last iteration that finished
+    uint64_t    nodes = 0;
+    double      seconds = 0;
+};
+
+//
+// iterative deepening alpha-beta search for checkers
+//
+// captures are forced, so they're searched past the nominal depth until the
+// position is quiet and the evaluation is never taken in the middle of an
+// exchange; a position with only one legal move doesn't use up depth either.
+// a transposition table keyed on the zobrist key keeps the best move and
+// bound of every position searched, across moves as well as iterations, and
+// the rest of the moves are ordered by how much they capture and then a
+// history table.
+//
+// scores are for the side to move, men are worth 100. a win in n plies is
+// kWin - n, a loss -(kWin - n). 80 plies with only king moves and no
+// captures, or a repeated position, is a draw.
+//
+class CheckersSearch
+{
+public:
+    static const int kInfinite = 32000;
+    static const int kWin = 30000;
+    static const int kMaxPly = 128;
+    static const int kDrawPlies = 80;
+
+    explicit CheckersSearch(size_t tableEntries = 1 << 20);
+
+    // search until the depth limit, the time budget (0 for none) or the stop
+    // flag; keyHistory is the keys of the game so far for spotting repetitions
+    CheckersSearchResult search(const CheckersPosition &position, std::chrono::milliseconds budget, int maxDepth = 64,
+                                const std::atomic<bool> *stop = nullptr,
+                                const std::vector<uint64_t> &keyHistory = std::vector<uint64_t>());
+
+    // forget everything learned, for a new game
+    void        clear();
+
+    // material and placement for the side to move
+    static int  evaluate(const CheckersPosition &position);
+
+private:
+    enum Bound
+    {
+        kUpper = 1,
+        kLower = 2,
+        kExact = 3
+    };
+
+    struct Entry
+    {
+        uint64_t    key;
+        int16_t     score;
+        int8_t      depth;
+        uint8_t     bound;
+        uint8_t     move;
+    };
+
+    int         negamax(const CheckersPosition &position, int depth, int alpha, int beta, int ply);
+    bool        isRepetition(const CheckersPosition &position) const;
+    void        checkTime();
+
+    std::vector<Entry>                      _table;
+    uint64_t                                _mask;
+    std::vector<uint64_t>                   _keys;      // game history then the current search path
+    int                                     _history[CheckersPosition::kSquares][CheckersPosition::kSquares];
+    uint64_t                                _nodes;
+    const std::atomic<bool>                *_stop;
+    bool                                    _aborted;
+    bool                                    _hasDeadline;
+    std::chrono::steady_clock::time_point   _deadline;
+    int                                     _rootBest;
+};
@@ -0,0 +1,309 @@
+#include "Chess.h"
+
+#include <algorithm>
+
+static const char kPieceLetters[] = "PNBRQKpnbrqk";
+
+// how long the AI thinks about each move
+static const std::chrono::milliseconds kThinkTime(1500);
+
+Chess::Chess()
+{
+}
+
+Chess::~Chess()
+{
+    _ai.cancel();
+}
+
+//
+// make a piece sprite, the bit's game tag is the ChessPiece it shows
+//
+Bit* Chess::PieceForPlayer(ChessPiece piece)
+{
+    // the white knight sprite really is spelled w_kinight.png
+    static const char *kSprites[12] = {
+        "w_pawn.png", "w_kinight.png", "w_bishop.png", "w_rook.png", "w_queen.png", "w_king.png",
+        "b_pawn.png", "b_knight.png", "b_bishop.png", "b_rook.png", "b_queen.png", "b_king.png",
+    };
+    Bit *bit = new Bit();
+    bit->LoadTextureFromFile(kSprites[piece]);
+    bit->setOwner(getPlayerAt(pieceColor(piece)));
+    bit->setGameTag(piece);
+    return bit;
+}
+
+//
+// setup the game board, this is called once at the start of the game
+//
+void Chess::setUpBoard()
+{
+    setNumberOfPlayers(2);
+    setAIPlayer(1);
+
+    _gameOptions.rowX = 8;
+    _gameOptions.rowY = 8;
+
+    // the sprites are 100x100, the holder's game tag is its square number
+    const float cellSize = 100.0f;
+    for (int row = 0; row < 8; ++row)
+    {
+        for (int col = 0; col < 8; ++col)
+        {
+            ImVec2 pos(col * cellSize, row * cellSize);
+            _grid[row][col].initHolder(pos, "square.png", col, row);
+            _grid[row][col].setGameTag((7 - row) * 8 + col);
+        }
+    }
+
+    _position.setFen(ChessPosition::kStartFen);
+    _keyHistory.assign(1, _position.key());
+    syncBoard();
+
+    // the table is big, only allocate it once
+    if (!_search)
+        _search = std::make_unique<ChessSearch>();
+    else
+        _search->clear();
+
+    startGame();
+}
+
+void Chess::syncBoard()
+{
+    for (int sq = 0; sq < 64; ++sq)
+    {
+        Square &square = squareAt(sq);
+        const ChessPiece piece = _position.pieceAt(sq);
+        Bit *b = square.bit();
+        if (b && piece != kNoPiece && b->gameTag() == piece)
+            continue;
+        if (b)
+            square.destroyBit();
+        if (piece == kNoPiece)
+            continue;
+        Bit *placeBit = PieceForPlayer(piece);
+        placeBit->setPosition(square.getPosition());
+        square.setBit(placeBit);
+    }
+}
+
+//
+// only the side to move may pick up a piece, and only one that has somewhere to go
+//
+bool Chess::canBitMoveFrom(Bit *bit, BitHolder *src)
+{
+    if (!bit || pieceColor(static_cast<ChessPiece>(bit->gameTag())) != _position.sideToMove())
+        return false;
+    if (getCurrentPlayer()->playerNumber() != _position.sideToMove())
+        return false;
+
+    ChessMoveList list;
+    _position.generateLegal(list);
+    for (ChessMove m : list)
+    {
+        if (moveFrom(m) == src->gameTag())
+            return true;
+    }
+    return false;
+}
+
+bool Chess::canBitMoveFromTo(Bit* bit, BitHolder*src, BitHolder*dst)
+{
+    return _position.findMove(src->gameTag(), dst->gameTag()) != kNoMove;
+}
+
+void Chess::bitMovedFromTo(Bit *bit, BitHolder *src, BitHolder *dst)
+{
+    const ChessMove move = _position.findMove(src->gameTag(), dst->gameTag());
+    if (move == kNoMove)
+    {
+        // put the sprites back the way the position has them
+        syncBoard();
+        return;
+    }
+    playMove(move);
+}
+
+void Chess::playMove(ChessMove move)
+{
+    // the archive keeps the move's place in the legal list, which fits a byte
+    ChessMoveList legal;
+    _position.generateLegal(legal);
+    _lastMoveCode = static_cast<int>(std::find(legal.begin(), legal.end(), move) - legal.begin());
+
+    ChessPosition::Undo undo;
+    _position.makeMove(move, undo);
+    _keyHistory.push_back(_position.key());
+    _lastMove = ChessPosition::moveToString(move);
+    syncBoard();
+    endTurn();
+}
+
+//
+// free all the memory used by the game on the heap
+//
+void Chess::stopGame()
+{
+    _ai.cancel();
+    for (int row = 0; row < 8; ++row)
+    {
+        for (int col = 0; col < 8; ++col)
+        {
+            _grid[row][col].destroyBit();
+        }
+    }
+}
+
+Player* Chess::checkForWinner()
+{
+    // checkmate: in check with no way out, the side that just moved wins
+    ChessMoveList list;
+    _position.generateLegal(list);
+    if (list.size == 0 && _position.inCheck())
+        return getPlayerAt(_position.sideToMove() ^ 1);
+    return nullptr;
+}
+
+bool Chess::checkForDraw()
+{
+    ChessMoveList list;
+    _position.generateLegal(list);
+    if (list.size == 0)
+        return !_position.inCheck();        // stalemate
+    if (_position.halfmoveClock() >= 100)
+        return true;                        // fifty moves without a capture or pawn move
+
+    // the same position three times with the same side to move
+    int repeats = 1;
+    const int last = static_cast<int>(_keyHistory.size()) - 1;
+    for (int i = 4; i <= std::min(_position.halfmoveClock(), last); i += 2)
+    {
+        if (_keyHistory[last - i] == _position.key() && ++repeats == 3)
+            return true;
+    }
+
+    // nothing left that can mate: bare kings, or a single knight or bishop
+    const Bitboard heavy = _position.pieces(kWhite, kPawn) | _position.pieces(kBlack, kPawn) |
+                           _position.pieces(kWhite, kRook) | _position.pieces(kBlack, kRook) |
+                           _position.pieces(kWhite, kQueen) | _position.pieces(kBlack, kQueen);
+    const Bitboard minors = _position.pieces(kWhite, kKnight) | _position.pieces(kBlack, kKnight) |
+                            _position.pieces(kWhite, kBishop) | _position.pieces(kBlack, kBishop);
+    return !heavy && ChessBitboard::count(minors) <= 1;
+}
+
+//
+// state strings
+//
+std::string Chess::initialStateString()
+{
+    return "rnbqkbnrpppppppp00000000000000000000000000000000PPPPPPPPRNBQKBNRwKQkq-";
+}
+
+std::string Chess::stateString() const
+{
+    std::string state;
+    state.reserve(70);
+    for (int rank = 7; rank >= 0; --rank)
+    {
+        for (int file = 0; file < 8; ++file)
+        {
+            const ChessPiece piece = _position.pieceAt(rank * 8 + file);
+            state.push_back(piece == kNoPiece ? '0' : kPieceLetters[piece]);
+        }
+    }
+    const int castling = _position.castlingRights();
+    state.push_back(_position.sideToMove() == kWhite ? 'w' : 'b');
+    state.push_back(castling & ChessCastling::kWhiteKingSide ? 'K' : '-');
+    state.push_back(castling & ChessCastling::kWhiteQueenSide ? 'Q' : '-');
+    state.push_back(castling & ChessCastling::kBlackKingSide ? 'k' : '-');
+    state.push_back(castling & ChessCastling::kBlackQueenSide ? 'q' : '-');
+    state.push_back(_position.epSquare() >= 0 ? static_cast<char>('a' + ChessBitboard::fileOf(_position.epSquare())) : '-');
+    return state;
+}
+
+void Chess::setStateString(const std::string &s)
+{
+    if (s.size() != 70)
+        return;
+
+    // rebuild a fen from the squares and let ChessPosition check it
+    std::string fen;
+    for (int row = 0; row < 8; ++row)
+    {
+        int empty = 0;
+        for (int col = 0; col < 8; ++col)
+        {
+            const char c = s[row * 8 + col];
+            if (c == '0')
+            {
+                ++empty;
+                continue;
+            }
+            if (empty)
+                fen.push_back(static_cast<char>('0' + empty));
+            empty = 0;
+            fen.push_back(c);
+        }
+        if (empty)
+            fen.push_back(static_cast<char>('0' + empty));
+        if (row < 7)
+            fen.push_back('/');
+    }
+    const bool whiteToMove = s[64] == 'w';
+    fen += whiteToMove ? " w " : " b ";
+    std::string castling;
+    for (int i = 65; i < 69; ++i)
+    {
+        if (s[i] != '-')
+            castling.push_back(s[i]);
+    }
+    fen += castling.empty() ? "-" : castling;
+    fen += ' ';
+    if (s[69] >= 'a' && s[69] <= 'h')
+    {
+        fen.push_back(s[69]);
+        fen.push_back(whiteToMove ? '6' : '3');
+    }
+    else
+        fen.push_back('-');
+
+    if (!_position.setFen(fen))
+        return;
+
+    stopGame();
+    _keyHistory.assign(1, _position.key());
+    syncBoard();
+
+    // the current player has to be the side to move
+    if ((_gameOptions.currentTurnNo & 1) != static_cast<unsigned int>(_position.sideToMove()))
+        _gameOptions.currentTurnNo++;
+}
+
+//
+// called every frame while it's the AI's turn: the first call starts the
+// search on the worker thread, later calls play the move once it's ready
+//
+void Chess::updateAI()
+{
+    if (checkForWinner() || checkForDraw())
+        return;
+
+    if (!_ai.busy())
+    {
+        const ChessPosition position = _position;
+        const std::vector<uint64_t> keys = _keyHistory;
+        ChessSearch *search = _search.get();
+        _ai.start([search, position, keys](const std::atomic<bool> &stop) {
+            ChessSearchLimits limits;
+            limits.time = kThinkTime;
+            limits.stop = &stop;
+            return static_cast<int>(search->search(position, limits, keys).bestMove);
+        }, kThinkTime);
+        return;
+    }
+
+    int move;
+    if (_ai.poll(move) && move != kNoMove)
+        playMove(static_cast<ChessMove>(move));
+}
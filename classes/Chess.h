@@ -0,0 +1,68 @@
+#pragma once
+#include "Game.h"
+#include "Square.h"
+#include "AIWorker.h"
+#include "ChessPosition.h"
+#include "ChessSearch.h"
+
+#include <memory>
+#include <vector>
+
+//
+// chess, two players on one board
+//
+// pieces are dragged from square to square; the rules all live in
+// ChessPosition and the sprites are brought in line with it after each move,
+// which takes care of captures, castling, en passant and promotion (always
+// to a queen from the board).
+//
+// the state string is 70 characters: the 64 squares from a8 across and down
+// to h1 ('0' empty, otherwise the FEN letter), the side to move ('w' / 'b'),
+// the castling rights as "KQkq" with '-' for the ones that are gone, and the
+// en passant file ('a'..'h') or '-'.
+//
+// the AI plays black with ChessSearch on an AIWorker thread, thinking for a
+// fixed time per move. the search keeps its transposition table from one
+// move to the next.
+//
+class Chess : public Game
+{
+public:
+    Chess();
+    ~Chess();
+
+    // set up the board
+    void        setUpBoard() override;
+
+    Player*     checkForWinner() override;
+    bool        checkForDraw() override;
+    std::string initialStateString() override;
+    std::string stateString() const override;
+    void        setStateString(const std::string &s) override;
+    bool        canBitMoveFrom(Bit*bit, BitHolder *src) override;
+    bool        canBitMoveFromTo(Bit* bit, BitHolder*src, BitHolder*dst) override;
+    void        bitMovedFromTo(Bit *bit, BitHolder *src, BitHolder *dst) override;
+    void        stopGame() override;
+
+    void        updateAI() override;
+    bool        gameHasAI() override { return true; }
+    BitHolder &getHolderAt(const int x, const int y) override { return _grid[y][x]; }
+
+    const ChessPosition &position() const { return _position; }
+
+private:
+    Bit *       PieceForPlayer(ChessPiece piece);
+    // the holder for a square, row 0 of the grid is the 8th rank
+    Square &    squareAt(int sq) { return _grid[7 - ChessBitboard::rankOf(sq)][ChessBitboard::fileOf(sq)]; }
+    // make the sprites on the board match _position
+    void        syncBoard();
+    // play a legal move for the side to move and hand the turn over
+    void        playMove(ChessMove move);
+
+    Square          _grid[8][8];
+    ChessPosition   _position;
+    // the key of every position in the game so far, for repetitions
+    std::vector<uint64_t>           _keyHistory;
+    AIWorker                        _ai;
+    std::unique_ptr<ChessSearch>    _search;
+};
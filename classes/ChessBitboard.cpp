@@ -0,0 +1,186 @@
+#include "ChessBitboard.h"
+
+#include <cstdlib>
+#include <mutex>
+#include <vector>
+
+namespace ChessAttacks
+{
+    Bitboard gPawn[2][64];
+    Bitboard gKnight[64];
+    Bitboard gKing[64];
+    Bitboard gBetween[64][64];
+    Bitboard gLine[64][64];
+    Magic    gBishopMagics[64];
+    Magic    gRookMagics[64];
+
+    // 102400 rook and 5248 bishop entries with the masks used here
+    static Bitboard sRookTable[0x19000];
+    static Bitboard sBishopTable[0x1480];
+
+    static const int kRookDirections[4][2] = { { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 } };
+    static const int kBishopDirections[4][2] = { { 1, 1 }, { 1, -1 }, { -1, 1 }, { -1, -1 } };
+
+    //
+    // the slow way: walk each ray until it leaves the board or hits a piece
+    //
+    static Bitboard slidingAttacks(int sq, Bitboard occupied, const int directions[4][2])
+    {
+        Bitboard attacks = 0;
+        for (int d = 0; d < 4; ++d)
+        {
+            int file = ChessBitboard::fileOf(sq) + directions[d][0];
+            int rank = ChessBitboard::rankOf(sq) + directions[d][1];
+            while (file >= 0 && file < 8 && rank >= 0 && rank < 8)
+            {
+                const Bitboard b = ChessBitboard::squareBit(rank * 8 + file);
+                attacks |= b;
+                if (occupied & b)
+                    break;
+                file += directions[d][0];
+                rank += directions[d][1];
+            }
+        }
+        return attacks;
+    }
+
+    static Bitboard stepAttacks(int sq, const int steps[][2], int count)
+    {
+        Bitboard attacks = 0;
+        for (int i = 0; i < count; ++i)
+        {
+            const int file = ChessBitboard::fileOf(sq) + steps[i][0];
+            const int rank = ChessBitboard::rankOf(sq) + steps[i][1];
+            if (file >= 0 && file < 8 && rank >= 0 && rank < 8)
+                attacks |= ChessBitboard::squareBit(rank * 8 + file);
+        }
+        return attacks;
+    }
+
+#if !defined(__BMI2__)
+    // xorshift64*, seeded the same every run so the magics are reproducible
+    static uint64_t nextRandom(uint64_t &state)
+    {
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        return state * 2685821657736338717ull;
+    }
+#endif
+
+    //
+    // find a magic for every square and fill its slice of the table.
+    // candidates with few bits set work best; a candidate is rejected as
+    // soon as two blocker sets with different attacks land on the same index.
+    //
+    static void initMagics(Magic magics[64], Bitboard *table, const int directions[4][2])
+    {
+        std::vector<Bitboard> occupancy(4096);
+        std::vector<Bitboard> reference(4096);
+#if !defined(__BMI2__)
+        // the magic search's state, kept across squares
+        std::vector<int> epoch(4096, 0);
+        int attempt = 0;
+        uint64_t seed = 0x9E3779B97F4A7C15ull;
+#endif
+
+        Bitboard *next = table;
+        for (int sq = 0; sq < 64; ++sq)
+        {
+            // the outermost square of each ray doesn't block anything behind it
+            const Bitboard edges = ((ChessBitboard::kRank1 | ChessBitboard::kRank8) & ~(ChessBitboard::kRank1 << (8 * ChessBitboard::rankOf(sq)))) |
+                                   ((ChessBitboard::kFileA | ChessBitboard::kFileH) & ~(ChessBitboard::kFileA << ChessBitboard::fileOf(sq)));
+
+            Magic &m = magics[sq];
+            m.mask = slidingAttacks(sq, 0, directions) & ~edges;
+            m.shift = 64 - ChessBitboard::count(m.mask);
+            m.attacks = next;
+
+            // every subset of the mask, by the carry-rippler trick
+            int size = 0;
+            Bitboard b = 0;
+            do
+            {
+                occupancy[size] = b;
+                reference[size] = slidingAttacks(sq, b, directions);
+                ++size;
+                b = (b - m.mask) & m.mask;
+            } while (b);
+            next += size;
+
+#if defined(__BMI2__)
+            m.magic = 0;
+            for (int i = 0; i < size; ++i)
+                m.attacks[m.index(occupancy[i])] = reference[i];
+#else
+            for (int i = 0; i < size;)
+            {
+                do
+                {
+                    m.magic = nextRandom(seed) & nextRandom(seed) & nextRandom(seed);
+                } while (ChessBitboard::count((m.magic * m.mask) >> 56) < 6);
+
+                ++attempt;
+                for (i = 0; i < size; ++i)
+                {
+                    const unsigned index = m.index(occupancy[i]);
+                    if (epoch[index] < attempt)
+                    {
+                        epoch[index] = attempt;
+                        m.attacks[index] = reference[i];
+                    }
+                    else if (m.attacks[index] != reference[i])
+                        break;
+                }
+            }
+#endif
+        }
+    }
+
+    static void initTables()
+    {
+        static const int kKnightSteps[8][2] = { { 1, 2 }, { 2, 1 }, { 2, -1 }, { 1, -2 }, { -1, -2 }, { -2, -1 }, { -2, 1 }, { -1, 2 } };
+        static const int kKingSteps[8][2] = { { 1, 0 }, { 1, 1 }, { 0, 1 }, { -1, 1 }, { -1, 0 }, { -1, -1 }, { 0, -1 }, { 1, -1 } };
+        static const int kWhitePawnSteps[2][2] = { { -1, 1 }, { 1, 1 } };
+        static const int kBlackPawnSteps[2][2] = { { -1, -1 }, { 1, -1 } };
+
+        for (int sq = 0; sq < 64; ++sq)
+        {
+            gKnight[sq] = stepAttacks(sq, kKnightSteps, 8);
+            gKing[sq] = stepAttacks(sq, kKingSteps, 8);
+            gPawn[0][sq] = stepAttacks(sq, kWhitePawnSteps, 2);
+            gPawn[1][sq] = stepAttacks(sq, kBlackPawnSteps, 2);
+        }
+
+        initMagics(gBishopMagics, sBishopTable, kBishopDirections);
+        initMagics(gRookMagics, sRookTable, kRookDirections);
+
+        for (int a = 0; a < 64; ++a)
+        {
+            for (int b = 0; b < 64; ++b)
+            {
+                gBetween[a][b] = 0;
+                gLine[a][b] = 0;
+                if (a == b)
+                    continue;
+                const Bitboard bb = ChessBitboard::squareBit(b);
+                if (rook(a, 0) & bb)
+                {
+                    gBetween[a][b] = rook(a, bb) & rook(b, ChessBitboard::squareBit(a));
+                    gLine[a][b] = (rook(a, 0) & rook(b, 0)) | ChessBitboard::squareBit(a) | bb;
+                }
+                else if (bishop(a, 0) & bb)
+                {
+                    gBetween[a][b] = bishop(a, bb) & bishop(b, ChessBitboard::squareBit(a));
+                    gLine[a][b] = (bishop(a, 0) & bishop(b, 0)) | ChessBitboard::squareBit(a) | bb;
+                }
+            }
+        }
+    }
+
+    void init()
+    {
+        static std::once_flag once;
+        std::call_once(once, initTables);
+    }
+}
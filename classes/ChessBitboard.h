@@ -0,0 +1,83 @@
+#pragma once
+#include <bit>
+#include <cstdint>
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+//
+// bitboards and attack tables for chess
+//
+// squares are numbered a1 = 0, b1 = 1 ... h8 = 63, so bit n of a bitboard is
+// square n. sliding attacks come from magic bitboard tables (or BMI2 PEXT
+// indexing where the compiler targets it): the relevant blockers of a square
+// are mapped to a dense index into a table of precomputed attack sets.
+//
+typedef uint64_t Bitboard;
+
+namespace ChessBitboard
+{
+    const Bitboard kFileA = 0x0101010101010101ull;
+    const Bitboard kFileH = kFileA << 7;
+    const Bitboard kRank1 = 0xFFull;
+    const Bitboard kRank2 = kRank1 << 8;
+    const Bitboard kRank4 = kRank1 << 24;
+    const Bitboard kRank5 = kRank1 << 32;
+    const Bitboard kRank7 = kRank1 << 48;
+    const Bitboard kRank8 = kRank1 << 56;
+
+    inline Bitboard squareBit(int sq) { return Bitboard(1) << sq; }
+    inline int      lsb(Bitboard b) { return std::countr_zero(b); }
+    inline int      popLsb(Bitboard &b)
+    {
+        const int sq = std::countr_zero(b);
+        b &= b - 1;
+        return sq;
+    }
+    inline int      count(Bitboard b) { return std::popcount(b); }
+    inline bool     moreThanOne(Bitboard b) { return (b & (b - 1)) != 0; }
+
+    inline int      fileOf(int sq) { return sq & 7; }
+    inline int      rankOf(int sq) { return sq >> 3; }
+}
+
+namespace ChessAttacks
+{
+    // builds every table, safe to call more than once and from any thread
+    void        init();
+
+    // tables filled in by init()
+    extern Bitboard gPawn[2][64];          // [color][square], squares a pawn there attacks
+    extern Bitboard gKnight[64];
+    extern Bitboard gKing[64];
+    extern Bitboard gBetween[64][64];      // squares strictly between two aligned squares
+    extern Bitboard gLine[64][64];         // the whole line through two aligned squares
+
+    struct Magic
+    {
+        Bitboard    mask;       // relevant blockers, board edges excluded
+        Bitboard    magic;
+        Bitboard   *attacks;    // this square's slice of the shared table
+        int         shift;
+
+        unsigned index(Bitboard occupied) const
+        {
+#if defined(__BMI2__)
+            return static_cast<unsigned>(_pext_u64(occupied, mask));
+#else
+            return static_cast<unsigned>(((occupied & mask) * magic) >> shift);
+#endif
+        }
+    };
+    extern Magic gBishopMagics[64];
+    extern Magic gRookMagics[64];
+
+    inline Bitboard pawn(int color, int sq) { return gPawn[color][sq]; }
+    inline Bitboard knight(int sq) { return gKnight[sq]; }
+    inline Bitboard king(int sq) { return gKing[sq]; }
+    inline Bitboard bishop(int sq, Bitboard occupied) { const Magic &m = gBishopMagics[sq]; return m.attacks[m.index(occupied)]; }
+    inline Bitboard rook(int sq, Bitboard occupied) { const Magic &m = gRookMagics[sq]; return m.attacks[m.index(occupied)]; }
+    inline Bitboard queen(int sq, Bitboard occupied) { return bishop(sq, occupied) | rook(sq, occupied); }
+    inline Bitboard between(int a, int b) { return gBetween[a][b]; }
+    inline Bitboard line(int a, int b) { return gLine[a][b]; }
+}
@@ -0,0 +1,137 @@
+#include "ChessEvaluation.h"
+
+using namespace ChessBitboard;
+
+namespace ChessEvaluation
+{
+    const int kPieceValue[kPieceTypeCount] = { 100, 320, 330, 500, 900, 0 };
+
+    //
+    // the tables read like a board from white's side, a8 first and h1 last
+    //
+    static const int kPawnTable[64] = {
+         0,  0,  0,  0,  0,  0,  0,  0,
+        50, 50, 50, 50, 50, 50, 50, 50,
+        10, 10, 20, 30, 30, 20, 10, 10,
+         5,  5, 10, 25, 25, 10,  5,  5,
+         0,  0,  0, 20, 20,  0,  0,  0,
+         5, -5,-10,  0,  0,-10, -5,  5,
+         5, 10, 10,-20,-20, 10, 10,  5,
+         0,  0,  0,  0,  0,  0,  0,  0,
+    };
+
+    static const int kKnightTable[64] = {
+       -50,-40,-30,-30,-30,-30,-40,-50,
+       -40,-20,  0,  0,  0,  0,-20,-40,
+       -30,  0, 10, 15, 15, 10,  0,-30,
+       -30,  5, 15, 20, 20, 15,  5,-30,
+       -30,  0, 15, 20, 20, 15,  0,-30,
+       -30,  5, 10, 15, 15, 10,  5,-30,
+       -40,-20,  0,  5,  5,  0,-20,-40,
+       -50,-40,-30,-30,-30,-30,-40,-50,
+    };
+
+    static const int kBishopTable[64] = {
+       -20,-10,-10,-10,-10,-10,-10,-20,
+       -10,  0,  0,  0,  0,  0,  0,-10,
+       -10,  0,  5, 10, 10,  5,  0,-10,
+       -10,  5,  5, 10, 10,  5,  5,-10,
+       -10,  0, 10, 10, 10, 10,  0,-10,
+       -10, 10, 10, 10, 10, 10, 10,-10,
+       -10,  5,  0,  0,  0,  0,  5,-10,
+       -20,-10,-10,-10,-10,-10,-10,-20,
+    };
+
+    static const int kRookTable[64] = {
+         0,  0,  0,  0,  0,  0,  0,  0,
+         5, 10, 10, 10, 10, 10, 10,  5,
+        -5,  0,  0,  0,  0,  0,  0, -5,
+        -5,  0,  0,  0,  0,  0,  0, -5,
+        -5,  0,  0,  0,  0,  0,  0, -5,
+        -5,  0,  0,  0,  0,  0,  0, -5,
+        -5,  0,  0,  0,  0,  0,  0, -5,
+         0,  0,  0,  5,  5,  0,  0,  0,
+    };
+
+    static const int kQueenTable[64] = {
+       -20,-10,-10, -5, -5,-10,-10,-20,
+       -10,  0,  0,  0,  0,  0,  0,-10,
+       -10,  0,  5,  5,  5,  5,  0,-10,
+        -5,  0,  5,  5,  5,  5,  0, -5,
+         0,  0,  5,  5,  5,  5,  0, -5,
+       -10,  5,  5,  5,  5,  5,  0,-10,
+       -10,  0,  5,  0,  0,  0,  0,-10,
+       -20,-10,-10, -5, -5,-10,-10,-20,
+    };
+
+    static const int kKingMiddleTable[64] = {
+       -30,-40,-40,-50,-50,-40,-40,-30,
+       -30,-40,-40,-50,-50,-40,-40,-30,
+       -30,-40,-40,-50,-50,-40,-40,-30,
+       -30,-40,-40,-50,-50,-40,-40,-30,
+       -20,-30,-30,-40,-40,-30,-30,-20,
+       -10,-20,-20,-20,-20,-20,-20,-10,
+        20, 20,  0,  0,  0,  0, 20, 20,
+        20, 30, 10,  0,  0, 10, 30, 20,
+    };
+
+    static const int kKingEndTable[64] = {
+       -50,-40,-30,-20,-20,-30,-40,-50,
+       -30,-20,-10,  0,  0,-10,-20,-30,
+       -30,-10, 20, 30, 30, 20,-10,-30,
+       -30,-10, 30, 40, 40, 30,-10,-30,
+       -30,-10, 30, 40, 40, 30,-10,-30,
+       -30,-10, 20, 30, 30, 20,-10,-30,
+       -30,-30,  0,  0,  0,  0,-30,-30,
+       -50,-30,-30,-30,-30,-30,-30,-50,
+    };
+
+    static const int * const kTables[kPieceTypeCount] = {
+        kPawnTable, kKnightTable, kBishopTable, kRookTable, kQueenTable, kKingMiddleTable,
+    };
+
+    // how much each piece counts towards the middlegame, 24 with everything on the board
+    static const int kPhaseWeight[kPieceTypeCount] = { 0, 1, 1, 2, 4, 0 };
+    static const int kMaxPhase = 24;
+    static const int kBishopPair = 30;
+
+    // the table index for a square, black reads the tables upside down
+    static inline int tableIndex(int color, int sq)
+    {
+        return color == kWhite ? (7 - rankOf(sq)) * 8 + fileOf(sq) : rankOf(sq) * 8 + fileOf(sq);
+    }
+
+    int evaluate(const ChessPosition &position)
+    {
+        int score = 0;          // everything but the king, white's point of view
+        int kingMiddle = 0;
+        int kingEnd = 0;
+        int phase = 0;
+        for (int color = kWhite; color <= kBlack; ++color)
+        {
+            const int sign = color == kWhite ? 1 : -1;
+            for (int type = kPawn; type < kKing; ++type)
+            {
+                Bitboard bb = position.pieces(color, type);
+                phase += kPhaseWeight[type] * count(bb);
+                while (bb)
+                {
+                    const int sq = popLsb(bb);
+                    score += sign * (kPieceValue[type] + kTables[type][tableIndex(color, sq)]);
+                }
+            }
+            if (moreThanOne(position.pieces(color, kBishop)))
+                score += sign * kBishopPair;
+
+            const int king = tableIndex(color, position.kingSquare(color));
+            kingMiddle += sign * kKingMiddleTable[king];
+            kingEnd += sign * kKingEndTable[king];
+        }
+
+        if (phase > kMaxPhase)
+            phase = kMaxPhase;
+        score += (kingMiddle * phase + kingEnd * (kMaxPhase - phase)) / kMaxPhase;
+        return position.sideToMove() == kWhite ? score : -score;
+    }
+}
+
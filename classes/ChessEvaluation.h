@@ -0,0 +1,18 @@
+#pragma once
+#include "ChessPosition.h"
+
+//
+// static evaluation for the chess search
+//
+// material plus piece-square tables (Tomasz Michniewski's "simplified
+// evaluation function"), with the king table blended from a middlegame one
+// that keeps it sheltered to an endgame one that brings it to the center as
+// the pieces come off. scores are centipawns for the side to move.
+//
+namespace ChessEvaluation
+{
+    // pawn, knight, bishop, rook, queen, king
+    extern const int kPieceValue[kPieceTypeCount];
+
+    int         evaluate(const ChessPosition &position);
+}
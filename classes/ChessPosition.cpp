@@ -0,0 +1,606 @@
+#include "ChessPosition.h"
+
+#include <cstring>
+#include <mutex>
+#include <sstream>
+
+using namespace ChessBitboard;
+
+const char *ChessPosition::kStartFen = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+//
+// zobrist keys, fixed so keys are the same from run to run
+//
+namespace ChessZobrist
+{
+    static uint64_t sPiece[12][64];
+    static uint64_t sCastling[16];
+    static uint64_t sEpFile[8];
+    static uint64_t sSide;
+
+    static void initKeys()
+    {
+        uint64_t state = 0x2545F4914F6CDD1Dull;
+        auto next = [&state]() {
+            state ^= state >> 12;
+            state ^= state << 25;
+            state ^= state >> 27;
+            return state * 2685821657736338717ull;
+        };
+        for (auto &piece : sPiece)
+            for (uint64_t &key : piece)
+                key = next();
+        for (uint64_t &key : sCastling)
+            key = next();
+        for (uint64_t &key : sEpFile)
+            key = next();
+        sSide = next();
+    }
+
+    static void init()
+    {
+        static std::once_flag once;
+        std::call_once(once, initKeys);
+    }
+}
+
+//
+// castling rights that survive a move touching each square
+//
+static const uint8_t kCastlingKeep[64] = {
+    13, 15, 15, 15, 12, 15, 15, 14,
+    15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15,
+     7, 15, 15, 15,  3, 15, 15, 11,
+};
+
+static const char kPieceChars[] = "PNBRQKpnbrqk";
+
+ChessPosition::ChessPosition()
+{
+    ChessAttacks::init();
+    ChessZobrist::init();
+    clear();
+    setFen(kStartFen);
+}
+
+void ChessPosition::clear()
+{
+    std::memset(_byType, 0, sizeof(_byType));
+    std::memset(_byColor, 0, sizeof(_byColor));
+    _occupied = 0;
+    for (ChessPiece &p : _board)
+        p = kNoPiece;
+    _side = kWhite;
+    _castling = 0;
+    _epSquare = -1;
+    _halfmoveClock = 0;
+    _fullmove = 1;
+    _key = 0;
+}
+
+void ChessPosition::putPiece(ChessPiece p, int sq)
+{
+    const Bitboard b = squareBit(sq);
+    _byType[pieceType(p)] |= b;
+    _byColor[pieceColor(p)] |= b;
+    _occupied |= b;
+    _board[sq] = p;
+    _key ^= ChessZobrist::sPiece[p][sq];
+}
+
+void ChessPosition::removePiece(int sq)
+{
+    const ChessPiece p = _board[sq];
+    const Bitboard b = squareBit(sq);
+    _byType[pieceType(p)] ^= b;
+    _byColor[pieceColor(p)] ^= b;
+    _occupied ^= b;
+    _board[sq] = kNoPiece;
+    _key ^= ChessZobrist::sPiece[p][sq];
+}
+
+void ChessPosition::movePiece(int from, int to)
+{
+    const ChessPiece p = _board[from];
+    const Bitboard b = squareBit(from) | squareBit(to);
+    _byType[pieceType(p)] ^= b;
+    _byColor[pieceColor(p)] ^= b;
+    _occupied ^= b;
+    _board[from] = kNoPiece;
+    _board[to] = p;
+    _key ^= ChessZobrist::sPiece[p][from] ^ ChessZobrist::sPiece[p][to];
+}
+
+uint64_t ChessPosition::computeKey() const
+{
+    uint64_t key = 0;
+    for (int sq = 0; sq < 64; ++sq)
+    {
+        if (_board[sq] != kNoPiece)
+            key ^= ChessZobrist::sPiece[_board[sq]][sq];
+    }
+    key ^= ChessZobrist::sCastling[_castling];
+    if (_epSquare >= 0)
+        key ^= ChessZobrist::sEpFile[fileOf(_epSquare)];
+    if (_side == kBlack)
+        key ^= ChessZobrist::sSide;
+    return key;
+}
+
+//
+// fen
+//
+bool ChessPosition::setFen(const std::string &fen)
+{
+    std::istringstream in(fen);
+    std::string placement, side, castling, ep;
+    int halfmove = 0;
+    int fullmove = 1;
+    if (!(in >> placement >> side))
+        return false;
+    // the rest is optional, missing fields read as empty strings / no numbers
+    in >> castling >> ep;
+    if (!(in >> halfmove >> fullmove))
+    {
+        halfmove = 0;
+        fullmove = 1;
+    }
+
+    ChessPosition p(*this);
+    p.clear();
+    int rank = 7;
+    int file = 0;
+    for (char c : placement)
+    {
+        if (c == '/')
+        {
+            if (file != 8 || rank == 0)
+                return false;
+            --rank;
+            file = 0;
+        }
+        else if (c >= '1' && c <= '8')
+            file += c - '0';
+        else
+        {
+            const char *found = std::strchr(kPieceChars, c);
+            if (!found || !c || file > 7)
+                return false;
+            p.putPiece(static_cast<ChessPiece>(found - kPieceChars), rank * 8 + file);
+            ++file;
+        }
+        if (file > 8)
+            return false;
+    }
+    if (rank != 0 || file != 8)
+        return false;
+    if (count(p.pieces(kWhite, kKing)) != 1 || count(p.pieces(kBlack, kKing)) != 1)
+        return false;
+
+    if (side == "w")
+        p._side = kWhite;
+    else if (side == "b")
+        p._side = kBlack;
+    else
+        return false;
+
+    // castling rights only count if king and rook are still at home
+    if (castling != "-" && !castling.empty())
+    {
+        for (char c : castling)
+        {
+            switch (c)
+            {
+                case 'K': if (p._board[4] == makePiece(kWhite, kKing) && p._board[7] == makePiece(kWhite, kRook)) p._castling |= ChessCastling::kWhiteKingSide; break;
+                case 'Q': if (p._board[4] == makePiece(kWhite, kKing) && p._board[0] == makePiece(kWhite, kRook)) p._castling |= ChessCastling::kWhiteQueenSide; break;
+                case 'k': if (p._board[60] == makePiece(kBlack, kKing) && p._board[63] == makePiece(kBlack, kRook)) p._castling |= ChessCastling::kBlackKingSide; break;
+                case 'q': if (p._board[60] == makePiece(kBlack, kKing) && p._board[56] == makePiece(kBlack, kRook)) p._castling |= ChessCastling::kBlackQueenSide; break;
+                default: return false;
+            }
+        }
+    }
+
+    // keep the en passant square only when a pawn can actually take there,
+    // the same rule makeMove uses, so equal positions get equal keys
+    if (ep != "-" && !ep.empty())
+    {
+        if (ep.size() != 2 || ep[0] < 'a' || ep[0] > 'h' || (ep[1] != '3' && ep[1] != '6'))
+            return false;
+        const int sq = (ep[1] - '1') * 8 + (ep[0] - 'a');
+        if (ChessAttacks::pawn(p._side ^ 1, sq) & p.pieces(p._side, kPawn))
+            p._epSquare = sq;
+    }
+    p._halfmoveClock = halfmove;
+    p._fullmove = fullmove > 0 ? fullmove : 1;
+
+    // the side that just moved can't be in check
+    if (p.attackersTo(p.kingSquare(p._side ^ 1), p._occupied) & p._byColor[p._side])
+        return false;
+
+    p._key = p.computeKey();
+    *this = p;
+    return true;
+}
+
+std::string ChessPosition::fen() const
+{
+    std::string s;
+    for (int rank = 7; rank >= 0; --rank)
+    {
+        int empty = 0;
+        for (int file = 0; file < 8; ++file)
+        {
+            const ChessPiece p = _board[rank * 8 + file];
+            if (p == kNoPiece)
+            {
+                ++empty;
+                continue;
+            }
+            if (empty)
+                s += char('0' + empty);
+            empty = 0;
+            s += kPieceChars[p];
+        }
+        if (empty)
+            s += char('0' + empty);
+        if (rank)
+            s += '/';
+    }
+    s += _side == kWhite ? " w " : " b ";
+    if (!_castling)
+        s += '-';
+    if (_castling & ChessCastling::kWhiteKingSide) s += 'K';
+    if (_castling & ChessCastling::kWhiteQueenSide) s += 'Q';
+    if (_castling & ChessCastling::kBlackKingSide) s += 'k';
+    if (_castling & ChessCastling::kBlackQueenSide) s += 'q';
+    s += ' ';
+    s += _epSquare >= 0 ? squareName(_epSquare) : "-";
+    s += ' ' + std::to_string(_halfmoveClock) + ' ' + std::to_string(_fullmove);
+    return s;
+}
+
+std::string ChessPosition::squareName(int sq)
+{
+    std::string s;
+    s += char('a' + fileOf(sq));
+    s += char('1' + rankOf(sq));
+    return s;
+}
+
+std::string ChessPosition::moveToString(ChessMove m)
+{
+    if (m == kNoMove)
+        return "0000";
+    std::string s = squareName(moveFrom(m)) + squareName(moveTo(m));
+    if (isPromotion(m))
+        s += "nbrq"[promotionType(m) - kKnight];
+    return s;
+}
+
+//
+// attacks
+//
+Bitboard ChessPosition::attackersTo(int sq, Bitboard occupied) const
+{
+    return (ChessAttacks::pawn(kWhite, sq) & pieces(kBlack, kPawn)) |
+           (ChessAttacks::pawn(kBlack, sq) & pieces(kWhite, kPawn)) |
+           (ChessAttacks::knight(sq) & _byType[kKnight]) |
+           (ChessAttacks::king(sq) & _byType[kKing]) |
+           (ChessAttacks::bishop(sq, occupied) & (_byType[kBishop] | _byType[kQueen])) |
+           (ChessAttacks::rook(sq, occupied) & (_byType[kRook] | _byType[kQueen]));
+}
+
+Bitboard ChessPosition::pinnedPieces() const
+{
+    const int us = _side;
+    const int them = us ^ 1;
+    const int ksq = kingSquare(us);
+    Bitboard snipers = ((ChessAttacks::rook(ksq, 0) & (_byType[kRook] | _byType[kQueen])) |
+                        (ChessAttacks::bishop(ksq, 0) & (_byType[kBishop] | _byType[kQueen]))) & _byColor[them];
+    Bitboard pinned = 0;
+    while (snipers)
+    {
+        const Bitboard blockers = ChessAttacks::between(ksq, popLsb(snipers)) & _occupied;
+        if (blockers && !moreThanOne(blockers))
+            pinned |= blockers & _byColor[us];
+    }
+    return pinned;
+}
+
+//
+// en passant takes two pawns off one rank at once, so pins can't be judged
+// from either pawn alone; just look at the king with the capture made
+//
+bool ChessPosition::enPassantIsLegal(int from) const
+{
+    const int us = _side;
+    const int them = us ^ 1;
+    const int ksq = kingSquare(us);
+    const int captured = _epSquare + (us == kWhite ? -8 : 8);
+    const Bitboard occupied = (_occupied ^ squareBit(from) ^ squareBit(captured)) | squareBit(_epSquare);
+    const Bitboard theirs = _byColor[them];
+    return !(ChessAttacks::rook(ksq, occupied) & (_byType[kRook] | _byType[kQueen]) & theirs) &&
+           !(ChessAttacks::bishop(ksq, occupied) & (_byType[kBishop] | _byType[kQueen]) & theirs) &&
+           !(ChessAttacks::knight(ksq) & _byType[kKnight] & theirs) &&
+           !(ChessAttacks::pawn(us, ksq) & _byType[kPawn] & theirs & ~squareBit(captured));
+}
+
+void ChessPosition::addPawnMoves(ChessMoveList &list, int from, int to, int flags) const
+{
+    if (to >= 56 || to < 8)
+    {
+        const int promotion = (flags & ChessMoveFlags::kCapture) ? ChessMoveFlags::kPromotionCapture : ChessMoveFlags::kPromotion;
+        for (int piece = 3; piece >= 0; --piece)
+            list.add(encodeMove(from, to, promotion + piece));
+    }
+    else
+        list.add(encodeMove(from, to, flags));
+}
+
+//
+// legal moves straight away: the king steps to unattacked squares, when in
+// check everything else must capture the checker or block, and pinned
+// pieces stay on the line through their king. kCapturesOnly keeps captures
+// and promotions, the moves the quiescence search looks at.
+//
+template <bool kCapturesOnly>
+void ChessPosition::generate(ChessMoveList &list) const
+{
+    const int us = _side;
+    const int them = us ^ 1;
+    const Bitboard ours = _byColor[us];
+    const Bitboard theirs = _byColor[them];
+    const int ksq = kingSquare(us);
+    const Bitboard checkers = attackersTo(ksq, _occupied) & theirs;
+
+    // king moves, with the king itself out of the way of sliders behind it
+    const Bitboard withoutKing = _occupied ^ squareBit(ksq);
+    Bitboard targets = ChessAttacks::king(ksq) & (kCapturesOnly ? theirs : ~ours);
+    while (targets)
+    {
+        const int to = popLsb(targets);
+        if (!(attackersTo(to, withoutKing) & theirs))
+            list.add(encodeMove(ksq, to, (theirs & squareBit(to)) ? ChessMoveFlags::kCapture : ChessMoveFlags::kQuiet));
+    }
+    if (moreThanOne(checkers))
+        return;
+
+    // out of check only by taking the checker or blocking
+    const Bitboard evasions = checkers ? (ChessAttacks::between(ksq, lsb(checkers)) | checkers) : ~Bitboard(0);
+    const Bitboard allowed = evasions & (kCapturesOnly ? theirs : ~ours);
+    const Bitboard pinned = pinnedPieces();
+
+    if (!kCapturesOnly && !checkers)
+    {
+        const int base = us == kWhite ? 0 : 56;
+        const int kingSide = us == kWhite ? ChessCastling::kWhiteKingSide : ChessCastling::kBlackKingSide;
+        const int queenSide = us == kWhite ? ChessCastling::kWhiteQueenSide : ChessCastling::kBlackQueenSide;
+        if ((_castling & kingSide) && !(_occupied & (squareBit(base + 5) | squareBit(base + 6))) &&
+            !(attackersTo(base + 5, _occupied) & theirs) && !(attackersTo(base + 6, _occupied) & theirs))
+            list.add(encodeMove(base + 4, base + 6, ChessMoveFlags::kKingCastle));
+        if ((_castling & queenSide) && !(_occupied & (squareBit(base + 1) | squareBit(base + 2) | squareBit(base + 3))) &&
+            !(attackersTo(base + 3, _occupied) & theirs) && !(attackersTo(base + 2, _occupied) & theirs))
+            list.add(encodeMove(base + 4, base + 2, ChessMoveFlags::kQueenCastle));
+    }
+
+    // knights can never move off a pin line
+    Bitboard pieces = this->pieces(us, kKnight) & ~pinned;
+    while (pieces)
+    {
+        const int from = popLsb(pieces);
+        Bitboard moves = ChessAttacks::knight(from) & allowed;
+        while (moves)
+        {
+            const int to = popLsb(moves);
+            list.add(encodeMove(from, to, (theirs & squareBit(to)) ? ChessMoveFlags::kCapture : ChessMoveFlags::kQuiet));
+        }
+    }
+
+    pieces = ours & (_byType[kBishop] | _byType[kRook] | _byType[kQueen]);
+    while (pieces)
+    {
+        const int from = popLsb(pieces);
+        const int type = pieceType(_board[from]);
+        Bitboard moves = type == kBishop ? ChessAttacks::bishop(from, _occupied)
+                       : type == kRook   ? ChessAttacks::rook(from, _occupied)
+                                         : ChessAttacks::queen(from, _occupied);
+        moves &= allowed;
+        if (pinned & squareBit(from))
+            moves &= ChessAttacks::line(ksq, from);
+        while (moves)
+        {
+            const int to = popLsb(moves);
+            list.add(encodeMove(from, to, (theirs & squareBit(to)) ? ChessMoveFlags::kCapture : ChessMoveFlags::kQuiet));
+        }
+    }
+
+    const int up = us == kWhite ? 8 : -8;
+    const Bitboard startRank = us == kWhite ? kRank2 : kRank7;
+    pieces = this->pieces(us, kPawn);
+    while (pieces)
+    {
+        const int from = popLsb(pieces);
+        const Bitboard pinLine = (pinned & squareBit(from)) ? ChessAttacks::line(ksq, from) : ~Bitboard(0);
+
+        // pushes go to empty squares, in captures-only mode just the promotions
+        const int to = from + up;
+        const Bitboard pushMask = evasions & pinLine;
+        if (!(_occupied & squareBit(to)) && (!kCapturesOnly || to >= 56 || to < 8))
+        {
+            if (pushMask & squareBit(to))
+                addPawnMoves(list, from, to, ChessMoveFlags::kQuiet);
+            if (!kCapturesOnly && (startRank & squareBit(from)) && !(_occupied & squareBit(to + up)) && (pushMask & squareBit(to + up)))
+                list.add(encodeMove(from, to + up, ChessMoveFlags::kDoublePush));
+        }
+
+        Bitboard captures = ChessAttacks::pawn(us, from) & theirs & allowed & pinLine;
+        while (captures)
+            addPawnMoves(list, from, popLsb(captures), ChessMoveFlags::kCapture);
+
+        if (_epSquare >= 0 && (ChessAttacks::pawn(us, from) & squareBit(_epSquare)) && enPassantIsLegal(from))
+            list.add(encodeMove(from, _epSquare, ChessMoveFlags::kEnPassant));
+    }
+}
+
+void ChessPosition::generateLegal(ChessMoveList &list) const
+{
+    generate<false>(list);
+}
+
+void ChessPosition::generateCaptures(ChessMoveList &list) const
+{
+    generate<true>(list);
+}
+
+ChessMove ChessPosition::findMove(int from, int to) const
+{
+    ChessMoveList list;
+    generateLegal(list);
+    ChessMove found = kNoMove;
+    for (ChessMove m : list)
+    {
+        if (moveFrom(m) != from || moveTo(m) != to)
+            continue;
+        // promotions come queen first
+        if (found == kNoMove)
+            found = m;
+    }
+    return found;
+}
+
+//
+// make / unmake
+//
+void ChessPosition::makeMove(ChessMove m, Undo &undo)
+{
+    const int from = moveFrom(m);
+    const int to = moveTo(m);
+    const int flags = moveFlags(m);
+    const int us = _side;
+    const ChessPiece moving = _board[from];
+
+    undo.key = _key;
+    undo.castling = static_cast<uint8_t>(_castling);
+    undo.epSquare = static_cast<int8_t>(_epSquare);
+    undo.halfmoveClock = static_cast<uint8_t>(_halfmoveClock > 255 ? 255 : _halfmoveClock);
+    undo.captured = kNoPiece;
+
+    if (_epSquare >= 0)
+        _key ^= ChessZobrist::sEpFile[fileOf(_epSquare)];
+    _epSquare = -1;
+
+    ++_halfmoveClock;
+    if (pieceType(moving) == kPawn)
+        _halfmoveClock = 0;
+
+    if (flags == ChessMoveFlags::kEnPassant)
+    {
+        const int captured = to + (us == kWhite ? -8 : 8);
+        undo.captured = _board[captured];
+        removePiece(captured);
+    }
+    else if (flags & ChessMoveFlags::kCapture)
+    {
+        undo.captured = _board[to];
+        removePiece(to);
+        _halfmoveClock = 0;
+    }
+
+    movePiece(from, to);
+
+    if (flags & ChessMoveFlags::kPromotion)
+    {
+        removePiece(to);
+        putPiece(makePiece(us, promotionType(m)), to);
+    }
+    else if (flags == ChessMoveFlags::kKingCastle)
+        movePiece(to + 1, to - 1);
+    else if (flags == ChessMoveFlags::kQueenCastle)
+        movePiece(to - 2, to + 1);
+    else if (flags == ChessMoveFlags::kDoublePush)
+    {
+        const int ep = (from + to) / 2;
+        if (ChessAttacks::pawn(us, ep) & pieces(us ^ 1, kPawn))
+        {
+            _epSquare = ep;
+            _key ^= ChessZobrist::sEpFile[fileOf(ep)];
+        }
+    }
+
+    const int castling = _castling & kCastlingKeep[from] & kCastlingKeep[to];
+    if (castling != _castling)
+    {
+        _key ^= ChessZobrist::sCastling[_castling] ^ ChessZobrist::sCastling[castling];
+        _castling = castling;
+    }
+
+    if (us == kBlack)
+        ++_fullmove;
+    _side ^= 1;
+    _key ^= ChessZobrist::sSide;
+}
+
+//
+// pass: only the side to move changes, for null move pruning
+//
+void ChessPosition::makeNullMove(Undo &undo)
+{
+    undo.key = _key;
+    undo.castling = static_cast<uint8_t>(_castling);
+    undo.epSquare = static_cast<int8_t>(_epSquare);
+    undo.halfmoveClock = static_cast<uint8_t>(_halfmoveClock > 255 ? 255 : _halfmoveClock);
+    undo.captured = kNoPiece;
+
+    if (_epSquare >= 0)
+        _key ^= ChessZobrist::sEpFile[fileOf(_epSquare)];
+    _epSquare = -1;
+    ++_halfmoveClock;
+    _side ^= 1;
+    _key ^= ChessZobrist::sSide;
+}
+
+void ChessPosition::unmakeNullMove(const Undo &undo)
+{
+    _side ^= 1;
+    _epSquare = undo.epSquare;
+    _halfmoveClock = undo.halfmoveClock;
+    _key = undo.key;
+}
+
+void ChessPosition::unmakeMove(ChessMove m, const Undo &undo)
+{
+    const int from = moveFrom(m);
+    const int to = moveTo(m);
+    const int flags = moveFlags(m);
+    _side ^= 1;
+    const int us = _side;
+    if (us == kBlack)
+        --_fullmove;
+
+    if (flags & ChessMoveFlags::kPromotion)
+    {
+        removePiece(to);
+        putPiece(makePiece(us, kPawn), to);
+    }
+    else if (flags == ChessMoveFlags::kKingCastle)
+        movePiece(to - 1, to + 1);
+    else if (flags == ChessMoveFlags::kQueenCastle)
+        movePiece(to + 1, to - 2);
+
+    movePiece(to, from);
+
+    if (flags == ChessMoveFlags::kEnPassant)
+        putPiece(undo.captured, to + (us == kWhite ? -8 : 8));
+    else if (flags & ChessMoveFlags::kCapture)
+        putPiece(undo.captured, to);
+
+    _castling = undo.castling;
+    _epSquare = undo.epSquare;
+    _halfmoveClock = undo.halfmoveClock;
+    _key = undo.key;
+}
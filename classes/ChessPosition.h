@@ -0,0 +1,172 @@
+#pragma once
+#include "ChessBitboard.h"
+
+#include <string>
+
+//
+// a chess position on bitboards with legal move generation and make / unmake
+//
+// pieces are kept both as bitboards (per type and per color) and as a 64
+// entry mailbox so "what is on this square" is a lookup. the zobrist key is
+// updated incrementally by makeMove and put back by unmakeMove.
+//
+
+enum ChessColor
+{
+    kWhite = 0,
+    kBlack = 1
+};
+
+enum ChessPieceType
+{
+    kPawn = 0,
+    kKnight,
+    kBishop,
+    kRook,
+    kQueen,
+    kKing,
+    kPieceTypeCount
+};
+
+// a colored piece is color * 6 + type, kNoPiece for an empty square
+typedef uint8_t ChessPiece;
+const ChessPiece kNoPiece = 12;
+inline ChessPiece   makePiece(int color, int type) { return static_cast<ChessPiece>(color * kPieceTypeCount + type); }
+inline int          pieceColor(ChessPiece p) { return p / kPieceTypeCount; }
+inline int          pieceType(ChessPiece p) { return p % kPieceTypeCount; }
+
+//
+// a move packed into 16 bits: from (6), to (6), flags (4)
+//
+// the flags follow the usual scheme where bit 2 marks captures and bit 3
+// promotions, the low two bits of a promotion pick the piece (knight .. queen)
+//
+typedef uint16_t ChessMove;
+
+namespace ChessMoveFlags
+{
+    const int kQuiet = 0;
+    const int kDoublePush = 1;
+    const int kKingCastle = 2;
+    const int kQueenCastle = 3;
+    const int kCapture = 4;
+    const int kEnPassant = 5;
+    const int kPromotion = 8;           // + 0..3 for knight, bishop, rook, queen
+    const int kPromotionCapture = 12;
+}
+
+const ChessMove kNoMove = 0;
+inline ChessMove    encodeMove(int from, int to, int flags) { return static_cast<ChessMove>(from | (to << 6) | (flags << 12)); }
+inline int          moveFrom(ChessMove m) { return m & 63; }
+inline int          moveTo(ChessMove m) { return (m >> 6) & 63; }
+inline int          moveFlags(ChessMove m) { return m >> 12; }
+inline bool         isCapture(ChessMove m) { return (moveFlags(m) & ChessMoveFlags::kCapture) != 0; }
+inline bool         isPromotion(ChessMove m) { return (moveFlags(m) & ChessMoveFlags::kPromotion) != 0; }
+inline int          promotionType(ChessMove m) { return kKnight + (moveFlags(m) & 3); }
+
+//
+// moves are generated into a fixed array, no position has more than 218
+//
+struct ChessMoveList
+{
+    ChessMove   moves[256];
+    int         size = 0;
+
+    void        add(ChessMove m) { moves[size++] = m; }
+    ChessMove  *begin() { return moves; }
+    ChessMove  *end() { return moves + size; }
+    const ChessMove *begin() const { return moves; }
+    const ChessMove *end() const { return moves + size; }
+};
+
+// castling rights bits
+namespace ChessCastling
+{
+    const int kWhiteKingSide = 1;
+    const int kWhiteQueenSide = 2;
+    const int kBlackKingSide = 4;
+    const int kBlackQueenSide = 8;
+}
+
+class ChessPosition
+{
+public:
+    static const char *kStartFen;
+
+    // what makeMove changes that can't be worked out again from the move
+    struct Undo
+    {
+        uint64_t    key;
+        ChessPiece  captured;
+        uint8_t     castling;
+        int8_t      epSquare;
+        uint8_t     halfmoveClock;
+    };
+
+    ChessPosition();
+
+    // forsyth-edwards notation, setFen leaves the position alone and returns
+    // false if the string can't be parsed
+    bool        setFen(const std::string &fen);
+    std::string fen() const;
+
+    // every legal move for the side to move
+    void        generateLegal(ChessMoveList &list) const;
+    // just the legal captures and promotions
+    void        generateCaptures(ChessMoveList &list) const;
+    // the legal move from one square to another, queen promotion preferred;
+    // kNoMove if there is none
+    ChessMove   findMove(int from, int to) const;
+
+    void        makeMove(ChessMove m, Undo &undo);
+    void        unmakeMove(ChessMove m, const Undo &undo);
+    // hand the move to the other side without moving anything
+    void        makeNullMove(Undo &undo);
+    void        unmakeNullMove(const Undo &undo);
+
+    bool        inCheck() const { return attackersTo(kingSquare(_side), _occupied) & _byColor[_side ^ 1]; }
+    // pieces of either color attacking a square, given the occupancy
+    Bitboard    attackersTo(int sq, Bitboard occupied) const;
+
+    int         sideToMove() const { return _side; }
+    ChessPiece  pieceAt(int sq) const { return _board[sq]; }
+    Bitboard    pieces(int color, int type) const { return _byType[type] & _byColor[color]; }
+    Bitboard    pieces(int color) const { return _byColor[color]; }
+    Bitboard    occupied() const { return _occupied; }
+    int         kingSquare(int color) const { return ChessBitboard::lsb(pieces(color, kKing)); }
+    int         castlingRights() const { return _castling; }
+    int         epSquare() const { return _epSquare; }
+    int         halfmoveClock() const { return _halfmoveClock; }
+    int         fullmoveNumber() const { return _fullmove; }
+    uint64_t    key() const { return _key; }
+    // anything besides king and pawns, null moves are unsafe without it (zugzwang)
+    bool        hasNonPawnMaterial(int color) const { return (_byColor[color] & ~(_byType[kPawn] | _byType[kKing])) != 0; }
+
+    // long algebraic, "e2e4", "e7e8q"
+    static std::string moveToString(ChessMove m);
+    static std::string squareName(int sq);
+
+private:
+    void        clear();
+    void        putPiece(ChessPiece p, int sq);
+    void        removePiece(int sq);
+    void        movePiece(int from, int to);
+    uint64_t    computeKey() const;
+    // pieces of the side to move pinned to their own king
+    Bitboard    pinnedPieces() const;
+    bool        enPassantIsLegal(int from) const;
+    template <bool kCapturesOnly>
+    void        generate(ChessMoveList &list) const;
+    void        addPawnMoves(ChessMoveList &list, int from, int to, int flags) const;
+
+    Bitboard    _byType[kPieceTypeCount];
+    Bitboard    _byColor[2];
+    Bitboard    _occupied;
+    ChessPiece  _board[64];
+    int         _side;
+    int         _castling;
+    int         _epSquare;          // -1 if there's no en passant capture
+    int         _halfmoveClock;
+    int         _fullmove;
+    uint64_t    _key;
+};
@@ -0,0 +1,423 @@
+#include "ChessSearch.h"
+#include "ChessEvaluation.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+//
+// transposition table
+//
+ChessTranspositionTable::ChessTranspositionTable(size_t megabytes) : _mask(0), _generation(0)
+{
+    resize(megabytes);
+}
+
+void ChessTranspositionTable::resize(size_t megabytes)
+{
+    const size_t wanted = std::max<size_t>(megabytes, 1) * 1024 * 1024 / sizeof(Entry);
+    size_t count = 1;
+    while (count * 2 <= wanted)
+        count *= 2;
+    _entries.assign(count, Entry());
+    _mask = count - 1;
+    clear();
+}
+
+void ChessTranspositionTable::clear()
+{
+    std::memset(_entries.data(), 0, _entries.size() * sizeof(Entry));
+    _generation = 0;
+}
+
+bool ChessTranspositionTable::probe(uint64_t key, Entry &entry) const
+{
+    entry = _entries[key & _mask];
+    return entry.bound != kNone && entry.check == static_cast<uint32_t>(key >> 32);
+}
+
+void ChessTranspositionTable::store(uint64_t key, ChessMove move, int score, int depth, int bound)
+{
+    Entry &entry = _entries[key & _mask];
+    const uint32_t check = static_cast<uint32_t>(key >> 32);
+    const bool samePosition = entry.bound != kNone && entry.check == check;
+
+    // a deeper result for the same position from this search is worth more
+    // than a shallow bound, anything else gets replaced
+    if (samePosition && entry.generation == _generation && bound != kExact && depth + 2 < entry.depth)
+        return;
+    if (samePosition && move == kNoMove)
+        move = entry.move;
+
+    entry.check = check;
+    entry.move = move;
+    entry.score = static_cast<int16_t>(score);
+    entry.depth = static_cast<int8_t>(depth);
+    entry.bound = static_cast<uint8_t>(bound);
+    entry.generation = _generation;
+}
+
+//
+// mate scores count plies from the root, the table keeps them counted from
+// the position itself so they stay right wherever it's found again
+//
+static int scoreToTable(int score, int ply)
+{
+    if (score >= ChessSearch::kMate - ChessSearch::kMaxPly)
+        return score + ply;
+    if (score <= -ChessSearch::kMate + ChessSearch::kMaxPly)
+        return score - ply;
+    return score;
+}
+
+static int scoreFromTable(int score, int ply)
+{
+    if (score >= ChessSearch::kMate - ChessSearch::kMaxPly)
+        return score - ply;
+    if (score <= -ChessSearch::kMate + ChessSearch::kMaxPly)
+        return score + ply;
+    return score;
+}
+
+// move ordering bands, each above anything the next one can score
+static const int kTableMoveScore = 1 << 30;
+static const int kCaptureScore = 1 << 28;
+static const int kKillerScore = 1 << 27;
+static const int kHistoryLimit = 1 << 20;
+
+ChessSearch::ChessSearch(size_t tableMegabytes) : _table(tableMegabytes), _nodes(0), _stop(nullptr), _aborted(false),
+    _hasDeadline(false), _rootBest(kNoMove)
+{
+    clear();
+}
+
+void ChessSearch::clear()
+{
+    _table.clear();
+    std::memset(_killers, 0, sizeof(_killers));
+    std::memset(_history, 0, sizeof(_history));
+}
+
+ChessSearchResult ChessSearch::search(const ChessPosition &position, const ChessSearchLimits &limits,
+                                      const std::vector<uint64_t> &keyHistory)
+{
+    const auto start = std::chrono::steady_clock::now();
+    _position = position;
+    _keys = keyHistory;
+    if (_keys.empty() || _keys.back() != position.key())
+        _keys.push_back(position.key());
+    _nodes = 0;
+    _stop = limits.stop;
+    _aborted = false;
+    _hasDeadline = limits.time.count() > 0;
+    _deadline = start + limits.time;
+
+    // the killers were for other plies, the history fades rather than resets
+    _table.newSearch();
+    std::memset(_killers, 0, sizeof(_killers));
+    for (auto &side : _history)
+        for (auto &from : side)
+            for (int &value : from)
+                value /= 2;
+
+    ChessSearchResult result;
+    ChessMoveList list;
+    _position.generateLegal(list);
+    if (list.size == 0)
+        return result;
+    result.bestMove = list.moves[0];
+
+    const int maxDepth = std::clamp(limits.depth, 1, kMaxPly - 1);
+    for (int depth = 1; depth <= maxDepth; ++depth)
+    {
+        _rootBest = kNoMove;
+        const int score = negamax(depth, -kInfinite, kInfinite, 0, false);
+        // a root move that finished searching is good to play even if the iteration didn't
+        if (_rootBest != kNoMove)
+            result.bestMove = _rootBest;
+        if (_aborted)
+            break;
+        result.score = score;
+        result.depth = depth;
+
+        if (list.size == 1 && _hasDeadline)
+            break;
+        if (isMateScore(score) && kMate - std::abs(score) <= depth)
+            break;
+        if (_hasDeadline && std::chrono::steady_clock::now() - start > limits.time / 2)
+            break;
+    }
+
+    result.nodes = _nodes;
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+void ChessSearch::checkTime()
+{
+    if ((_stop && _stop->load(std::memory_order_relaxed)) ||
+        (_hasDeadline && std::chrono::steady_clock::now() >= _deadline))
+        _aborted = true;
+}
+
+bool ChessSearch::isRepetition() const
+{
+    // only positions with the same side to move, back to the last irreversible move
+    const int last = static_cast<int>(_keys.size()) - 1;
+    const int reach = std::min(_position.halfmoveClock(), last);
+    for (int i = 4; i <= reach; i += 2)
+    {
+        if (_keys[last - i] == _keys[last])
+            return true;
+    }
+    return false;
+}
+
+void ChessSearch::scoreMoves(const ChessMoveList &list, int scores[], ChessMove ttMove, int ply) const
+{
+    const int side = _position.sideToMove();
+    for (int i = 0; i < list.size; ++i)
+    {
+        const ChessMove m = list.moves[i];
+        if (m == ttMove)
+            scores[i] = kTableMoveScore;
+        else if (isPromotion(m) && promotionType(m) != kQueen)
+            scores[i] = -1;
+        else if (isCapture(m) || isPromotion(m))
+        {
+            // most valuable victim, least valuable attacker
+            int victim = 0;
+            if (moveFlags(m) == ChessMoveFlags::kEnPassant)
+                victim = ChessEvaluation::kPieceValue[kPawn];
+            else if (isCapture(m))
+                victim = ChessEvaluation::kPieceValue[pieceType(_position.pieceAt(moveTo(m)))];
+            if (isPromotion(m))
+                victim += ChessEvaluation::kPieceValue[kQueen];
+            scores[i] = kCaptureScore + victim * 8 - pieceType(_position.pieceAt(moveFrom(m)));
+        }
+        else if (m == _killers[ply][0])
+            scores[i] = kKillerScore + 1;
+        else if (m == _killers[ply][1])
+            scores[i] = kKillerScore;
+        else
+            scores[i] = _history[side][moveFrom(m)][moveTo(m)];
+    }
+}
+
+// bring the best scoring of the remaining moves up to position i
+static void pickMove(ChessMoveList &list, int scores[], int i)
+{
+    int best = i;
+    for (int j = i + 1; j < list.size; ++j)
+    {
+        if (scores[j] > scores[best])
+            best = j;
+    }
+    std::swap(list.moves[i], list.moves[best]);
+    std::swap(scores[i], scores[best]);
+}
+
+void ChessSearch::updateQuietStats(ChessMove m, int depth, int ply)
+{
+    if (_killers[ply][0] != m)
+    {
+        _killers[ply][1] = _killers[ply][0];
+        _killers[ply][0] = m;
+    }
+    int &history = _history[_position.sideToMove()][moveFrom(m)][moveTo(m)];
+    history += depth * depth;
+    if (history > kHistoryLimit)
+    {
+        for (auto &side : _history)
+            for (auto &from : side)
+                for (int &value : from)
+                    value /= 2;
+    }
+}
+
+int ChessSearch::negamax(int depth, int alpha, int beta, int ply, bool allowNull)
+{
+    if (depth <= 0)
+        return quiescence(alpha, beta, ply);
+
+    if ((++_nodes & 2047) == 0)
+        checkTime();
+    if (_aborted)
+        return 0;
+
+    const bool pvNode = beta - alpha > 1;
+    if (ply > 0)
+    {
+        if (_position.halfmoveClock() >= 100 || isRepetition())
+            return 0;
+        if (ply >= kMaxPly - 1)
+            return ChessEvaluation::evaluate(_position);
+
+        // no line from here can beat a mate that's already been found closer to the root
+        alpha = std::max(alpha, -kMate + ply);
+        beta = std::min(beta, kMate - ply - 1);
+        if (alpha >= beta)
+            return alpha;
+    }
+
+    ChessTranspositionTable::Entry entry;
+    ChessMove ttMove = kNoMove;
+    if (_table.probe(_position.key(), entry))
+    {
+        ttMove = entry.move;
+        if (!pvNode && entry.depth >= depth)
+        {
+            const int score = scoreFromTable(entry.score, ply);
+            if (entry.bound == ChessTranspositionTable::kExact ||
+                (entry.bound == ChessTranspositionTable::kLower && score >= beta) ||
+                (entry.bound == ChessTranspositionTable::kUpper && score <= alpha))
+                return score;
+        }
+    }
+
+    const bool inCheck = _position.inCheck();
+    ChessPosition::Undo undo;
+
+    //
+    // null move: if passing still leaves us above beta after a reduced search
+    // a real move will too. not in check, and not with only pawns where
+    // passing might be the best move there is (zugzwang)
+    //
+    if (allowNull && !pvNode && !inCheck && depth >= 3 && _position.hasNonPawnMaterial(_position.sideToMove()) &&
+        ChessEvaluation::evaluate(_position) >= beta)
+    {
+        const int reduction = depth >= 7 ? 3 : 2;
+        _position.makeNullMove(undo);
+        _keys.push_back(_position.key());
+        const int score = -negamax(depth - 1 - reduction, -beta, -beta + 1, ply + 1, false);
+        _keys.pop_back();
+        _position.unmakeNullMove(undo);
+        if (_aborted)
+            return 0;
+        if (score >= beta)
+            return isMateScore(score) ? beta : score;
+    }
+
+    ChessMoveList list;
+    _position.generateLegal(list);
+    if (list.size == 0)
+        return inCheck ? -kMate + ply : 0;
+
+    int scores[256];
+    scoreMoves(list, scores, ttMove, ply);
+
+    const int originalAlpha = alpha;
+    int best = -kInfinite;
+    ChessMove bestMove = kNoMove;
+    for (int i = 0; i < list.size; ++i)
+    {
+        pickMove(list, scores, i);
+        const ChessMove m = list.moves[i];
+        const bool quiet = !isCapture(m) && !isPromotion(m);
+
+        _position.makeMove(m, undo);
+        _keys.push_back(_position.key());
+        // moves that give check are searched a ply deeper
+        const int newDepth = depth - 1 + (_position.inCheck() ? 1 : 0);
+        int score;
+        if (i == 0)
+            score = -negamax(newDepth, -beta, -alpha, ply + 1, true);
+        else
+        {
+            score = -negamax(newDepth, -alpha - 1, -alpha, ply + 1, true);
+            if (score > alpha && score < beta)
+                score = -negamax(newDepth, -beta, -alpha, ply + 1, true);
+        }
+        _keys.pop_back();
+        _position.unmakeMove(m, undo);
+        if (_aborted)
+            return 0;
+
+        if (score > best)
+        {
+            best = score;
+            if (score > alpha)
+            {
+                alpha = score;
+                bestMove = m;
+                if (ply == 0)
+                    _rootBest = m;
+                if (alpha >= beta)
+                {
+                    if (quiet)
+                        updateQuietStats(m, depth, ply);
+                    break;
+                }
+            }
+        }
+    }
+
+    const int bound = best >= beta ? ChessTranspositionTable::kLower :
+                      best > originalAlpha ? ChessTranspositionTable::kExact : ChessTranspositionTable::kUpper;
+    _table.store(_position.key(), bestMove, scoreToTable(best, ply), depth, bound);
+    return best;
+}
+
+//
+// only captures (and queen promotions) until the position is quiet, the side
+// to move can always stand pat on the static evaluation instead. in check
+// there's no standing pat and every evasion is tried.
+//
+int ChessSearch::quiescence(int alpha, int beta, int ply)
+{
+    if ((++_nodes & 2047) == 0)
+        checkTime();
+    if (_aborted)
+        return 0;
+    if (ply >= kMaxPly - 1)
+        return ChessEvaluation::evaluate(_position);
+
+    const bool inCheck = _position.inCheck();
+    ChessMoveList list;
+    int best;
+    if (inCheck)
+    {
+        _position.generateLegal(list);
+        if (list.size == 0)
+            return -kMate + ply;
+        best = -kInfinite;
+    }
+    else
+    {
+        best = ChessEvaluation::evaluate(_position);
+        if (best >= beta)
+            return best;
+        alpha = std::max(alpha, best);
+        _position.generateCaptures(list);
+    }
+
+    int scores[256];
+    scoreMoves(list, scores, kNoMove, ply);
+
+    ChessPosition::Undo undo;
+    for (int i = 0; i < list.size; ++i)
+    {
+        pickMove(list, scores, i);
+        const ChessMove m = list.moves[i];
+        if (!inCheck && isPromotion(m) && promotionType(m) != kQueen)
+            continue;
+
+        _position.makeMove(m, undo);
+        const int score = -quiescence(-beta, -alpha, ply + 1);
+        _position.unmakeMove(m, undo);
+        if (_aborted)
+            return 0;
+
+        if (score > best)
+        {
+            best = score;
+            if (score > alpha)
+            {
+                alpha = score;
+                if (alpha >= beta)
+                    break;
+            }
+        }
+    }
+    return best;
+}
@@ -0,0 +1,133 @@
+#pragma once
+#include "ChessPosition.h"
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+//
+// transposition table for the chess search
+//
+// one entry per slot, indexed by the low bits of the zobrist key with the
+// high 32 bits kept to tell positions apart. the table lives as long as the
+// ChessSearch that owns it, so what one move's search learned is there for
+// the next one; entries from older searches are the first to be replaced.
+//
+class ChessTranspositionTable
+{
+public:
+    enum Bound
+    {
+        kNone = 0,
+        kUpper = 1,         // the score is at most this (failed low)
+        kLower = 2,         // the score is at least this (failed high)
+        kExact = 3
+    };
+
+    struct Entry
+    {
+        uint32_t    check;
+        ChessMove   move;
+        int16_t     score;
+        int8_t      depth;
+        uint8_t     bound;
+        uint8_t     generation;
+    };
+
+    explicit ChessTranspositionTable(size_t megabytes = 16);
+
+    // the size is rounded down to a power of two entries, the table is cleared
+    void        resize(size_t megabytes);
+    void        clear();
+    // called at the start of every search to age what's in the table
+    void        newSearch() { ++_generation; }
+
+    bool        probe(uint64_t key, Entry &entry) const;
+    void        store(uint64_t key, ChessMove move, int score, int depth, int bound);
+
+    size_t      entryCount() const { return _entries.size(); }
+
+private:
+    std::vector<Entry>  _entries;
+    uint64_t            _mask;
+    uint8_t             _generation;
+};
+
+struct ChessSearchLimits
+{
+    int                         depth = 64;
+    std::chrono::milliseconds   time{0};            // 0 for no time limit
+    const std::atomic<bool>    *stop = nullptr;     // raised from outside to end the search
+};
+
+struct ChessSearchResult
+{
+    ChessMove   bestMove = kNoMove;
+    int         score = 0;          // centipawns for the side to move, see ChessSearch::kMate
+    int         depth = 0;          // last iteration that finished
+    uint64_t    nodes = 0;
+    double      seconds = 0;
+};
+
+//
+// iterative deepening principal variation search
+//
+// each iteration is a negamax alpha-beta search where only the first move
+// at a node gets the full window and the rest are tried with a null window,
+// re-searched only if they beat it. the leaves run a quiescence search over
+// captures so the static evaluation is never taken in the middle of an
+// exchange. on top of that: transposition table cutoffs and move ordering,
+// null move pruning, a check extension, and quiet moves ordered by two killer
+// moves per ply and a history table.
+//
+// scores are centipawns for the side to move. a mate in n plies scores
+// kMate - n, being mated -(kMate - n).
+//
+// the search stops at the depth limit, when the stop flag goes up, or when
+// the time budget runs out; a new iteration isn't started after half the
+// budget since it would most likely not finish. a stopped search still
+// returns the best move found so far.
+//
+class ChessSearch
+{
+public:
+    static const int kInfinite = 32000;
+    static const int kMate = 31000;
+    static const int kMaxPly = 100;
+
+    explicit ChessSearch(size_t tableMegabytes = 16);
+
+    // keyHistory is the zobrist keys of the game so far, oldest first, for
+    // spotting repetitions; it may end with the position itself
+    ChessSearchResult search(const ChessPosition &position, const ChessSearchLimits &limits,
+                             const std::vector<uint64_t> &keyHistory = std::vector<uint64_t>());
+
+    // forget everything learned, for a new game
+    void        clear();
+
+    ChessTranspositionTable &table() { return _table; }
+
+    static bool isMateScore(int score) { return score >= kMate - kMaxPly || score <= -kMate + kMaxPly; }
+
+private:
+    int         negamax(int depth, int alpha, int beta, int ply, bool allowNull);
+    int         quiescence(int alpha, int beta, int ply);
+    // scores for picking moves in order, highest first
+    void        scoreMoves(const ChessMoveList &list, int scores[], ChessMove ttMove, int ply) const;
+    // the position repeats one since the last capture or pawn move
+    bool        isRepetition() const;
+    void        checkTime();
+    void        updateQuietStats(ChessMove m, int depth, int ply);
+
+    ChessPosition                           _position;
+    ChessTranspositionTable                 _table;
+    std::vector<uint64_t>                   _keys;      // game history then the current search path
+    ChessMove                               _killers[kMaxPly][2];
+    int                                     _history[2][64][64];
+    uint64_t                                _nodes;
+    const std::atomic<bool>                *_stop;
+    bool                                    _aborted;
+    bool                                    _hasDeadline;
+    std::chrono::steady_clock::time_point   _deadline;
+    ChessMove                               _rootBest;
+};
@@ -0,0 +1,249 @@
+#include "ConnectFour.h"
+#include "ConnectFourBook.h"
+
+#include <bit>
+
+// how long the AI may think before settling for ConnectFourSolver::quickMove
+static const std::chrono::milliseconds kThinkTime(2000);
+
+ConnectFour::ConnectFour()
+{
+}
+
+ConnectFour::~ConnectFour()
+{
+    _ai.cancel();
+}
+
+//
+// red for the first player, yellow for the second
+//
+Bit* ConnectFour::PieceForPlayer(const int playerNumber)
+{
+    Bit *bit = new Bit();
+    bit->LoadTextureFromFile(playerNumber == 0 ? "red.png" : "yellow.png");
+    bit->setOwner(getPlayerAt(playerNumber));
+    return bit;
+}
+
+//
+// setup the game board, this is called once at the start of the game
+//
+void ConnectFour::setUpBoard()
+{
+    setNumberOfPlayers(2);
+    setAIPlayer(1);
+
+    _gameOptions.rowX = kColumns;
+    _gameOptions.rowY = kRows;
+
+    // the sprites are 100x100
+    const float cellSize = 100.0f;
+    for (int row = 0; row < kRows; ++row)
+    {
+        for (int col = 0; col < kColumns; ++col)
+        {
+            ImVec2 pos(col * cellSize, row * cellSize);
+            _grid[row][col].initHolder(pos, "square.png", col, row);
+            _grid[row][col].setGameTag(col);
+        }
+    }
+
+    // the table is big, only allocate it once
+    if (!_solver)
+        _solver = std::make_unique<ConnectFourSolver>();
+
+    startGame();
+}
+
+//
+// a click anywhere in a column drops into that column
+//
+bool ConnectFour::actionForEmptyHolder(BitHolder *holder)
+{
+    if (!holder)
+        return false;
+    // nothing more to play once somebody has won
+    if (checkForWinner())
+        return false;
+    return dropInColumn(holder->gameTag());
+}
+
+bool ConnectFour::dropInColumn(int col)
+{
+    if (col < 0 || col >= kColumns)
+        return false;
+    for (int row = kRows - 1; row >= 0; --row)
+    {
+        Square &square = _grid[row][col];
+        if (square.bit())
+            continue;
+        Bit *placeBit = PieceForPlayer(getCurrentPlayer()->playerNumber());
+        placeBit->setPosition(square.getPosition());
+        square.setBit(placeBit);
+        _lastMoveCode = row * kColumns + col;
+        return true;
+    }
+    return false;
+}
+
+bool ConnectFour::canBitMoveFrom(Bit *bit, BitHolder *src)
+{
+    // pieces stay where they land
+    return false;
+}
+
+bool ConnectFour::canBitMoveFromTo(Bit* bit, BitHolder*src, BitHolder*dst)
+{
+    return false;
+}
+
+//
+// free all the memory used by the game on the heap
+//
+void ConnectFour::stopGame()
+{
+    // a search for the old board is no use any more
+    _ai.cancel();
+    for (int row = 0; row < kRows; ++row)
+    {
+        for (int col = 0; col < kColumns; ++col)
+        {
+            _grid[row][col].destroyBit();
+        }
+    }
+}
+
+void ConnectFour::playerMasks(uint64_t masks[2]) const
+{
+    masks[0] = 0;
+    masks[1] = 0;
+    for (int row = 0; row < kRows; ++row)
+    {
+        for (int col = 0; col < kColumns; ++col)
+        {
+            Bit *b = _grid[row][col].bit();
+            if (!b)
+                continue;
+            const int player = b->getOwner()->playerNumber();
+            masks[player & 1] |= uint64_t(1) << ConnectFourPosition::cellBit(col, kRows - 1 - row);
+        }
+    }
+}
+
+ConnectFourPosition ConnectFour::position() const
+{
+    uint64_t masks[2];
+    playerMasks(masks);
+    const uint64_t mask = masks[0] | masks[1];
+    const int moves = static_cast<int>(std::popcount(mask));
+    return ConnectFourPosition(masks[moves & 1], mask, moves);
+}
+
+Player* ConnectFour::checkForWinner()
+{
+    uint64_t masks[2];
+    playerMasks(masks);
+    for (int player = 0; player < 2; ++player)
+    {
+        if (ConnectFourPosition::hasAlignment(masks[player]))
+            return getPlayerAt(player);
+    }
+    return nullptr;
+}
+
+bool ConnectFour::checkForDraw()
+{
+    // a draw is a full board with no winner, the top row fills last
+    if (checkForWinner() != nullptr)
+        return false;
+    for (int col = 0; col < kColumns; ++col)
+    {
+        if (_grid[0][col].bit() == nullptr)
+            return false;
+    }
+    return true;
+}
+
+//
+// state strings, 42 characters left-to-right, top-to-bottom,
+// '0' empty, '1' player 1 (red), '2' player 2 (yellow)
+//
+std::string ConnectFour::initialStateString()
+{
+    return std::string(kRows * kColumns, '0');
+}
+
+std::string ConnectFour::stateString() const
+{
+    std::string state;
+    state.reserve(kRows * kColumns);
+    for (int row = 0; row < kRows; ++row)
+    {
+        for (int col = 0; col < kColumns; ++col)
+        {
+            Bit *b = _grid[row][col].bit();
+            state.push_back(b ? static_cast<char>('1' + b->getOwner()->playerNumber()) : '0');
+        }
+    }
+    return state;
+}
+
+void ConnectFour::setStateString(const std::string &s)
+{
+    stopGame();
+
+    int placedCount = 0;
+    for (int index = 0; index < kRows * kColumns && index < static_cast<int>(s.size()); ++index)
+    {
+        const int savedPlayerIndex = s[index] - '1';
+        if (savedPlayerIndex < 0 || savedPlayerIndex > 1)
+            continue;
+
+        Square &square = _grid[index / kColumns][index % kColumns];
+        Bit *b = PieceForPlayer(savedPlayerIndex);
+        b->setPosition(square.getPosition());
+        square.setBit(b);
+        ++placedCount;
+    }
+
+    _gameOptions.currentTurnNo = static_cast<unsigned int>(placedCount);
+}
+
+//
+// called every frame while it's the AI's turn: the first call starts the
+// search on the worker thread, later calls play the move once it's ready
+//
+void ConnectFour::updateAI()
+{
+    if (checkForWinner() || checkForDraw())
+        return;
+
+    if (!_ai.busy())
+    {
+        // the opening comes from the book, the solver takes over a few moves in
+        const int bookMove = ConnectFourBook::probe(position());
+        if (bookMove >= 0 && dropInColumn(bookMove))
+        {
+            endTurn();
+            return;
+        }
+
+        const ConnectFourPosition pos = position();
+        ConnectFourSolver *solver = _solver.get();
+        _ai.start([solver, pos](const std::atomic<bool> &stop) {
+            // the exact win / draw / loss is all that's needed to play perfectly
+            solver->setStopFlag(&stop);
+            int move = solver->bestMove(pos, true);
+            if (solver->stopped())
+                move = ConnectFourSolver::quickMove(pos);
+            solver->setStopFlag(nullptr);
+            return move;
+        }, kThinkTime);
+        return;
+    }
+
+    int col;
+    if (_ai.poll(col) && dropInColumn(col))
+        endTurn();
+}
@@ -0,0 +1,55 @@
+#pragma once
+#include "Game.h"
+#include "Square.h"
+#include "AIWorker.h"
+#include "ConnectFourSolver.h"
+
+#include <memory>
+
+//
+// connect four on the standard 7 column, 6 row board
+//
+// clicking anywhere in a column drops a piece to the lowest empty square.
+// the AI plays its first moves from ConnectFourBook, then it's
+// ConnectFourSolver running on an AIWorker thread; when it can't solve the
+// position inside its time budget it falls back to quickMove().
+//
+class ConnectFour : public Game
+{
+public:
+    static const int kColumns = ConnectFourPosition::kWidth;
+    static const int kRows = ConnectFourPosition::kHeight;
+
+    ConnectFour();
+    ~ConnectFour();
+
+    // set up the board
+    void        setUpBoard() override;
+
+    Player*     checkForWinner() override;
+    bool        checkForDraw() override;
+    std::string initialStateString() override;
+    std::string stateString() const override;
+    void        setStateString(const std::string &s) override;
+    bool        actionForEmptyHolder(BitHolder *holder) override;
+    bool        canBitMoveFrom(Bit*bit, BitHolder *src) override;
+    bool        canBitMoveFromTo(Bit* bit, BitHolder*src, BitHolder*dst) override;
+    void        stopGame() override;
+
+    void        updateAI() override;
+    bool        gameHasAI() override { return true; }
+    BitHolder &getHolderAt(const int x, const int y) override { return _grid[y][x]; }
+private:
+    Bit *       PieceForPlayer(const int playerNumber);
+    // drop the current player's piece into a column, false if it's full
+    bool        dropInColumn(int col);
+    // the board as a solver position, the player to move is the current player
+    ConnectFourPosition position() const;
+    // one bitboard per player, same bit layout as ConnectFourPosition
+    void        playerMasks(uint64_t masks[2]) const;
+
+    // grid rows run top to bottom, row kRows - 1 is the bottom of the board
+    Square                              _grid[kRows][kColumns];
+    AIWorker                            _ai;
+    std::unique_ptr<ConnectFourSolver>  _solver;
+};
@@ -0,0 +1,37 @@
+#include "ConnectFourBook.h"
+
+#include <algorithm>
+
+//
+// the columns of a bitboard in the opposite order
+//
+static uint64_t mirrorBits(uint64_t bits)
+{
+    const int stride = ConnectFourPosition::kHeight + 1;
+    const uint64_t column = (uint64_t(1) << stride) - 1;
+    uint64_t result = 0;
+    for (int col = 0; col < ConnectFourPosition::kWidth; ++col)
+        result |= ((bits >> (col * stride)) & column) << (ConnectFourBook::mirrorColumn(col) * stride);
+    return result;
+}
+
+uint64_t ConnectFourBook::canonicalKey(const ConnectFourPosition &position, bool &mirrored)
+{
+    const uint64_t key = position.key();
+    const uint64_t mirror = mirrorBits(position.current()) + mirrorBits(position.mask());
+    mirrored = mirror < key;
+    return mirrored ? mirror : key;
+}
+
+int ConnectFourBook::probe(const ConnectFourPosition &position, int *score)
+{
+    bool mirrored;
+    const uint64_t key = canonicalKey(position, mirrored);
+    const Entry *end = kEntries + kSize;
+    const Entry *entry = std::lower_bound(kEntries, end, key, [](const Entry &e, uint64_t k) { return e.key < k; });
+    if (entry == end || entry->key != key)
+        return -1;
+    if (score)
+        *score = entry->score;
+    return mirrored ? mirrorColumn(entry->move) : entry->move;
+}
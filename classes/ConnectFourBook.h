@@ -0,0 +1,43 @@
+#pragma once
+#include "ConnectFourSolver.h"
+
+#include <cstddef>
+#include <cstdint>
+
+//
+// connect four opening book, compiled in
+//
+// the second player's move (the one ConnectFour's AI plays) in every
+// position it can reach in its first few moves, whatever the first player
+// does, with the weak score ConnectFourSolver gave it. those are the
+// positions the solver can't answer inside the AI's time budget; a few
+// moves later it can.
+//
+// a position and its mirror image are stored once, under the smaller of
+// their two keys, with the move in that frame. the entries are sorted by
+// key and looked up by binary search.
+//
+// the table in ConnectFourBookData.cpp is written by tools/connect4_book,
+// see there to rebuild it.
+//
+class ConnectFourBook
+{
+public:
+    struct Entry
+    {
+        uint64_t    key;        // a canonicalKey()
+        int8_t      move;       // column, in the key's frame
+        int8_t      score;      // weak score for the side to move: 1 win, 0 draw, -1 loss
+    };
+
+    static const Entry  kEntries[];
+    static const size_t kSize;
+
+    // the book column for the position and, if asked, its score; -1 if it's not in the book
+    static int      probe(const ConnectFourPosition &position, int *score = nullptr);
+
+    // the same key for a position and its mirror image, "mirrored" says
+    // whether the key is the mirror's
+    static uint64_t canonicalKey(const ConnectFourPosition &position, bool &mirrored);
+    static int      mirrorColumn(int col) { return ConnectFourPosition::kWidth - 1 - col; }
+};
@@ -0,0 +1,2690 @@
+//
+// written by tools/connect4_book -p 10, don't edit
+//
+
+#include "ConnectFourBook.h"
+
+const ConnectFourBook::Entry ConnectFourBook::kEntries[] = {
+    { 0x0000000000001ull, 3, 1 },
+    { 0x0000000000080ull, 2, 1 },
+    { 0x0000000004000ull, 3, 0 },
+    { 0x0000000008081ull, 3, 1 },
+    { 0x0000000008180ull, 1, 1 },
+    { 0x0000000008581ull, 3, 1 },
+    { 0x0000000008980ull, 2, 1 },
+    { 0x0000000010080ull, 2, 1 },
+    { 0x0000000010580ull, 2, 1 },
+    { 0x0000000018981ull, 3, 1 },
+    { 0x0000000019180ull, 3, 1 },
+    { 0x0000000028980ull, 2, 1 },
+    { 0x0000000030081ull, 3, 1 },
+    { 0x0000000030180ull, 3, 1 },
+    { 0x0000000030581ull, 3, 1 },
+    { 0x0000000030980ull, 3, 1 },
+    { 0x0000000050080ull, 1, 1 },
+    { 0x0000000050281ull, 1, 1 },
+    { 0x0000000050480ull, 3, 1 },
+    { 0x0000000050580ull, 2, 1 },
+    { 0x0000000050683ull, 2, 1 },
+    { 0x0000000050A81ull, 2, 1 },
+    { 0x0000000068981ull, 3, 1 },
+    { 0x0000000069180ull, 3, 1 },
+    { 0x0000000090280ull, 1, 1 },
+    { 0x0000000090681ull, 1, 1 },
+    { 0x0000000090A80ull, 0, 1 },
+    { 0x00000000A8980ull, 4, 1 },
+    { 0x00000000D0581ull, 2, 1 },
+    { 0x00000000D0980ull, 3, 1 },
+    { 0x0000000110680ull, 3, 1 },
+    { 0x0000000150580ull, 4, 1 },
+    { 0x0000000200000ull, 3, -1 },
+    { 0x0000000208080ull, 3, 1 },
+    { 0x0000000208580ull, 3, 1 },
+    { 0x0000000218980ull, 3, 1 },
+    { 0x0000000230080ull, 3, 1 },
+    { 0x0000000230580ull, 3, 1 },
+    { 0x0000000250280ull, 3, 1 },
+    { 0x0000000250681ull, 3, 1 },
+    { 0x0000000268980ull, 3, 1 },
+    { 0x0000000290680ull, 3, 1 },
+    { 0x00000002D0580ull, 3, 1 },
+    { 0x0000000400003ull, 3, 1 },
+    { 0x0000000400081ull, 3, 1 },
+    { 0x0000000404001ull, 3, 1 },
+    { 0x0000000404080ull, 3, 1 },
+    { 0x0000000408083ull, 3, 1 },
+    { 0x0000000408181ull, 1, 1 },
+    { 0x0000000408583ull, 3, 1 },
+    { 0x0000000408981ull, 3, 1 },
+    { 0x000000040C000ull, 2, 0 },
+    { 0x0000000410081ull, 3, 1 },
+    { 0x0000000410581ull, 2, 1 },
+    { 0x0000000418983ull, 3, 1 },
+    { 0x0000000419181ull, 3, 1 },
+    { 0x000000041A180ull, 3, 1 },
+    { 0x0000000428981ull, 3, 1 },
+    { 0x0000000429180ull, 3, 1 },
+    { 0x000000042C001ull, 3, 1 },
+    { 0x000000042C080ull, 3, 1 },
+    { 0x0000000430083ull, 3, 1 },
+    { 0x0000000430181ull, 3, 1 },
+    { 0x0000000430380ull, 1, 1 },
+    { 0x0000000430583ull, 3, 1 },
+    { 0x0000000430981ull, 3, 1 },
+    { 0x0000000430B81ull, 3, 1 },
+    { 0x0000000431180ull, 3, 1 },
+    { 0x0000000431380ull, 3, 1 },
+    { 0x000000044C000ull, 3, 1 },
+    { 0x0000000450081ull, 3, 1 },
+    { 0x0000000450180ull, 3, 1 },
+    { 0x0000000450481ull, 3, 1 },
+    { 0x0000000450581ull, 3, 1 },
+    { 0x0000000450880ull, 3, 1 },
+    { 0x0000000450980ull, 3, 1 },
+    { 0x0000000450B80ull, 3, 1 },
+    { 0x0000000490480ull, 3, 1 },
+    { 0x0000000800001ull, 3, 1 },
+    { 0x0000000804000ull, 3, 0 },
+    { 0x0000000808081ull, 3, 1 },
+    { 0x0000000808581ull, 2, 1 },
+    { 0x0000000818583ull, 3, 1 },
+    { 0x0000000818981ull, 2, 1 },
+    { 0x0000000819180ull, 3, 1 },
+    { 0x0000000828581ull, 2, 1 },
+    { 0x000000082C000ull, 3, 0 },
+    { 0x0000000830081ull, 2, 1 },
+    { 0x0000000830180ull, 3, 1 },
+    { 0x0000000830581ull, 0, 1 },
+    { 0x0000000830980ull, 2, 1 },
+    { 0x0000000830B80ull, 3, 1 },
+    { 0x0000000850480ull, 0, 1 },
+    { 0x0000000870083ull, 1, 1 },
+    { 0x0000000870181ull, 0, 1 },
+    { 0x00000008B0081ull, 3, 1 },
+    { 0x0000000A00001ull, 3, 1 },
+    { 0x0000000A00080ull, 2, 1 },
+    { 0x0000000A04000ull, 4, 1 },
+    { 0x0000000A08081ull, 3, 1 },
+    { 0x0000000A08180ull, 3, 1 },
+    { 0x0000000A08581ull, 3, 1 },
+    { 0x0000000A08980ull, 3, 1 },
+    { 0x0000000A10080ull, 3, 1 },
+    { 0x0000000A10580ull, 3, 1 },
+    { 0x0000000A18981ull, 3, 1 },
+    { 0x0000000A19180ull, 3, 1 },
+    { 0x0000000A28980ull, 2, 1 },
+    { 0x0000000A30081ull, 3, 1 },
+    { 0x0000000A30180ull, 3, 1 },
+    { 0x0000000A30581ull, 3, 1 },
+    { 0x0000000A30980ull, 3, 1 },
+    { 0x0000000A50080ull, 3, 1 },
+    { 0x0000000A50281ull, 3, 1 },
+    { 0x0000000A50480ull, 1, 1 },
+    { 0x0000000A50580ull, 3, 1 },
+    { 0x0000000A90280ull, 3, 1 },
+    { 0x0000000C00007ull, 0, 1 },
+    { 0x0000000C00027ull, 3, 1 },
+    { 0x0000000C00083ull, 3, 1 },
+    { 0x0000000C00097ull, 3, 1 },
+    { 0x0000000C00181ull, 3, 1 },
+    { 0x0000000C04003ull, 3, 1 },
+    { 0x0000000C04017ull, 3, 1 },
+    { 0x0000000C04081ull, 3, 1 },
+    { 0x0000000C04180ull, 3, 1 },
+    { 0x0000000C08087ull, 0, 1 },
+    { 0x0000000C080A7ull, 3, 1 },
+    { 0x0000000C08183ull, 3, 1 },
+    { 0x0000000C08197ull, 3, 1 },
+    { 0x0000000C08587ull, 0, 1 },
+    { 0x0000000C08983ull, 3, 1 },
+    { 0x0000000C09181ull, 3, 1 },
+    { 0x0000000C0C001ull, 3, 1 },
+    { 0x0000000C0C080ull, 3, 1 },
+    { 0x0000000C10083ull, 3, 1 },
+    { 0x0000000C10097ull, 3, 1 },
+    { 0x0000000C10181ull, 3, 1 },
+    { 0x0000000C10583ull, 3, 1 },
+    { 0x0000000C10981ull, 3, 1 },
+    { 0x0000000C20081ull, 3, 1 },
+    { 0x0000000C2C003ull, 3, 1 },
+    { 0x0000000C2C081ull, 3, 1 },
+    { 0x0000000C2C180ull, 3, 1 },
+    { 0x0000000C30087ull, 0, 1 },
+    { 0x0000000C30183ull, 3, 1 },
+    { 0x0000000C30381ull, 1, 1 },
+    { 0x0000000C4C001ull, 3, 1 },
+    { 0x0000000C4C080ull, 3, 1 },
+    { 0x0000000C50083ull, 3, 1 },
+    { 0x0000000C50181ull, 3, 1 },
+    { 0x0000000C50380ull, 1, 1 },
+    { 0x0000000C8C000ull, 3, 1 },
+    { 0x0000000C90081ull, 3, 1 },
+    { 0x0000000C90180ull, 3, 1 },
+    { 0x0000001018581ull, 3, 1 },
+    { 0x0000001070081ull, 3, 1 },
+    { 0x0000001200000ull, 3, -1 },
+    { 0x0000001208080ull, 3, 1 },
+    { 0x0000001208580ull, 3, 1 },
+    { 0x0000001218980ull, 3, 1 },
+    { 0x0000001230080ull, 3, 1 },
+    { 0x0000001230580ull, 3, 1 },
+    { 0x0000001250280ull, 3, 1 },
+    { 0x0000001400003ull, 3, 1 },
+    { 0x0000001400017ull, 3, 1 },
+    { 0x0000001400081ull, 3, 1 },
+    { 0x0000001404001ull, 3, 1 },
+    { 0x0000001404080ull, 3, 1 },
+    { 0x0000001408083ull, 3, 1 },
+    { 0x0000001408097ull, 3, 1 },
+    { 0x0000001408583ull, 3, 1 },
+    { 0x0000001408981ull, 3, 1 },
+    { 0x0000001410081ull, 2, 1 },
+    { 0x000000142C001ull, 3, 1 },
+    { 0x000000142C080ull, 3, 1 },
+    { 0x0000001430083ull, 3, 1 },
+    { 0x0000001430181ull, 3, 1 },
+    { 0x000000144C000ull, 3, 1 },
+    { 0x0000001450081ull, 2, 1 },
+    { 0x0000001450180ull, 3, 1 },
+    { 0x0000001800003ull, 3, 1 },
+    { 0x0000001800081ull, 3, 1 },
+    { 0x0000001804001ull, 3, 1 },
+    { 0x0000001804080ull, 3, 1 },
+    { 0x0000001808083ull, 3, 1 },
+    { 0x0000001808181ull, 3, 1 },
+    { 0x000000180C000ull, 3, 1 },
+    { 0x0000001810081ull, 3, 1 },
+    { 0x000000182C001ull, 3, 1 },
+    { 0x000000182C080ull, 3, 1 },
+    { 0x0000001830181ull, 0, 1 },
+    { 0x0000001830380ull, 1, 1 },
+    { 0x000000184C000ull, 3, 1 },
+    { 0x0000001850180ull, 3, 1 },
+    { 0x0000001A00003ull, 3, 1 },
+    { 0x0000001A00081ull, 2, 1 },
+    { 0x0000001A04001ull, 1, 1 },
+    { 0x0000001A04103ull, 3, 1 },
+    { 0x0000001A04201ull, 3, 1 },
+    { 0x0000001A08083ull, 3, 1 },
+    { 0x0000001A08181ull, 3, 1 },
+    { 0x0000001A08380ull, 1, 1 },
+    { 0x0000001A08583ull, 3, 1 },
+    { 0x0000001A08981ull, 3, 1 },
+    { 0x0000001A08B81ull, 3, 1 },
+    { 0x0000001A09180ull, 3, 1 },
+    { 0x0000001A09380ull, 3, 1 },
+    { 0x0000001A0C101ull, 3, 1 },
+    { 0x0000001A10081ull, 3, 1 },
+    { 0x0000001A10180ull, 3, 1 },
+    { 0x0000001A10581ull, 3, 1 },
+    { 0x0000001A10980ull, 3, 1 },
+    { 0x0000001A10B80ull, 3, 1 },
+    { 0x0000001A20080ull, 3, 1 },
+    { 0x0000001A20580ull, 3, 1 },
+    { 0x0000001A30083ull, 3, 1 },
+    { 0x0000001A30181ull, 3, 1 },
+    { 0x0000001A30380ull, 1, 1 },
+    { 0x0000001A50081ull, 3, 1 },
+    { 0x0000001A50180ull, 3, 1 },
+    { 0x0000001A90080ull, 3, 1 },
+    { 0x0000001C00047ull, 3, 1 },
+    { 0x0000001C00087ull, 3, 1 },
+    { 0x0000001C000A7ull, 3, 1 },
+    { 0x0000001C00183ull, 3, 1 },
+    { 0x0000001C00197ull, 3, 1 },
+    { 0x0000001C00381ull, 3, 1 },
+    { 0x0000001C04007ull, 3, 1 },
+    { 0x0000001C04027ull, 3, 1 },
+    { 0x0000001C04083ull, 3, 1 },
+    { 0x0000001C04097ull, 3, 1 },
+    { 0x0000001C04181ull, 3, 1 },
+    { 0x0000001C04380ull, 3, 1 },
+    { 0x0000001C08187ull, 3, 1 },
+    { 0x0000001C08383ull, 3, 1 },
+    { 0x0000001C0C003ull, 3, 1 },
+    { 0x0000001C0C017ull, 3, 1 },
+    { 0x0000001C0C081ull, 3, 1 },
+    { 0x0000001C0C180ull, 3, 1 },
+    { 0x0000001C10087ull, 3, 1 },
+    { 0x0000001C10183ull, 3, 1 },
+    { 0x0000001C10381ull, 3, 1 },
+    { 0x0000001C1C001ull, 3, 1 },
+    { 0x0000001C1C080ull, 3, 1 },
+    { 0x0000001C20083ull, 3, 1 },
+    { 0x0000001C20181ull, 3, 1 },
+    { 0x0000001C2C007ull, 3, 1 },
+    { 0x0000001C2C083ull, 3, 1 },
+    { 0x0000001C2C181ull, 3, 1 },
+    { 0x0000001C2C380ull, 3, 1 },
+    { 0x0000001C40081ull, 3, 1 },
+    { 0x0000001C4C003ull, 3, 1 },
+    { 0x0000001C4C081ull, 3, 1 },
+    { 0x0000001C4C180ull, 3, 1 },
+    { 0x0000001C8C001ull, 3, 1 },
+    { 0x0000001C8C080ull, 3, 1 },
+    { 0x0000001D0C000ull, 3, 1 },
+    { 0x0000002430081ull, 3, 1 },
+    { 0x0000002800001ull, 3, 1 },
+    { 0x0000002804000ull, 3, 0 },
+    { 0x0000002808081ull, 1, 1 },
+    { 0x0000002808283ull, 3, 1 },
+    { 0x0000002808481ull, 1, 1 },
+    { 0x0000002810281ull, 3, 1 },
+    { 0x000000282C000ull, 3, 0 },
+    { 0x0000002830180ull, 3, 1 },
+    { 0x0000002A00001ull, 2, 1 },
+    { 0x0000002A04101ull, 3, 1 },
+    { 0x0000002A08003ull, 3, 1 },
+    { 0x0000002A08081ull, 3, 1 },
+    { 0x0000002A08180ull, 3, 1 },
+    { 0x0000002A08581ull, 6, 1 },
+    { 0x0000002A08980ull, 3, 1 },
+    { 0x0000002A08B80ull, 3, 1 },
+    { 0x0000002A10001ull, 3, 1 },
+    { 0x0000002A10080ull, 3, 1 },
+    { 0x0000002A10580ull, 2, 1 },
+    { 0x0000002A30081ull, 3, 1 },
+    { 0x0000002A30180ull, 3, 1 },
+    { 0x0000002A50080ull, 3, 1 },
+    { 0x0000002C00027ull, 3, 1 },
+    { 0x0000002C00083ull, 3, 1 },
+    { 0x0000002C00097ull, 3, 1 },
+    { 0x0000002C00181ull, 4, 1 },
+    { 0x0000002C04003ull, 3, 1 },
+    { 0x0000002C04017ull, 3, 1 },
+    { 0x0000002C04081ull, 3, 1 },
+    { 0x0000002C04180ull, 3, 1 },
+    { 0x0000002C08183ull, 3, 1 },
+    { 0x0000002C0C001ull, 3, 1 },
+    { 0x0000002C0C080ull, 3, 1 },
+    { 0x0000002C10083ull, 3, 1 },
+    { 0x0000002C10181ull, 2, 1 },
+    { 0x0000002C20081ull, 1, 1 },
+    { 0x0000002C2C003ull, 3, 1 },
+    { 0x0000002C2C081ull, 3, 1 },
+    { 0x0000002C2C180ull, 3, 1 },
+    { 0x0000002C4C001ull, 3, 1 },
+    { 0x0000002C4C080ull, 3, 1 },
+    { 0x0000002C8C000ull, 3, 1 },
+    { 0x0000003200001ull, 3, 1 },
+    { 0x0000003200080ull, 2, 1 },
+    { 0x0000003204000ull, 4, 1 },
+    { 0x0000003208081ull, 3, 1 },
+    { 0x0000003208180ull, 1, 1 },
+    { 0x0000003208581ull, 3, 1 },
+    { 0x0000003208980ull, 3, 1 },
+    { 0x0000003210080ull, 2, 1 },
+    { 0x0000003210580ull, 3, 1 },
+    { 0x0000003230081ull, 3, 1 },
+    { 0x0000003230180ull, 3, 1 },
+    { 0x0000003250080ull, 3, 1 },
+    { 0x0000003400007ull, 0, 1 },
+    { 0x0000003400027ull, 3, 1 },
+    { 0x0000003400083ull, 3, 1 },
+    { 0x0000003400097ull, 3, 1 },
+    { 0x0000003400181ull, 4, 1 },
+    { 0x0000003404003ull, 3, 1 },
+    { 0x0000003404017ull, 3, 1 },
+    { 0x0000003404081ull, 3, 1 },
+    { 0x0000003404180ull, 1, 1 },
+    { 0x0000003404581ull, 3, 1 },
+    { 0x0000003404980ull, 3, 1 },
+    { 0x0000003408087ull, 0, 1 },
+    { 0x0000003408183ull, 4, 1 },
+    { 0x000000340C001ull, 2, 1 },
+    { 0x000000340C080ull, 2, 1 },
+    { 0x000000340C580ull, 3, 1 },
+    { 0x0000003410083ull, 2, 1 },
+    { 0x000000342C003ull, 3, 1 },
+    { 0x000000342C081ull, 3, 1 },
+    { 0x000000342C180ull, 3, 1 },
+    { 0x000000344C001ull, 3, 1 },
+    { 0x000000344C080ull, 3, 1 },
+    { 0x000000348C000ull, 3, 1 },
+    { 0x0000003800007ull, 0, 1 },
+    { 0x0000003800027ull, 3, 1 },
+    { 0x0000003800083ull, 3, 1 },
+    { 0x0000003800097ull, 3, 1 },
+    { 0x0000003800181ull, 3, 1 },
+    { 0x0000003804003ull, 3, 1 },
+    { 0x0000003804017ull, 3, 1 },
+    { 0x0000003804081ull, 3, 1 },
+    { 0x0000003804180ull, 3, 1 },
+    { 0x0000003808087ull, 0, 1 },
+    { 0x0000003808183ull, 2, 1 },
+    { 0x0000003808381ull, 1, 1 },
+    { 0x000000380C001ull, 3, 1 },
+    { 0x000000380C080ull, 3, 1 },
+    { 0x0000003810083ull, 1, 1 },
+    { 0x0000003810181ull, 0, 1 },
+    { 0x000000381C000ull, 2, 1 },
+    { 0x0000003820081ull, 3, 1 },
+    { 0x000000382C003ull, 3, 1 },
+    { 0x000000382C081ull, 3, 1 },
+    { 0x000000382C180ull, 3, 1 },
+    { 0x000000384C001ull, 3, 1 },
+    { 0x000000384C080ull, 3, 1 },
+    { 0x000000385C001ull, 3, 1 },
+    { 0x000000385C080ull, 3, 1 },
+    { 0x000000388C000ull, 3, 1 },
+    { 0x000000389C000ull, 3, 1 },
+    { 0x0000003A00007ull, 3, 1 },
+    { 0x0000003A00083ull, 3, 1 },
+    { 0x0000003A04003ull, 3, 1 },
+    { 0x0000003A04107ull, 3, 1 },
+    { 0x0000003A04203ull, 3, 1 },
+    { 0x0000003A04401ull, 3, 1 },
+    { 0x0000003A08087ull, 3, 1 },
+    { 0x0000003A08183ull, 3, 1 },
+    { 0x0000003A08381ull, 3, 1 },
+    { 0x0000003A0C103ull, 3, 1 },
+    { 0x0000003A0C201ull, 3, 1 },
+    { 0x0000003A10083ull, 3, 1 },
+    { 0x0000003A10181ull, 3, 1 },
+    { 0x0000003A10380ull, 3, 1 },
+    { 0x0000003A1C101ull, 3, 1 },
+    { 0x0000003A20081ull, 3, 1 },
+    { 0x0000003A20180ull, 3, 1 },
+    { 0x0000003A40080ull, 3, 1 },
+    { 0x0000004808281ull, 5, 1 },
+    { 0x0000004A08001ull, 3, 1 },
+    { 0x0000005200000ull, 3, -1 },
+    { 0x0000005208080ull, 2, 1 },
+    { 0x0000005208580ull, 2, 1 },
+    { 0x0000005218081ull, 3, 1 },
+    { 0x0000005218180ull, 1, 1 },
+    { 0x0000005228080ull, 2, 1 },
+    { 0x0000005230080ull, 2, 1 },
+    { 0x0000005400003ull, 4, 1 },
+    { 0x0000005400017ull, 4, 1 },
+    { 0x0000005400081ull, 3, 1 },
+    { 0x0000005404001ull, 2, 1 },
+    { 0x0000005404080ull, 3, 1 },
+    { 0x0000005404580ull, 3, 1 },
+    { 0x0000005408083ull, 5, 1 },
+    { 0x0000005414003ull, 2, 1 },
+    { 0x0000005414081ull, 3, 1 },
+    { 0x0000005424001ull, 3, 1 },
+    { 0x000000542C001ull, 2, 1 },
+    { 0x000000542C080ull, 3, 1 },
+    { 0x000000544C000ull, 2, 1 },
+    { 0x0000005800003ull, 3, 1 },
+    { 0x0000005800017ull, 3, 1 },
+    { 0x0000005800081ull, 3, 1 },
+    { 0x0000005804001ull, 3, 1 },
+    { 0x0000005804080ull, 3, 1 },
+    { 0x0000005808083ull, 3, 1 },
+    { 0x0000005808181ull, 3, 1 },
+    { 0x000000580C000ull, 3, 1 },
+    { 0x0000005810081ull, 3, 1 },
+    { 0x000000582C001ull, 2, 1 },
+    { 0x000000582C080ull, 3, 1 },
+    { 0x000000584C000ull, 2, 1 },
+    { 0x000000585C000ull, 3, 1 },
+    { 0x0000005A00003ull, 3, 1 },
+    { 0x0000005A04103ull, 3, 1 },
+    { 0x0000005A04201ull, 3, 1 },
+    { 0x0000005A08083ull, 3, 1 },
+    { 0x0000005A08181ull, 3, 1 },
+    { 0x0000005A0C101ull, 3, 1 },
+    { 0x0000005A10081ull, 3, 1 },
+    { 0x0000005A10180ull, 3, 1 },
+    { 0x0000005A20080ull, 3, 1 },
+    { 0x0000006800003ull, 3, 1 },
+    { 0x0000006800081ull, 1, 1 },
+    { 0x0000006800283ull, 3, 1 },
+    { 0x0000006800481ull, 3, 1 },
+    { 0x0000006804001ull, 3, 1 },
+    { 0x0000006804080ull, 1, 1 },
+    { 0x0000006804281ull, 3, 1 },
+    { 0x0000006804480ull, 3, 1 },
+    { 0x000000680C000ull, 3, 1 },
+    { 0x000000680C280ull, 3, 1 },
+    { 0x000000682C001ull, 3, 1 },
+    { 0x000000682C080ull, 3, 1 },
+    { 0x000000684C000ull, 3, 1 },
+    { 0x0000006A04103ull, 3, 1 },
+    { 0x0000006A04201ull, 3, 1 },
+    { 0x0000006A08007ull, 0, 1 },
+    { 0x0000006A08083ull, 3, 1 },
+    { 0x0000006A08181ull, 6, 1 },
+    { 0x0000006A08380ull, 1, 1 },
+    { 0x0000006A0C101ull, 2, 1 },
+    { 0x0000006A10003ull, 3, 1 },
+    { 0x0000006A10081ull, 3, 1 },
+    { 0x0000006A10180ull, 2, 1 },
+    { 0x0000006A20001ull, 3, 1 },
+    { 0x0000006A20080ull, 2, 1 },
+    { 0x0000006C00087ull, 0, 1 },
+    { 0x0000006C00183ull, 2, 1 },
+    { 0x0000006C04007ull, 0, 1 },
+    { 0x0000006C04083ull, 3, 1 },
+    { 0x0000006C04181ull, 5, 1 },
+    { 0x0000006C04380ull, 1, 1 },
+    { 0x0000006C0C003ull, 3, 1 },
+    { 0x0000006C0C081ull, 2, 1 },
+    { 0x0000006C0C180ull, 2, 1 },
+    { 0x0000006C1C001ull, 2, 1 },
+    { 0x0000006C1C080ull, 2, 1 },
+    { 0x0000007200003ull, 5, 1 },
+    { 0x0000007200081ull, 2, 1 },
+    { 0x0000007204001ull, 1, 1 },
+    { 0x0000007204103ull, 4, 1 },
+    { 0x0000007204201ull, 3, 1 },
+    { 0x0000007208083ull, 3, 1 },
+    { 0x0000007208181ull, 1, 1 },
+    { 0x000000720C101ull, 2, 1 },
+    { 0x0000007210081ull, 2, 1 },
+    { 0x0000007400087ull, 0, 1 },
+    { 0x0000007400183ull, 4, 1 },
+    { 0x0000007404007ull, 0, 1 },
+    { 0x0000007404083ull, 3, 1 },
+    { 0x0000007404181ull, 4, 1 },
+    { 0x000000740C003ull, 2, 1 },
+    { 0x000000740C081ull, 2, 1 },
+    { 0x0000007800087ull, 3, 1 },
+    { 0x0000007800183ull, 3, 1 },
+    { 0x0000007800381ull, 3, 1 },
+    { 0x0000007804007ull, 3, 1 },
+    { 0x0000007804083ull, 3, 1 },
+    { 0x0000007804181ull, 3, 1 },
+    { 0x0000007804380ull, 3, 1 },
+    { 0x000000780C003ull, 3, 1 },
+    { 0x000000780C081ull, 3, 1 },
+    { 0x000000780C180ull, 3, 1 },
+    { 0x000000781C001ull, 3, 1 },
+    { 0x000000781C080ull, 3, 1 },
+    { 0x0000009218080ull, 2, 1 },
+    { 0x0000009414001ull, 2, 1 },
+    { 0x000000A800001ull, 5, 1 },
+    { 0x000000A800281ull, 2, 1 },
+    { 0x000000A804000ull, 5, 1 },
+    { 0x000000A804280ull, 2, 1 },
+    { 0x000000A82C000ull, 2, 0 },
+    { 0x000000AA04101ull, 2, 1 },
+    { 0x000000AA08003ull, 2, 1 },
+    { 0x000000AA08081ull, 2, 1 },
+    { 0x000000AA08180ull, 4, 1 },
+    { 0x000000AA10001ull, 2, 1 },
+    { 0x000000AA10080ull, 2, 1 },
+    { 0x000000AC00083ull, 2, 1 },
+    { 0x000000AC04003ull, 2, 1 },
+    { 0x000000AC04081ull, 2, 1 },
+    { 0x000000AC04180ull, 4, 1 },
+    { 0x000000AC0C001ull, 2, 1 },
+    { 0x000000AC0C080ull, 2, 1 },
+    { 0x000000B200001ull, 2, 1 },
+    { 0x000000B204101ull, 2, 1 },
+    { 0x000000B208003ull, 0, 1 },
+    { 0x000000B208081ull, 2, 1 },
+    { 0x000000B210001ull, 2, 1 },
+    { 0x000000B400083ull, 2, 1 },
+    { 0x000000B404003ull, 2, 1 },
+    { 0x000000B404081ull, 2, 1 },
+    { 0x000000B800083ull, 2, 1 },
+    { 0x000000B800181ull, 2, 1 },
+    { 0x000000B804003ull, 2, 1 },
+    { 0x000000B804081ull, 2, 1 },
+    { 0x000000B804180ull, 2, 1 },
+    { 0x000000B80C001ull, 2, 1 },
+    { 0x000000B80C080ull, 2, 1 },
+    { 0x000000CA08003ull, 2, 1 },
+    { 0x000000CA08081ull, 2, 1 },
+    { 0x000000CA10001ull, 2, 1 },
+    { 0x000000D200001ull, 1, 1 },
+    { 0x000000D200080ull, 2, 0 },
+    { 0x000000D200103ull, 0, 1 },
+    { 0x000000D200201ull, 1, 1 },
+    { 0x000000D204000ull, 2, -1 },
+    { 0x000000D204101ull, 4, 1 },
+    { 0x000000D208081ull, 2, 1 },
+    { 0x000000D208180ull, 1, 0 },
+    { 0x000000D210080ull, 2, 0 },
+    { 0x000000D214001ull, 1, 0 },
+    { 0x000000D214080ull, 2, -1 },
+    { 0x000000D224000ull, 2, -1 },
+    { 0x000000D400083ull, 4, 1 },
+    { 0x000000D400181ull, 1, 1 },
+    { 0x000000D404081ull, 2, 1 },
+    { 0x000000D404180ull, 1, 1 },
+    { 0x000000D40C080ull, 2, 1 },
+    { 0x000000D800007ull, 0, 1 },
+    { 0x000000D800083ull, 2, 1 },
+    { 0x000000D800181ull, 2, 1 },
+    { 0x000000D804003ull, 2, 1 },
+    { 0x000000D804081ull, 2, 1 },
+    { 0x000000D804180ull, 2, 1 },
+    { 0x000000D80C001ull, 4, 1 },
+    { 0x000000D80C080ull, 2, 1 },
+    { 0x000000D81C000ull, 2, 1 },
+    { 0x000000DA00007ull, 0, 1 },
+    { 0x000000DA00083ull, 2, 1 },
+    { 0x000000DA04003ull, 1, 1 },
+    { 0x000000E800007ull, 0, 1 },
+    { 0x000000E800083ull, 1, 1 },
+    { 0x000000E804003ull, 2, 1 },
+    { 0x000000E804081ull, 2, 1 },
+    { 0x000000E80C001ull, 2, 1 },
+    { 0x000000E80C080ull, 2, 1 },
+    { 0x000000E81C000ull, 2, 1 },
+    { 0x0000010008080ull, 2, 1 },
+    { 0x0000010008580ull, 2, 1 },
+    { 0x0000010018081ull, 2, 1 },
+    { 0x0000010018180ull, 2, 1 },
+    { 0x0000010018581ull, 3, 1 },
+    { 0x0000010018980ull, 2, 1 },
+    { 0x0000010028080ull, 2, 1 },
+    { 0x0000010028580ull, 2, 1 },
+    { 0x0000010030080ull, 2, 1 },
+    { 0x0000010030580ull, 2, 1 },
+    { 0x0000010038083ull, 2, 1 },
+    { 0x0000010038181ull, 2, 1 },
+    { 0x0000010038380ull, 2, 1 },
+    { 0x0000010038981ull, 2, 1 },
+    { 0x0000010039180ull, 2, 1 },
+    { 0x0000010050280ull, 4, 1 },
+    { 0x0000010050681ull, 2, 1 },
+    { 0x0000010058081ull, 4, 1 },
+    { 0x0000010058180ull, 4, 1 },
+    { 0x0000010058980ull, 4, 1 },
+    { 0x0000010068081ull, 2, 1 },
+    { 0x0000010068180ull, 1, 1 },
+    { 0x0000010068581ull, 3, 1 },
+    { 0x0000010068980ull, 2, 1 },
+    { 0x0000010070081ull, 3, 1 },
+    { 0x0000010070180ull, 3, 1 },
+    { 0x0000010070581ull, 2, 1 },
+    { 0x0000010070980ull, 2, 1 },
+    { 0x0000010090680ull, 4, 1 },
+    { 0x00000100A8080ull, 2, 1 },
+    { 0x00000100A8580ull, 2, 1 },
+    { 0x00000100B0080ull, 3, 1 },
+    { 0x00000100B0580ull, 4, 1 },
+    { 0x00000100D0580ull, 4, 1 },
+    { 0x00000100E8083ull, 2, 1 },
+    { 0x00000100E8181ull, 1, 1 },
+    { 0x0000010168081ull, 4, 1 },
+    { 0x00000101A8081ull, 4, 1 },
+    { 0x00000101A8180ull, 1, 1 },
+    { 0x0000010218080ull, 3, 1 },
+    { 0x0000010218580ull, 3, 1 },
+    { 0x0000010238081ull, 2, 1 },
+    { 0x0000010238180ull, 2, 1 },
+    { 0x0000010238980ull, 2, 1 },
+    { 0x0000010268080ull, 3, 1 },
+    { 0x0000010268580ull, 3, 1 },
+    { 0x0000010270080ull, 3, 1 },
+    { 0x0000010270580ull, 3, 1 },
+    { 0x00000102E8081ull, 3, 1 },
+    { 0x00000103A8080ull, 3, 1 },
+    { 0x0000010400001ull, 3, 1 },
+    { 0x0000010400080ull, 3, 1 },
+    { 0x0000010404000ull, 3, 1 },
+    { 0x0000010408081ull, 4, 1 },
+    { 0x0000010408581ull, 3, 1 },
+    { 0x0000010418583ull, 3, 1 },
+    { 0x0000010418981ull, 3, 1 },
+    { 0x0000010419180ull, 3, 1 },
+    { 0x0000010428581ull, 2, 1 },
+    { 0x000001042C000ull, 3, 1 },
+    { 0x0000010430081ull, 3, 1 },
+    { 0x0000010430180ull, 3, 1 },
+    { 0x0000010430581ull, 3, 1 },
+    { 0x0000010430980ull, 3, 1 },
+    { 0x0000010430B80ull, 3, 1 },
+    { 0x0000010450480ull, 3, 1 },
+    { 0x0000010470083ull, 3, 1 },
+    { 0x0000010470181ull, 3, 1 },
+    { 0x0000010470380ull, 1, 1 },
+    { 0x00000104B0081ull, 3, 1 },
+    { 0x00000104B0180ull, 3, 1 },
+    { 0x0000010530080ull, 3, 1 },
+    { 0x0000010818581ull, 2, 1 },
+    { 0x0000010870081ull, 2, 1 },
+    { 0x0000010870180ull, 4, 1 },
+    { 0x00000108B0080ull, 3, 1 },
+    { 0x0000010A08001ull, 3, 1 },
+    { 0x0000010A08080ull, 3, 1 },
+    { 0x0000010A08580ull, 3, 1 },
+    { 0x0000010A10000ull, 3, 1 },
+    { 0x0000010A18081ull, 3, 1 },
+    { 0x0000010A18180ull, 3, 1 },
+    { 0x0000010A18581ull, 3, 1 },
+    { 0x0000010A18980ull, 3, 1 },
+    { 0x0000010A28080ull, 3, 1 },
+    { 0x0000010A28580ull, 2, 1 },
+    { 0x0000010A30080ull, 3, 1 },
+    { 0x0000010A30580ull, 3, 1 },
+    { 0x0000010A50280ull, 3, 1 },
+    { 0x0000010A68081ull, 3, 1 },
+    { 0x0000010A68180ull, 1, 1 },
+    { 0x0000010A70081ull, 3, 1 },
+    { 0x0000010A70180ull, 3, 1 },
+    { 0x0000010AA8080ull, 3, 1 },
+    { 0x0000010AB0080ull, 3, 1 },
+    { 0x0000010C00003ull, 3, 1 },
+    { 0x0000010C00017ull, 3, 1 },
+    { 0x0000010C00081ull, 3, 1 },
+    { 0x0000010C00180ull, 3, 1 },
+    { 0x0000010C04001ull, 3, 1 },
+    { 0x0000010C04080ull, 3, 1 },
+    { 0x0000010C08083ull, 3, 1 },
+    { 0x0000010C08097ull, 3, 1 },
+    { 0x0000010C08583ull, 3, 1 },
+    { 0x0000010C08981ull, 3, 1 },
+    { 0x0000010C0C000ull, 3, 1 },
+    { 0x0000010C10081ull, 3, 1 },
+    { 0x0000010C10581ull, 3, 1 },
+    { 0x0000010C2C001ull, 3, 1 },
+    { 0x0000010C2C080ull, 3, 1 },
+    { 0x0000010C30083ull, 3, 1 },
+    { 0x0000010C30181ull, 3, 1 },
+    { 0x0000010C30380ull, 1, 1 },
+    { 0x0000010C4C000ull, 3, 1 },
+    { 0x0000010C50081ull, 3, 1 },
+    { 0x0000010C50180ull, 3, 1 },
+    { 0x0000011208000ull, 3, 1 },
+    { 0x0000011218080ull, 3, 1 },
+    { 0x0000011218580ull, 3, 1 },
+    { 0x0000011268080ull, 3, 1 },
+    { 0x0000011270080ull, 3, 1 },
+    { 0x0000011400001ull, 3, 1 },
+    { 0x0000011400080ull, 3, 1 },
+    { 0x0000011404000ull, 3, 1 },
+    { 0x0000011408581ull, 3, 1 },
+    { 0x000001142C000ull, 3, 1 },
+    { 0x0000011430081ull, 2, 1 },
+    { 0x0000011430180ull, 3, 1 },
+    { 0x0000011800001ull, 3, 1 },
+    { 0x0000011800080ull, 3, 1 },
+    { 0x0000011804000ull, 3, 1 },
+    { 0x0000011808081ull, 3, 1 },
+    { 0x000001182C000ull, 3, 1 },
+    { 0x0000011830180ull, 4, 1 },
+    { 0x0000011A00001ull, 3, 1 },
+    { 0x0000011A04101ull, 5, 1 },
+    { 0x0000011A08003ull, 3, 1 },
+    { 0x0000011A08081ull, 3, 1 },
+    { 0x0000011A08180ull, 3, 1 },
+    { 0x0000011A08581ull, 3, 1 },
+    { 0x0000011A08980ull, 3, 1 },
+    { 0x0000011A08B80ull, 3, 1 },
+    { 0x0000011A10001ull, 3, 1 },
+    { 0x0000011A10080ull, 3, 1 },
+    { 0x0000011A10580ull, 3, 1 },
+    { 0x0000011A18083ull, 3, 1 },
+    { 0x0000011A18181ull, 3, 1 },
+    { 0x0000011A18380ull, 1, 1 },
+    { 0x0000011A20000ull, 3, 1 },
+    { 0x0000011A28081ull, 3, 1 },
+    { 0x0000011A28180ull, 3, 1 },
+    { 0x0000011A30081ull, 3, 1 },
+    { 0x0000011A30180ull, 3, 1 },
+    { 0x0000011A48080ull, 3, 1 },
+    { 0x0000011A50080ull, 3, 1 },
+    { 0x0000011C00007ull, 3, 1 },
+    { 0x0000011C00027ull, 3, 1 },
+    { 0x0000011C00083ull, 3, 1 },
+    { 0x0000011C00097ull, 3, 1 },
+    { 0x0000011C00181ull, 3, 1 },
+    { 0x0000011C00380ull, 3, 1 },
+    { 0x0000011C04003ull, 3, 1 },
+    { 0x0000011C04017ull, 3, 1 },
+    { 0x0000011C04081ull, 3, 1 },
+    { 0x0000011C04180ull, 3, 1 },
+    { 0x0000011C08087ull, 3, 1 },
+    { 0x0000011C08183ull, 3, 1 },
+    { 0x0000011C0C001ull, 3, 1 },
+    { 0x0000011C0C080ull, 3, 1 },
+    { 0x0000011C10083ull, 3, 1 },
+    { 0x0000011C10181ull, 3, 1 },
+    { 0x0000011C1C000ull, 3, 1 },
+    { 0x0000011C20081ull, 3, 1 },
+    { 0x0000011C2C003ull, 3, 1 },
+    { 0x0000011C2C081ull, 3, 1 },
+    { 0x0000011C2C180ull, 3, 1 },
+    { 0x0000011C4C001ull, 3, 1 },
+    { 0x0000011C4C080ull, 3, 1 },
+    { 0x0000011C8C000ull, 3, 1 },
+    { 0x0000012808281ull, 3, 1 },
+    { 0x0000012A08001ull, 3, 1 },
+    { 0x0000012A08080ull, 3, 1 },
+    { 0x0000012A08580ull, 3, 1 },
+    { 0x0000012A10000ull, 3, 1 },
+    { 0x0000012A18081ull, 3, 1 },
+    { 0x0000012A18180ull, 2, 1 },
+    { 0x0000012A28080ull, 1, 1 },
+    { 0x0000012A30080ull, 3, 1 },
+    { 0x0000012C00003ull, 3, 1 },
+    { 0x0000012C00017ull, 3, 1 },
+    { 0x0000012C00081ull, 3, 1 },
+    { 0x0000012C00180ull, 3, 1 },
+    { 0x0000012C04001ull, 3, 1 },
+    { 0x0000012C04080ull, 3, 1 },
+    { 0x0000012C08083ull, 3, 1 },
+    { 0x0000012C0C000ull, 3, 1 },
+    { 0x0000012C10081ull, 3, 1 },
+    { 0x0000012C2C001ull, 3, 1 },
+    { 0x0000012C2C080ull, 3, 1 },
+    { 0x0000012C4C000ull, 3, 1 },
+    { 0x0000013208001ull, 3, 1 },
+    { 0x0000013208080ull, 3, 1 },
+    { 0x0000013208580ull, 3, 1 },
+    { 0x0000013210000ull, 2, 1 },
+    { 0x0000013218081ull, 3, 1 },
+    { 0x0000013218180ull, 2, 1 },
+    { 0x0000013228080ull, 2, 1 },
+    { 0x0000013230001ull, 3, 1 },
+    { 0x0000013230080ull, 3, 1 },
+    { 0x0000013250000ull, 5, 1 },
+    { 0x0000013400003ull, 3, 1 },
+    { 0x0000013400017ull, 3, 1 },
+    { 0x0000013400081ull, 3, 1 },
+    { 0x0000013400180ull, 1, 1 },
+    { 0x0000013400581ull, 3, 1 },
+    { 0x0000013400980ull, 3, 1 },
+    { 0x0000013404001ull, 3, 1 },
+    { 0x0000013404080ull, 3, 1 },
+    { 0x0000013404580ull, 3, 1 },
+    { 0x0000013408083ull, 3, 1 },
+    { 0x000001340C000ull, 2, 1 },
+    { 0x000001342C001ull, 3, 1 },
+    { 0x000001342C080ull, 3, 1 },
+    { 0x000001344C000ull, 3, 1 },
+    { 0x0000013800003ull, 3, 1 },
+    { 0x0000013800017ull, 3, 1 },
+    { 0x0000013800081ull, 3, 1 },
+    { 0x0000013800180ull, 3, 1 },
+    { 0x0000013804001ull, 3, 1 },
+    { 0x0000013804080ull, 3, 1 },
+    { 0x0000013808083ull, 3, 1 },
+    { 0x0000013808181ull, 3, 1 },
+    { 0x000001380C000ull, 3, 1 },
+    { 0x0000013810081ull, 3, 1 },
+    { 0x000001382C001ull, 3, 1 },
+    { 0x000001382C080ull, 3, 1 },
+    { 0x000001384C000ull, 3, 1 },
+    { 0x000001385C000ull, 3, 1 },
+    { 0x0000013A00003ull, 3, 1 },
+    { 0x0000013A00081ull, 3, 1 },
+    { 0x0000013A04001ull, 3, 1 },
+    { 0x0000013A04103ull, 3, 1 },
+    { 0x0000013A04201ull, 3, 1 },
+    { 0x0000013A08007ull, 3, 1 },
+    { 0x0000013A08083ull, 3, 1 },
+    { 0x0000013A08181ull, 3, 1 },
+    { 0x0000013A08380ull, 3, 1 },
+    { 0x0000013A0C101ull, 3, 1 },
+    { 0x0000013A10003ull, 3, 1 },
+    { 0x0000013A10081ull, 3, 1 },
+    { 0x0000013A10180ull, 3, 1 },
+    { 0x0000013A20001ull, 3, 1 },
+    { 0x0000013A20080ull, 3, 1 },
+    { 0x0000013A40000ull, 3, 1 },
+    { 0x0000015208000ull, 2, 1 },
+    { 0x0000015218001ull, 3, 1 },
+    { 0x0000015218080ull, 3, 1 },
+    { 0x0000015228000ull, 4, 1 },
+    { 0x0000015230000ull, 2, 1 },
+    { 0x0000015400001ull, 3, 1 },
+    { 0x0000015400080ull, 3, 1 },
+    { 0x0000015400580ull, 3, 1 },
+    { 0x0000015404000ull, 2, 1 },
+    { 0x0000015414001ull, 3, 1 },
+    { 0x0000015414080ull, 3, 1 },
+    { 0x0000015424000ull, 2, 1 },
+    { 0x000001542C000ull, 2, 1 },
+    { 0x0000015800001ull, 3, 1 },
+    { 0x0000015800080ull, 3, 1 },
+    { 0x0000015804000ull, 3, 1 },
+    { 0x0000015808081ull, 3, 1 },
+    { 0x000001582C000ull, 3, 1 },
+    { 0x0000015A00001ull, 2, 1 },
+    { 0x0000015A08003ull, 3, 1 },
+    { 0x0000015A08081ull, 3, 1 },
+    { 0x0000015A08180ull, 3, 1 },
+    { 0x0000015A10001ull, 3, 1 },
+    { 0x0000015A10080ull, 3, 1 },
+    { 0x0000015A20000ull, 3, 1 },
+    { 0x0000016800001ull, 3, 1 },
+    { 0x0000016800080ull, 4, 0 },
+    { 0x0000016800281ull, 3, 1 },
+    { 0x0000016804000ull, 3, 1 },
+    { 0x0000016804280ull, 3, 1 },
+    { 0x000001682C000ull, 3, 1 },
+    { 0x0000016A04101ull, 5, 1 },
+    { 0x0000016A08003ull, 3, 1 },
+    { 0x0000016A08081ull, 3, 1 },
+    { 0x0000016A08180ull, 3, 1 },
+    { 0x0000016A10001ull, 3, 1 },
+    { 0x0000016A10080ull, 3, 1 },
+    { 0x0000016A20000ull, 4, 1 },
+    { 0x0000016C00007ull, 0, 1 },
+    { 0x0000016C00083ull, 3, 1 },
+    { 0x0000016C00181ull, 6, 1 },
+    { 0x0000016C00380ull, 1, 1 },
+    { 0x0000016C04003ull, 3, 1 },
+    { 0x0000016C04081ull, 3, 1 },
+    { 0x0000016C04180ull, 3, 1 },
+    { 0x0000016C0C001ull, 3, 1 },
+    { 0x0000016C0C080ull, 3, 1 },
+    { 0x0000016C1C000ull, 2, 1 },
+    { 0x0000017200001ull, 2, 1 },
+    { 0x0000017204101ull, 5, 1 },
+    { 0x0000017208003ull, 3, 1 },
+    { 0x0000017208081ull, 2, 1 },
+    { 0x0000017208180ull, 1, 1 },
+    { 0x0000017210001ull, 2, 1 },
+    { 0x0000017210080ull, 2, 1 },
+    { 0x0000017400007ull, 0, 1 },
+    { 0x0000017400083ull, 3, 1 },
+    { 0x0000017400181ull, 1, 1 },
+    { 0x0000017404003ull, 3, 1 },
+    { 0x0000017404081ull, 3, 1 },
+    { 0x0000017404180ull, 1, 1 },
+    { 0x000001740C001ull, 2, 1 },
+    { 0x000001740C080ull, 2, 1 },
+    { 0x0000017800007ull, 3, 1 },
+    { 0x0000017800083ull, 3, 1 },
+    { 0x0000017800181ull, 3, 1 },
+    { 0x0000017800380ull, 3, 1 },
+    { 0x0000017804003ull, 3, 1 },
+    { 0x0000017804081ull, 3, 1 },
+    { 0x0000017804180ull, 3, 1 },
+    { 0x000001780C001ull, 3, 1 },
+    { 0x000001780C080ull, 3, 1 },
+    { 0x000001781C000ull, 3, 1 },
+    { 0x0000019218000ull, 4, 1 },
+    { 0x0000019414000ull, 2, 1 },
+    { 0x0000019A08001ull, 2, 1 },
+    { 0x000001A800101ull, 1, 1 },
+    { 0x000001A800200ull, 0, 1 },
+    { 0x000001A804100ull, 2, 1 },
+    { 0x000001AA08001ull, 2, 1 },
+    { 0x000001AA08080ull, 2, 1 },
+    { 0x000001AA10000ull, 5, 1 },
+    { 0x000001AC00003ull, 2, 1 },
+    { 0x000001AC00081ull, 2, 1 },
+    { 0x000001AC00180ull, 4, 1 },
+    { 0x000001AC04001ull, 2, 1 },
+    { 0x000001AC04080ull, 2, 1 },
+    { 0x000001AC0C000ull, 2, 1 },
+    { 0x000001B208001ull, 4, 1 },
+    { 0x000001B208080ull, 2, 1 },
+    { 0x000001B400003ull, 2, 1 },
+    { 0x000001B400081ull, 2, 1 },
+    { 0x000001B404001ull, 2, 1 },
+    { 0x000001B404080ull, 2, 1 },
+    { 0x000001B800003ull, 2, 1 },
+    { 0x000001B800081ull, 2, 1 },
+    { 0x000001B800180ull, 4, 1 },
+    { 0x000001B804001ull, 2, 1 },
+    { 0x000001B804080ull, 2, 1 },
+    { 0x000001B80C000ull, 2, 1 },
+    { 0x000001CA08001ull, 2, 1 },
+    { 0x000001D200101ull, 5, 1 },
+    { 0x000001D208080ull, 2, 1 },
+    { 0x000001D214000ull, 2, -1 },
+    { 0x000001D400003ull, 4, 1 },
+    { 0x000001D400081ull, 4, 1 },
+    { 0x000001D400180ull, 1, 1 },
+    { 0x000001D404001ull, 2, 1 },
+    { 0x000001D404080ull, 2, 1 },
+    { 0x000001D800003ull, 2, 1 },
+    { 0x000001D800081ull, 2, 1 },
+    { 0x000001D800180ull, 4, 1 },
+    { 0x000001D804001ull, 2, 1 },
+    { 0x000001D804080ull, 2, 1 },
+    { 0x000001D80C000ull, 2, 1 },
+    { 0x000001DA00003ull, 2, 1 },
+    { 0x000001E800003ull, 2, 1 },
+    { 0x000001E800081ull, 1, 1 },
+    { 0x000001E804001ull, 2, 1 },
+    { 0x000001E804080ull, 2, 1 },
+    { 0x000001E80C000ull, 2, 1 },
+    { 0x0000020A04001ull, 1, 1 },
+    { 0x0000020A04080ull, 0, 1 },
+    { 0x0000020A04084ull, 3, 1 },
+    { 0x0000020A04103ull, 3, 1 },
+    { 0x0000020A04182ull, 3, 1 },
+    { 0x0000020A04201ull, 3, 1 },
+    { 0x0000020A0C000ull, 3, 1 },
+    { 0x0000020A0C082ull, 3, 1 },
+    { 0x0000020A0C101ull, 3, 1 },
+    { 0x0000021204082ull, 3, 1 },
+    { 0x0000021204101ull, 3, 1 },
+    { 0x0000021A04088ull, 3, 1 },
+    { 0x0000021A04107ull, 0, 1 },
+    { 0x0000021A04184ull, 3, 1 },
+    { 0x0000021A04203ull, 3, 1 },
+    { 0x0000021A04382ull, 1, 1 },
+    { 0x0000021A04401ull, 3, 1 },
+    { 0x0000021A0C001ull, 1, 1 },
+    { 0x0000021A0C080ull, 0, 1 },
+    { 0x0000021A0C084ull, 3, 1 },
+    { 0x0000021A0C103ull, 3, 1 },
+    { 0x0000021A0C182ull, 3, 1 },
+    { 0x0000021A0C201ull, 3, 1 },
+    { 0x0000021A1C000ull, 2, 1 },
+    { 0x0000021A1C082ull, 2, 1 },
+    { 0x0000021A1C101ull, 2, 1 },
+    { 0x0000021A5C001ull, 1, 1 },
+    { 0x0000021A5C080ull, 0, 1 },
+    { 0x0000021A9C000ull, 3, 1 },
+    { 0x0000022A04084ull, 3, 1 },
+    { 0x0000022A04103ull, 3, 1 },
+    { 0x0000022A04182ull, 3, 1 },
+    { 0x0000022A04201ull, 3, 1 },
+    { 0x0000022A0C000ull, 2, 1 },
+    { 0x0000022A0C082ull, 3, 1 },
+    { 0x0000022A0C101ull, 2, 1 },
+    { 0x0000022A2C001ull, 1, 1 },
+    { 0x0000022A2C080ull, 0, 1 },
+    { 0x0000022A4C000ull, 3, 1 },
+    { 0x0000022A5C000ull, 4, 1 },
+    { 0x0000022C00183ull, 3, 1 },
+    { 0x0000022C00381ull, 1, 1 },
+    { 0x0000022C04181ull, 4, 1 },
+    { 0x0000023204001ull, 1, 1 },
+    { 0x0000023204080ull, 0, 1 },
+    { 0x0000023204084ull, 3, 1 },
+    { 0x0000023204103ull, 3, 1 },
+    { 0x0000023204182ull, 1, 1 },
+    { 0x0000023204201ull, 3, 1 },
+    { 0x000002320C000ull, 2, 1 },
+    { 0x000002320C082ull, 2, 1 },
+    { 0x000002320C101ull, 2, 1 },
+    { 0x000002322C001ull, 1, 1 },
+    { 0x000002322C080ull, 0, 1 },
+    { 0x000002324C000ull, 3, 1 },
+    { 0x0000023400183ull, 3, 1 },
+    { 0x0000023400381ull, 1, 1 },
+    { 0x0000023404181ull, 3, 1 },
+    { 0x0000024A2C000ull, 3, 1 },
+    { 0x0000024C00181ull, 3, 1 },
+    { 0x0000025204082ull, 2, 1 },
+    { 0x0000025204101ull, 3, 1 },
+    { 0x000002522C000ull, 3, 1 },
+    { 0x0000025400007ull, 0, 1 },
+    { 0x0000025400083ull, 3, 1 },
+    { 0x0000025400181ull, 2, 1 },
+    { 0x0000025404003ull, 2, 1 },
+    { 0x0000029400003ull, 2, 1 },
+    { 0x0000030018080ull, 4, 1 },
+    { 0x0000030018580ull, 4, 1 },
+    { 0x0000030038081ull, 2, 1 },
+    { 0x0000030038180ull, 2, 1 },
+    { 0x0000030038980ull, 2, 1 },
+    { 0x0000030068080ull, 4, 1 },
+    { 0x0000030068580ull, 4, 1 },
+    { 0x0000030070080ull, 3, 1 },
+    { 0x0000030070580ull, 2, 1 },
+    { 0x00000300E8081ull, 4, 1 },
+    { 0x00000301A8080ull, 4, 1 },
+    { 0x0000030418581ull, 2, 1 },
+    { 0x0000030470081ull, 3, 1 },
+    { 0x0000030470180ull, 3, 1 },
+    { 0x00000304B0080ull, 3, 1 },
+    { 0x0000030870080ull, 1, 1 },
+    { 0x0000030A18080ull, 3, 1 },
+    { 0x0000030A18580ull, 4, 1 },
+    { 0x0000030A68080ull, 4, 1 },
+    { 0x0000030A70080ull, 3, 1 },
+    { 0x0000030C00001ull, 3, 1 },
+    { 0x0000030C00080ull, 3, 1 },
+    { 0x0000030C08581ull, 3, 1 },
+    { 0x0000030C2C000ull, 3, 1 },
+    { 0x0000030C30081ull, 3, 1 },
+    { 0x0000030C30180ull, 3, 1 },
+    { 0x0000031A08001ull, 3, 1 },
+    { 0x0000031A08080ull, 3, 1 },
+    { 0x0000031A08580ull, 3, 1 },
+    { 0x0000031A10000ull, 3, 1 },
+    { 0x0000031A18081ull, 3, 1 },
+    { 0x0000031A18180ull, 3, 1 },
+    { 0x0000031A28080ull, 3, 1 },
+    { 0x0000031A30080ull, 3, 1 },
+    { 0x0000031C00003ull, 3, 1 },
+    { 0x0000031C00017ull, 3, 1 },
+    { 0x0000031C00081ull, 3, 1 },
+    { 0x0000031C00180ull, 3, 1 },
+    { 0x0000031C04001ull, 3, 1 },
+    { 0x0000031C04080ull, 3, 1 },
+    { 0x0000031C08083ull, 3, 1 },
+    { 0x0000031C0C000ull, 3, 1 },
+    { 0x0000031C10081ull, 3, 1 },
+    { 0x0000031C2C001ull, 3, 1 },
+    { 0x0000031C2C080ull, 3, 1 },
+    { 0x0000031C4C000ull, 3, 1 },
+    { 0x0000032A18080ull, 2, 1 },
+    { 0x0000032C00001ull, 3, 1 },
+    { 0x0000032C00080ull, 4, 1 },
+    { 0x0000032C2C000ull, 3, 1 },
+    { 0x0000033218080ull, 4, 1 },
+    { 0x0000033230000ull, 2, 1 },
+    { 0x0000033400001ull, 4, 1 },
+    { 0x0000033400080ull, 4, 1 },
+    { 0x0000033400580ull, 4, 1 },
+    { 0x000003342C000ull, 3, 1 },
+    { 0x0000033800001ull, 3, 1 },
+    { 0x0000033800080ull, 3, 1 },
+    { 0x0000033808081ull, 3, 1 },
+    { 0x000003382C000ull, 3, 1 },
+    { 0x0000033A00001ull, 3, 1 },
+    { 0x0000033A08003ull, 3, 1 },
+    { 0x0000033A08081ull, 3, 1 },
+    { 0x0000033A08180ull, 3, 1 },
+    { 0x0000033A10001ull, 3, 1 },
+    { 0x0000033A10080ull, 3, 1 },
+    { 0x0000033A20000ull, 3, 1 },
+    { 0x0000035218000ull, 4, 1 },
+    { 0x0000035414000ull, 4, 1 },
+    { 0x0000035A08001ull, 3, 1 },
+    { 0x0000035A08080ull, 3, 1 },
+    { 0x0000035A10000ull, 3, 1 },
+    { 0x0000036A08001ull, 4, 1 },
+    { 0x0000036A08080ull, 4, 1 },
+    { 0x0000036A10000ull, 4, 1 },
+    { 0x0000036C00003ull, 3, 1 },
+    { 0x0000036C00081ull, 3, 1 },
+    { 0x0000036C00180ull, 4, 1 },
+    { 0x0000036C04001ull, 3, 1 },
+    { 0x0000036C04080ull, 3, 1 },
+    { 0x0000036C0C000ull, 3, 1 },
+    { 0x0000037208001ull, 4, 1 },
+    { 0x0000037208080ull, 4, 1 },
+    { 0x0000037400003ull, 4, 1 },
+    { 0x0000037400081ull, 4, 1 },
+    { 0x0000037404001ull, 4, 1 },
+    { 0x0000037404080ull, 4, 1 },
+    { 0x0000037800003ull, 3, 1 },
+    { 0x0000037800081ull, 3, 1 },
+    { 0x0000037800180ull, 3, 1 },
+    { 0x0000037804001ull, 3, 1 },
+    { 0x0000037804080ull, 3, 1 },
+    { 0x000003780C000ull, 3, 1 },
+    { 0x000003A800100ull, 2, 1 },
+    { 0x000003AC00001ull, 2, 1 },
+    { 0x000003B800001ull, 2, 1 },
+    { 0x000003B800080ull, 4, 1 },
+    { 0x000003D400001ull, 4, 1 },
+    { 0x000003D400080ull, 4, 1 },
+    { 0x000003D800001ull, 2, 1 },
+    { 0x000003D800080ull, 4, 1 },
+    { 0x000003E800001ull, 2, 1 },
+    { 0x000003E800080ull, 4, 1 },
+    { 0x0000040A04082ull, 3, 1 },
+    { 0x0000040A04101ull, 3, 1 },
+    { 0x0000041A04001ull, 1, 1 },
+    { 0x0000041A04080ull, 0, 1 },
+    { 0x0000041A04084ull, 3, 1 },
+    { 0x0000041A04103ull, 3, 1 },
+    { 0x0000041A04182ull, 3, 1 },
+    { 0x0000041A04201ull, 3, 1 },
+    { 0x0000041A0C082ull, 3, 1 },
+    { 0x0000041A0C101ull, 3, 1 },
+    { 0x0000041A5C000ull, 3, 1 },
+    { 0x0000042A04082ull, 3, 1 },
+    { 0x0000042A04101ull, 3, 1 },
+    { 0x0000042A2C000ull, 3, 1 },
+    { 0x0000042C00181ull, 3, 1 },
+    { 0x0000043204082ull, 4, 1 },
+    { 0x0000043204101ull, 4, 1 },
+    { 0x000004322C000ull, 3, 1 },
+    { 0x0000043400181ull, 4, 1 },
+    { 0x0000043A0C001ull, 3, 1 },
+    { 0x0000043A0C080ull, 3, 1 },
+    { 0x0000043A1C000ull, 3, 1 },
+    { 0x0000045400003ull, 2, 1 },
+    { 0x0000046A04001ull, 1, 1 },
+    { 0x0000046A04080ull, 0, 1 },
+    { 0x0000050050281ull, 1, 1 },
+    { 0x0000050050480ull, 3, 1 },
+    { 0x0000050058083ull, 3, 1 },
+    { 0x0000050058181ull, 4, 1 },
+    { 0x0000050058380ull, 1, 1 },
+    { 0x0000050090280ull, 1, 1 },
+    { 0x0000050098081ull, 3, 1 },
+    { 0x0000050098180ull, 4, 1 },
+    { 0x0000050250280ull, 3, 1 },
+    { 0x0000050258081ull, 3, 1 },
+    { 0x0000050258180ull, 3, 1 },
+    { 0x0000050408083ull, 3, 1 },
+    { 0x0000050408181ull, 1, 1 },
+    { 0x0000050408583ull, 3, 1 },
+    { 0x0000050408981ull, 3, 1 },
+    { 0x0000050410081ull, 3, 1 },
+    { 0x0000050410581ull, 2, 1 },
+    { 0x0000050808081ull, 3, 1 },
+    { 0x0000050808581ull, 2, 1 },
+    { 0x0000050C08087ull, 0, 1 },
+    { 0x0000050C08183ull, 1, 1 },
+    { 0x0000050C10083ull, 3, 1 },
+    { 0x0000050C10181ull, 3, 1 },
+    { 0x0000050C20081ull, 3, 1 },
+    { 0x0000051408083ull, 3, 1 },
+    { 0x0000051410081ull, 2, 1 },
+    { 0x0000051808083ull, 3, 1 },
+    { 0x0000051808181ull, 3, 1 },
+    { 0x0000051810081ull, 3, 1 },
+    { 0x0000052808081ull, 1, 1 },
+    { 0x0000055404001ull, 4, 1 },
+    { 0x0000055404080ull, 3, 1 },
+    { 0x0000056800081ull, 4, 1 },
+    { 0x0000056800180ull, 4, 1 },
+    { 0x0000056804080ull, 3, 1 },
+    { 0x000005A800080ull, 4, 0 },
+    { 0x000005D200001ull, 4, -1 },
+    { 0x000005D200080ull, 2, 0 },
+    { 0x0000065204001ull, 1, 1 },
+    { 0x0000065204080ull, 0, 1 },
+    { 0x0000070470080ull, 4, 1 },
+    { 0x0000071A18080ull, 4, 1 },
+    { 0x0000071C00001ull, 3, 1 },
+    { 0x0000071C00080ull, 3, 1 },
+    { 0x0000071C2C000ull, 3, 1 },
+    { 0x0000073A08001ull, 3, 1 },
+    { 0x0000073A08080ull, 3, 1 },
+    { 0x0000076C00001ull, 4, 1 },
+    { 0x0000077800001ull, 3, 1 },
+    { 0x0000077800080ull, 3, 1 },
+    { 0x0000081A04082ull, 3, 1 },
+    { 0x0000081A04101ull, 3, 1 },
+    { 0x0000083A04001ull, 3, 1 },
+    { 0x0000083A04080ull, 3, 1 },
+    { 0x0000090050280ull, 4, 1 },
+    { 0x0000090058081ull, 2, 1 },
+    { 0x0000090058180ull, 6, 1 },
+    { 0x0000090408081ull, 3, 1 },
+    { 0x0000090408581ull, 3, 1 },
+    { 0x0000090C08083ull, 3, 1 },
+    { 0x0000090C08181ull, 1, 1 },
+    { 0x0000090C10081ull, 3, 1 },
+    { 0x0000091408081ull, 2, 1 },
+    { 0x0000091808081ull, 3, 1 },
+    { 0x0000096800080ull, 1, 1 },
+    { 0x00000B0018081ull, 2, 1 },
+    { 0x00000B0018180ull, 2, 1 },
+    { 0x00000B0018581ull, 3, 1 },
+    { 0x00000B0018980ull, 4, 1 },
+    { 0x00000B0028080ull, 2, 1 },
+    { 0x00000B0028580ull, 2, 1 },
+    { 0x00000B0038083ull, 2, 1 },
+    { 0x00000B0038181ull, 2, 1 },
+    { 0x00000B0038380ull, 2, 1 },
+    { 0x00000B0058081ull, 1, 1 },
+    { 0x00000B0058180ull, 5, 1 },
+    { 0x00000B0068081ull, 2, 1 },
+    { 0x00000B0068180ull, 4, 1 },
+    { 0x00000B00A8080ull, 2, 1 },
+    { 0x00000B0218080ull, 3, 1 },
+    { 0x00000B0218580ull, 3, 1 },
+    { 0x00000B0238081ull, 2, 1 },
+    { 0x00000B0238180ull, 2, 1 },
+    { 0x00000B0268080ull, 3, 1 },
+    { 0x00000B0400001ull, 3, 1 },
+    { 0x00000B0400080ull, 3, 1 },
+    { 0x00000B0A18081ull, 3, 1 },
+    { 0x00000B0A18180ull, 3, 1 },
+    { 0x00000B0A28080ull, 3, 1 },
+    { 0x00000B0C00003ull, 3, 1 },
+    { 0x00000B0C00081ull, 3, 1 },
+    { 0x00000B0C00180ull, 3, 1 },
+    { 0x00000B0C04001ull, 3, 1 },
+    { 0x00000B0C04080ull, 3, 1 },
+    { 0x00000B1218080ull, 3, 1 },
+    { 0x00000B1400001ull, 3, 1 },
+    { 0x00000B1400080ull, 3, 1 },
+    { 0x00000B1800001ull, 3, 1 },
+    { 0x00000B1800080ull, 3, 1 },
+    { 0x00000B1C00007ull, 3, 1 },
+    { 0x00000B1C00083ull, 3, 1 },
+    { 0x00000B1C00181ull, 3, 1 },
+    { 0x00000B1C00380ull, 3, 1 },
+    { 0x00000B1C04003ull, 3, 1 },
+    { 0x00000B1C04081ull, 3, 1 },
+    { 0x00000B1C04180ull, 3, 1 },
+    { 0x00000B1C0C001ull, 3, 1 },
+    { 0x00000B1C0C080ull, 3, 1 },
+    { 0x00000B2A08001ull, 3, 1 },
+    { 0x00000B2A08080ull, 3, 1 },
+    { 0x00000B2C00003ull, 3, 1 },
+    { 0x00000B2C00081ull, 3, 1 },
+    { 0x00000B2C00180ull, 3, 1 },
+    { 0x00000B2C04001ull, 3, 1 },
+    { 0x00000B2C04080ull, 3, 1 },
+    { 0x00000B3208001ull, 3, 1 },
+    { 0x00000B3208080ull, 3, 1 },
+    { 0x00000B3400003ull, 3, 1 },
+    { 0x00000B3400081ull, 3, 1 },
+    { 0x00000B3400180ull, 3, 1 },
+    { 0x00000B3404001ull, 3, 1 },
+    { 0x00000B3404080ull, 3, 1 },
+    { 0x00000B3800003ull, 3, 1 },
+    { 0x00000B3800081ull, 3, 1 },
+    { 0x00000B3800180ull, 3, 1 },
+    { 0x00000B3804001ull, 3, 1 },
+    { 0x00000B3804080ull, 3, 1 },
+    { 0x00000B4C00080ull, 3, 1 },
+    { 0x00000B5400001ull, 3, 1 },
+    { 0x00000B5400080ull, 3, 1 },
+    { 0x00000B5800001ull, 3, 1 },
+    { 0x00000B5800080ull, 3, 1 },
+    { 0x00000B6800001ull, 3, 1 },
+    { 0x00000B6800080ull, 3, 1 },
+    { 0x00000C3204001ull, 1, 1 },
+    { 0x00000C3204080ull, 0, 1 },
+    { 0x0000110C08081ull, 3, 1 },
+    { 0x0000130018080ull, 2, 1 },
+    { 0x0000130018580ull, 3, 1 },
+    { 0x0000130038081ull, 2, 1 },
+    { 0x0000130038180ull, 2, 1 },
+    { 0x0000130058080ull, 5, 1 },
+    { 0x0000130068080ull, 2, 1 },
+    { 0x0000130238080ull, 2, 1 },
+    { 0x0000130A18080ull, 3, 1 },
+    { 0x0000130C00001ull, 3, 1 },
+    { 0x0000130C00080ull, 3, 1 },
+    { 0x0000131C00003ull, 3, 1 },
+    { 0x0000131C00081ull, 3, 1 },
+    { 0x0000131C00180ull, 3, 1 },
+    { 0x0000131C04001ull, 3, 1 },
+    { 0x0000131C04080ull, 3, 1 },
+    { 0x0000132C00001ull, 3, 1 },
+    { 0x0000132C00080ull, 3, 1 },
+    { 0x0000133400001ull, 3, 1 },
+    { 0x0000133400080ull, 3, 1 },
+    { 0x0000133800001ull, 3, 1 },
+    { 0x0000133800080ull, 3, 1 },
+    { 0x0000171A08001ull, 3, 1 },
+    { 0x0000171A08080ull, 3, 1 },
+    { 0x0000173800001ull, 3, 1 },
+    { 0x0000173800080ull, 3, 1 },
+    { 0x0000230038080ull, 2, 1 },
+    { 0x0000231C00001ull, 3, 1 },
+    { 0x0000231C00080ull, 3, 1 },
+    { 0x0000800008080ull, 2, 1 },
+    { 0x0000800008580ull, 2, 1 },
+    { 0x0000800018081ull, 3, 1 },
+    { 0x0000800018180ull, 2, 1 },
+    { 0x0000800018581ull, 3, 1 },
+    { 0x0000800018980ull, 3, 1 },
+    { 0x0000800028080ull, 2, 1 },
+    { 0x0000800028580ull, 2, 1 },
+    { 0x0000800030080ull, 3, 1 },
+    { 0x0000800030580ull, 3, 1 },
+    { 0x0000800038181ull, 2, 1 },
+    { 0x0000800038380ull, 2, 1 },
+    { 0x0000800050280ull, 3, 1 },
+    { 0x0000800050681ull, 3, 1 },
+    { 0x0000800058180ull, 2, 1 },
+    { 0x0000800068081ull, 2, 1 },
+    { 0x0000800068180ull, 1, 1 },
+    { 0x0000800068581ull, 3, 1 },
+    { 0x0000800068980ull, 2, 1 },
+    { 0x0000800090680ull, 3, 1 },
+    { 0x00008000A8080ull, 2, 1 },
+    { 0x00008000A8580ull, 3, 1 },
+    { 0x00008000D0580ull, 3, 1 },
+    { 0x00008000D8181ull, 3, 1 },
+    { 0x00008000D8380ull, 1, 1 },
+    { 0x00008000E8083ull, 4, 1 },
+    { 0x00008000E8181ull, 1, 1 },
+    { 0x0000800158180ull, 3, 1 },
+    { 0x0000800168081ull, 4, 1 },
+    { 0x00008001A8081ull, 4, 1 },
+    { 0x00008001A8180ull, 1, 1 },
+    { 0x0000800218080ull, 3, 1 },
+    { 0x0000800218580ull, 3, 1 },
+    { 0x0000800238180ull, 2, 1 },
+    { 0x0000800268080ull, 3, 1 },
+    { 0x0000800268580ull, 3, 1 },
+    { 0x00008002D8180ull, 3, 1 },
+    { 0x00008002E8081ull, 3, 1 },
+    { 0x00008003A8080ull, 3, 1 },
+    { 0x0000800400001ull, 3, 1 },
+    { 0x0000800408081ull, 3, 1 },
+    { 0x0000800408581ull, 3, 1 },
+    { 0x0000800418083ull, 3, 1 },
+    { 0x0000800418181ull, 2, 1 },
+    { 0x0000800418583ull, 3, 1 },
+    { 0x0000800418981ull, 3, 1 },
+    { 0x0000800419180ull, 3, 1 },
+    { 0x0000800428081ull, 3, 1 },
+    { 0x0000800428581ull, 3, 1 },
+    { 0x0000800428980ull, 3, 1 },
+    { 0x0000800430081ull, 3, 1 },
+    { 0x0000800430180ull, 3, 1 },
+    { 0x0000800430581ull, 3, 1 },
+    { 0x0000800430980ull, 3, 1 },
+    { 0x0000800430B80ull, 3, 1 },
+    { 0x0000800438183ull, 2, 1 },
+    { 0x0000800438381ull, 2, 1 },
+    { 0x0000800450080ull, 3, 1 },
+    { 0x0000800450281ull, 3, 1 },
+    { 0x0000800450480ull, 3, 1 },
+    { 0x0000800450580ull, 3, 1 },
+    { 0x0000800458181ull, 3, 1 },
+    { 0x0000800490280ull, 3, 1 },
+    { 0x0000800818081ull, 3, 1 },
+    { 0x0000800818581ull, 3, 1 },
+    { 0x0000800818980ull, 2, 1 },
+    { 0x0000800830080ull, 2, 1 },
+    { 0x0000800830580ull, 2, 1 },
+    { 0x0000800838181ull, 2, 1 },
+    { 0x0000800850280ull, 3, 1 },
+    { 0x0000800870081ull, 3, 1 },
+    { 0x0000800870180ull, 3, 1 },
+    { 0x00008008B0080ull, 2, 1 },
+    { 0x0000800A08080ull, 3, 1 },
+    { 0x0000800A08580ull, 3, 1 },
+    { 0x0000800A18081ull, 3, 1 },
+    { 0x0000800A18180ull, 3, 1 },
+    { 0x0000800A18581ull, 3, 1 },
+    { 0x0000800A18980ull, 3, 1 },
+    { 0x0000800A28080ull, 3, 1 },
+    { 0x0000800A28580ull, 2, 1 },
+    { 0x0000800A30080ull, 3, 1 },
+    { 0x0000800A30580ull, 3, 1 },
+    { 0x0000800A50280ull, 3, 1 },
+    { 0x0000800A68081ull, 3, 1 },
+    { 0x0000800A68180ull, 1, 1 },
+    { 0x0000800AA8080ull, 3, 1 },
+    { 0x0000800C00003ull, 3, 1 },
+    { 0x0000800C00017ull, 3, 1 },
+    { 0x0000800C00081ull, 3, 1 },
+    { 0x0000800C04001ull, 3, 1 },
+    { 0x0000800C04080ull, 3, 1 },
+    { 0x0000800C08083ull, 3, 1 },
+    { 0x0000800C08097ull, 3, 1 },
+    { 0x0000800C08181ull, 3, 1 },
+    { 0x0000800C08583ull, 3, 1 },
+    { 0x0000800C08981ull, 3, 1 },
+    { 0x0000800C10081ull, 3, 1 },
+    { 0x0000800C10581ull, 3, 1 },
+    { 0x0000800C18087ull, 0, 1 },
+    { 0x0000800C18183ull, 3, 1 },
+    { 0x0000800C28083ull, 3, 1 },
+    { 0x0000800C28181ull, 1, 1 },
+    { 0x0000800C2C001ull, 3, 1 },
+    { 0x0000800C2C080ull, 3, 1 },
+    { 0x0000800C30083ull, 3, 1 },
+    { 0x0000800C30181ull, 3, 1 },
+    { 0x0000800C30380ull, 1, 1 },
+    { 0x0000800C48081ull, 3, 1 },
+    { 0x0000800C50081ull, 3, 1 },
+    { 0x0000800C50180ull, 3, 1 },
+    { 0x0000800C90080ull, 3, 1 },
+    { 0x0000801070080ull, 3, 1 },
+    { 0x0000801218080ull, 3, 1 },
+    { 0x0000801218580ull, 3, 1 },
+    { 0x0000801268080ull, 3, 1 },
+    { 0x0000801400001ull, 3, 1 },
+    { 0x0000801408081ull, 3, 1 },
+    { 0x0000801408581ull, 3, 1 },
+    { 0x0000801418083ull, 2, 1 },
+    { 0x0000801428081ull, 3, 1 },
+    { 0x0000801430081ull, 3, 1 },
+    { 0x0000801430180ull, 3, 1 },
+    { 0x0000801450080ull, 3, 1 },
+    { 0x0000801800001ull, 3, 1 },
+    { 0x0000801808081ull, 3, 1 },
+    { 0x0000801818083ull, 3, 1 },
+    { 0x0000801818181ull, 3, 1 },
+    { 0x0000801828081ull, 3, 1 },
+    { 0x0000801830180ull, 3, 1 },
+    { 0x0000801A00001ull, 3, 1 },
+    { 0x0000801A04101ull, 4, 1 },
+    { 0x0000801A08081ull, 3, 1 },
+    { 0x0000801A08180ull, 3, 1 },
+    { 0x0000801A08581ull, 3, 1 },
+    { 0x0000801A08980ull, 3, 1 },
+    { 0x0000801A08B80ull, 3, 1 },
+    { 0x0000801A10080ull, 3, 1 },
+    { 0x0000801A10580ull, 3, 1 },
+    { 0x0000801A18083ull, 3, 1 },
+    { 0x0000801A18181ull, 3, 1 },
+    { 0x0000801A18380ull, 1, 1 },
+    { 0x0000801A28081ull, 3, 1 },
+    { 0x0000801A28180ull, 3, 1 },
+    { 0x0000801A30081ull, 3, 1 },
+    { 0x0000801A30180ull, 3, 1 },
+    { 0x0000801A48080ull, 3, 1 },
+    { 0x0000801A50080ull, 3, 1 },
+    { 0x0000801C00007ull, 3, 1 },
+    { 0x0000801C00027ull, 3, 1 },
+    { 0x0000801C00083ull, 3, 1 },
+    { 0x0000801C00097ull, 3, 1 },
+    { 0x0000801C00181ull, 3, 1 },
+    { 0x0000801C04003ull, 3, 1 },
+    { 0x0000801C04017ull, 3, 1 },
+    { 0x0000801C04081ull, 3, 1 },
+    { 0x0000801C04180ull, 3, 1 },
+    { 0x0000801C08087ull, 3, 1 },
+    { 0x0000801C08183ull, 3, 1 },
+    { 0x0000801C08381ull, 3, 1 },
+    { 0x0000801C0C001ull, 3, 1 },
+    { 0x0000801C0C080ull, 3, 1 },
+    { 0x0000801C10083ull, 3, 1 },
+    { 0x0000801C10181ull, 3, 1 },
+    { 0x0000801C20081ull, 3, 1 },
+    { 0x0000801C2C003ull, 3, 1 },
+    { 0x0000801C2C081ull, 3, 1 },
+    { 0x0000801C2C180ull, 3, 1 },
+    { 0x0000801C4C001ull, 3, 1 },
+    { 0x0000801C4C080ull, 3, 1 },
+    { 0x0000802808281ull, 5, 1 },
+    { 0x0000802818081ull, 2, 1 },
+    { 0x0000802A08001ull, 2, 1 },
+    { 0x0000802A08080ull, 3, 1 },
+    { 0x0000802A08580ull, 3, 1 },
+    { 0x0000802A18003ull, 2, 1 },
+    { 0x0000802A18081ull, 3, 1 },
+    { 0x0000802A18180ull, 2, 1 },
+    { 0x0000802A28001ull, 4, 1 },
+    { 0x0000802A28080ull, 1, 1 },
+    { 0x0000802A30080ull, 3, 1 },
+    { 0x0000802C00003ull, 3, 1 },
+    { 0x0000802C00017ull, 3, 1 },
+    { 0x0000802C00081ull, 3, 1 },
+    { 0x0000802C04001ull, 3, 1 },
+    { 0x0000802C04080ull, 3, 1 },
+    { 0x0000802C08083ull, 3, 1 },
+    { 0x0000802C08181ull, 3, 1 },
+    { 0x0000802C10081ull, 2, 1 },
+    { 0x0000802C2C001ull, 3, 1 },
+    { 0x0000802C2C080ull, 3, 1 },
+    { 0x0000803208080ull, 3, 1 },
+    { 0x0000803208580ull, 3, 1 },
+    { 0x0000803218081ull, 3, 1 },
+    { 0x0000803218180ull, 1, 1 },
+    { 0x0000803228080ull, 2, 1 },
+    { 0x0000803230080ull, 3, 1 },
+    { 0x0000803400003ull, 3, 1 },
+    { 0x0000803400017ull, 3, 1 },
+    { 0x0000803400081ull, 3, 1 },
+    { 0x0000803404001ull, 3, 1 },
+    { 0x0000803404080ull, 3, 1 },
+    { 0x0000803404580ull, 3, 1 },
+    { 0x0000803408083ull, 3, 1 },
+    { 0x0000803408181ull, 1, 1 },
+    { 0x0000803410081ull, 2, 1 },
+    { 0x000080342C001ull, 3, 1 },
+    { 0x000080342C080ull, 3, 1 },
+    { 0x0000803800003ull, 3, 1 },
+    { 0x0000803800017ull, 3, 1 },
+    { 0x0000803800081ull, 3, 1 },
+    { 0x0000803804001ull, 3, 1 },
+    { 0x0000803804080ull, 3, 1 },
+    { 0x0000803808083ull, 3, 1 },
+    { 0x0000803808181ull, 3, 1 },
+    { 0x0000803810081ull, 3, 1 },
+    { 0x000080382C001ull, 3, 1 },
+    { 0x000080382C080ull, 3, 1 },
+    { 0x0000803A00003ull, 3, 1 },
+    { 0x0000803A00081ull, 3, 1 },
+    { 0x0000803A04001ull, 3, 1 },
+    { 0x0000803A04103ull, 3, 1 },
+    { 0x0000803A04201ull, 3, 1 },
+    { 0x0000803A08083ull, 3, 1 },
+    { 0x0000803A08181ull, 3, 1 },
+    { 0x0000803A08380ull, 3, 1 },
+    { 0x0000803A0C101ull, 3, 1 },
+    { 0x0000803A10081ull, 3, 1 },
+    { 0x0000803A10180ull, 3, 1 },
+    { 0x0000803A20080ull, 3, 1 },
+    { 0x0000804A18001ull, 3, 1 },
+    { 0x0000805218080ull, 2, 1 },
+    { 0x0000805400001ull, 3, 1 },
+    { 0x0000805408081ull, 2, 1 },
+    { 0x0000805414001ull, 3, 1 },
+    { 0x0000805800001ull, 3, 1 },
+    { 0x0000805808081ull, 3, 1 },
+    { 0x0000805A00001ull, 2, 1 },
+    { 0x0000805A08003ull, 3, 1 },
+    { 0x0000805A08081ull, 3, 1 },
+    { 0x0000805A08180ull, 3, 1 },
+    { 0x0000805A10001ull, 3, 1 },
+    { 0x0000805A10080ull, 3, 1 },
+    { 0x0000806800001ull, 5, 1 },
+    { 0x0000806800281ull, 1, 1 },
+    { 0x0000806804280ull, 5, 1 },
+    { 0x0000806814001ull, 3, 1 },
+    { 0x0000806814080ull, 2, 0 },
+    { 0x0000806A04101ull, 4, 1 },
+    { 0x0000806A08003ull, 3, 1 },
+    { 0x0000806A08081ull, 3, 1 },
+    { 0x0000806A08180ull, 3, 1 },
+    { 0x0000806A10001ull, 3, 1 },
+    { 0x0000806A10080ull, 3, 1 },
+    { 0x0000806C00007ull, 0, 1 },
+    { 0x0000806C00083ull, 3, 1 },
+    { 0x0000806C00181ull, 3, 1 },
+    { 0x0000806C04003ull, 3, 1 },
+    { 0x0000806C04081ull, 3, 1 },
+    { 0x0000806C04180ull, 3, 1 },
+    { 0x0000806C0C001ull, 2, 1 },
+    { 0x0000806C0C080ull, 3, 1 },
+    { 0x0000807200001ull, 2, 1 },
+    { 0x0000807204101ull, 4, 1 },
+    { 0x0000807208003ull, 0, 1 },
+    { 0x0000807208081ull, 3, 1 },
+    { 0x0000807208180ull, 1, 1 },
+    { 0x0000807210001ull, 2, 1 },
+    { 0x0000807210080ull, 2, 1 },
+    { 0x0000807400007ull, 0, 1 },
+    { 0x0000807400083ull, 3, 1 },
+    { 0x0000807400181ull, 1, 1 },
+    { 0x0000807404003ull, 3, 1 },
+    { 0x0000807404081ull, 3, 1 },
+    { 0x0000807404180ull, 2, 1 },
+    { 0x000080740C001ull, 2, 1 },
+    { 0x000080740C080ull, 2, 1 },
+    { 0x0000807800007ull, 3, 1 },
+    { 0x0000807800083ull, 3, 1 },
+    { 0x0000807800181ull, 3, 1 },
+    { 0x0000807804003ull, 3, 1 },
+    { 0x0000807804081ull, 3, 1 },
+    { 0x0000807804180ull, 3, 1 },
+    { 0x000080780C001ull, 3, 1 },
+    { 0x000080780C080ull, 3, 1 },
+    { 0x0000809A08001ull, 2, 1 },
+    { 0x000080AA08080ull, 2, 1 },
+    { 0x000080AC00003ull, 2, 1 },
+    { 0x000080AC00081ull, 2, 1 },
+    { 0x000080AC04001ull, 2, 1 },
+    { 0x000080AC04080ull, 2, 1 },
+    { 0x000080B208001ull, 2, 1 },
+    { 0x000080B208080ull, 2, 1 },
+    { 0x000080B400003ull, 2, 1 },
+    { 0x000080B400081ull, 2, 1 },
+    { 0x000080B404001ull, 2, 1 },
+    { 0x000080B404080ull, 2, 1 },
+    { 0x000080B800003ull, 2, 1 },
+    { 0x000080B800081ull, 2, 1 },
+    { 0x000080B804001ull, 2, 1 },
+    { 0x000080B804080ull, 2, 1 },
+    { 0x000080CA08001ull, 2, 1 },
+    { 0x000080D200101ull, 4, 1 },
+    { 0x000080D208080ull, 1, 0 },
+    { 0x000080D400003ull, 0, 1 },
+    { 0x000080D400081ull, 4, 1 },
+    { 0x000080D404001ull, 2, 1 },
+    { 0x000080D404080ull, 2, 1 },
+    { 0x000080D800003ull, 2, 1 },
+    { 0x000080D800081ull, 2, 1 },
+    { 0x000080D804001ull, 2, 1 },
+    { 0x000080D804080ull, 2, 1 },
+    { 0x000080DA00003ull, 2, 1 },
+    { 0x000080E800003ull, 5, 1 },
+    { 0x000080E804001ull, 2, 1 },
+    { 0x0000810018080ull, 2, 1 },
+    { 0x0000810018580ull, 2, 1 },
+    { 0x0000810038081ull, 2, 1 },
+    { 0x0000810038180ull, 2, 1 },
+    { 0x0000810038581ull, 2, 1 },
+    { 0x0000810038980ull, 2, 1 },
+    { 0x0000810058080ull, 4, 1 },
+    { 0x0000810058580ull, 4, 1 },
+    { 0x0000810068080ull, 6, 1 },
+    { 0x0000810068580ull, 3, 1 },
+    { 0x0000810070080ull, 3, 1 },
+    { 0x0000810070580ull, 3, 1 },
+    { 0x00008100D8180ull, 4, 1 },
+    { 0x00008100E8081ull, 6, 1 },
+    { 0x00008101A8080ull, 6, 1 },
+    { 0x0000810238080ull, 2, 1 },
+    { 0x0000810238580ull, 2, 1 },
+    { 0x0000810418081ull, 3, 1 },
+    { 0x0000810418581ull, 3, 1 },
+    { 0x0000810418980ull, 3, 1 },
+    { 0x0000810430080ull, 3, 1 },
+    { 0x0000810430580ull, 3, 1 },
+    { 0x0000810438181ull, 2, 1 },
+    { 0x0000810450280ull, 4, 1 },
+    { 0x0000810470081ull, 3, 1 },
+    { 0x0000810470180ull, 3, 1 },
+    { 0x00008104B0080ull, 3, 1 },
+    { 0x0000810870080ull, 2, 1 },
+    { 0x0000810A18080ull, 6, 1 },
+    { 0x0000810A18580ull, 6, 1 },
+    { 0x0000810A68080ull, 6, 1 },
+    { 0x0000810A70080ull, 6, 1 },
+    { 0x0000810C00001ull, 3, 1 },
+    { 0x0000810C08081ull, 3, 1 },
+    { 0x0000810C08581ull, 3, 1 },
+    { 0x0000810C18083ull, 3, 1 },
+    { 0x0000810C18181ull, 3, 1 },
+    { 0x0000810C28081ull, 3, 1 },
+    { 0x0000810C30081ull, 3, 1 },
+    { 0x0000810C30180ull, 3, 1 },
+    { 0x0000810C50080ull, 3, 1 },
+    { 0x0000811418081ull, 3, 1 },
+    { 0x0000811430080ull, 3, 1 },
+    { 0x0000811818081ull, 3, 1 },
+    { 0x0000811A08001ull, 6, 1 },
+    { 0x0000811A08080ull, 6, 1 },
+    { 0x0000811A08580ull, 6, 1 },
+    { 0x0000811A18081ull, 6, 1 },
+    { 0x0000811A18180ull, 6, 1 },
+    { 0x0000811A28080ull, 6, 1 },
+    { 0x0000811A30080ull, 6, 1 },
+    { 0x0000811C00003ull, 3, 1 },
+    { 0x0000811C00017ull, 3, 1 },
+    { 0x0000811C00081ull, 3, 1 },
+    { 0x0000811C00180ull, 3, 1 },
+    { 0x0000811C04001ull, 3, 1 },
+    { 0x0000811C04080ull, 3, 1 },
+    { 0x0000811C08083ull, 3, 1 },
+    { 0x0000811C08181ull, 3, 1 },
+    { 0x0000811C10081ull, 3, 1 },
+    { 0x0000811C2C001ull, 3, 1 },
+    { 0x0000811C2C080ull, 3, 1 },
+    { 0x0000812A18001ull, 6, 1 },
+    { 0x0000812C00001ull, 3, 1 },
+    { 0x0000812C08081ull, 3, 1 },
+    { 0x0000813218080ull, 6, 1 },
+    { 0x0000813400001ull, 3, 1 },
+    { 0x0000813400580ull, 3, 1 },
+    { 0x0000813408081ull, 3, 1 },
+    { 0x0000813800001ull, 3, 1 },
+    { 0x0000813808081ull, 3, 1 },
+    { 0x0000813A00001ull, 3, 1 },
+    { 0x0000813A08003ull, 3, 1 },
+    { 0x0000813A08081ull, 3, 1 },
+    { 0x0000813A08180ull, 3, 1 },
+    { 0x0000813A10001ull, 3, 1 },
+    { 0x0000813A10080ull, 3, 1 },
+    { 0x0000815A08001ull, 6, 1 },
+    { 0x0000816A08001ull, 6, 1 },
+    { 0x0000816A08080ull, 6, 1 },
+    { 0x0000816C00003ull, 3, 1 },
+    { 0x0000816C00081ull, 3, 1 },
+    { 0x0000816C00180ull, 3, 1 },
+    { 0x0000816C04001ull, 3, 1 },
+    { 0x0000816C04080ull, 3, 1 },
+    { 0x0000817208001ull, 6, 1 },
+    { 0x0000817208080ull, 6, 1 },
+    { 0x0000817400003ull, 3, 1 },
+    { 0x0000817400081ull, 3, 1 },
+    { 0x0000817400180ull, 4, 1 },
+    { 0x0000817404001ull, 3, 1 },
+    { 0x0000817404080ull, 3, 1 },
+    { 0x0000817800003ull, 3, 1 },
+    { 0x0000817800081ull, 3, 1 },
+    { 0x0000817800180ull, 3, 1 },
+    { 0x0000817804001ull, 3, 1 },
+    { 0x0000817804080ull, 3, 1 },
+    { 0x000081A800100ull, 5, 1 },
+    { 0x000081AC00001ull, 2, 1 },
+    { 0x000081B400001ull, 2, 1 },
+    { 0x000081B800001ull, 2, 1 },
+    { 0x000081D400001ull, 4, 1 },
+    { 0x000081D800001ull, 2, 1 },
+    { 0x000081E800001ull, 4, 1 },
+    { 0x0000820000001ull, 4, 1 },
+    { 0x0000820A00001ull, 3, 1 },
+    { 0x0000820A04082ull, 3, 1 },
+    { 0x0000820A04101ull, 3, 1 },
+    { 0x0000821A00003ull, 3, 1 },
+    { 0x0000821A00081ull, 2, 1 },
+    { 0x0000821A00180ull, 3, 1 },
+    { 0x0000821A04001ull, 1, 1 },
+    { 0x0000821A04084ull, 3, 1 },
+    { 0x0000821A04103ull, 3, 1 },
+    { 0x0000821A04182ull, 3, 1 },
+    { 0x0000821A04201ull, 3, 1 },
+    { 0x0000821A08083ull, 3, 1 },
+    { 0x0000821A08181ull, 3, 1 },
+    { 0x0000821A0C082ull, 3, 1 },
+    { 0x0000821A0C101ull, 3, 1 },
+    { 0x0000821A10081ull, 3, 1 },
+    { 0x0000822A00001ull, 3, 1 },
+    { 0x0000822A04082ull, 3, 1 },
+    { 0x0000822A04101ull, 3, 1 },
+    { 0x0000822A08081ull, 3, 1 },
+    { 0x0000822C00181ull, 3, 1 },
+    { 0x0000823200001ull, 3, 1 },
+    { 0x0000823204082ull, 3, 1 },
+    { 0x0000823204101ull, 3, 1 },
+    { 0x0000823400181ull, 1, 1 },
+    { 0x0000823A00007ull, 3, 1 },
+    { 0x0000823A00083ull, 3, 1 },
+    { 0x0000823A00181ull, 3, 1 },
+    { 0x0000823A00380ull, 3, 1 },
+    { 0x0000823A04003ull, 3, 1 },
+    { 0x0000823A04180ull, 3, 1 },
+    { 0x0000823A0C001ull, 3, 1 },
+    { 0x0000823A0C080ull, 3, 1 },
+    { 0x0000825400003ull, 4, 1 },
+    { 0x0000825A00003ull, 3, 1 },
+    { 0x0000825A00180ull, 3, 1 },
+    { 0x0000826A00003ull, 3, 1 },
+    { 0x0000826A00081ull, 2, 1 },
+    { 0x0000826A00180ull, 3, 1 },
+    { 0x0000826A04001ull, 1, 1 },
+    { 0x0000827200003ull, 4, 1 },
+    { 0x0000827200081ull, 2, 1 },
+    { 0x0000827200180ull, 5, 1 },
+    { 0x0000827204001ull, 1, 1 },
+    { 0x000082AA00001ull, 4, 1 },
+    { 0x000082B200001ull, 4, 1 },
+    { 0x000082D200001ull, 1, 1 },
+    { 0x0000830038080ull, 2, 1 },
+    { 0x0000830038580ull, 2, 1 },
+    { 0x0000830470080ull, 3, 1 },
+    { 0x0000830C18081ull, 3, 1 },
+    { 0x0000830C30080ull, 3, 1 },
+    { 0x0000831A18080ull, 6, 1 },
+    { 0x0000831C00001ull, 3, 1 },
+    { 0x0000831C08081ull, 3, 1 },
+    { 0x0000833A08001ull, 3, 1 },
+    { 0x0000836C00001ull, 3, 1 },
+    { 0x0000837400001ull, 4, 1 },
+    { 0x0000837800001ull, 3, 1 },
+    { 0x0000841A00001ull, 3, 1 },
+    { 0x0000841A04082ull, 3, 1 },
+    { 0x0000841A04101ull, 3, 1 },
+    { 0x0000841A08081ull, 3, 1 },
+    { 0x0000843A00003ull, 3, 1 },
+    { 0x0000843A00081ull, 3, 1 },
+    { 0x0000843A00180ull, 3, 1 },
+    { 0x0000843A04001ull, 3, 1 },
+    { 0x0000845A00001ull, 3, 1 },
+    { 0x0000846A00001ull, 3, 1 },
+    { 0x0000847200001ull, 4, 1 },
+    { 0x0000850050280ull, 3, 1 },
+    { 0x0000850058081ull, 3, 1 },
+    { 0x0000850058180ull, 3, 1 },
+    { 0x0000850098080ull, 3, 1 },
+    { 0x0000850258080ull, 6, 1 },
+    { 0x0000850408081ull, 3, 1 },
+    { 0x0000850408581ull, 3, 1 },
+    { 0x0000850C08083ull, 3, 1 },
+    { 0x0000850C08181ull, 3, 1 },
+    { 0x0000850C10081ull, 3, 1 },
+    { 0x0000851408081ull, 3, 1 },
+    { 0x0000851808081ull, 3, 1 },
+    { 0x0000860000003ull, 3, 1 },
+    { 0x0000860000081ull, 3, 1 },
+    { 0x0000860000180ull, 4, 1 },
+    { 0x0000860004001ull, 4, 1 },
+    { 0x000086002C001ull, 4, 1 },
+    { 0x000086002C080ull, 3, 1 },
+    { 0x0000860200001ull, 3, 1 },
+    { 0x0000860400007ull, 0, 1 },
+    { 0x0000860400027ull, 3, 1 },
+    { 0x0000860400083ull, 3, 1 },
+    { 0x0000860400097ull, 3, 1 },
+    { 0x0000860400181ull, 3, 1 },
+    { 0x0000860404003ull, 3, 1 },
+    { 0x0000860404017ull, 3, 1 },
+    { 0x0000860404081ull, 3, 1 },
+    { 0x000086042C081ull, 3, 1 },
+    { 0x000086042C180ull, 3, 1 },
+    { 0x000086044C080ull, 3, 1 },
+    { 0x0000860800003ull, 3, 1 },
+    { 0x0000860800017ull, 3, 1 },
+    { 0x0000860800081ull, 3, 1 },
+    { 0x000086082C080ull, 3, 1 },
+    { 0x0000860A00003ull, 3, 1 },
+    { 0x0000860A00081ull, 2, 1 },
+    { 0x0000860A00180ull, 3, 1 },
+    { 0x0000860A04001ull, 1, 1 },
+    { 0x0000860A04084ull, 3, 1 },
+    { 0x0000860A04103ull, 3, 1 },
+    { 0x0000860A04182ull, 3, 1 },
+    { 0x0000860A04201ull, 3, 1 },
+    { 0x0000860A08083ull, 3, 1 },
+    { 0x0000860A08181ull, 3, 1 },
+    { 0x0000860A0C082ull, 3, 1 },
+    { 0x0000860A0C101ull, 3, 1 },
+    { 0x0000860A10081ull, 3, 1 },
+    { 0x0000860A2C001ull, 1, 1 },
+    { 0x0000860A2C080ull, 0, 1 },
+    { 0x0000860C00087ull, 0, 1 },
+    { 0x0000860C00183ull, 3, 1 },
+    { 0x0000860C00381ull, 1, 1 },
+    { 0x0000860C04007ull, 0, 1 },
+    { 0x0000860C04083ull, 3, 1 },
+    { 0x0000860C04181ull, 3, 1 },
+    { 0x0000860C0C003ull, 3, 1 },
+    { 0x0000860C0C081ull, 3, 1 },
+    { 0x0000861200001ull, 3, 1 },
+    { 0x0000861204082ull, 3, 1 },
+    { 0x0000861204101ull, 3, 1 },
+    { 0x0000861208081ull, 3, 1 },
+    { 0x0000861400083ull, 3, 1 },
+    { 0x0000861400181ull, 4, 1 },
+    { 0x0000861404003ull, 3, 1 },
+    { 0x0000861404081ull, 3, 1 },
+    { 0x0000861800007ull, 0, 1 },
+    { 0x0000861800083ull, 3, 1 },
+    { 0x0000861800181ull, 3, 1 },
+    { 0x0000861804003ull, 3, 1 },
+    { 0x0000861804081ull, 3, 1 },
+    { 0x0000861A00007ull, 0, 1 },
+    { 0x0000861A00083ull, 2, 1 },
+    { 0x0000861A00181ull, 2, 1 },
+    { 0x0000861A00380ull, 1, 1 },
+    { 0x0000861A04003ull, 1, 1 },
+    { 0x0000861A04180ull, 0, 1 },
+    { 0x0000861A0C001ull, 1, 1 },
+    { 0x0000862800003ull, 3, 1 },
+    { 0x0000862800081ull, 4, 1 },
+    { 0x0000862A00003ull, 3, 1 },
+    { 0x0000862A00180ull, 3, 1 },
+    { 0x0000863200003ull, 3, 1 },
+    { 0x0000863200081ull, 2, 1 },
+    { 0x0000863200180ull, 4, 1 },
+    { 0x0000863204001ull, 1, 1 },
+    { 0x0000865200001ull, 4, 1 },
+    { 0x0000883A00001ull, 3, 1 },
+    { 0x0000890058080ull, 3, 1 },
+    { 0x0000890C08081ull, 3, 1 },
+    { 0x00008A0000001ull, 4, 1 },
+    { 0x00008A0400003ull, 3, 1 },
+    { 0x00008A0400017ull, 3, 1 },
+    { 0x00008A0400081ull, 3, 1 },
+    { 0x00008A042C080ull, 3, 1 },
+    { 0x00008A0A00001ull, 3, 1 },
+    { 0x00008A0A04082ull, 3, 1 },
+    { 0x00008A0A04101ull, 3, 1 },
+    { 0x00008A0A08081ull, 3, 1 },
+    { 0x00008A0C00007ull, 0, 1 },
+    { 0x00008A0C00083ull, 3, 1 },
+    { 0x00008A0C00181ull, 3, 1 },
+    { 0x00008A0C04003ull, 3, 1 },
+    { 0x00008A0C04081ull, 3, 1 },
+    { 0x00008A1400003ull, 3, 1 },
+    { 0x00008A1400081ull, 3, 1 },
+    { 0x00008A1800003ull, 3, 1 },
+    { 0x00008A1800081ull, 3, 1 },
+    { 0x00008A1A00003ull, 3, 1 },
+    { 0x00008A1A00081ull, 2, 1 },
+    { 0x00008A1A00180ull, 3, 1 },
+    { 0x00008A1A04001ull, 1, 1 },
+    { 0x00008A2A00001ull, 5, 1 },
+    { 0x00008A3200001ull, 3, 1 },
+    { 0x00008B0018580ull, 2, 1 },
+    { 0x00008B0038081ull, 2, 1 },
+    { 0x00008B0038180ull, 2, 1 },
+    { 0x00008B0068080ull, 3, 1 },
+    { 0x00008B0418081ull, 3, 1 },
+    { 0x00008B0418180ull, 4, 1 },
+    { 0x00008B0C00001ull, 3, 1 },
+    { 0x00008B1C00003ull, 3, 1 },
+    { 0x00008B1C00081ull, 3, 1 },
+    { 0x00008B1C00180ull, 3, 1 },
+    { 0x00008B1C04001ull, 3, 1 },
+    { 0x00008B2C00001ull, 3, 1 },
+    { 0x00008B3400001ull, 3, 1 },
+    { 0x00008B3800001ull, 3, 1 },
+    { 0x00008C0000001ull, 3, 1 },
+    { 0x00008C0400003ull, 4, 1 },
+    { 0x00008C0400081ull, 3, 1 },
+    { 0x00008C0400180ull, 4, 1 },
+    { 0x00008C0404001ull, 3, 1 },
+    { 0x00008C0800001ull, 3, 1 },
+    { 0x00008C0A00001ull, 3, 1 },
+    { 0x00008C0C00083ull, 3, 1 },
+    { 0x00008C0C00181ull, 3, 1 },
+    { 0x00008C0C04003ull, 3, 1 },
+    { 0x00008C0C04081ull, 3, 1 },
+    { 0x00008C0C04180ull, 3, 1 },
+    { 0x00008C0C0C001ull, 3, 1 },
+    { 0x00008C1400081ull, 3, 1 },
+    { 0x00008C1404001ull, 3, 1 },
+    { 0x00008C1800003ull, 3, 1 },
+    { 0x00008C1800081ull, 3, 1 },
+    { 0x00008C1804001ull, 3, 1 },
+    { 0x00008C1A00003ull, 3, 1 },
+    { 0x00008C1A00081ull, 2, 1 },
+    { 0x00008C1A00180ull, 3, 1 },
+    { 0x00008C1A04001ull, 1, 1 },
+    { 0x00008C2800001ull, 3, 1 },
+    { 0x00008C2A00001ull, 3, 1 },
+    { 0x00008C3200001ull, 3, 1 },
+    { 0x00008E0000181ull, 4, 1 },
+    { 0x00008E0000380ull, 4, 1 },
+    { 0x00008E0004003ull, 4, 1 },
+    { 0x00008E0004081ull, 4, 1 },
+    { 0x00008E0004180ull, 4, 1 },
+    { 0x00008E000C001ull, 4, 1 },
+    { 0x00008E002C003ull, 4, 1 },
+    { 0x00008E002C081ull, 4, 1 },
+    { 0x00008E004C001ull, 4, 1 },
+    { 0x00008E004C080ull, 4, 1 },
+    { 0x00008E0200180ull, 4, 1 },
+    { 0x00008E0204001ull, 4, 1 },
+    { 0x00008E022C001ull, 4, 1 },
+    { 0x0000920C00003ull, 3, 1 },
+    { 0x0000920C00081ull, 3, 1 },
+    { 0x0000921A00001ull, 3, 1 },
+    { 0x0000931C00001ull, 3, 1 },
+    { 0x0000940400001ull, 3, 1 },
+    { 0x0000940C00003ull, 3, 1 },
+    { 0x0000940C00081ull, 3, 1 },
+    { 0x0000940C00180ull, 3, 1 },
+    { 0x0000940C04001ull, 3, 1 },
+    { 0x0000941400001ull, 3, 1 },
+    { 0x0000941800001ull, 3, 1 },
+    { 0x0000941A00001ull, 3, 1 },
+    { 0x0000960000180ull, 1, 1 },
+    { 0x0000960000581ull, 3, 1 },
+    { 0x0000960000980ull, 3, 1 },
+    { 0x0000960004001ull, 2, 1 },
+    { 0x0000960004580ull, 2, 1 },
+    { 0x0000960014003ull, 3, 1 },
+    { 0x0000960014081ull, 3, 1 },
+    { 0x0000960014180ull, 3, 1 },
+    { 0x0000960024001ull, 3, 1 },
+    { 0x000096002C001ull, 1, 1 },
+    { 0x0000960200580ull, 3, 1 },
+    { 0x0000960214001ull, 1, 1 },
+    { 0x00009A0000003ull, 3, 1 },
+    { 0x00009A0000081ull, 2, 1 },
+    { 0x00009A0000180ull, 5, 1 },
+    { 0x00009A0004001ull, 1, 1 },
+    { 0x00009A0004084ull, 4, 1 },
+    { 0x00009A0004103ull, 4, 1 },
+    { 0x00009A0004182ull, 2, 1 },
+    { 0x00009A0004201ull, 2, 1 },
+    { 0x00009A0008083ull, 4, 1 },
+    { 0x00009A0008181ull, 2, 1 },
+    { 0x00009A000C082ull, 2, 1 },
+    { 0x00009A000C101ull, 2, 1 },
+    { 0x00009A0010081ull, 2, 1 },
+    { 0x00009A002C001ull, 4, 1 },
+    { 0x00009A0200001ull, 3, 1 },
+    { 0x00009A0204082ull, 3, 1 },
+    { 0x00009A0204101ull, 3, 1 },
+    { 0x00009A0208081ull, 3, 1 },
+    { 0x00009A0400007ull, 0, 1 },
+    { 0x00009A0400083ull, 3, 1 },
+    { 0x00009A0404003ull, 3, 1 },
+    { 0x00009A0800003ull, 3, 1 },
+    { 0x00009A0A00003ull, 3, 1 },
+    { 0x00009A0A00081ull, 2, 1 },
+    { 0x00009A0A00180ull, 3, 1 },
+    { 0x00009A0A04001ull, 1, 1 },
+    { 0x00009A1200001ull, 3, 1 },
+    { 0x00009C0004001ull, 3, 1 },
+    { 0x00009C0400007ull, 0, 1 },
+    { 0x00009C0400083ull, 3, 1 },
+    { 0x00009C0400181ull, 3, 1 },
+    { 0x00009C0400380ull, 1, 1 },
+    { 0x00009C0404003ull, 4, 1 },
+    { 0x00009C0404081ull, 3, 1 },
+    { 0x00009C0404180ull, 3, 1 },
+    { 0x00009C040C001ull, 3, 1 },
+    { 0x00009C0800003ull, 3, 1 },
+    { 0x00009C0800081ull, 4, 1 },
+    { 0x00009C0800180ull, 4, 1 },
+    { 0x00009C0804001ull, 3, 1 },
+    { 0x00009C0A04001ull, 1, 1 },
+    { 0x0000A40C00001ull, 3, 1 },
+    { 0x0000A60000580ull, 3, 1 },
+    { 0x0000A60014001ull, 3, 1 },
+    { 0x0000AA0000001ull, 3, 1 },
+    { 0x0000AA0004082ull, 4, 1 },
+    { 0x0000AA0004101ull, 4, 1 },
+    { 0x0000AA0008081ull, 4, 1 },
+    { 0x0000AA0400003ull, 3, 1 },
+    { 0x0000AA0400081ull, 3, 1 },
+    { 0x0000AA0404001ull, 2, 1 },
+    { 0x0000AA0800001ull, 3, 1 },
+    { 0x0000AA0A00001ull, 3, 1 },
+    { 0x0000AC0400003ull, 4, 1 },
+    { 0x0000AC0400180ull, 3, 1 },
+    { 0x0000AC0404001ull, 3, 1 },
+    { 0x0000CA0400001ull, 3, 1 },
+    { 0x0000EA0000081ull, 2, 1 },
+    { 0x0000EA0000180ull, 5, 1 },
+    { 0x0000EA0004001ull, 1, 1 },
+    { 0x0001007200007ull, 0, 1 },
+    { 0x0001007200083ull, 2, 1 },
+    { 0x0001007204003ull, 1, 1 },
+    { 0x000100A800003ull, 2, 1 },
+    { 0x000100A800081ull, 4, 1 },
+    { 0x000100A804001ull, 2, 1 },
+    { 0x000100B200003ull, 5, 1 },
+    { 0x0001011A04103ull, 3, 1 },
+    { 0x0001011A04201ull, 3, 1 },
+    { 0x0001011A0C101ull, 3, 1 },
+    { 0x0001012A04101ull, 3, 1 },
+    { 0x0001017200003ull, 3, 1 },
+    { 0x000101A800001ull, 4, 1 },
+    { 0x0001031A04101ull, 3, 1 },
+    { 0x0001800018580ull, 2, 1 },
+    { 0x0001800038081ull, 2, 1 },
+    { 0x0001800038180ull, 2, 1 },
+    { 0x0001800038581ull, 2, 1 },
+    { 0x0001800038980ull, 2, 1 },
+    { 0x0001800058580ull, 3, 1 },
+    { 0x0001800068281ull, 2, 1 },
+    { 0x0001800068480ull, 2, 1 },
+    { 0x0001800068580ull, 5, 1 },
+    { 0x00018000A8280ull, 2, 1 },
+    { 0x00018000D8180ull, 1, 1 },
+    { 0x00018000E8081ull, 1, 1 },
+    { 0x0001800238580ull, 2, 1 },
+    { 0x0001800268280ull, 3, 1 },
+    { 0x0001800418081ull, 3, 1 },
+    { 0x0001800418581ull, 2, 1 },
+    { 0x0001800418980ull, 2, 1 },
+    { 0x0001800430580ull, 3, 1 },
+    { 0x0001800438181ull, 2, 1 },
+    { 0x0001800450280ull, 1, 1 },
+    { 0x0001800470081ull, 3, 1 },
+    { 0x0001800470180ull, 3, 1 },
+    { 0x0001800A18580ull, 3, 1 },
+    { 0x0001800C00001ull, 3, 1 },
+    { 0x0001800C08081ull, 3, 1 },
+    { 0x0001800C08581ull, 3, 1 },
+    { 0x0001800C18083ull, 3, 1 },
+    { 0x0001800C18181ull, 3, 1 },
+    { 0x0001800C28081ull, 3, 1 },
+    { 0x0001800C30081ull, 3, 1 },
+    { 0x0001800C30180ull, 3, 1 },
+    { 0x0001801418081ull, 2, 1 },
+    { 0x0001801818081ull, 3, 1 },
+    { 0x0001801A08580ull, 3, 1 },
+    { 0x0001801A18081ull, 3, 1 },
+    { 0x0001801A18180ull, 3, 1 },
+    { 0x0001801C00003ull, 3, 1 },
+    { 0x0001801C00017ull, 3, 1 },
+    { 0x0001801C00081ull, 3, 1 },
+    { 0x0001801C04001ull, 3, 1 },
+    { 0x0001801C08083ull, 3, 1 },
+    { 0x0001801C08181ull, 3, 1 },
+    { 0x0001801C10081ull, 3, 1 },
+    { 0x0001801C2C001ull, 3, 1 },
+    { 0x0001802A18001ull, 2, 1 },
+    { 0x0001802C00001ull, 2, 1 },
+    { 0x0001802C08003ull, 3, 1 },
+    { 0x0001802C08081ull, 3, 1 },
+    { 0x0001802C10001ull, 2, 1 },
+    { 0x0001803400001ull, 5, 1 },
+    { 0x0001803408081ull, 5, 1 },
+    { 0x0001803800001ull, 3, 1 },
+    { 0x0001803808081ull, 3, 1 },
+    { 0x0001803A00001ull, 3, 1 },
+    { 0x0001803A08081ull, 3, 1 },
+    { 0x0001803A08180ull, 3, 1 },
+    { 0x0001804C08001ull, 3, 1 },
+    { 0x0001805A08001ull, 3, 1 },
+    { 0x0001806C00003ull, 3, 1 },
+    { 0x0001806C00081ull, 3, 1 },
+    { 0x0001806C04001ull, 2, 1 },
+    { 0x0001807208001ull, 5, 1 },
+    { 0x0001807400003ull, 5, 1 },
+    { 0x0001807400081ull, 3, 1 },
+    { 0x0001807404001ull, 5, 1 },
+    { 0x0001807800003ull, 3, 1 },
+    { 0x0001807800081ull, 3, 1 },
+    { 0x0001807804001ull, 3, 1 },
+    { 0x000180B800001ull, 2, 1 },
+    { 0x000180D400001ull, 5, 1 },
+    { 0x000180D800001ull, 2, 1 },
+    { 0x0001810038580ull, 2, 1 },
+    { 0x0001810068280ull, 6, 1 },
+    { 0x0001810C18081ull, 3, 1 },
+    { 0x0001811C00001ull, 3, 1 },
+    { 0x0001811C08081ull, 3, 1 },
+    { 0x0001812C08001ull, 2, 1 },
+    { 0x0001816C00001ull, 1, 1 },
+    { 0x0001817400001ull, 1, 1 },
+    { 0x0001817800001ull, 3, 1 },
+    { 0x0001821A00001ull, 3, 1 },
+    { 0x0001821A04082ull, 3, 1 },
+    { 0x0001821A04101ull, 3, 1 },
+    { 0x0001821A08081ull, 3, 1 },
+    { 0x0001823A00003ull, 3, 1 },
+    { 0x0001823A00081ull, 3, 1 },
+    { 0x0001823A04001ull, 3, 1 },
+    { 0x0001825A00001ull, 3, 1 },
+    { 0x0001826A00001ull, 1, 1 },
+    { 0x0001827200001ull, 5, 1 },
+    { 0x0001843A00001ull, 3, 1 },
+    { 0x0001850C08081ull, 3, 1 },
+    { 0x0001860000001ull, 4, 1 },
+    { 0x0001860400003ull, 3, 1 },
+    { 0x0001860400017ull, 3, 1 },
+    { 0x0001860400081ull, 4, 1 },
+    { 0x0001860A00001ull, 3, 1 },
+    { 0x0001860A04082ull, 3, 1 },
+    { 0x0001860A04101ull, 3, 1 },
+    { 0x0001860A08081ull, 3, 1 },
+    { 0x0001860C00007ull, 0, 1 },
+    { 0x0001860C00083ull, 3, 1 },
+    { 0x0001860C00181ull, 3, 1 },
+    { 0x0001860C04003ull, 3, 1 },
+    { 0x0001860C04081ull, 3, 1 },
+    { 0x0001861400003ull, 4, 1 },
+    { 0x0001861800003ull, 3, 1 },
+    { 0x0001861800081ull, 3, 1 },
+    { 0x0001861A00003ull, 3, 1 },
+    { 0x0001861A00081ull, 2, 1 },
+    { 0x0001861A04001ull, 1, 1 },
+    { 0x0001862A00001ull, 4, 1 },
+    { 0x0001863200001ull, 4, 1 },
+    { 0x00018A0C00003ull, 2, 1 },
+    { 0x00018A0C00081ull, 5, 1 },
+    { 0x00018A1A00001ull, 3, 1 },
+    { 0x00018B1C00001ull, 3, 1 },
+    { 0x00018C0400001ull, 3, 1 },
+    { 0x00018C0C00003ull, 3, 1 },
+    { 0x00018C0C00081ull, 3, 1 },
+    { 0x00018C0C04001ull, 3, 1 },
+    { 0x00018C1400001ull, 3, 1 },
+    { 0x00018C1800001ull, 3, 1 },
+    { 0x00018C1A00001ull, 3, 1 },
+    { 0x00018E0000003ull, 4, 1 },
+    { 0x00018E0000081ull, 4, 1 },
+    { 0x00018E0004001ull, 4, 1 },
+    { 0x00018E002C001ull, 4, 1 },
+    { 0x00018E0200001ull, 4, 1 },
+    { 0x00018E0400083ull, 4, 1 },
+    { 0x00018E0400181ull, 4, 1 },
+    { 0x00018E0404081ull, 4, 1 },
+    { 0x00018E0800081ull, 4, 1 },
+    { 0x0001940C00001ull, 3, 1 },
+    { 0x0001960000001ull, 4, 1 },
+    { 0x0001960000580ull, 3, 1 },
+    { 0x0001960014001ull, 4, 1 },
+    { 0x0001960400081ull, 3, 1 },
+    { 0x00019A0000001ull, 5, 1 },
+    { 0x00019A0004082ull, 2, 1 },
+    { 0x00019A0004101ull, 2, 1 },
+    { 0x00019A0008081ull, 2, 1 },
+    { 0x00019A0400003ull, 5, 1 },
+    { 0x00019A0A00001ull, 5, 1 },
+    { 0x00019C0400003ull, 3, 1 },
+    { 0x00019C0404001ull, 3, 1 },
+    { 0x0001AA0400001ull, 1, 1 },
+    { 0x0001B60000003ull, 3, 1 },
+    { 0x0001B60000081ull, 3, 1 },
+    { 0x0001B60004001ull, 2, 1 },
+    { 0x0001B60200001ull, 3, 1 },
+    { 0x0001D60000001ull, 3, 1 },
+    { 0x0002007200003ull, 5, 1 },
+    { 0x000200A800001ull, 2, 1 },
+    { 0x0002011A04101ull, 3, 1 },
+    { 0x0002806800003ull, 3, 1 },
+    { 0x0002806800081ull, 1, 1 },
+    { 0x0002806804001ull, 3, 1 },
+    { 0x000280A800001ull, 2, 1 },
+    { 0x0002816800001ull, 3, 1 },
+    { 0x0002940000001ull, 3, 1 },
+    { 0x0002940014001ull, 3, 1 },
+    { 0x0002940400003ull, 4, 1 },
+    { 0x0002940400081ull, 3, 1 },
+    { 0x0002940404001ull, 2, 1 },
+    { 0x0002940800001ull, 3, 1 },
+    { 0x0002940A00001ull, 3, 1 },
+    { 0x00029A0000181ull, 2, 1 },
+    { 0x00029A0000380ull, 1, 1 },
+    { 0x0002A40400001ull, 3, 1 },
+    { 0x0003800038580ull, 2, 1 },
+    { 0x0003800C18081ull, 5, 1 },
+    { 0x0003801C00001ull, 3, 1 },
+    { 0x0003801C08081ull, 3, 1 },
+    { 0x0003802C08001ull, 5, 1 },
+    { 0x0003807800001ull, 3, 1 },
+    { 0x0003823A00001ull, 3, 1 },
+    { 0x0003860C00003ull, 5, 1 },
+    { 0x0003861A00001ull, 5, 1 },
+    { 0x00038C0C00001ull, 5, 1 },
+    { 0x00038E0000001ull, 4, 1 },
+    { 0x00038E0400081ull, 4, 1 },
+    { 0x0003B60000001ull, 5, 1 },
+    { 0x0004806800001ull, 3, 1 },
+    { 0x0004940400001ull, 3, 1 },
+    { 0x0005800058081ull, 3, 1 },
+    { 0x0005803400003ull, 3, 1 },
+    { 0x0005803400081ull, 3, 1 },
+    { 0x0005803404001ull, 3, 1 },
+    { 0x0005805400001ull, 3, 1 },
+    { 0x0005813400001ull, 3, 1 },
+    { 0x0005820000001ull, 3, 1 },
+    { 0x0005820400003ull, 3, 1 },
+    { 0x0005820400081ull, 3, 1 },
+    { 0x0005820404001ull, 3, 1 },
+    { 0x0005820800001ull, 4, 1 },
+    { 0x0005820A00001ull, 3, 1 },
+    { 0x0005820C00007ull, 0, 1 },
+    { 0x0005820C00083ull, 3, 1 },
+    { 0x0005820C00181ull, 3, 1 },
+    { 0x0005820C04003ull, 3, 1 },
+    { 0x0005820C04081ull, 3, 1 },
+    { 0x0005820C0C001ull, 3, 1 },
+    { 0x0005821400003ull, 3, 1 },
+    { 0x0005821400081ull, 3, 1 },
+    { 0x0005821404001ull, 3, 1 },
+    { 0x0005821A00003ull, 3, 1 },
+    { 0x0005821A00081ull, 2, 1 },
+    { 0x0005821A04001ull, 1, 1 },
+    { 0x0005822A00001ull, 1, 1 },
+    { 0x0005823200001ull, 3, 1 },
+    { 0x0005840400001ull, 3, 1 },
+    { 0x0005840C00003ull, 3, 1 },
+    { 0x0005840C00081ull, 3, 1 },
+    { 0x0005840C04001ull, 3, 1 },
+    { 0x0005841400001ull, 3, 1 },
+    { 0x0005841A00001ull, 3, 1 },
+    { 0x0005860000081ull, 3, 1 },
+    { 0x0005860004001ull, 3, 1 },
+    { 0x000586002C001ull, 3, 1 },
+    { 0x0005860400083ull, 3, 1 },
+    { 0x0005860400181ull, 4, 1 },
+    { 0x0005860404003ull, 3, 1 },
+    { 0x0005860404081ull, 3, 1 },
+    { 0x000586040C001ull, 4, 1 },
+    { 0x0005860800003ull, 3, 1 },
+    { 0x0005860800081ull, 3, 1 },
+    { 0x0005860804001ull, 4, 1 },
+    { 0x0005860A00081ull, 2, 1 },
+    { 0x0005860A04001ull, 1, 1 },
+    { 0x0005861000001ull, 3, 1 },
+    { 0x0005880C00001ull, 4, 1 },
+    { 0x00058A0400081ull, 3, 1 },
+    { 0x00058A0404001ull, 2, 1 },
+    { 0x00058A0800001ull, 5, 1 },
+    { 0x00058C0000001ull, 3, 1 },
+    { 0x00058C0400003ull, 3, 1 },
+    { 0x00058C0400081ull, 3, 1 },
+    { 0x00058C0404001ull, 3, 1 },
+    { 0x00058C0800001ull, 3, 1 },
+    { 0x00058C0A00001ull, 3, 1 },
+    { 0x00058E0000181ull, 4, 1 },
+    { 0x00058E0004081ull, 4, 1 },
+    { 0x0005940400001ull, 3, 1 },
+    { 0x00059A0000003ull, 3, 1 },
+    { 0x00059A0000081ull, 3, 1 },
+    { 0x00059A0004001ull, 4, 1 },
+    { 0x00059A0200001ull, 3, 1 },
+    { 0x00059C0004001ull, 3, 1 },
+    { 0x0005AA0000001ull, 4, 1 },
+    { 0x0005B40000001ull, 3, 1 },
+    { 0x0006A40000001ull, 3, 1 },
+    { 0x0009803400001ull, 3, 1 },
+    { 0x0009820400001ull, 3, 1 },
+    { 0x0009820C00003ull, 3, 1 },
+    { 0x0009820C00081ull, 3, 1 },
+    { 0x0009820C04001ull, 3, 1 },
+    { 0x0009821400001ull, 3, 1 },
+    { 0x0009821A00001ull, 3, 1 },
+    { 0x0009840C00001ull, 3, 1 },
+    { 0x0009860000001ull, 3, 1 },
+    { 0x0009860400003ull, 3, 1 },
+    { 0x0009860400081ull, 3, 1 },
+    { 0x0009860404001ull, 3, 1 },
+    { 0x0009860800001ull, 3, 1 },
+    { 0x0009860A00001ull, 3, 1 },
+    { 0x00098A0400001ull, 3, 1 },
+    { 0x00098C0400001ull, 3, 1 },
+    { 0x00098E0004001ull, 4, 1 },
+    { 0x00099A0000001ull, 4, 1 },
+    { 0x000B821A00001ull, 3, 1 },
+    { 0x000B8C0400001ull, 3, 1 },
+    { 0x0011820C00001ull, 3, 1 },
+    { 0x0011860400001ull, 3, 1 },
+    { 0x0040000018081ull, 3, 1 },
+    { 0x0040000038181ull, 2, 1 },
+    { 0x0040000050681ull, 3, 1 },
+    { 0x0040000068081ull, 3, 1 },
+    { 0x0040000068581ull, 3, 1 },
+    { 0x00400000D8181ull, 3, 1 },
+    { 0x0040000400001ull, 3, 1 },
+    { 0x0040000408081ull, 3, 1 },
+    { 0x0040000408581ull, 3, 1 },
+    { 0x0040000418083ull, 3, 1 },
+    { 0x0040000418181ull, 2, 1 },
+    { 0x0040000418981ull, 3, 1 },
+    { 0x0040000428081ull, 3, 1 },
+    { 0x0040000430081ull, 3, 1 },
+    { 0x0040000430581ull, 3, 1 },
+    { 0x0040000438183ull, 2, 1 },
+    { 0x0040000438381ull, 2, 1 },
+    { 0x0040000450281ull, 3, 1 },
+    { 0x0040000458181ull, 3, 1 },
+    { 0x0040000468083ull, 3, 1 },
+    { 0x0040000468181ull, 4, 1 },
+    { 0x00400004A8081ull, 3, 1 },
+    { 0x0040000818081ull, 3, 1 },
+    { 0x0040000818581ull, 3, 1 },
+    { 0x0040000838181ull, 2, 1 },
+    { 0x0040000868081ull, 5, 1 },
+    { 0x0040000870081ull, 3, 1 },
+    { 0x0040000A18081ull, 3, 1 },
+    { 0x0040000A68081ull, 3, 1 },
+    { 0x0040000C00003ull, 3, 1 },
+    { 0x0040000C00017ull, 3, 1 },
+    { 0x0040000C00081ull, 3, 1 },
+    { 0x0040000C04001ull, 3, 1 },
+    { 0x0040000C08083ull, 3, 1 },
+    { 0x0040000C08097ull, 3, 1 },
+    { 0x0040000C08181ull, 3, 1 },
+    { 0x0040000C08583ull, 3, 1 },
+    { 0x0040000C08981ull, 3, 1 },
+    { 0x0040000C10081ull, 3, 1 },
+    { 0x0040000C10581ull, 3, 1 },
+    { 0x0040000C18087ull, 0, 1 },
+    { 0x0040000C18183ull, 3, 1 },
+    { 0x0040000C28083ull, 3, 1 },
+    { 0x0040000C28181ull, 4, 1 },
+    { 0x0040000C2C001ull, 3, 1 },
+    { 0x0040000C30083ull, 3, 1 },
+    { 0x0040000C30181ull, 3, 1 },
+    { 0x0040000C48081ull, 3, 1 },
+    { 0x0040000C50081ull, 3, 1 },
+    { 0x0040001400001ull, 3, 1 },
+    { 0x0040001408081ull, 3, 1 },
+    { 0x0040001408581ull, 3, 1 },
+    { 0x0040001418083ull, 3, 1 },
+    { 0x0040001428081ull, 3, 1 },
+    { 0x0040001430081ull, 3, 1 },
+    { 0x0040001800001ull, 3, 1 },
+    { 0x0040001808081ull, 3, 1 },
+    { 0x0040001818083ull, 3, 1 },
+    { 0x0040001818181ull, 3, 1 },
+    { 0x0040001828081ull, 3, 1 },
+    { 0x0040001830081ull, 3, 1 },
+    { 0x0040001A00001ull, 3, 1 },
+    { 0x0040001A04101ull, 3, 1 },
+    { 0x0040001A08081ull, 3, 1 },
+    { 0x0040001A08581ull, 3, 1 },
+    { 0x0040001A18083ull, 3, 1 },
+    { 0x0040001A18181ull, 3, 1 },
+    { 0x0040001A28081ull, 3, 1 },
+    { 0x0040001A30081ull, 3, 1 },
+    { 0x0040001C00007ull, 3, 1 },
+    { 0x0040001C00027ull, 3, 1 },
+    { 0x0040001C00083ull, 3, 1 },
+    { 0x0040001C00097ull, 3, 1 },
+    { 0x0040001C00181ull, 3, 1 },
+    { 0x0040001C04003ull, 3, 1 },
+    { 0x0040001C04017ull, 3, 1 },
+    { 0x0040001C04081ull, 3, 1 },
+    { 0x0040001C08087ull, 3, 1 },
+    { 0x0040001C08183ull, 3, 1 },
+    { 0x0040001C08381ull, 3, 1 },
+    { 0x0040001C0C001ull, 3, 1 },
+    { 0x0040001C10083ull, 3, 1 },
+    { 0x0040001C10181ull, 3, 1 },
+    { 0x0040001C20081ull, 3, 1 },
+    { 0x0040001C2C003ull, 3, 1 },
+    { 0x0040001C2C081ull, 3, 1 },
+    { 0x0040001C4C001ull, 3, 1 },
+    { 0x0040002808281ull, 3, 1 },
+    { 0x0040002818081ull, 3, 1 },
+    { 0x0040002A08001ull, 2, 1 },
+    { 0x0040002A18003ull, 2, 1 },
+    { 0x0040002A18081ull, 3, 1 },
+    { 0x0040002A28001ull, 4, 1 },
+    { 0x0040002C00003ull, 3, 1 },
+    { 0x0040002C00017ull, 3, 1 },
+    { 0x0040002C00081ull, 2, 1 },
+    { 0x0040002C04001ull, 3, 1 },
+    { 0x0040002C08083ull, 3, 1 },
+    { 0x0040002C08181ull, 4, 1 },
+    { 0x0040002C10081ull, 3, 1 },
+    { 0x0040002C2C001ull, 3, 1 },
+    { 0x0040003218081ull, 3, 1 },
+    { 0x0040003400003ull, 3, 1 },
+    { 0x0040003400017ull, 3, 1 },
+    { 0x0040003400081ull, 3, 1 },
+    { 0x0040003400581ull, 3, 1 },
+    { 0x0040003404001ull, 3, 1 },
+    { 0x0040003408083ull, 3, 1 },
+    { 0x0040003408181ull, 3, 1 },
+    { 0x0040003410081ull, 2, 1 },
+    { 0x004000342C001ull, 3, 1 },
+    { 0x0040003800003ull, 3, 1 },
+    { 0x0040003800017ull, 3, 1 },
+    { 0x0040003800081ull, 3, 1 },
+    { 0x0040003804001ull, 3, 1 },
+    { 0x0040003808083ull, 3, 1 },
+    { 0x0040003808181ull, 3, 1 },
+    { 0x0040003810081ull, 3, 1 },
+    { 0x004000382C001ull, 3, 1 },
+    { 0x0040003A00003ull, 3, 1 },
+    { 0x0040003A00081ull, 3, 1 },
+    { 0x0040003A04001ull, 3, 1 },
+    { 0x0040003A04103ull, 3, 1 },
+    { 0x0040003A04201ull, 3, 1 },
+    { 0x0040003A08083ull, 3, 1 },
+    { 0x0040003A08181ull, 3, 1 },
+    { 0x0040003A0C101ull, 3, 1 },
+    { 0x0040003A10081ull, 3, 1 },
+    { 0x0040004A18001ull, 3, 1 },
+    { 0x0040004C08081ull, 3, 1 },
+    { 0x0040005400001ull, 3, 1 },
+    { 0x0040005408081ull, 2, 1 },
+    { 0x0040005414001ull, 3, 1 },
+    { 0x0040005800001ull, 3, 1 },
+    { 0x0040005808081ull, 3, 1 },
+    { 0x0040005A00001ull, 3, 1 },
+    { 0x0040005A04101ull, 3, 1 },
+    { 0x0040005A08081ull, 3, 1 },
+    { 0x0040006800001ull, 3, 1 },
+    { 0x0040006800281ull, 3, 1 },
+    { 0x0040006A04101ull, 3, 1 },
+    { 0x0040006A08003ull, 3, 1 },
+    { 0x0040006A08081ull, 2, 1 },
+    { 0x0040006A10001ull, 3, 1 },
+    { 0x0040006C00007ull, 0, 1 },
+    { 0x0040006C00083ull, 2, 1 },
+    { 0x0040006C04003ull, 3, 1 },
+    { 0x0040006C04081ull, 2, 1 },
+    { 0x0040006C0C001ull, 3, 1 },
+    { 0x0040007200001ull, 3, 1 },
+    { 0x0040007204101ull, 3, 1 },
+    { 0x0040007208081ull, 3, 1 },
+    { 0x0040007400007ull, 0, 1 },
+    { 0x0040007400083ull, 3, 1 },
+    { 0x0040007400181ull, 3, 1 },
+    { 0x0040007404003ull, 3, 1 },
+    { 0x0040007404081ull, 3, 1 },
+    { 0x004000740C001ull, 2, 1 },
+    { 0x0040007800007ull, 3, 1 },
+    { 0x0040007800083ull, 3, 1 },
+    { 0x0040007800181ull, 3, 1 },
+    { 0x0040007804003ull, 3, 1 },
+    { 0x0040007804081ull, 3, 1 },
+    { 0x004000780C001ull, 3, 1 },
+    { 0x004000A800101ull, 4, 1 },
+    { 0x004000AC00003ull, 2, 1 },
+    { 0x004000AC04001ull, 2, 1 },
+    { 0x004000B208001ull, 2, 1 },
+    { 0x004000B400003ull, 2, 1 },
+    { 0x004000B400081ull, 2, 1 },
+    { 0x004000B404001ull, 2, 1 },
+    { 0x004000B800003ull, 2, 1 },
+    { 0x004000B800081ull, 2, 1 },
+    { 0x004000B804001ull, 2, 1 },
+    { 0x004000CA08001ull, 2, 1 },
+    { 0x004000D200101ull, 1, 1 },
+    { 0x004000D400003ull, 4, 1 },
+    { 0x004000D400081ull, 4, 1 },
+    { 0x004000D404001ull, 2, 1 },
+    { 0x004000D800003ull, 2, 1 },
+    { 0x004000D800081ull, 2, 1 },
+    { 0x004000D804001ull, 2, 1 },
+    { 0x004000DA00003ull, 2, 1 },
+    { 0x004000DA00081ull, 2, 1 },
+    { 0x004000DA04001ull, 1, 1 },
+    { 0x004000E800003ull, 2, 1 },
+    { 0x004000E800081ull, 1, 1 },
+    { 0x004000E804001ull, 2, 1 },
+    { 0x004000F200003ull, 5, 1 },
+    { 0x004000F200081ull, 2, 1 },
+    { 0x004000F204001ull, 1, 1 },
+    { 0x0040010038081ull, 2, 1 },
+    { 0x00400100E8081ull, 5, 1 },
+    { 0x0040010418081ull, 3, 1 },
+    { 0x0040010418581ull, 3, 1 },
+    { 0x0040010438181ull, 2, 1 },
+    { 0x0040010468081ull, 3, 1 },
+    { 0x0040010470081ull, 3, 1 },
+    { 0x0040010C08081ull, 3, 1 },
+    { 0x0040010C08581ull, 2, 1 },
+    { 0x0040010C18083ull, 3, 1 },
+    { 0x0040010C18181ull, 3, 1 },
+    { 0x0040010C28081ull, 3, 1 },
+    { 0x0040010C30081ull, 3, 1 },
+    { 0x0040011418081ull, 3, 1 },
+    { 0x0040011818081ull, 3, 1 },
+    { 0x0040011A08001ull, 5, 1 },
+    { 0x0040011A18081ull, 5, 1 },
+    { 0x0040011C00003ull, 3, 1 },
+    { 0x0040011C00017ull, 3, 1 },
+    { 0x0040011C00081ull, 3, 1 },
+    { 0x0040011C04001ull, 3, 1 },
+    { 0x0040011C08083ull, 3, 1 },
+    { 0x0040011C08181ull, 3, 1 },
+    { 0x0040011C10081ull, 3, 1 },
+    { 0x0040011C2C001ull, 3, 1 },
+    { 0x0040012A18001ull, 5, 1 },
+    { 0x0040012C08081ull, 2, 1 },
+    { 0x0040013408081ull, 3, 1 },
+    { 0x0040013808081ull, 3, 1 },
+    { 0x0040013A04101ull, 3, 1 },
+    { 0x0040013A08003ull, 3, 1 },
+    { 0x0040013A08081ull, 3, 1 },
+    { 0x0040013A10001ull, 3, 1 },
+    { 0x0040015A08001ull, 5, 1 },
+    { 0x0040016A08001ull, 5, 1 },
+    { 0x0040016C00003ull, 3, 1 },
+    { 0x0040016C00081ull, 4, 1 },
+    { 0x0040016C04001ull, 3, 1 },
+    { 0x0040017208001ull, 5, 1 },
+    { 0x0040017400003ull, 3, 1 },
+    { 0x0040017400081ull, 3, 1 },
+    { 0x0040017404001ull, 3, 1 },
+    { 0x0040017800003ull, 3, 1 },
+    { 0x0040017800081ull, 3, 1 },
+    { 0x0040017804001ull, 3, 1 },
+    { 0x0040020A04082ull, 3, 1 },
+    { 0x0040020A04101ull, 3, 1 },
+    { 0x0040021A04084ull, 3, 1 },
+    { 0x0040021A04103ull, 3, 1 },
+    { 0x0040021A04182ull, 3, 1 },
+    { 0x0040021A04201ull, 3, 1 },
+    { 0x0040021A0C082ull, 3, 1 },
+    { 0x0040021A0C101ull, 3, 1 },
+    { 0x0040022A04082ull, 3, 1 },
+    { 0x0040022A04101ull, 3, 1 },
+    { 0x0040022C00181ull, 2, 1 },
+    { 0x0040023204082ull, 3, 1 },
+    { 0x0040023204101ull, 3, 1 },
+    { 0x0040023400181ull, 3, 1 },
+    { 0x0040023A0C001ull, 3, 1 },
+    { 0x0040025400003ull, 3, 1 },
+    { 0x0040025A00081ull, 2, 1 },
+    { 0x0040027200081ull, 2, 1 },
+    { 0x0040030C18081ull, 3, 1 },
+    { 0x0040031C08081ull, 3, 1 },
+    { 0x0040041A04082ull, 3, 1 },
+    { 0x0040041A04101ull, 3, 1 },
+    { 0x0040050058081ull, 3, 1 },
+    { 0x0040050408081ull, 3, 1 },
+    { 0x0040050408581ull, 3, 1 },
+    { 0x0040050C08083ull, 3, 1 },
+    { 0x0040050C08181ull, 3, 1 },
+    { 0x0040050C10081ull, 3, 1 },
+    { 0x0040051408081ull, 3, 1 },
+    { 0x0040051808081ull, 3, 1 },
+    { 0x0040062A00003ull, 3, 1 },
+    { 0x0040062A00081ull, 2, 1 },
+    { 0x0040090C08081ull, 3, 1 },
+    { 0x00400B0038081ull, 2, 1 },
+    { 0x00400B1C00003ull, 3, 1 },
+    { 0x00400B1C00081ull, 3, 1 },
+    { 0x00408000E8081ull, 4, 1 },
+    { 0x0040800418081ull, 3, 1 },
+    { 0x0040800418581ull, 3, 1 },
+    { 0x0040800438181ull, 2, 1 },
+    { 0x0040800468081ull, 3, 1 },
+    { 0x0040800C08081ull, 3, 1 },
+    { 0x0040800C08581ull, 3, 1 },
+    { 0x0040800C18083ull, 3, 1 },
+    { 0x0040800C18181ull, 3, 1 },
+    { 0x0040800C28081ull, 3, 1 },
+    { 0x0040800C30081ull, 3, 1 },
+    { 0x0040801418081ull, 3, 1 },
+    { 0x0040801818081ull, 3, 1 },
+    { 0x0040801A18081ull, 4, 1 },
+    { 0x0040801C00003ull, 3, 1 },
+    { 0x0040801C00017ull, 3, 1 },
+    { 0x0040801C00081ull, 3, 1 },
+    { 0x0040801C08083ull, 3, 1 },
+    { 0x0040801C08181ull, 3, 1 },
+    { 0x0040801C10081ull, 3, 1 },
+    { 0x0040802C08081ull, 3, 1 },
+    { 0x0040803408081ull, 3, 1 },
+    { 0x0040803808081ull, 3, 1 },
+    { 0x0040803A04101ull, 3, 1 },
+    { 0x0040803A08081ull, 3, 1 },
+    { 0x0040806C00003ull, 3, 1 },
+    { 0x0040806C00081ull, 3, 1 },
+    { 0x0040807400003ull, 3, 1 },
+    { 0x0040807400081ull, 3, 1 },
+    { 0x0040807800003ull, 3, 1 },
+    { 0x0040807800081ull, 3, 1 },
+    { 0x0040810C18081ull, 3, 1 },
+    { 0x0040811C08081ull, 3, 1 },
+    { 0x0040820068081ull, 2, 1 },
+    { 0x0040820A18081ull, 3, 1 },
+    { 0x0040820C00003ull, 3, 1 },
+    { 0x0040820C14003ull, 3, 1 },
+    { 0x0040820C14081ull, 3, 1 },
+    { 0x0040821A04082ull, 3, 1 },
+    { 0x0040821A04101ull, 3, 1 },
+    { 0x0040821A08081ull, 3, 1 },
+    { 0x0040821C00007ull, 3, 1 },
+    { 0x0040821C00083ull, 3, 1 },
+    { 0x0040821C00181ull, 3, 1 },
+    { 0x0040821C04003ull, 3, 1 },
+    { 0x0040822C00003ull, 3, 1 },
+    { 0x0040823400003ull, 4, 1 },
+    { 0x0040823800003ull, 3, 1 },
+    { 0x0040823A00003ull, 3, 1 },
+    { 0x0040841C00003ull, 3, 1 },
+    { 0x0040860400003ull, 3, 1 },
+    { 0x0040860400017ull, 3, 1 },
+    { 0x0040860A04082ull, 3, 1 },
+    { 0x0040860A04101ull, 3, 1 },
+    { 0x0040860C00007ull, 0, 1 },
+    { 0x0040860C00083ull, 3, 1 },
+    { 0x0040860C00181ull, 3, 1 },
+    { 0x0040860C04003ull, 3, 1 },
+    { 0x0040861400003ull, 3, 1 },
+    { 0x0040861800003ull, 3, 1 },
+    { 0x0040861A00003ull, 3, 1 },
+    { 0x00408A0C00003ull, 3, 1 },
+    { 0x00408C0C00003ull, 3, 1 },
+    { 0x00409A0004082ull, 4, 1 },
+    { 0x00409A0004101ull, 4, 1 },
+    { 0x00409A0400003ull, 3, 1 },
+    { 0x00409C0400003ull, 4, 1 },
+    { 0x0041007200003ull, 3, 1 },
+    { 0x0041011A04101ull, 3, 1 },
+    { 0x0041011A08003ull, 3, 1 },
+    { 0x0041013A00003ull, 3, 1 },
+    { 0x0041821C00003ull, 3, 1 },
+    { 0x0041860C00003ull, 3, 1 },
+    { 0x00418E0400003ull, 4, 1 },
+    { 0x0045820C00003ull, 3, 1 },
+    { 0x0080811A08003ull, 3, 1 },
+    { 0x00C0000C18083ull, 3, 1 },
+    { 0x00C0001C00003ull, 3, 1 },
+    { 0x00C0001C00017ull, 3, 1 },
+    { 0x00C0001C08083ull, 3, 1 },
+    { 0x00C0006C00003ull, 3, 1 },
+    { 0x00C0007400003ull, 3, 1 },
+    { 0x00C0007800003ull, 3, 1 },
+};
+
+const size_t ConnectFourBook::kSize = sizeof(kEntries) / sizeof(kEntries[0]);
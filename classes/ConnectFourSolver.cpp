@@ -0,0 +1,332 @@
+#include "ConnectFourSolver.h"
+
+#include <algorithm>
+#include <bit>
+
+//
+// position
+//
+int ConnectFourPosition::playSequence(const std::string &seq)
+{
+    for (size_t i = 0; i < seq.size(); ++i)
+    {
+        const int col = seq[i] - '1';
+        if (col < 0 || col >= kWidth || !canPlay(col) || isWinningMove(col))
+            return static_cast<int>(i);
+        play(col);
+    }
+    return static_cast<int>(seq.size());
+}
+
+uint64_t ConnectFourPosition::computeWinningPositions(uint64_t stones, uint64_t mask)
+{
+    const int H = kHeight;
+
+    // vertical: three stacked stones, the cell on top wins
+    uint64_t r = (stones << 1) & (stones << 2) & (stones << 3);
+
+    // horizontal, then the two diagonals: for every direction check the
+    // three-in-a-row and split-row shapes on both sides of the empty cell
+    const int shifts[3] = { H + 1, H, H + 2 };
+    for (int shift : shifts)
+    {
+        uint64_t p = (stones << shift) & (stones << 2 * shift);
+        r |= p & (stones << 3 * shift);
+        r |= p & (stones >> shift);
+        p = (stones >> shift) & (stones >> 2 * shift);
+        r |= p & (stones << shift);
+        r |= p & (stones >> 3 * shift);
+    }
+    return r & (kBoard ^ mask);
+}
+
+uint64_t ConnectFourPosition::possibleNonLosingMoves() const
+{
+    uint64_t moves = possible();
+    const uint64_t opponentWins = opponentWinningPositions();
+    const uint64_t forced = moves & opponentWins;
+    if (forced)
+    {
+        // two threats at once can't both be blocked
+        if (forced & (forced - 1))
+            return 0;
+        moves = forced;
+    }
+    // never play directly underneath a cell the opponent wins on
+    return moves & ~(opponentWins >> 1);
+}
+
+int ConnectFourPosition::moveScore(uint64_t move) const
+{
+    return std::popcount(computeWinningPositions(_current | move, _mask));
+}
+
+bool ConnectFourPosition::hasAlignment(uint64_t stones)
+{
+    const int H = kHeight;
+    const int shifts[4] = { H + 1, H, H + 2, 1 };
+    for (int shift : shifts)
+    {
+        const uint64_t m = stones & (stones >> shift);
+        if (m & (m >> 2 * shift))
+            return true;
+    }
+    return false;
+}
+
+//
+// solver
+//
+const int ConnectFourSolver::kColumnOrder[ConnectFourPosition::kWidth] = { 3, 2, 4, 1, 5, 0, 6 };
+
+ConnectFourSolver::ConnectFourSolver() : _keys(kTableSize), _values(kTableSize), _nodes(0), _stop(nullptr), _aborted(false)
+{
+}
+
+void ConnectFourSolver::clearTable()
+{
+    std::fill(_keys.begin(), _keys.end(), 0);
+    std::fill(_values.begin(), _values.end(), 0);
+}
+
+void ConnectFourSolver::store(uint64_t key, uint8_t value)
+{
+    const size_t slot = static_cast<size_t>(key % kTableSize);
+    _keys[slot] = static_cast<uint32_t>(key);
+    _values[slot] = value;
+}
+
+uint8_t ConnectFourSolver::load(uint64_t key) const
+{
+    const size_t slot = static_cast<size_t>(key % kTableSize);
+    return _keys[slot] == static_cast<uint32_t>(key) ? _values[slot] : 0;
+}
+
+//
+// up to 7 moves kept sorted by score; equal scores come out in the order they
+// went in, so adding columns in reverse center-first order keeps that order
+//
+class ConnectFourMoveSorter
+{
+public:
+    ConnectFourMoveSorter() : _size(0) {}
+
+    void add(uint64_t move, int score)
+    {
+        int pos = _size++;
+        for (; pos && _entries[pos - 1].score > score; --pos)
+            _entries[pos] = _entries[pos - 1];
+        _entries[pos].move = move;
+        _entries[pos].score = score;
+    }
+    uint64_t next() { return _size ? _entries[--_size].move : 0; }
+
+private:
+    struct Entry
+    {
+        uint64_t    move;
+        int         score;
+    };
+    Entry   _entries[ConnectFourPosition::kWidth];
+    int     _size;
+};
+
+//
+// the table value encodes either an upper bound (1 .. kMaxScore - kMinScore + 1)
+// or a lower bound (above that), 0 means empty
+//
+int ConnectFourSolver::negamax(const ConnectFourPosition &position, int alpha, int beta)
+{
+    const int kCells = ConnectFourPosition::kCells;
+    ++_nodes;
+    if ((_nodes & 4095) == 0 && stopped())
+        _aborted = true;
+    if (_aborted)
+        return alpha;
+
+    const uint64_t next = position.possibleNonLosingMoves();
+    if (next == 0)
+        return -(kCells - position.moves()) / 2;    // every move lets the opponent win
+    if (position.moves() >= kCells - 2)
+        return 0;                                   // the board fills up with no win
+
+    // we can't win next move (the caller checked), so the best we can do is win after that
+    int min = -(kCells - 2 - position.moves()) / 2;
+    if (alpha < min)
+    {
+        alpha = min;
+        if (alpha >= beta)
+            return alpha;
+    }
+    int max = (kCells - 1 - position.moves()) / 2;
+
+    const uint64_t key = position.key();
+    if (int value = load(key))
+    {
+        if (value > kMaxScore - kMinScore + 1)
+        {
+            min = value + 2 * kMinScore - kMaxScore - 2;
+            if (alpha < min)
+            {
+                alpha = min;
+                if (alpha >= beta)
+                    return alpha;
+            }
+        }
+        else
+        {
+            max = value + kMinScore - 1;
+        }
+    }
+    if (beta > max)
+    {
+        beta = max;
+        if (alpha >= beta)
+            return beta;
+    }
+
+    ConnectFourMoveSorter moves;
+    for (int i = ConnectFourPosition::kWidth - 1; i >= 0; --i)
+    {
+        if (uint64_t move = next & ConnectFourPosition::columnMask(kColumnOrder[i]))
+            moves.add(move, position.moveScore(move));
+    }
+
+    while (uint64_t move = moves.next())
+    {
+        ConnectFourPosition child(position);
+        child.playMove(move);
+        const int score = -negamax(child, -beta, -alpha);
+        if (_aborted)
+            return alpha;       // don't let a cut short search into the table
+        if (score >= beta)
+        {
+            store(key, static_cast<uint8_t>(score + kMaxScore - 2 * kMinScore + 2));
+            return score;
+        }
+        if (score > alpha)
+            alpha = score;
+    }
+    store(key, static_cast<uint8_t>(alpha - kMinScore + 1));
+    return alpha;
+}
+
+int ConnectFourSolver::solve(const ConnectFourPosition &position, bool weak)
+{
+    const int kCells = ConnectFourPosition::kCells;
+    if (position.canWinNext())
+        return (kCells + 1 - position.moves()) / 2;
+
+    int min = -(kCells - position.moves()) / 2;
+    int max = (kCells + 1 - position.moves()) / 2;
+    if (weak)
+    {
+        min = -1;
+        max = 1;
+    }
+    _aborted = false;
+
+    // null-window searches, probing near zero first since most positions are close games
+    while (min < max)
+    {
+        int med = min + (max - min) / 2;
+        if (med <= 0 && min / 2 < med)
+            med = min / 2;
+        else if (med >= 0 && max / 2 > med)
+            med = max / 2;
+        const int r = negamax(position, med, med + 1);
+        if (_aborted)
+            return 0;
+        if (r <= med)
+            max = r;
+        else
+            min = r;
+    }
+    return min;
+}
+
+void ConnectFourSolver::analyze(const ConnectFourPosition &position, bool weak, int scores[ConnectFourPosition::kWidth])
+{
+    const int kCells = ConnectFourPosition::kCells;
+    for (int col = 0; col < ConnectFourPosition::kWidth; ++col)
+    {
+        if (!position.canPlay(col))
+            scores[col] = kInvalidMove;
+        else if (position.isWinningMove(col))
+            scores[col] = (kCells + 1 - position.moves()) / 2;
+        else
+        {
+            ConnectFourPosition child(position);
+            child.play(col);
+            scores[col] = -solve(child, weak);
+        }
+    }
+}
+
+int ConnectFourSolver::bestMove(const ConnectFourPosition &position, bool weak, int *score)
+{
+    int scores[ConnectFourPosition::kWidth];
+    if (weak && !position.canWinNext())
+    {
+        // without a win on the spot no weak score beats 1, so with the
+        // columns in tie-break order the first win is the one to play and
+        // the rest needn't be solved
+        for (int col : kColumnOrder)
+        {
+            scores[col] = kInvalidMove;
+            if (!position.canPlay(col))
+                continue;
+            ConnectFourPosition child(position);
+            child.play(col);
+            scores[col] = -solve(child, true);
+            if (scores[col] > 0)
+            {
+                if (score)
+                    *score = scores[col];
+                return col;
+            }
+        }
+    }
+    else
+        analyze(position, weak, scores);
+
+    // ties go to the column nearest the center
+    int best = -1;
+    for (int col : kColumnOrder)
+    {
+        if (scores[col] != kInvalidMove && (best < 0 || scores[col] > scores[best]))
+            best = col;
+    }
+    if (score)
+        *score = best >= 0 ? scores[best] : 0;
+    return best;
+}
+
+int ConnectFourSolver::quickMove(const ConnectFourPosition &position)
+{
+    for (int col : kColumnOrder)
+    {
+        if (position.canPlay(col) && position.isWinningMove(col))
+            return col;
+    }
+
+    uint64_t candidates = position.possibleNonLosingMoves();
+    if (candidates == 0)
+        candidates = position.possible();   // lost anyway, play something
+
+    int best = -1;
+    int bestScore = -1;
+    for (int col : kColumnOrder)
+    {
+        const uint64_t move = candidates & ConnectFourPosition::columnMask(col);
+        if (!move)
+            continue;
+        const int score = position.moveScore(move);
+        if (score > bestScore)
+        {
+            best = col;
+            bestScore = score;
+        }
+    }
+    return best;
+}
@@ -0,0 +1,139 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//
+// headless Connect Four position and perfect-play solver
+//
+// the 7x6 board is stored as two 64-bit bitboards, one column per 7 bits
+// (6 playable rows plus a sentinel bit on top):
+//
+//    .  .  .  .  .  .  .
+//    5 12 19 26 33 40 47
+//    4 11 18 25 32 39 46
+//    3 10 17 24 31 38 45
+//    2  9 16 23 30 37 44
+//    1  8 15 22 29 36 43
+//    0  7 14 21 28 35 42
+//
+// "current" holds the stones of the player to move and "mask" all stones,
+// so current + mask is a unique key for the position.
+//
+class ConnectFourPosition
+{
+public:
+    static constexpr int kWidth = 7;
+    static constexpr int kHeight = 6;
+    static constexpr int kCells = kWidth * kHeight;
+
+    ConnectFourPosition() : _current(0), _mask(0), _moves(0) {}
+    // from the stones of the player to move and of both players
+    ConnectFourPosition(uint64_t current, uint64_t mask, int moves) : _current(current), _mask(mask), _moves(moves) {}
+
+    bool        canPlay(int col) const { return (_mask & topMask(col)) == 0; }
+    void        play(int col) { playMove((_mask + bottomMask(col)) & columnMask(col)); }
+    // play a move given as its single bit
+    void        playMove(uint64_t move)
+    {
+        _current ^= _mask;
+        _mask |= move;
+        _moves++;
+    }
+    // play a sequence of 1-based column digits ("4453"), returns how many were played
+    int         playSequence(const std::string &seq);
+
+    bool        isWinningMove(int col) const { return winningPositions() & possible() & columnMask(col); }
+    bool        canWinNext() const { return winningPositions() & possible(); }
+    int         moves() const { return _moves; }
+    uint64_t    key() const { return _current + _mask; }
+    uint64_t    current() const { return _current; }
+    uint64_t    mask() const { return _mask; }
+
+    // the lowest free cell of every column that isn't full
+    uint64_t    possible() const { return (_mask + kBottom) & kBoard; }
+    // moves that don't hand the opponent a win next turn; 0 if every move loses
+    uint64_t    possibleNonLosingMoves() const;
+    // how many winning cells a move would leave the player making it, used for ordering
+    int         moveScore(uint64_t move) const;
+
+    // did the player owning "stones" complete four in a row?
+    static bool hasAlignment(uint64_t stones);
+
+    static constexpr uint64_t bottomMask(int col) { return uint64_t(1) << (col * (kHeight + 1)); }
+    static constexpr uint64_t topMask(int col) { return uint64_t(1) << (kHeight - 1 + col * (kHeight + 1)); }
+    static constexpr uint64_t columnMask(int col) { return ((uint64_t(1) << kHeight) - 1) << (col * (kHeight + 1)); }
+    static constexpr int      cellBit(int col, int row) { return col * (kHeight + 1) + row; }
+
+private:
+    uint64_t    winningPositions() const { return computeWinningPositions(_current, _mask); }
+    uint64_t    opponentWinningPositions() const { return computeWinningPositions(_current ^ _mask, _mask); }
+    // empty cells that would complete four in a row for the owner of "stones"
+    static uint64_t computeWinningPositions(uint64_t stones, uint64_t mask);
+
+    // bit 0 of every column, and every playable cell
+    static constexpr uint64_t kBottom = 0x0000040810204081ull;
+    static constexpr uint64_t kBoard = kBottom * ((uint64_t(1) << kHeight) - 1);
+
+    uint64_t    _current;
+    uint64_t    _mask;
+    int         _moves;
+};
+
+//
+// negamax with alpha-beta, a transposition table and center-first, threat
+// based move ordering, driven by null-window searches that narrow in on the
+// exact score.
+//
+// scores are for the side to move: a win with your k-th last stone scores k
+// (the earlier the win the higher), 0 is a draw, negative is a loss.
+//
+class ConnectFourSolver
+{
+public:
+    static constexpr int kMinScore = -(ConnectFourPosition::kCells) / 2 + 3;
+    static constexpr int kMaxScore = (ConnectFourPosition::kCells + 1) / 2 - 3;
+
+    ConnectFourSolver();
+
+    // exact score; with weak = true only the sign (win / draw / loss) is exact
+    int         solve(const ConnectFourPosition &position, bool weak = false);
+    // score of every column for the side to move (kInvalidMove for full columns)
+    void        analyze(const ConnectFourPosition &position, bool weak, int scores[ConnectFourPosition::kWidth]);
+    // best column to play, preferring the fastest win and slowest loss; weak
+    // can't tell wins apart, so it takes the first win nearest the center
+    int         bestMove(const ConnectFourPosition &position, bool weak = false, int *score = nullptr);
+    // a sensible move without searching, for when there's no time to solve:
+    // win if possible, avoid handing over a win, then the most new threats
+    static int  quickMove(const ConnectFourPosition &position);
+
+    // an abandoned search returns garbage, callers check stopped()
+    void        setStopFlag(const std::atomic<bool> *stop) { _stop = stop; }
+    bool        stopped() const { return _stop && _stop->load(std::memory_order_relaxed); }
+
+    uint64_t    nodeCount() const { return _nodes; }
+    void        resetNodeCount() { _nodes = 0; }
+    void        clearTable();
+
+    static constexpr int kInvalidMove = -1000;
+
+private:
+    int         negamax(const ConnectFourPosition &position, int alpha, int beta);
+
+    //
+    // transposition table: the key is 49 bits and the table size is a prime
+    // above 2^17, so the low 32 bits stored alongside the slot number pin the
+    // position down exactly (chinese remainder theorem)
+    //
+    static constexpr size_t kTableSize = 8388593;       // prime just under 2^23
+    void        store(uint64_t key, uint8_t value);
+    uint8_t     load(uint64_t key) const;
+
+    std::vector<uint32_t>       _keys;
+    std::vector<uint8_t>        _values;
+    uint64_t                    _nodes;
+    const std::atomic<bool>    *_stop;
+    bool                        _aborted;       // the stop flag was seen during this solve
+    static const int            kColumnOrder[ConnectFourPosition::kWidth];
+};
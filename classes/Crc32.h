@@ -0,0 +1,41 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+//
+// standard CRC-32 (IEEE 802.3, reflected polynomial 0xEDB88320)
+// used to detect corrupt or torn files written by the save and journal code
+//
+namespace Crc32
+{
+    constexpr std::array<uint32_t, 256> makeTable()
+    {
+        std::array<uint32_t, 256> table{};
+        for (uint32_t i = 0; i < 256; ++i)
+        {
+            uint32_t c = i;
+            for (int k = 0; k < 8; ++k)
+                c = (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+            table[i] = c;
+        }
+        return table;
+    }
+
+    inline constexpr std::array<uint32_t, 256> kTable = makeTable();
+
+    // feed more bytes into a running crc; start with crc = 0
+    inline uint32_t update(uint32_t crc, const void *data, size_t size)
+    {
+        const uint8_t *p = static_cast<const uint8_t *>(data);
+        crc = ~crc;
+        for (size_t i = 0; i < size; ++i)
+            crc = kTable[(crc ^ p[i]) & 0xFF] ^ (crc >> 8);
+        return ~crc;
+    }
+
+    inline uint32_t compute(const void *data, size_t size)
+    {
+        return update(0, data, size);
+    }
+}
@@ -0,0 +1,70 @@
+#include "FileIO.h"
+
+#include <filesystem>
+#include <system_error>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace FileIO
+{
+    bool readAll(const std::string &path, std::vector<uint8_t> &out)
+    {
+        out.clear();
+        FILE *file = std::fopen(path.c_str(), "rb");
+        if (!file)
+            return false;
+
+        uint8_t buffer[64 * 1024];
+        size_t got;
+        while ((got = std::fread(buffer, 1, sizeof(buffer), file)) > 0)
+            out.insert(out.end(), buffer, buffer + got);
+
+        bool ok = !std::ferror(file);
+        std::fclose(file);
+        return ok;
+    }
+
+    bool syncFile(FILE *file)
+    {
+        if (std::fflush(file) != 0)
+            return false;
+#ifdef _WIN32
+        return _commit(_fileno(file)) == 0;
+#else
+        return fsync(fileno(file)) == 0;
+#endif
+    }
+
+    bool writeAtomic(const std::string &path, const std::vector<uint8_t> &data)
+    {
+        const std::string tmpPath = path + ".tmp";
+
+        FILE *file = std::fopen(tmpPath.c_str(), "wb");
+        if (!file)
+            return false;
+
+        bool ok = data.empty() || std::fwrite(data.data(), 1, data.size(), file) == data.size();
+        ok = syncFile(file) && ok;
+        ok = (std::fclose(file) == 0) && ok;
+
+        std::error_code ec;
+        if (!ok)
+        {
+            std::filesystem::remove(tmpPath, ec);
+            return false;
+        }
+
+        // rename replaces the destination in one step on both POSIX and Windows
+        std::filesystem::rename(tmpPath, path, ec);
+        if (ec)
+        {
+            std::filesystem::remove(tmpPath, ec);
+            return false;
+        }
+        return true;
+    }
+}
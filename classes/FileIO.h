@@ -0,0 +1,21 @@
+#pragma once
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+//
+// small file helpers shared by the save, journal and archive code
+//
+namespace FileIO
+{
+    // read an entire file into memory, false if it can't be opened
+    bool readAll(const std::string &path, std::vector<uint8_t> &out);
+
+    // write a file so readers only ever see the old or the new contents:
+    // the data goes to "<path>.tmp", is flushed to disk, then renamed over path
+    bool writeAtomic(const std::string &path, const std::vector<uint8_t> &data);
+
+    // flush the C buffers and ask the OS to push the file to stable storage
+    bool syncFile(FILE *file);
+}
@@ -15,13 +15,18 @@ Game::Game()
 	_gameOptions.rowY = 0;
 	_gameOptions.score = 0;
 	_gameOptions.AIDepthSearches = 0;
+	_gameOptions.AIMAXDepth = 0;
+	_gameOptions.AIThreads = 1;
 	_gameOptions.AIvsAI = false;
 	
 	_score = 0;
 	_table = nullptr;
 	_winner = nullptr;
 	_lastMove = "";
+	_lastMoveCode = kNoMoveCode;
 	_gameNumber = -1;
+	_dragBit = nullptr;
+	_dragSource = nullptr;
 }
 
 
@@ -87,6 +92,8 @@ void Game::endTurn()
 	turn->_date = (int)_gameOptions.currentTurnNo;
 	turn->_score = _score;
 	turn->_gameNumber = _gameNumber;
+	turn->_move = _lastMoveCode == kNoMoveCode ? "" : std::to_string(_lastMoveCode);
+	_lastMoveCode = kNoMoveCode;
 	_turns.push_back(turn);
 	ClassGame::EndOfTurn();
 }
@@ -98,16 +105,35 @@ void Game::scanForMouse()
         updateAI();
         return;
     }
+    if (gameHasAI())
+        ponder();
 
     ImVec2 mousePos = ImGui::GetMousePos();
     mousePos.x -= ImGui::GetWindowPos().x;
     mousePos.y -= ImGui::GetWindowPos().y;
 
+    // a dragged piece follows the mouse until the button comes up
+    if (_dragBit)
+    {
+        _dragBit->setPosition(ImVec2(mousePos.x - _dragOffset.x, mousePos.y - _dragOffset.y));
+        if (!ImGui::IsMouseDown(0))
+        {
+            finishDrag(mousePos);
+            return;
+        }
+    }
+
     for (int y=0; y<_gameOptions.rowY; y++) {
         for (int x=0; x<_gameOptions.rowX; x++) {
 			BitHolder &holder = getHolderAt(x, y);
             if (holder.isMouseOver(mousePos)) {
-                if (ImGui::IsMouseClicked(0)) {
+                if (_dragBit) {
+                    holder.setHighlighted(true);
+                } else if (ImGui::IsMouseClicked(0)) {
+                    // pick up a piece the game lets move, otherwise it's a plain click
+                    if (holder.bit() && startDrag(holder, mousePos)) {
+                        continue;
+                    }
                     if (actionForEmptyHolder(&holder)) {
                         endTurn();
                     }
@@ -121,6 +147,55 @@ void Game::scanForMouse()
     }    
 }
 
+//
+// pick up the piece in a holder if both the holder and the game allow it
+//
+bool Game::startDrag(BitHolder &holder, const ImVec2 &mousePos)
+{
+	Bit *bit = holder.canDragBit(holder.bit());
+	if (!bit || !canBitMoveFrom(bit, &holder))
+		return false;
+
+	_dragBit = bit;
+	_dragSource = &holder;
+	_dragOffset = ImVec2(mousePos.x - bit->getPosition().x, mousePos.y - bit->getPosition().y);
+	bit->setPickedUp(true);
+	return true;
+}
+
+//
+// drop the dragged piece on the holder under the mouse, or send it back
+//
+void Game::finishDrag(const ImVec2 &mousePos)
+{
+	Bit *bit = _dragBit;
+	BitHolder *src = _dragSource;
+	_dragBit = nullptr;
+	_dragSource = nullptr;
+	bit->setPickedUp(false);
+
+	BitHolder *dst = nullptr;
+	for (int y=0; y<_gameOptions.rowY && !dst; y++) {
+		for (int x=0; x<_gameOptions.rowX && !dst; x++) {
+			if (getHolderAt(x, y).isMouseOver(mousePos))
+				dst = &getHolderAt(x, y);
+		}
+	}
+
+	if (dst && dst != src && canBitMoveFromTo(bit, src, dst) && dst->canDropBitAtPoint(bit, mousePos)) {
+		// the destination takes the piece first, anything it held is released
+		dst->dropBitAtPoint(bit, mousePos);
+		bit->setPosition(dst->getPosition());
+		src->draggedBitTo(bit, dst);
+		bitMovedFromTo(bit, src, dst);
+		return;
+	}
+	if (dst)
+		dst->willNotDropBit(bit);
+	src->cancelDragBit(bit);
+	bit->setPosition(src->getPosition());
+}
+
 //
 // draw the board and then the pieces
 // this will also go somewhere else when the heirarchy is set up
@@ -133,11 +208,15 @@ void Game::drawFrame()
         for (int x=0; x<_gameOptions.rowX; x++) {
 			BitHolder &holder = getHolderAt(x, y);
             holder.paintSprite();
-            if (holder.bit()) {
+            if (holder.bit() && holder.bit() != _dragBit) {
                 holder.bit()->paintSprite();
             }
         }
     }
+    // the dragged piece goes on top of everything
+    if (_dragBit) {
+        _dragBit->paintSprite();
+    }
 }
 
 void Game::bitMovedFromTo(Bit *bit, BitHolder *src, BitHolder *dst)
@@ -174,3 +253,11 @@ void Game::updateAI()
 {
 }
 
+void Game::ponder()
+{
+}
+
+void Game::drawSettings()
+{
+}
+
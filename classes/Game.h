@@ -23,6 +23,7 @@ struct GameOptions
 	int score;
 	int AIDepthSearches;
 	int AIMAXDepth;
+	int AIThreads;			// search threads for the AIs that can use more than one
 	bool AIvsAI;
 };
 
@@ -30,7 +31,7 @@ class Game
 {
 public:
 	Game();
-	~Game();
+	virtual ~Game();
 
 	void		startGame();
 
@@ -39,8 +40,15 @@ public:
 	// draw the current frame
 	void	drawFrame();
 
-	// end the current game turn
+	// end the current game turn, recording _lastMoveCode with it
 	void	endTurn();
+
+	// a move as the archive stores it, one byte: the cell played, numbered the
+	// way the game numbers its moves, for the games that place pieces, or the
+	// move's place in the legal move list for the ones that move them; a pass
+	// has its own code
+	static const int kNoMoveCode = -1;
+	static const int kPassMoveCode = 255;
 	
 	// Should return true if it is legal for the given bit to be moved from its current holder.
 	// Default implementation always returns true. 
@@ -75,6 +83,10 @@ public:
 	virtual		void	stopGame() = 0;
     virtual     bool    gameHasAI();
     virtual     void    updateAI();
+    // called every frame while a human is to move in a game with an AI, so the AI can think on their time
+    virtual     void    ponder();
+    // called inside the Settings window so a game can add its own controls
+    virtual     void    drawSettings();
 
 	virtual		std::string	initialStateString() = 0;
 	virtual		std::string stateString() const = 0;
@@ -100,9 +112,21 @@ public:
 
 	int						_score;
 	std::string				_lastMove;
+	// set by the game before each endTurn(), kNoMoveCode for a game that doesn't
+	// say, which keeps its games out of the archive
+	int						_lastMoveCode;
 
 	GameOptions 			_gameOptions;
 
 	int						_gameNumber;
+
+private:
+	// dragging pieces between holders, see scanForMouse
+	bool		startDrag(BitHolder &holder, const ImVec2 &mousePos);
+	void		finishDrag(const ImVec2 &mousePos);
+
+	Bit						*_dragBit;
+	BitHolder				*_dragSource;
+	ImVec2					_dragOffset;
 };
 
@@ -0,0 +1,345 @@
+#include "GameArchive.h"
+#include "BinaryIO.h"
+#include "Crc32.h"
+#include "FileIO.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <system_error>
+
+using namespace GameArchiveFormat;
+
+//
+// fixed width little-endian loads straight out of the mapping
+//
+static inline uint16_t load16(const uint8_t *p) { return uint16_t(p[0] | (p[1] << 8)); }
+static inline uint32_t load32(const uint8_t *p) { return uint32_t(load16(p)) | (uint32_t(load16(p + 2)) << 16); }
+static inline uint64_t load64(const uint8_t *p) { return uint64_t(load32(p)) | (uint64_t(load32(p + 4)) << 32); }
+
+static bool seekTo(FILE *file, uint64_t offset)
+{
+#ifdef _WIN32
+    return _fseeki64(file, static_cast<long long>(offset), SEEK_SET) == 0;
+#else
+    return fseeko(file, static_cast<off_t>(offset), SEEK_SET) == 0;
+#endif
+}
+
+struct ArchiveHeader
+{
+    uint16_t    flags;
+    uint64_t    gameCount;
+    uint64_t    indexOffset;
+    uint64_t    blocksEnd;
+};
+
+static bool parseHeader(const uint8_t *data, size_t size, ArchiveHeader &header, std::string &error)
+{
+    if (size < kHeaderSize || load32(data) != kMagic)
+    {
+        error = "not a game archive";
+        return false;
+    }
+    if (load16(data + 4) != kVersion)
+    {
+        error = "unsupported game archive version";
+        return false;
+    }
+    if (load32(data + kHeaderSize - 4) != Crc32::compute(data, kHeaderSize - 4))
+    {
+        error = "game archive header is damaged";
+        return false;
+    }
+    header.flags = load16(data + 6);
+    header.gameCount = load64(data + 8);
+    header.indexOffset = load64(data + 16);
+    header.blocksEnd = load64(data + 24);
+    return true;
+}
+
+//
+// writer
+//
+GameArchiveWriter::GameArchiveWriter() : _file(nullptr), _blocksEnd(kHeaderSize), _nextGameNumber(0)
+{
+}
+
+GameArchiveWriter::~GameArchiveWriter()
+{
+    close();
+}
+
+bool GameArchiveWriter::writeHeader(uint16_t flags, uint64_t indexOffset)
+{
+    std::vector<uint8_t> header;
+    ByteWriter w(header);
+    w.u32(kMagic);
+    w.u16(kVersion);
+    w.u16(flags);
+    w.u64(_index.size());
+    w.u64(indexOffset);
+    w.u64(_blocksEnd);
+    header.resize(kHeaderSize - 4, 0);
+    w.u32(Crc32::compute(header.data(), header.size()));
+
+    return seekTo(_file, 0) && std::fwrite(header.data(), 1, header.size(), _file) == header.size();
+}
+
+//
+// pick up the games already in an archive. a closed archive has its index
+// read back; one that was never closed is recovered by walking the blocks
+// until the first one that is cut short or fails its crc.
+//
+bool GameArchiveWriter::loadExisting(const std::string &path, std::string &error)
+{
+    MappedFile map;
+    if (!map.open(path, MappedFile::kSequential))
+    {
+        error = "can't read " + path;
+        return false;
+    }
+    const uint8_t *data = map.data();
+    const size_t size = map.size();
+
+    ArchiveHeader header;
+    if (!parseHeader(data, size, header, error))
+        return false;
+
+    _index.clear();
+    if ((header.flags & kFlagClosed) && header.indexOffset + header.gameCount * kIndexEntrySize <= size)
+    {
+        const uint8_t *p = data + header.indexOffset;
+        _index.resize(header.gameCount);
+        for (GameArchiveIndexEntry &entry : _index)
+        {
+            entry.gameNumber = load64(p);
+            entry.blockOffset = load64(p + 8);
+            entry.moveCount = load16(p + 16);
+            entry.result = p[18];
+            entry.cells = p[19];
+            entry.crc = load32(p + 20);
+            p += kIndexEntrySize;
+        }
+        _blocksEnd = header.blocksEnd;
+    }
+    else
+    {
+        size_t pos = kHeaderSize;
+        while (pos + kBlockHeaderSize <= size)
+        {
+            const uint8_t *block = data + pos;
+            GameArchiveIndexEntry entry;
+            entry.gameNumber = load64(block);
+            entry.moveCount = load16(block + 8);
+            entry.result = block[10];
+            entry.cells = block[11];
+            entry.crc = load32(block + 12);
+            entry.blockOffset = pos;
+            const size_t blockSize = kBlockHeaderSize + entry.moveCount;
+            if (pos + blockSize > size || Crc32::compute(block + kBlockHeaderSize, entry.moveCount) != entry.crc)
+                break;
+            _index.push_back(entry);
+            pos += blockSize;
+        }
+        _blocksEnd = pos;
+    }
+
+    _nextGameNumber = 0;
+    for (const GameArchiveIndexEntry &entry : _index)
+        _nextGameNumber = std::max(_nextGameNumber, entry.gameNumber + 1);
+    return true;
+}
+
+bool GameArchiveWriter::open(const std::string &path, std::string &error)
+{
+    close();
+    _index.clear();
+    _blocksEnd = kHeaderSize;
+    _nextGameNumber = 0;
+
+    std::error_code ec;
+    const bool exists = std::filesystem::exists(path, ec);
+    if (exists)
+    {
+        if (!loadExisting(path, error))
+            return false;
+        // drop the old index (or a torn tail); it is rewritten on close
+        std::filesystem::resize_file(path, _blocksEnd, ec);
+        if (ec)
+        {
+            error = "can't truncate " + path;
+            return false;
+        }
+    }
+
+    _file = std::fopen(path.c_str(), exists ? "r+b" : "w+b");
+    if (!_file)
+    {
+        error = "can't open " + path + " for writing";
+        return false;
+    }
+    // mark the archive open until close() writes the index
+    if (!writeHeader(0, 0) || !seekTo(_file, _blocksEnd))
+    {
+        error = "can't write " + path;
+        close();
+        return false;
+    }
+    std::fflush(_file);
+    return true;
+}
+
+bool GameArchiveWriter::addGame(uint64_t gameNumber, uint8_t result, uint8_t cells, const uint8_t *moves, size_t moveCount)
+{
+    if (!_file || moveCount > kMaxMoves)
+        return false;
+
+    GameArchiveIndexEntry entry;
+    entry.gameNumber = gameNumber;
+    entry.blockOffset = _blocksEnd;
+    entry.moveCount = static_cast<uint16_t>(moveCount);
+    entry.result = result;
+    entry.cells = cells;
+    entry.crc = Crc32::compute(moves, moveCount);
+
+    uint8_t header[kBlockHeaderSize];
+    for (int i = 0; i < 8; ++i)
+        header[i] = uint8_t(gameNumber >> (8 * i));
+    header[8] = uint8_t(moveCount);
+    header[9] = uint8_t(moveCount >> 8);
+    header[10] = result;
+    header[11] = cells;
+    for (int i = 0; i < 4; ++i)
+        header[12 + i] = uint8_t(entry.crc >> (8 * i));
+
+    if (std::fwrite(header, 1, sizeof(header), _file) != sizeof(header) ||
+        (moveCount && std::fwrite(moves, 1, moveCount, _file) != moveCount))
+        return false;
+    // hand the block to the OS so a crash only loses the index, which open() can rebuild
+    std::fflush(_file);
+
+    _blocksEnd += kBlockHeaderSize + moveCount;
+    _index.push_back(entry);
+    _nextGameNumber = std::max(_nextGameNumber, gameNumber + 1);
+    return true;
+}
+
+bool GameArchiveWriter::close()
+{
+    if (!_file)
+        return true;
+
+    std::stable_sort(_index.begin(), _index.end(), [](const GameArchiveIndexEntry &a, const GameArchiveIndexEntry &b) {
+        return a.gameNumber < b.gameNumber;
+    });
+
+    std::vector<uint8_t> index;
+    index.reserve(_index.size() * kIndexEntrySize);
+    ByteWriter w(index);
+    for (const GameArchiveIndexEntry &entry : _index)
+    {
+        w.u64(entry.gameNumber);
+        w.u64(entry.blockOffset);
+        w.u16(entry.moveCount);
+        w.u8(entry.result);
+        w.u8(entry.cells);
+        w.u32(entry.crc);
+    }
+
+    // index first, then the header that points at it
+    bool ok = seekTo(_file, _blocksEnd) && std::fwrite(index.data(), 1, index.size(), _file) == index.size();
+    ok = ok && FileIO::syncFile(_file);
+    ok = ok && writeHeader(kFlagClosed, _blocksEnd);
+    ok = FileIO::syncFile(_file) && ok;
+    ok = (std::fclose(_file) == 0) && ok;
+    _file = nullptr;
+    return ok;
+}
+
+//
+// reader
+//
+bool GameArchiveReader::open(const std::string &path, std::string &error)
+{
+    close();
+    if (!_map.open(path, MappedFile::kRandom))
+    {
+        error = "can't map " + path;
+        return false;
+    }
+
+    ArchiveHeader header;
+    if (!parseHeader(_map.data(), _map.size(), header, error))
+    {
+        close();
+        return false;
+    }
+    if (!(header.flags & kFlagClosed))
+    {
+        error = path + " was not closed cleanly, compact it to rebuild the index";
+        close();
+        return false;
+    }
+    if (header.indexOffset + header.gameCount * kIndexEntrySize > _map.size())
+    {
+        error = path + " is truncated";
+        close();
+        return false;
+    }
+
+    _index = _map.data() + header.indexOffset;
+    _gameCount = static_cast<size_t>(header.gameCount);
+    // the index is binary searched, pull it in now rather than a page fault at a time
+    _map.adviseWillNeed(header.indexOffset, _gameCount * kIndexEntrySize);
+    return true;
+}
+
+GameRecordView GameArchiveReader::at(size_t i) const
+{
+    const uint8_t *entry = _index + i * kIndexEntrySize;
+    GameRecordView view;
+    view.gameNumber = load64(entry);
+    const uint64_t offset = load64(entry + 8);
+    view.moveCount = load16(entry + 16);
+    view.result = entry[18];
+    view.cells = entry[19];
+    view.crc = load32(entry + 20);
+    // a damaged offset yields an empty game rather than a read past the mapping
+    if (offset + kBlockHeaderSize + view.moveCount > _map.size())
+    {
+        view.moveCount = 0;
+        view.moves = nullptr;
+        return view;
+    }
+    view.moves = _map.data() + offset + kBlockHeaderSize;
+    return view;
+}
+
+bool GameArchiveReader::find(uint64_t gameNumber, GameRecordView &view) const
+{
+    size_t lo = 0;
+    size_t hi = _gameCount;
+    while (lo < hi)
+    {
+        const size_t mid = lo + (hi - lo) / 2;
+        if (load64(_index + mid * kIndexEntrySize) < gameNumber)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (lo == _gameCount || load64(_index + lo * kIndexEntrySize) != gameNumber)
+        return false;
+    view = at(lo);
+    return true;
+}
+
+size_t GameArchiveReader::verify() const
+{
+    size_t bad = 0;
+    for (GameRecordView view : *this)
+    {
+        if (!view.moves || Crc32::compute(view.moves, view.moveCount) != view.crc)
+            ++bad;
+    }
+    return bad;
+}
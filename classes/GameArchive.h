@@ -0,0 +1,138 @@
+#pragma once
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "MappedFile.h"
+
+//
+// archive of finished games, meant to hold millions of records
+//
+// layout (all integers little-endian):
+//   header      64 bytes, see below
+//   move blocks one per game, appended as games finish:
+//                 u64 game number, u16 move count, u8 result, u8 board cells,
+//                 u32 crc32 of the moves, then one byte per move (the game's
+//                 move code, see Game::kPassMoveCode)
+//   index       one fixed-size 24 byte entry per game, sorted by game number:
+//                 u64 game number, u64 block offset, u16 move count, u8 result,
+//                 u8 board cells, u32 crc32 of the moves
+//
+// header:
+//   u32 magic 'TTGA'  u16 version  u16 flags  u64 game count  u64 index offset
+//   u64 end of move blocks  zero padding  u32 crc32 of the first 60 bytes
+//
+// the writer only appends move blocks while games are played and writes the
+// index when it is closed. until then the header is marked open; reopening an
+// archive that was never closed rebuilds the index by scanning the blocks.
+//
+// the reader maps the file and hands out views that point straight into the
+// mapping, so iterating millions of games copies nothing.
+//
+
+namespace GameArchiveFormat
+{
+    const uint32_t kMagic = 0x41475454;     // "TTGA"
+    const uint16_t kVersion = 1;
+    const uint16_t kFlagClosed = 1;         // index and header are valid
+
+    const size_t kHeaderSize = 64;
+    const size_t kBlockHeaderSize = 16;
+    const size_t kIndexEntrySize = 24;
+    const size_t kMaxMoves = 0xFFFF;
+
+    // game results stored per record
+    const uint8_t kResultDraw = 0;          // 1..n = player number + 1 won
+    const uint8_t kResultUnfinished = 0xFF;
+}
+
+// a game as it sits in the archive, pointing into the mapped file
+struct GameRecordView
+{
+    uint64_t        gameNumber;
+    uint8_t         result;
+    uint8_t         cells;          // board size, e.g. 9 for tic-tac-toe
+    uint16_t        moveCount;
+    uint32_t        crc;
+    const uint8_t  *moves;          // moveCount move codes in play order
+};
+
+// one fixed-size index entry, as kept in memory by the writer
+struct GameArchiveIndexEntry
+{
+    uint64_t    gameNumber;
+    uint64_t    blockOffset;
+    uint16_t    moveCount;
+    uint8_t     result;
+    uint8_t     cells;
+    uint32_t    crc;
+};
+
+//
+// streaming writer, one addGame() per finished game
+//
+class GameArchiveWriter
+{
+public:
+    GameArchiveWriter();
+    ~GameArchiveWriter();
+
+    // creates the archive, or reopens an existing one to append more games
+    bool        open(const std::string &path, std::string &error);
+    // writes the sorted index and marks the archive closed
+    bool        close();
+
+    bool        addGame(uint64_t gameNumber, uint8_t result, uint8_t cells, const uint8_t *moves, size_t moveCount);
+
+    size_t      gameCount() const { return _index.size(); }
+    // one past the highest game number stored so far
+    uint64_t    nextGameNumber() const { return _nextGameNumber; }
+    bool        isOpen() const { return _file != nullptr; }
+
+private:
+    bool        writeHeader(uint16_t flags, uint64_t indexOffset);
+    bool        loadExisting(const std::string &path, std::string &error);
+
+    FILE                               *_file;
+    std::vector<GameArchiveIndexEntry>  _index;
+    uint64_t                            _blocksEnd;
+    uint64_t                            _nextGameNumber;
+};
+
+//
+// zero-copy reader over a closed archive
+//
+class GameArchiveReader
+{
+public:
+    bool            open(const std::string &path, std::string &error);
+    void            close() { _map.close(); _gameCount = 0; }
+
+    size_t          gameCount() const { return _gameCount; }
+    // i-th game in game number order
+    GameRecordView  at(size_t i) const;
+    // binary search the index for a game number
+    bool            find(uint64_t gameNumber, GameRecordView &view) const;
+    // check the crc of every move block, returns the number of bad records
+    size_t          verify() const;
+
+    class Iterator
+    {
+    public:
+        Iterator(const GameArchiveReader *reader, size_t i) : _reader(reader), _i(i) {}
+        GameRecordView  operator*() const { return _reader->at(_i); }
+        Iterator       &operator++() { ++_i; return *this; }
+        bool            operator!=(const Iterator &other) const { return _i != other._i; }
+    private:
+        const GameArchiveReader *_reader;
+        size_t                   _i;
+    };
+    Iterator        begin() const { return Iterator(this, 0); }
+    Iterator        end() const { return Iterator(this, _gameCount); }
+
+private:
+    MappedFile      _map;
+    const uint8_t  *_index = nullptr;
+    size_t          _gameCount = 0;
+};
@@ -0,0 +1,278 @@
+#include "GameJournal.h"
+#include "BinaryIO.h"
+#include "Crc32.h"
+#include "FileIO.h"
+
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+
+static const size_t kFileHeaderSize = 8;
+static const size_t kRecordOverhead = 2 + 1 + 4;   // size, type, crc
+static const size_t kMaxPayload = 1024;
+
+//
+// walk the records in a journal image, calling visit(type, reader) for each
+// good one. returns the byte offset just past the last good record.
+//
+template <typename Visit>
+static size_t scanRecords(const std::vector<uint8_t> &bytes, Visit visit)
+{
+    size_t pos = kFileHeaderSize;
+    while (pos + kRecordOverhead <= bytes.size())
+    {
+        ByteReader head(bytes.data() + pos, 3);
+        const size_t payloadSize = head.u16();
+        const uint8_t type = head.u8();
+        const size_t recordSize = kRecordOverhead + payloadSize;
+        if (pos + recordSize > bytes.size())
+            break;
+
+        const uint8_t *body = bytes.data() + pos + 2;      // type + payload
+        ByteReader crc(body + 1 + payloadSize, 4);
+        if (crc.u32() != Crc32::compute(body, 1 + payloadSize))
+            break;
+
+        ByteReader payload(body + 1, payloadSize);
+        visit(type, payload);
+        pos += recordSize;
+    }
+    return pos;
+}
+
+static bool validHeader(const std::vector<uint8_t> &bytes)
+{
+    if (bytes.size() < kFileHeaderSize)
+        return false;
+    ByteReader r(bytes.data(), kFileHeaderSize);
+    return r.u32() == GameJournal::kMagic && r.u16() == GameJournal::kVersion;
+}
+
+static void writeFileHeader(FILE *file)
+{
+    std::vector<uint8_t> header;
+    ByteWriter w(header);
+    w.u32(GameJournal::kMagic);
+    w.u16(GameJournal::kVersion);
+    w.u16(0);
+    std::fwrite(header.data(), 1, header.size(), file);
+}
+
+GameJournal::GameJournal() :
+    _file(nullptr),
+    _pendingRecords(0),
+    _appendedSeq(0),
+    _durableSeq(0),
+    _restart(false),
+    _flushRequested(false),
+    _quit(false),
+    _recordsWritten(0),
+    _syncCount(0)
+{
+}
+
+GameJournal::~GameJournal()
+{
+    close();
+}
+
+bool GameJournal::replay(const std::string &path, JournalGame &game)
+{
+    std::vector<uint8_t> bytes;
+    if (!FileIO::readAll(path, bytes) || !validHeader(bytes))
+        return false;
+
+    bool found = false;
+    game.gameNumber = -1;
+    game.turns.clear();
+    scanRecords(bytes, [&](uint8_t type, ByteReader &r) {
+        if (type == kNewGame)
+        {
+            game.gameNumber = r.i32();
+            game.turns.clear();
+            found = true;
+        }
+        else if (type == kTurn)
+        {
+            const int gameNumber = r.i32();
+            JournalTurn turn;
+            turn.turnNo = r.u32();
+            std::string board(r.remaining(), '\0');
+            r.read(board.data(), board.size());
+            turn.boardState = std::move(board);
+            if (gameNumber != game.gameNumber)
+            {
+                game.gameNumber = gameNumber;
+                game.turns.clear();
+            }
+            game.turns.push_back(std::move(turn));
+            found = true;
+        }
+    });
+    return found;
+}
+
+bool GameJournal::open(const std::string &path)
+{
+    close();
+    _path = path;
+
+    // keep every good record and cut off a torn tail so new appends follow valid data
+    std::vector<uint8_t> bytes;
+    bool reuse = FileIO::readAll(path, bytes) && validHeader(bytes);
+    if (reuse)
+    {
+        const size_t validEnd = scanRecords(bytes, [](uint8_t, ByteReader &) {});
+        if (validEnd != bytes.size())
+        {
+            std::error_code ec;
+            std::filesystem::resize_file(path, validEnd, ec);
+            reuse = !ec;
+        }
+    }
+
+    _file = std::fopen(path.c_str(), reuse ? "ab" : "wb");
+    if (!_file)
+        return false;
+    if (!reuse)
+    {
+        writeFileHeader(_file);
+        FileIO::syncFile(_file);
+    }
+
+    _quit = false;
+    _restart = false;
+    _thread = std::thread(&GameJournal::run, this);
+    return true;
+}
+
+void GameJournal::close()
+{
+    if (!_thread.joinable())
+        return;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _quit = true;
+    }
+    _wake.notify_one();
+    _thread.join();
+    if (_file)
+    {
+        std::fclose(_file);
+        _file = nullptr;
+    }
+}
+
+void GameJournal::appendRecord(RecordType type, const uint8_t *payload, size_t size)
+{
+    // build the whole record on the stack so the lock only covers a memcpy
+    uint8_t record[kRecordOverhead + kMaxPayload];
+    record[0] = uint8_t(size);
+    record[1] = uint8_t(size >> 8);
+    record[2] = type;
+    std::memcpy(record + 3, payload, size);
+    const uint32_t crc = Crc32::compute(record + 2, 1 + size);
+    for (int i = 0; i < 4; ++i)
+        record[3 + size + i] = uint8_t(crc >> (8 * i));
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _pending.insert(_pending.end(), record, record + kRecordOverhead + size);
+        ++_pendingRecords;
+        ++_appendedSeq;
+    }
+    _wake.notify_one();
+}
+
+void GameJournal::beginGame(int gameNumber)
+{
+    if (!isOpen())
+        return;
+
+    {
+        // the writer truncates the file before writing anything queued after this
+        std::lock_guard<std::mutex> lock(_mutex);
+        _pending.clear();
+        _pendingRecords = 0;
+        _restart = true;
+    }
+    uint8_t payload[4];
+    for (int i = 0; i < 4; ++i)
+        payload[i] = uint8_t(uint32_t(gameNumber) >> (8 * i));
+    appendRecord(kNewGame, payload, sizeof(payload));
+}
+
+void GameJournal::appendTurn(int gameNumber, unsigned int turnNo, const std::string &boardState)
+{
+    if (!isOpen() || boardState.size() > kMaxPayload - 8)
+        return;
+
+    uint8_t payload[kMaxPayload];
+    for (int i = 0; i < 4; ++i)
+    {
+        payload[i] = uint8_t(uint32_t(gameNumber) >> (8 * i));
+        payload[4 + i] = uint8_t(turnNo >> (8 * i));
+    }
+    std::memcpy(payload + 8, boardState.data(), boardState.size());
+    appendRecord(kTurn, payload, 8 + boardState.size());
+}
+
+void GameJournal::flush()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    const uint64_t target = _appendedSeq;
+    if (_durableSeq >= target || !isOpen())
+        return;
+    _flushRequested = true;
+    _wake.notify_one();
+    _flushed.wait(lock, [&] { return _durableSeq >= target; });
+}
+
+//
+// writer thread: collect a batch, write it, fsync once for the whole batch
+//
+void GameJournal::run()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    for (;;)
+    {
+        _wake.wait(lock, [this] { return _quit || _restart || !_pending.empty(); });
+        if (_quit && !_restart && _pending.empty())
+            break;
+
+        // group commit: give other appends a moment to join this batch
+        if (!_quit && _pending.size() < kGroupCommitBytes)
+            _wake.wait_for(lock, kGroupCommitWindow, [this] { return _quit || _flushRequested || _pending.size() >= kGroupCommitBytes; });
+        _flushRequested = false;
+
+        _writing.swap(_pending);
+        const uint64_t records = _pendingRecords;
+        _pendingRecords = 0;
+        const bool restart = _restart;
+        const uint64_t seq = _appendedSeq;
+        _restart = false;
+        lock.unlock();
+
+        if (restart)
+        {
+            std::fclose(_file);
+            _file = std::fopen(_path.c_str(), "wb");
+            if (_file)
+                writeFileHeader(_file);
+        }
+        if (_file)
+        {
+            std::fwrite(_writing.data(), 1, _writing.size(), _file);
+            FileIO::syncFile(_file);
+        }
+        _writing.clear();
+
+        lock.lock();
+        _recordsWritten += records;
+        _durableSeq = seq;
+        ++_syncCount;
+        _flushed.notify_all();
+    }
+    _durableSeq = _appendedSeq;
+    _flushed.notify_all();
+}
@@ -0,0 +1,100 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+//
+// append-only autosave journal
+//
+// every finished turn is appended as a small binary record so a game in
+// progress survives the process dying. appends only copy the record into a
+// memory buffer; a writer thread batches whatever has piled up and does one
+// write + fsync for the whole batch (group commit), so the render loop never
+// waits on the disk.
+//
+// file layout:
+//   u32 magic 'TTJL'  u16 version  u16 reserved
+//   records: u16 payload size, u8 type, payload, u32 crc32(type + payload)
+//
+// a record cut short by a crash fails its crc; replay stops there and the
+// torn tail is trimmed off before new records are appended.
+//
+
+struct JournalTurn
+{
+    unsigned int    turnNo;
+    std::string     boardState;
+};
+
+// what replay found for the most recent game in the journal
+struct JournalGame
+{
+    int                         gameNumber;
+    std::vector<JournalTurn>    turns;      // in order, not including the start of game
+};
+
+class GameJournal
+{
+public:
+    static const uint32_t kMagic = 0x4C4A5454;     // "TTJL"
+    static const uint16_t kVersion = 1;
+
+    enum RecordType : uint8_t
+    {
+        kNewGame = 1,
+        kTurn = 2
+    };
+
+    GameJournal();
+    ~GameJournal();
+
+    // read the journal and return the last game in it; false if there is nothing to restore
+    static bool replay(const std::string &path, JournalGame &game);
+
+    // trims any torn tail and starts the writer thread
+    bool open(const std::string &path);
+    void close();
+
+    // start a fresh game: everything journaled so far is obsolete and is dropped
+    void beginGame(int gameNumber);
+    // hot path, called once per finished turn
+    void appendTurn(int gameNumber, unsigned int turnNo, const std::string &boardState);
+
+    // block until everything appended so far is on disk
+    void flush();
+
+    uint64_t recordsWritten() const { return _recordsWritten; }
+    uint64_t syncCount() const { return _syncCount; }
+    bool     isOpen() const { return _thread.joinable(); }
+
+private:
+    void appendRecord(RecordType type, const uint8_t *payload, size_t size);
+    void run();
+
+    std::string             _path;
+    FILE                   *_file;
+    std::thread             _thread;
+    std::mutex              _mutex;
+    std::condition_variable _wake;
+    std::condition_variable _flushed;
+    std::vector<uint8_t>    _pending;       // filled by appends
+    std::vector<uint8_t>    _writing;       // owned by the writer thread
+    uint64_t                _pendingRecords;
+    uint64_t                _appendedSeq;
+    uint64_t                _durableSeq;
+    bool                    _restart;
+    bool                    _flushRequested;
+    bool                    _quit;
+    std::atomic<uint64_t>   _recordsWritten;
+    std::atomic<uint64_t>   _syncCount;
+
+    // how long the writer waits for more records before committing a batch
+    static constexpr std::chrono::microseconds kGroupCommitWindow{ 2000 };
+    static const size_t kGroupCommitBytes = 64 * 1024;
+};
@@ -0,0 +1,296 @@
+#include "Gomoku.h"
+
+#include <algorithm>
+#include <thread>
+
+// the AI has to answer inside kThinkTime, the search stops a little short of it
+static const std::chrono::milliseconds kThinkTime(100);
+static const std::chrono::milliseconds kSearchTime(90);
+// a ponder search runs until the human moves, this only puts an end to it if they never do
+static const std::chrono::milliseconds kPonderTime(10 * 60 * 1000);
+// the sprites are 100x100, drawn at half size so the board fits
+static const float kCellSize = 50.0f;
+
+const char *Gomoku::kBookPath = "gomoku.book";
+const char *Gomoku::kNetworkPath = "gomoku.nnue";
+
+Gomoku::Gomoku() : _lastMoveFromBook(false), _useNetwork(false), _pondering(true), _ponderMove(-1), _ponderHits(0), _ponderMisses(0)
+{
+}
+
+Gomoku::~Gomoku()
+{
+    _ai.cancel();
+}
+
+Bit* Gomoku::PieceForPlayer(const int playerNumber)
+{
+    Bit *bit = new Bit();
+    bit->LoadTextureFromFile(playerNumber == 0 ? "x.png" : "o.png");
+    bit->setSize(kCellSize, kCellSize);
+    bit->setOwner(getPlayerAt(playerNumber));
+    return bit;
+}
+
+//
+// setup the game board, this is called once at the start of the game
+//
+void Gomoku::setUpBoard()
+{
+    setNumberOfPlayers(2);
+    setAIPlayer(1);
+
+    _gameOptions.rowX = kSize;
+    _gameOptions.rowY = kSize;
+
+    for (int row = 0; row < kSize; ++row)
+    {
+        for (int col = 0; col < kSize; ++col)
+        {
+            ImVec2 pos(col * kCellSize, row * kCellSize);
+            _grid[row][col].initHolder(pos, "square.png", col, row);
+            _grid[row][col].setSize(kCellSize, kCellSize);
+            _grid[row][col].setGameTag(GomokuBoard::cellIndex(col, row));
+        }
+    }
+    _board.clear();
+
+    // the table is big, only allocate it once
+    if (!_search)
+        _search = std::make_unique<GomokuSearch>();
+    else
+        _search->clearTable();
+    if (!_book.isLoaded())
+    {
+        std::string error;
+        if (!_book.load(kBookPath, error))
+            _bookStatus = error;
+        else if (_book.boardSize() != kSize)
+        {
+            _book = OpeningBook();
+            _bookStatus = "made for another board size";
+        }
+        else
+            _bookStatus = std::to_string(_book.size()) + " positions";
+    }
+    if (!_network.isLoaded())
+    {
+        std::string error;
+        _networkStatus = _network.load(kNetworkPath, error) ? std::string("loaded, ") + GomokuNetwork::kernelName() : error;
+    }
+    _lastMoveFromBook = false;
+    _ponderMove = -1;
+    _ponderHits = 0;
+    _ponderMisses = 0;
+
+    startGame();
+}
+
+bool Gomoku::actionForEmptyHolder(BitHolder *holder)
+{
+    if (!holder)
+        return false;
+    return placeStone(holder->gameTag());
+}
+
+bool Gomoku::placeStone(int index)
+{
+    if (index < 0 || index >= GomokuBoard::kCells || _board.cell(index) != GomokuBoard::kEmpty)
+        return false;
+    // nothing more to play once somebody has won
+    if (_board.winner() != GomokuBoard::kEmpty)
+        return false;
+
+    const int player = getCurrentPlayer()->playerNumber();
+    Square &square = _grid[index / kSize][index % kSize];
+    Bit *placeBit = PieceForPlayer(player);
+    placeBit->setPosition(square.getPosition());
+    square.setBit(placeBit);
+    _board.place(index, player);
+    _lastMoveCode = index;
+    return true;
+}
+
+bool Gomoku::canBitMoveFrom(Bit *bit, BitHolder *src)
+{
+    // stones stay where they're put
+    return false;
+}
+
+bool Gomoku::canBitMoveFromTo(Bit* bit, BitHolder*src, BitHolder*dst)
+{
+    return false;
+}
+
+//
+// free all the memory used by the game on the heap
+//
+void Gomoku::stopGame()
+{
+    // a search for the old board is no use any more
+    _ai.cancel();
+    _ponderMove = -1;
+    for (int row = 0; row < kSize; ++row)
+    {
+        for (int col = 0; col < kSize; ++col)
+        {
+            _grid[row][col].destroyBit();
+        }
+    }
+    _board.clear();
+}
+
+Player* Gomoku::checkForWinner()
+{
+    const int winner = _board.winner();
+    return winner == GomokuBoard::kEmpty ? nullptr : getPlayerAt(winner);
+}
+
+bool Gomoku::checkForDraw()
+{
+    return _board.full() && _board.winner() == GomokuBoard::kEmpty;
+}
+
+//
+// state strings, 225 characters left-to-right, top-to-bottom,
+// '0' empty, '1' player 1 (black), '2' player 2 (white)
+//
+std::string Gomoku::initialStateString()
+{
+    return std::string(GomokuBoard::kCells, '0');
+}
+
+std::string Gomoku::stateString() const
+{
+    std::string state;
+    state.reserve(GomokuBoard::kCells);
+    for (int index = 0; index < GomokuBoard::kCells; ++index)
+    {
+        const int player = _board.cell(index);
+        state.push_back(player == GomokuBoard::kEmpty ? '0' : static_cast<char>('1' + player));
+    }
+    return state;
+}
+
+void Gomoku::setStateString(const std::string &s)
+{
+    stopGame();
+
+    for (int index = 0; index < GomokuBoard::kCells && index < static_cast<int>(s.size()); ++index)
+    {
+        const int savedPlayerIndex = s[index] - '1';
+        if (savedPlayerIndex < 0 || savedPlayerIndex > 1)
+            continue;
+
+        Square &square = _grid[index / kSize][index % kSize];
+        Bit *b = PieceForPlayer(savedPlayerIndex);
+        b->setPosition(square.getPosition());
+        square.setBit(b);
+        _board.place(index, savedPlayerIndex);
+    }
+
+    _gameOptions.currentTurnNo = static_cast<unsigned int>(_board.stoneCount());
+}
+
+//
+// called every frame while it's the AI's turn: the first call starts the
+// search on the worker thread, later calls play the move once it's ready
+//
+void Gomoku::updateAI()
+{
+    // the ponder search was for the move the human just made, or it's no use
+    if (_ponderMove >= 0)
+    {
+        const bool hit = _board.lastMove() == _ponderMove;
+        if (hit)
+            ++_ponderHits;
+        else
+            ++_ponderMisses;
+        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - _ponderStart);
+        if (hit && !checkForWinner() && !checkForDraw() && _book.probe(_board.cells()) < 0)
+        {
+            _ai.setBudget(std::max(std::chrono::milliseconds(0), kThinkTime - elapsed));
+            _lastMoveFromBook = false;
+        }
+        else
+            _ai.cancel();
+        _ponderMove = -1;
+    }
+
+    if (checkForWinner() || checkForDraw())
+        return;
+
+    if (!_ai.busy())
+    {
+        // a book position is answered straight away
+        const int bookMove = _book.probe(_board.cells());
+        if (bookMove >= 0 && placeStone(bookMove))
+        {
+            _lastMoveFromBook = true;
+            endTurn();
+            return;
+        }
+        _lastMoveFromBook = false;
+
+        const GomokuBoard board = _board;
+        GomokuSearch *search = _search.get();
+        search->setThreads(_gameOptions.AIThreads);
+        search->setNetwork(searchNetwork());
+        _ai.start([search, board](const std::atomic<bool> &stop) {
+            search->setStopFlag(&stop);
+            return search->bestMove(board, kSearchTime);
+        }, kThinkTime);
+        return;
+    }
+
+    int index;
+    if (_ai.poll(index) && placeStone(index))
+        endTurn();
+}
+
+//
+// called every frame while the human is to move: guess their move and
+// start searching the reply to it, see the class comment
+//
+void Gomoku::ponder()
+{
+    if (!_pondering || _ai.busy() || !_search || checkForWinner() || checkForDraw())
+        return;
+
+    const int expected = _search->expectedMove(_board);
+    if (expected < 0)
+        return;
+    GomokuBoard board = _board;
+    board.place(expected, board.sideToMove());
+    // nothing to think about if the game ends there or the book has the answer
+    if (board.winner() != GomokuBoard::kEmpty || board.full() || _book.probe(board.cells()) >= 0)
+        return;
+
+    GomokuSearch *search = _search.get();
+    search->setThreads(_gameOptions.AIThreads);
+    search->setNetwork(searchNetwork());
+    _ai.start([search, board](const std::atomic<bool> &stop) {
+        search->setStopFlag(&stop);
+        return search->bestMove(board, kPonderTime);
+    }, kPonderTime);
+    _ponderMove = expected;
+    _ponderStart = std::chrono::steady_clock::now();
+}
+
+void Gomoku::drawSettings()
+{
+    const int hardwareThreads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    ImGui::SetNextItemWidth(150);
+    ImGui::SliderInt("AI threads", &_gameOptions.AIThreads, 1, hardwareThreads);
+    ImGui::Text("Opening book: %s", _bookStatus.c_str());
+    ImGui::Text("Network: %s", _networkStatus.c_str());
+    if (_network.isLoaded())
+        ImGui::Checkbox("Score positions with the network", &_useNetwork);
+    ImGui::Checkbox("Ponder on your time", &_pondering);
+    ImGui::Text("Ponder: %d right, %d wrong", _ponderHits, _ponderMisses);
+    // the worker is joined once the move is played, so the numbers are safe to read
+    if (_lastMoveFromBook)
+        ImGui::Text("Last move: from the book");
+    else if (_search && !_ai.busy() && _search->nodeCount() > 0)
+        ImGui::Text("Last search: depth %d, %llu nodes", _search->completedDepth(), (unsigned long long)_search->nodeCount());
+}
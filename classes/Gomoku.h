@@ -0,0 +1,83 @@
+#pragma once
+#include "Game.h"
+#include "Square.h"
+#include "AIWorker.h"
+#include "GomokuBoard.h"
+#include "GomokuNetwork.h"
+#include "GomokuSearch.h"
+#include "OpeningBook.h"
+
+#include <memory>
+
+//
+// gomoku, five in a row on a 15x15 board
+//
+// clicking an empty cell places the current player's stone there, black
+// (player 1) goes first and five or more in a row wins. the AI is
+// GomokuSearch on an AIWorker thread with a tenth of a second per move,
+// searching with GameOptions::AIThreads threads (set in the Settings
+// window). positions in the opening book at kBookPath (made by
+// tools/gomoku_book) are answered from it without searching.
+//
+// while the human thinks, the AI ponders: it guesses their move (the one
+// its table expects, see GomokuSearch::expectedMove()) and searches its
+// reply to that on the worker with no time limit. if the guess was right
+// the search carries on as the real one, with whatever is left of
+// kThinkTime since it started, so after a long think the answer is
+// immediate and comes from a much deeper search; if it was wrong it's
+// stopped and only what it left in the table is kept.
+//
+// if there's a network at kNetworkPath (tools/gomoku_nnue trains one), the
+// Settings window can switch the search's leaf scores over to it.
+//
+class Gomoku : public Game
+{
+public:
+    static const int kSize = GomokuBoard::kSize;
+    static const char *kBookPath;
+    static const char *kNetworkPath;
+
+    Gomoku();
+    ~Gomoku();
+
+    // set up the board
+    void        setUpBoard() override;
+
+    Player*     checkForWinner() override;
+    bool        checkForDraw() override;
+    std::string initialStateString() override;
+    std::string stateString() const override;
+    void        setStateString(const std::string &s) override;
+    bool        actionForEmptyHolder(BitHolder *holder) override;
+    bool        canBitMoveFrom(Bit*bit, BitHolder *src) override;
+    bool        canBitMoveFromTo(Bit* bit, BitHolder*src, BitHolder*dst) override;
+    void        stopGame() override;
+
+    void        updateAI() override;
+    void        ponder() override;
+    bool        gameHasAI() override { return true; }
+    void        drawSettings() override;
+    BitHolder &getHolderAt(const int x, const int y) override { return _grid[y][x]; }
+private:
+    Bit *       PieceForPlayer(const int playerNumber);
+    // put the current player's stone on a cell, false if it's taken
+    bool        placeStone(int index);
+    // the network the search should score with, nullptr for the window totals
+    const GomokuNetwork *searchNetwork() const { return _useNetwork && _network.isLoaded() ? &_network : nullptr; }
+
+    Square          _grid[kSize][kSize];
+    GomokuBoard     _board;
+    AIWorker        _ai;
+    std::unique_ptr<GomokuSearch>   _search;
+    OpeningBook     _book;
+    std::string     _bookStatus;
+    bool            _lastMoveFromBook;
+    GomokuNetwork   _network;
+    std::string     _networkStatus;
+    bool            _useNetwork;        // the Settings checkbox
+    bool            _pondering;         // the Settings checkbox
+    int             _ponderMove;        // the human move the running ponder search expects, -1 if none
+    std::chrono::steady_clock::time_point   _ponderStart;
+    int             _ponderHits;
+    int             _ponderMisses;
+};
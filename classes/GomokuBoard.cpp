@@ -0,0 +1,225 @@
+#include "GomokuBoard.h"
+
+#include <array>
+#include <cstring>
+
+// what a window with this many stones of one player (and none of the other's) is worth
+static const int kWindowValue[6] = { 0, 1, 10, 100, 1000, 0 };
+// the gain for completing five, more than any amount of window value
+static const int kFiveGain = 1000000;
+
+//
+// which cells make up each window and which windows go through each cell,
+// the same for every board so they're built once
+//
+struct GomokuWindows
+{
+    int16_t cells[GomokuBoard::kWindows][5];
+    int16_t byCell[GomokuBoard::kCells][20];
+    uint8_t byCellCount[GomokuBoard::kCells];
+
+    GomokuWindows()
+    {
+        static const int kDirections[4][2] = { { 1, 0 }, { 0, 1 }, { 1, 1 }, { 1, -1 } };
+        const int size = GomokuBoard::kSize;
+        std::memset(byCellCount, 0, sizeof(byCellCount));
+        int window = 0;
+        for (const auto &dir : kDirections)
+        {
+            for (int row = 0; row < size; ++row)
+            {
+                for (int col = 0; col < size; ++col)
+                {
+                    const int endCol = col + 4 * dir[0];
+                    const int endRow = row + 4 * dir[1];
+                    if (endCol < 0 || endCol >= size || endRow < 0 || endRow >= size)
+                        continue;
+                    for (int i = 0; i < 5; ++i)
+                    {
+                        const int index = GomokuBoard::cellIndex(col + i * dir[0], row + i * dir[1]);
+                        cells[window][i] = static_cast<int16_t>(index);
+                        byCell[index][byCellCount[index]++] = static_cast<int16_t>(window);
+                    }
+                    ++window;
+                }
+            }
+        }
+    }
+};
+
+static const GomokuWindows &windows()
+{
+    static const GomokuWindows tables;
+    return tables;
+}
+
+//
+// zobrist keys by player and cell, from a fixed splitmix64 stream
+//
+static constexpr std::array<std::array<uint64_t, GomokuBoard::kCells>, 2> buildZobrist()
+{
+    std::array<std::array<uint64_t, GomokuBoard::kCells>, 2> keys{};
+    uint64_t state = 0x6A09E667F3BCC908ull;
+    for (auto &player : keys)
+    {
+        for (uint64_t &key : player)
+        {
+            uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            key = z ^ (z >> 31);
+        }
+    }
+    return keys;
+}
+
+static constexpr std::array<std::array<uint64_t, GomokuBoard::kCells>, 2> kZobrist = buildZobrist();
+
+GomokuBoard::GomokuBoard()
+{
+    clear();
+}
+
+void GomokuBoard::clear()
+{
+    std::memset(_cells, kEmpty, sizeof(_cells));
+    std::memset(_counts, 0, sizeof(_counts));
+    std::memset(_open, 0, sizeof(_open));
+    std::memset(_near, 0, sizeof(_near));
+    _score[0] = _score[1] = 0;
+    _fourTotal[0] = _fourTotal[1] = 0;
+    _fives[0] = _fives[1] = 0;
+    _stones[0] = _stones[1] = 0;
+    _key = 0;
+    _moves.clear();
+    for (int w = 0; w < kWindows; ++w)
+        addWindow(w, 1);
+    if (_network)
+        _network->refresh(_accumulator, _cells);
+}
+
+void GomokuBoard::setNetwork(const GomokuNetwork *network)
+{
+    _network = network;
+    if (_network)
+        _network->refresh(_accumulator, _cells);
+}
+
+//
+// add (sign 1) or take out (sign -1) what a window contributes to the
+// totals, for the stones it holds right now
+//
+void GomokuBoard::addWindow(int window, int sign)
+{
+    const int16_t *cells = windows().cells[window];
+    for (int player = 0; player < 2; ++player)
+    {
+        const int own = _counts[player][window];
+        if (_counts[player ^ 1][window] != 0 || own == 5)
+            continue;
+        _score[player] += sign * kWindowValue[own];
+        for (int i = 0; i < 5; ++i)
+        {
+            if (_cells[cells[i]] == kEmpty)
+            {
+                _open[player][own][cells[i]] += sign;
+                if (own == 4)
+                    _fourTotal[player] += sign;
+            }
+        }
+    }
+}
+
+void GomokuBoard::place(int cell, int player)
+{
+    const GomokuWindows &tables = windows();
+    const int count = tables.byCellCount[cell];
+    for (int i = 0; i < count; ++i)
+        addWindow(tables.byCell[cell][i], -1);
+    _cells[cell] = static_cast<int8_t>(player);
+    for (int i = 0; i < count; ++i)
+    {
+        const int w = tables.byCell[cell][i];
+        if (++_counts[player][w] == 5)
+            ++_fives[player];
+        addWindow(w, 1);
+    }
+    ++_stones[player];
+    _key ^= kZobrist[player][cell];
+    _moves.push_back(cell);
+    if (_network)
+        _network->addStone(_accumulator, cell, player);
+
+    const int col = cell % kSize;
+    const int row = cell / kSize;
+    for (int r = row - 2; r <= row + 2; ++r)
+    {
+        for (int c = col - 2; c <= col + 2; ++c)
+        {
+            if (r >= 0 && r < kSize && c >= 0 && c < kSize)
+                ++_near[cellIndex(c, r)];
+        }
+    }
+}
+
+void GomokuBoard::undo()
+{
+    if (_moves.empty())
+        return;
+    const int cell = _moves.back();
+    const int player = _cells[cell];
+    _moves.pop_back();
+    --_stones[player];
+    _key ^= kZobrist[player][cell];
+    if (_network)
+        _network->removeStone(_accumulator, cell, player);
+
+    const GomokuWindows &tables = windows();
+    const int count = tables.byCellCount[cell];
+    for (int i = 0; i < count; ++i)
+    {
+        const int w = tables.byCell[cell][i];
+        addWindow(w, -1);
+        if (_counts[player][w]-- == 5)
+            --_fives[player];
+    }
+    _cells[cell] = kEmpty;
+    for (int i = 0; i < count; ++i)
+        addWindow(tables.byCell[cell][i], 1);
+
+    const int col = cell % kSize;
+    const int row = cell / kSize;
+    for (int r = row - 2; r <= row + 2; ++r)
+    {
+        for (int c = col - 2; c <= col + 2; ++c)
+        {
+            if (r >= 0 && r < kSize && c >= 0 && c < kSize)
+                --_near[cellIndex(c, r)];
+        }
+    }
+}
+
+int GomokuBoard::winningCells(int player, int *cells, int max) const
+{
+    int found = 0;
+    for (int index = 0; index < kCells && found < max && _fourTotal[player] > 0; ++index)
+    {
+        if (_open[player][4][index])
+            cells[found++] = index;
+    }
+    return found;
+}
+
+int GomokuBoard::gain(int index, int player) const
+{
+    int total = _open[player][4][index] ? kFiveGain : 0;
+    for (int k = 0; k < 4; ++k)
+        total += _open[player][k][index] * (kWindowValue[k + 1] - kWindowValue[k]);
+    return total;
+}
+
+int GomokuBoard::evaluate() const
+{
+    const int side = sideToMove();
+    return _score[side] - _score[side ^ 1];
+}
@@ -0,0 +1,99 @@
+#pragma once
+#include "GomokuNetwork.h"
+
+#include <cstdint>
+#include <vector>
+
+//
+// headless 15x15 gomoku board with an incrementally updated pattern count
+//
+// every run of five cells in a row (horizontal, vertical or diagonal, 572 of
+// them on this board) is a "window". a window holding stones of only one
+// player is a threat of that player's, worth more the more stones it has:
+// four in a window is a four (one move from five), three in a window with
+// the other two cells empty is a three, and an open three or open four is
+// simply one that sits in several overlapping windows.
+//
+// placing or removing a stone only touches the 20 windows through its cell,
+// so the totals below are kept up to date as stones go on and come off:
+//   - each player's summed window value, which is the static evaluation
+//   - per empty cell and player, how many windows through the cell hold k
+//     of the player's stones and none of the other's. k = 4 marks the cells
+//     that win on the spot, k = 3 the cells that make a four, and together
+//     they score candidate moves without looking at the board.
+//
+// with a GomokuNetwork set, the network's accumulator is kept up to date the
+// same way, so the network can score the position without a pass over the
+// board (see setNetwork()).
+//
+// five or more in a row wins (freestyle rules), black (player 0) moves first.
+//
+class GomokuBoard
+{
+public:
+    static const int kSize = 15;
+    static const int kCells = kSize * kSize;
+    static const int kEmpty = -1;
+    // kSize - 4 windows along every row and column, (kSize - 4)^2 along each diagonal direction
+    static const int kWindows = 2 * kSize * (kSize - 4) + 2 * (kSize - 4) * (kSize - 4);
+
+    GomokuBoard();
+
+    void        clear();
+    // put a stone for a player on an empty cell / take the last one back
+    void        place(int cell, int player);
+    void        undo();
+
+    int         cell(int index) const { return _cells[index]; }
+    // every cell at once, kEmpty or the player
+    const int8_t *cells() const { return _cells; }
+    int         stoneCount() const { return static_cast<int>(_moves.size()); }
+    int         lastMove() const { return _moves.empty() ? -1 : _moves.back(); }
+    // black moves when the stone counts are level
+    int         sideToMove() const { return _stones[0] > _stones[1] ? 1 : 0; }
+    bool        full() const { return stoneCount() == kCells; }
+    // the player with five in a row, kEmpty while nobody has one
+    int         winner() const { return _fives[0] ? 0 : _fives[1] ? 1 : kEmpty; }
+
+    // windows through an empty cell holding "stones" of the player's and none
+    // of the opponent's
+    int         windowsAt(int player, int stones, int index) const { return _open[player][stones][index]; }
+    // the cells that would give the player five, up to "max" of them; the
+    // return value is how many were found
+    int         winningCells(int player, int *cells, int max) const;
+    bool        hasWinningCell(int player) const { return _fourTotal[player] > 0; }
+    // how much playing the cell adds to the player's window total
+    int         gain(int index, int player) const;
+    // has a stone within two cells in any direction
+    bool        isNearStones(int index) const { return _near[index] > 0; }
+
+    // window totals, side to move minus the other side
+    int         evaluate() const;
+
+    // keep the network's accumulator for the stones from now on, nullptr to
+    // stop; the network has to outlive the board or be taken off it first
+    void        setNetwork(const GomokuNetwork *network);
+    const GomokuNetwork *network() const { return _network; }
+    const GomokuAccumulator &accumulator() const { return _accumulator; }
+
+    // zobrist key of the stones on the board, whose move it is follows from them
+    uint64_t    key() const { return _key; }
+
+    static int  cellIndex(int col, int row) { return row * kSize + col; }
+
+private:
+    void        addWindow(int window, int sign);
+
+    int8_t              _cells[kCells];
+    uint8_t             _counts[2][kWindows];
+    uint16_t            _open[2][5][kCells];
+    uint8_t             _near[kCells];
+    int                 _score[2];
+    int                 _fourTotal[2];
+    int                 _fives[2];
+    int                 _stones[2];
+    uint64_t            _key;
+    std::vector<int>    _moves;
+    const GomokuNetwork *_network = nullptr;
+    GomokuAccumulator   _accumulator;
+};
@@ -0,0 +1,270 @@
+#include "GomokuNetwork.h"
+#include "BinaryIO.h"
+#include "Crc32.h"
+#include "FileIO.h"
+
+#include <algorithm>
+#include <cmath>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+static const size_t kHeaderSize = 16;
+
+static size_t bodySize()
+{
+    using N = GomokuNetwork;
+    return size_t(N::kInputs) * N::kHidden * 2 + N::kHidden * 2 + N::kLayer2 * 2 * N::kHidden + N::kLayer2 * 4 +
+           N::kLayer2 + 4;
+}
+
+template <typename T>
+static T quantized(float value, float scale, float limit)
+{
+    return static_cast<T>(std::clamp(std::round(value * scale), -limit, limit));
+}
+
+void GomokuNetwork::quantize(const FloatWeights &weights)
+{
+    const float activation = kActivationMax;
+    _w1.resize(weights.w1.size());
+    _b1.resize(weights.b1.size());
+    _w2.resize(weights.w2.size());
+    _b2.resize(weights.b2.size());
+    _w3.resize(weights.w3.size());
+    for (size_t i = 0; i < _w1.size(); ++i)
+        _w1[i] = quantized<int16_t>(weights.w1[i], activation, 32767);
+    for (size_t i = 0; i < _b1.size(); ++i)
+        _b1[i] = quantized<int16_t>(weights.b1[i], activation, 32767);
+    for (size_t i = 0; i < _w2.size(); ++i)
+        _w2[i] = quantized<int8_t>(weights.w2[i], kWeightScale, 127);
+    for (size_t i = 0; i < _b2.size(); ++i)
+        _b2[i] = quantized<int32_t>(weights.b2[i], activation * kWeightScale, 1e9f);
+    for (size_t i = 0; i < _w3.size(); ++i)
+        _w3[i] = quantized<int8_t>(weights.w3[i], kWeightScale, 127);
+    _b3 = quantized<int32_t>(weights.b3, activation * kWeightScale, 1e9f);
+}
+
+bool GomokuNetwork::save(const std::string &path) const
+{
+    if (!isLoaded())
+        return false;
+    std::vector<uint8_t> body;
+    body.reserve(bodySize());
+    ByteWriter b(body);
+    for (int16_t w : _w1)
+        b.u16(static_cast<uint16_t>(w));
+    for (int16_t w : _b1)
+        b.u16(static_cast<uint16_t>(w));
+    for (int8_t w : _w2)
+        b.u8(static_cast<uint8_t>(w));
+    for (int32_t w : _b2)
+        b.i32(w);
+    for (int8_t w : _w3)
+        b.u8(static_cast<uint8_t>(w));
+    b.i32(_b3);
+
+    std::vector<uint8_t> out;
+    out.reserve(kHeaderSize + body.size());
+    ByteWriter w(out);
+    w.u32(kMagic);
+    w.u16(kVersion);
+    w.u16(kInputs);
+    w.u16(kHidden);
+    w.u16(kLayer2);
+    w.u32(Crc32::compute(body.data(), body.size()));
+    w.bytes(body.data(), body.size());
+    return FileIO::writeAtomic(path, out);
+}
+
+bool GomokuNetwork::load(const std::string &path, std::string &error)
+{
+    std::vector<uint8_t> bytes;
+    if (!FileIO::readAll(path, bytes))
+    {
+        error = "can't read " + path;
+        return false;
+    }
+    ByteReader r(bytes.data(), bytes.size());
+    const uint32_t magic = r.u32();
+    const uint16_t version = r.u16();
+    const uint16_t inputs = r.u16();
+    const uint16_t hidden = r.u16();
+    const uint16_t layer2 = r.u16();
+    const uint32_t crc = r.u32();
+    if (!r.ok() || magic != kMagic)
+    {
+        error = "not a network";
+        return false;
+    }
+    if (version != kVersion)
+    {
+        error = "unsupported network version";
+        return false;
+    }
+    if (inputs != kInputs || hidden != kHidden || layer2 != kLayer2)
+    {
+        error = "made for another network shape";
+        return false;
+    }
+    if (bytes.size() != kHeaderSize + bodySize() || Crc32::compute(bytes.data() + kHeaderSize, bodySize()) != crc)
+    {
+        error = "network is damaged";
+        return false;
+    }
+
+    _w1.resize(size_t(kInputs) * kHidden);
+    _b1.resize(kHidden);
+    _w2.resize(kLayer2 * 2 * kHidden);
+    _b2.resize(kLayer2);
+    _w3.resize(kLayer2);
+    for (int16_t &w : _w1)
+        w = static_cast<int16_t>(r.u16());
+    for (int16_t &w : _b1)
+        w = static_cast<int16_t>(r.u16());
+    for (int8_t &w : _w2)
+        w = static_cast<int8_t>(r.u8());
+    for (int32_t &w : _b2)
+        w = r.i32();
+    for (int8_t &w : _w3)
+        w = static_cast<int8_t>(r.u8());
+    _b3 = r.i32();
+    return true;
+}
+
+const char *GomokuNetwork::kernelName()
+{
+#if defined(__AVX2__)
+    return "AVX2";
+#else
+    return "portable";
+#endif
+}
+
+void GomokuNetwork::refresh(GomokuAccumulator &accumulator, const int8_t *cells) const
+{
+    for (int side = 0; side < 2; ++side)
+        std::copy(_b1.begin(), _b1.end(), accumulator.values[side]);
+    for (int cell = 0; cell < kCells; ++cell)
+    {
+        if (cells[cell] >= 0)
+            addStone(accumulator, cell, cells[cell]);
+    }
+}
+
+//
+// a stone's row for each side, added or subtracted; int16 wraps the same
+// both ways, so taking a stone off always gives back what was there
+//
+void GomokuNetwork::addStone(GomokuAccumulator &accumulator, int cell, int player) const
+{
+    for (int side = 0; side < 2; ++side)
+    {
+        const int16_t *row = &_w1[size_t(feature(cell, player, side)) * kHidden];
+        int16_t *values = accumulator.values[side];
+#if defined(__AVX2__)
+        for (int i = 0; i < kHidden; i += 16)
+        {
+            const __m256i sum = _mm256_add_epi16(_mm256_load_si256(reinterpret_cast<const __m256i *>(values + i)),
+                                                 _mm256_loadu_si256(reinterpret_cast<const __m256i *>(row + i)));
+            _mm256_store_si256(reinterpret_cast<__m256i *>(values + i), sum);
+        }
+#else
+        for (int i = 0; i < kHidden; ++i)
+            values[i] = static_cast<int16_t>(values[i] + row[i]);
+#endif
+    }
+}
+
+void GomokuNetwork::removeStone(GomokuAccumulator &accumulator, int cell, int player) const
+{
+    for (int side = 0; side < 2; ++side)
+    {
+        const int16_t *row = &_w1[size_t(feature(cell, player, side)) * kHidden];
+        int16_t *values = accumulator.values[side];
+#if defined(__AVX2__)
+        for (int i = 0; i < kHidden; i += 16)
+        {
+            const __m256i difference = _mm256_sub_epi16(_mm256_load_si256(reinterpret_cast<const __m256i *>(values + i)),
+                                                        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(row + i)));
+            _mm256_store_si256(reinterpret_cast<__m256i *>(values + i), difference);
+        }
+#else
+        for (int i = 0; i < kHidden; ++i)
+            values[i] = static_cast<int16_t>(values[i] - row[i]);
+#endif
+    }
+}
+
+int GomokuNetwork::output(const int32_t *layer2) const
+{
+    int32_t sum = _b3;
+    for (int o = 0; o < kLayer2; ++o)
+    {
+        const int32_t activation = std::clamp((layer2[o] + _b2[o]) >> 6, 0, int(kActivationMax));
+        sum += activation * _w3[o];
+    }
+    return static_cast<int>(int64_t(sum) * kOutputScale / (kActivationMax * kWeightScale));
+}
+
+int GomokuNetwork::evaluatePortable(const GomokuAccumulator &accumulator, int sideToMove) const
+{
+    uint8_t inputs[2 * kHidden];
+    for (int i = 0; i < kHidden; ++i)
+    {
+        inputs[i] = static_cast<uint8_t>(std::clamp<int>(accumulator.values[sideToMove][i], 0, int(kActivationMax)));
+        inputs[kHidden + i] = static_cast<uint8_t>(std::clamp<int>(accumulator.values[sideToMove ^ 1][i], 0, int(kActivationMax)));
+    }
+    int32_t layer2[kLayer2];
+    for (int o = 0; o < kLayer2; ++o)
+    {
+        const int8_t *weights = &_w2[o * 2 * kHidden];
+        int32_t sum = 0;
+        for (int i = 0; i < 2 * kHidden; ++i)
+            sum += inputs[i] * weights[i];
+        layer2[o] = sum;
+    }
+    return output(layer2);
+}
+
+int GomokuNetwork::evaluate(const GomokuAccumulator &accumulator, int sideToMove) const
+{
+#if defined(__AVX2__)
+    // clip to 0..127 and pack to bytes; the pack works within 128-bit halves, the permute puts them back in order
+    alignas(32) uint8_t inputs[2 * kHidden];
+    const __m256i ceiling = _mm256_set1_epi16(kActivationMax);
+    for (int half = 0; half < 2; ++half)
+    {
+        const int16_t *values = accumulator.values[half == 0 ? sideToMove : sideToMove ^ 1];
+        for (int i = 0; i < kHidden; i += 32)
+        {
+            const __m256i low = _mm256_min_epi16(_mm256_load_si256(reinterpret_cast<const __m256i *>(values + i)), ceiling);
+            const __m256i high = _mm256_min_epi16(_mm256_load_si256(reinterpret_cast<const __m256i *>(values + i + 16)), ceiling);
+            const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(low, high), 0xD8);
+            _mm256_store_si256(reinterpret_cast<__m256i *>(inputs + half * kHidden + i), packed);
+        }
+    }
+
+    // unsigned inputs times signed weights, pairs summed to 16 bits and then to 32
+    const __m256i ones = _mm256_set1_epi16(1);
+    int32_t layer2[kLayer2];
+    for (int o = 0; o < kLayer2; ++o)
+    {
+        const int8_t *weights = &_w2[o * 2 * kHidden];
+        __m256i sum = _mm256_setzero_si256();
+        for (int i = 0; i < 2 * kHidden; i += 32)
+        {
+            const __m256i products = _mm256_maddubs_epi16(_mm256_load_si256(reinterpret_cast<const __m256i *>(inputs + i)),
+                                                          _mm256_loadu_si256(reinterpret_cast<const __m256i *>(weights + i)));
+            sum = _mm256_add_epi32(sum, _mm256_madd_epi16(products, ones));
+        }
+        __m128i folded = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+        folded = _mm_add_epi32(folded, _mm_shuffle_epi32(folded, _MM_SHUFFLE(1, 0, 3, 2)));
+        folded = _mm_add_epi32(folded, _mm_shuffle_epi32(folded, _MM_SHUFFLE(2, 3, 0, 1)));
+        layer2[o] = _mm_cvtsi128_si32(folded);
+    }
+    return output(layer2);
+#else
+    return evaluatePortable(accumulator, sideToMove);
+#endif
+}
@@ -0,0 +1,100 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//
+// a small quantized neural network that scores gomoku positions, NNUE style
+//
+// the inputs are one per cell and player, seen from one side: a stone of
+// "mine" or of "theirs" on the cell, 450 in all. the first layer's outputs
+// for a position are just the bias plus the weight rows of the stones on the
+// board, so they're kept in an accumulator, one for each player's side, and
+// a stone going on or coming off adds or subtracts its row (addStone(),
+// removeStone(); GomokuBoard does it as it plays). evaluating a position
+// only has the small layers after that left to do:
+//
+//   accumulator[side to move] ++ accumulator[other side]   2 x 64 int16
+//     clipped to 0..127 as uint8                            128
+//     times int8 weights, int32 sums, >> 6, clipped          16
+//     times int8 weights, int32 sum                           1
+//
+// 127 stands for 1.0 in the activations and 64 for 1.0 in the second and
+// third layer's weights (kActivationMax, kWeightScale), so the int8 products
+// can't overflow the 16-bit pairs AVX2's multiply-add makes. with AVX2
+// (where the compiler targets it, see USE_AVX2) the accumulator rows are
+// added 16 values at a time and the second layer is byte multiply-adds;
+// evaluatePortable() is the same arithmetic one value at a time and gives
+// exactly the same result.
+//
+// an output of 1.0 is worth kOutputScale in GomokuBoard::evaluate()'s units,
+// which is what evaluate() returns, for the side to move.
+//
+// the weights come from a file (tools/gomoku_nnue trains and writes one):
+//   u32 magic 'NNUE'  u16 version  u16 inputs  u16 hidden  u16 second layer
+//   u32 crc32 of everything after the header
+//   then int16 first layer weights (input-major) and biases, int8 second
+//   layer weights (output-major), int32 biases, int8 output weights and an
+//   int32 output bias, all little-endian
+//
+struct GomokuAccumulator
+{
+    alignas(32) int16_t values[2][64];      // from each player's side
+};
+
+class GomokuNetwork
+{
+public:
+    static const uint32_t kMagic = 0x45554E4E;      // "NNUE"
+    static const uint16_t kVersion = 1;
+    static const int kCells = 225;
+    static const int kInputs = kCells * 2;
+    static const int kHidden = 64;
+    static const int kLayer2 = 16;
+    static const int kActivationMax = 127;
+    static const int kWeightScale = 64;
+    static const int kOutputScale = 500;
+
+    // the real numbers the quantized weights stand for, what a trainer works with
+    struct FloatWeights
+    {
+        std::vector<float>  w1 = std::vector<float>(kInputs * kHidden);
+        std::vector<float>  b1 = std::vector<float>(kHidden);
+        std::vector<float>  w2 = std::vector<float>(kLayer2 * 2 * kHidden);
+        std::vector<float>  b2 = std::vector<float>(kLayer2);
+        std::vector<float>  w3 = std::vector<float>(kLayer2);
+        float               b3 = 0;
+    };
+
+    // round the weights to the network's integers, clamping the ones that don't fit
+    void        quantize(const FloatWeights &weights);
+    bool        save(const std::string &path) const;
+    // false with a reason if the file isn't a complete, undamaged network of this shape
+    bool        load(const std::string &path, std::string &error);
+    bool        isLoaded() const { return !_w1.empty(); }
+
+    // the input a player's stone on a cell is, from the perspective player's side
+    static int  feature(int cell, int player, int perspective) { return cell * 2 + (player != perspective); }
+
+    // the accumulator from scratch, for cells that are -1 empty or the player
+    void        refresh(GomokuAccumulator &accumulator, const int8_t *cells) const;
+    void        addStone(GomokuAccumulator &accumulator, int cell, int player) const;
+    void        removeStone(GomokuAccumulator &accumulator, int cell, int player) const;
+
+    // the score for the side to move
+    int         evaluate(const GomokuAccumulator &accumulator, int sideToMove) const;
+    int         evaluatePortable(const GomokuAccumulator &accumulator, int sideToMove) const;
+    // which kernels evaluate() and the accumulator updates were built with
+    static const char *kernelName();
+
+private:
+    // finish from the clipped first layer
+    int         output(const int32_t *layer2) const;
+
+    std::vector<int16_t>    _w1;
+    std::vector<int16_t>    _b1;
+    std::vector<int8_t>     _w2;
+    std::vector<int32_t>    _b2;
+    std::vector<int8_t>     _w3;
+    int32_t                 _b3 = 0;
+};
@@ -0,0 +1,357 @@
+#include "GomokuSearch.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+// candidate moves kept at the root and below it
+static const int kRootBranching = 16;
+static const int kBranching = 10;
+static const int kMaxPly = 64;
+// fours in a row a VCF may take, and its node budgets
+static const int kVcfDepth = 12;
+static const int kRootVcfNodes = 20000;
+static const int kReplyVcfNodes = 1000;
+
+// 2^20 entries of 16 bytes
+static const size_t kTableEntries = size_t(1) << 20;
+
+//
+// a table entry packed into 64 bits: the score, the depth it was searched
+// to, what kind of bound it is and the best move (kNoMove if none)
+//
+enum Bound { kExact, kLower, kUpper };
+static const int kNoMove = 0xFF;
+
+static uint64_t packEntry(int score, int depth, Bound bound, int move)
+{
+    return static_cast<uint32_t>(score) | uint64_t(depth & 0xFF) << 32 | uint64_t(bound) << 40 | uint64_t(move & 0xFF) << 48;
+}
+
+GomokuSearch::GomokuSearch() : GomokuSearch(nullptr)
+{
+    _ownTable = std::make_unique<SharedHashTable>(kTableEntries);
+    _table = _ownTable.get();
+}
+
+GomokuSearch::GomokuSearch(SharedHashTable *table) : _table(table), _threads(1), _nodes(0), _vcfLimit(0),
+    _completedDepth(0), _aborted(false), _stop(nullptr), _network(nullptr)
+{
+}
+
+void GomokuSearch::setNetwork(const GomokuNetwork *network)
+{
+    if (network == _network)
+        return;
+    _network = network;
+    _table->clear();
+}
+
+void GomokuSearch::checkTime()
+{
+    if ((_stop && _stop->load(std::memory_order_relaxed)) || std::chrono::steady_clock::now() >= _deadline)
+        _aborted = true;
+}
+
+int GomokuSearch::candidates(const GomokuBoard &board, int *moves, int max) const
+{
+    if (board.stoneCount() == 0)
+    {
+        moves[0] = GomokuBoard::cellIndex(GomokuBoard::kSize / 2, GomokuBoard::kSize / 2);
+        return 1;
+    }
+
+    // building our own lines counts a little more than spoiling theirs
+    const int me = board.sideToMove();
+    int scores[GomokuBoard::kCells];
+    int cells[GomokuBoard::kCells];
+    int count = 0;
+    for (int index = 0; index < GomokuBoard::kCells; ++index)
+    {
+        if (board.cell(index) != GomokuBoard::kEmpty || !board.isNearStones(index))
+            continue;
+        scores[index] = board.gain(index, me) * 5 + board.gain(index, me ^ 1) * 4;
+        cells[count++] = index;
+    }
+    const int kept = std::min(count, max);
+    std::partial_sort(cells, cells + kept, cells + count, [&scores](int a, int b) { return scores[a] > scores[b]; });
+    std::copy(cells, cells + kept, moves);
+    return kept;
+}
+
+int GomokuSearch::expectedMove(const GomokuBoard &board) const
+{
+    if (board.full())
+        return -1;
+    uint64_t data;
+    if (_table->probe(board.key(), data))
+    {
+        const int move = static_cast<int>((data >> 48) & 0xFF);
+        if (move != kNoMove && board.cell(move) == GomokuBoard::kEmpty)
+            return move;
+    }
+    int moves[1];
+    return candidates(board, moves, 1) > 0 ? moves[0] : -1;
+}
+
+int GomokuSearch::findVcf(GomokuBoard &board, int nodeLimit)
+{
+    _vcfLimit = _nodes + static_cast<uint64_t>(nodeLimit);
+    int move = -1;
+    return vcf(board, kVcfDepth, &move) ? move : -1;
+}
+
+bool GomokuSearch::vcf(GomokuBoard &board, int depth, int *firstMove)
+{
+    if ((++_nodes & 1023) == 0)
+        checkTime();
+    if (_aborted || _nodes > _vcfLimit)
+        return false;
+
+    const int me = board.sideToMove();
+    const int opponent = me ^ 1;
+    int cells[2];
+    if (board.winningCells(me, cells, 1))
+    {
+        if (firstMove)
+            *firstMove = cells[0];
+        return true;
+    }
+    if (depth <= 0)
+        return false;
+
+    // a four of theirs has to be blocked first, and the block has to be a four too
+    const int threats = board.winningCells(opponent, cells, 2);
+    if (threats >= 2)
+        return false;
+    const int forced = threats == 1 ? cells[0] : -1;
+
+    for (int index = 0; index < GomokuBoard::kCells; ++index)
+    {
+        if (board.cell(index) != GomokuBoard::kEmpty || board.windowsAt(me, 3, index) == 0)
+            continue;
+        if (forced >= 0 && index != forced)
+            continue;
+
+        board.place(index, me);
+        int replies[2];
+        const int fours = board.winningCells(me, replies, 2);
+        bool win = fours >= 2;
+        if (fours == 1)
+        {
+            board.place(replies[0], opponent);
+            win = vcf(board, depth - 1, nullptr);
+            board.undo();
+        }
+        board.undo();
+        if (win)
+        {
+            if (firstMove)
+                *firstMove = index;
+            return true;
+        }
+    }
+    return false;
+}
+
+int GomokuSearch::negamax(GomokuBoard &board, int depth, int alpha, int beta, int ply)
+{
+    if ((++_nodes & 1023) == 0)
+        checkTime();
+    if (_aborted)
+        return 0;
+
+    const int me = board.sideToMove();
+    const int opponent = me ^ 1;
+    if (board.winner() != GomokuBoard::kEmpty)
+        return -(kWinScore - ply);
+    if (board.hasWinningCell(me))
+        return kWinScore - ply - 1;
+    if (board.full())
+        return 0;
+
+    // wins are stored as distance from this node, not the root
+    const int alphaIn = alpha;
+    const uint64_t key = board.key();
+    int ttMove = -1;
+    uint64_t data;
+    if (depth > 0 && _table->probe(key, data))
+    {
+        int score = static_cast<int32_t>(data);
+        const int ttDepth = static_cast<int>((data >> 32) & 0xFF);
+        const Bound bound = static_cast<Bound>((data >> 40) & 0xFF);
+        const int move = static_cast<int>((data >> 48) & 0xFF);
+        ttMove = move == kNoMove ? -1 : move;
+        if (score > kWinScore - kMaxPly)
+            score -= ply;
+        else if (score < -kWinScore + kMaxPly)
+            score += ply;
+        if (ttDepth >= depth && (bound == kExact || (bound == kLower && score >= beta) || (bound == kUpper && score <= alpha)))
+            return score;
+    }
+    const int storedDepth = depth;
+
+    int moves[kRootBranching];
+    int count;
+    int blocks[2];
+    const int threats = board.winningCells(opponent, blocks, 2);
+    if (threats >= 2)
+        return -(kWinScore - ply - 2);
+    if (threats == 1)
+    {
+        // the only move there is, searched without using up depth
+        moves[0] = blocks[0];
+        count = 1;
+        ++depth;
+    }
+    else
+    {
+        if (depth <= 0 || ply >= kMaxPly)
+            return board.network() ? board.network()->evaluate(board.accumulator(), board.sideToMove()) : board.evaluate();
+        count = candidates(board, moves, kBranching);
+        // the table's move first, if it's one of the candidates
+        for (int i = 1; i < count; ++i)
+        {
+            if (moves[i] == ttMove)
+            {
+                std::rotate(moves, moves + i, moves + i + 1);
+                break;
+            }
+        }
+    }
+
+    int best = -kWinScore - 1;
+    int bestMove = kNoMove;
+    for (int i = 0; i < count; ++i)
+    {
+        board.place(moves[i], me);
+        const int score = -negamax(board, depth - 1, -beta, -alpha, ply + 1);
+        board.undo();
+        if (_aborted)
+            return 0;
+        if (score > best)
+        {
+            best = score;
+            bestMove = moves[i];
+            alpha = std::max(alpha, score);
+            if (alpha >= beta)
+                break;
+        }
+    }
+
+    if (storedDepth > 0)
+    {
+        const Bound bound = best <= alphaIn ? kUpper : best >= beta ? kLower : kExact;
+        int stored = best;
+        if (stored > kWinScore - kMaxPly)
+            stored += ply;
+        else if (stored < -kWinScore + kMaxPly)
+            stored -= ply;
+        _table->store(key, packEntry(stored, storedDepth, bound, bestMove));
+    }
+    return best;
+}
+
+int GomokuSearch::deepen(GomokuBoard &board, int *moves, int count, int firstDepth, int maxDepth)
+{
+    // iterative deepening, a move that finished searching in a cut short iteration isn't trusted
+    const int me = board.sideToMove();
+    int best = moves[0];
+    for (int depth = firstDepth; depth <= maxDepth && !_aborted; ++depth)
+    {
+        int alpha = -kWinScore - 1;
+        int iterationBest = -1;
+        for (int i = 0; i < count; ++i)
+        {
+            board.place(moves[i], me);
+            const int score = -negamax(board, depth - 1, -kWinScore - 1, -alpha, 1);
+            board.undo();
+            if (_aborted)
+                break;
+            if (score > alpha)
+            {
+                alpha = score;
+                iterationBest = i;
+            }
+        }
+        if (_aborted)
+            break;
+
+        best = moves[iterationBest];
+        _completedDepth = depth;
+        if (alpha >= kWinScore - kMaxPly || alpha <= -kWinScore + kMaxPly)
+            break;
+
+        // the best move goes first next time, the rest keep their order
+        std::rotate(moves, moves + iterationBest, moves + iterationBest + 1);
+    }
+    return best;
+}
+
+int GomokuSearch::bestMove(const GomokuBoard &position, std::chrono::milliseconds budget, int maxDepth)
+{
+    _deadline = std::chrono::steady_clock::now() + budget;
+    _nodes = 0;
+    _completedDepth = 0;
+    _aborted = false;
+
+    GomokuBoard board = position;
+    if (board.full())
+        return -1;
+    board.setNetwork(_network);
+    const int me = board.sideToMove();
+    const int opponent = me ^ 1;
+
+    // five now, or stop theirs
+    int cells[1];
+    if (board.winningCells(me, cells, 1) || board.winningCells(opponent, cells, 1))
+        return cells[0];
+
+    const int winning = findVcf(board, kRootVcfNodes);
+    if (winning >= 0)
+        return winning;
+
+    int moves[kRootBranching];
+    int count = candidates(board, moves, kRootBranching);
+
+    // drop the moves that leave the opponent a forced win, unless that's all of them
+    int safe[kRootBranching];
+    int safeCount = 0;
+    for (int i = 0; i < count && !_aborted; ++i)
+    {
+        board.place(moves[i], me);
+        if (findVcf(board, kReplyVcfNodes) < 0)
+            safe[safeCount++] = moves[i];
+        board.undo();
+    }
+    if (safeCount > 0 && !_aborted)
+    {
+        std::copy(safe, safe + safeCount, moves);
+        count = safeCount;
+    }
+
+    // the helpers run until the main search is done with them
+    std::atomic<bool> helpersStop(false);
+    std::vector<std::unique_ptr<GomokuSearch>> helpers;
+    std::vector<std::thread> threads;
+    for (int i = 1; i < _threads && count > 0; ++i)
+    {
+        helpers.push_back(std::unique_ptr<GomokuSearch>(new GomokuSearch(_table)));
+        GomokuSearch *helper = helpers.back().get();
+        helper->_deadline = _deadline;
+        helper->_stop = &helpersStop;
+        threads.emplace_back([helper, board, moves, count, i, maxDepth]() mutable {
+            std::rotate(moves, moves + i % count, moves + count);
+            helper->deepen(board, moves, count, 1 + (i & 1), maxDepth);
+        });
+    }
+
+    const int best = deepen(board, moves, count, 1, maxDepth);
+
+    helpersStop = true;
+    for (std::thread &thread : threads)
+        thread.join();
+    for (const auto &helper : helpers)
+        _nodes += helper->_nodes;
+    return best;
+}
@@ -0,0 +1,89 @@
+#pragma once
+#include "GomokuBoard.h"
+#include "SharedHashTable.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+//
+// gomoku AI: threat-space search for forced wins, alpha-beta for the rest
+//
+// a full width search is hopeless on 225 cells, so every node only looks at
+// the empty cells near stones, ranked by how much they add to the mover's
+// windows plus how much they take from the opponent's, and keeps the best
+// few. forced moves (blocking a four) don't use up depth.
+//
+// before that, bestMove() looks for a VCF ("victory by continuous fours"):
+// a sequence of moves that each make a four, so the opponent's reply is
+// forced every time, ending in two fours at once or a five. the same search
+// run for the opponent after each root candidate throws out the moves that
+// would let them do it to us.
+//
+// scores are for the side to move, kWinScore - ply for a win. leaves are
+// scored with GomokuBoard::evaluate(), or with a GomokuNetwork when one is
+// set, the board keeping the network's accumulator as the search plays.
+//
+// the alpha-beta search keeps bounds and best moves in a SharedHashTable.
+// with more than one thread it's lazy SMP: helper threads run the same
+// iterative deepening from the same root with their own board, starting
+// every other one a ply deeper and each with the root moves in a different
+// order, and all of them share the one table. the helpers' results are
+// thrown away, what they leave in the table is what makes the main thread
+// reach each depth sooner.
+//
+class GomokuSearch
+{
+public:
+    static constexpr int kWinScore = 100000000;
+    static constexpr int kMaxDepth = 12;
+
+    GomokuSearch();
+
+    // the cell to play for the side to move, found inside the time budget
+    // or once maxDepth is done; -1 if the board is full
+    int         bestMove(const GomokuBoard &board, std::chrono::milliseconds budget, int maxDepth = kMaxDepth);
+    // the first move of a forced win by continuous fours for the side to
+    // move, or -1; the board is put back the way it was
+    int         findVcf(GomokuBoard &board, int nodeLimit);
+    // the move the table holds for the side to move, or the most promising
+    // candidate when it holds none; -1 if the board is full. not safe while searching
+    int         expectedMove(const GomokuBoard &board) const;
+
+    // the search returns what it has early once this goes up
+    void        setStopFlag(const std::atomic<bool> *stop) { _stop = stop; }
+    // threads for the alpha-beta search, the calling one included
+    void        setThreads(int threads) { _threads = threads < 1 ? 1 : threads; }
+    void        clearTable() { _table->clear(); }
+    // score leaves with the network instead of the window totals, nullptr to
+    // go back; clears the table when it changes. not safe while searching
+    void        setNetwork(const GomokuNetwork *network);
+
+    // every thread's nodes
+    uint64_t    nodeCount() const { return _nodes; }
+    // the last iteration of the alpha-beta search that finished
+    int         completedDepth() const { return _completedDepth; }
+
+private:
+    // a helper sharing another search's table
+    explicit GomokuSearch(SharedHashTable *table);
+
+    bool        vcf(GomokuBoard &board, int depth, int *firstMove);
+    // iterative deepening over the root moves, returns the best one
+    int         deepen(GomokuBoard &board, int *moves, int count, int firstDepth, int maxDepth);
+    int         negamax(GomokuBoard &board, int depth, int alpha, int beta, int ply);
+    // the most promising empty cells near stones, best first
+    int         candidates(const GomokuBoard &board, int *moves, int max) const;
+    void        checkTime();
+
+    std::unique_ptr<SharedHashTable>        _ownTable;
+    SharedHashTable                        *_table;
+    int                                     _threads;
+    uint64_t                                _nodes;
+    uint64_t                                _vcfLimit;      // node count the current VCF search has to stop at
+    int                                     _completedDepth;
+    bool                                    _aborted;
+    const std::atomic<bool>                *_stop;
+    const GomokuNetwork                    *_network;
+    std::chrono::steady_clock::time_point   _deadline;
+};
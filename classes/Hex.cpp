@@ -0,0 +1,226 @@
+#include "Hex.h"
+#include <algorithm>
+#include <thread>
+
+// how long the AI thinks about each move
+static const std::chrono::milliseconds kThinkTime(1500);
+// the sprites are 100x100, drawn smaller with each row half a cell further right
+static const float kCellSpacing = 48.0f;
+static const float kRowSpacing = 42.0f;
+static const float kStoneSize = 44.0f;
+
+Hex::Hex()
+{
+}
+
+Hex::~Hex()
+{
+    _ai.cancel();
+}
+
+Bit* Hex::PieceForPlayer(const int playerNumber)
+{
+    Bit *bit = new Bit();
+    bit->LoadTextureFromFile(playerNumber == 0 ? "red.png" : "yellow.png");
+    bit->setSize(kStoneSize, kStoneSize);
+    bit->setOwner(getPlayerAt(playerNumber));
+    return bit;
+}
+
+//
+// setup the game board, this is called once at the start of the game
+//
+void Hex::setUpBoard()
+{
+    setNumberOfPlayers(2);
+    setAIPlayer(1);
+
+    _gameOptions.rowX = HexBoard::kSize;
+    _gameOptions.rowY = HexBoard::kSize;
+
+    const int last = HexBoard::kSize - 1;
+    for (int row = 0; row < HexBoard::kSize; ++row)
+    {
+        for (int col = 0; col < HexBoard::kSize; ++col)
+        {
+            Square &square = _grid[row][col];
+            ImVec2 pos(col * kCellSpacing + row * kCellSpacing / 2, row * kRowSpacing);
+            square.initHolder(pos, "square.png", col, row);
+            square.setSize(kStoneSize, kStoneSize);
+            square.setGameTag(HexBoard::cellAt(row, col));
+
+            // the edges in their owner's colour, the corners belong to both
+            const bool redEdge = row == 0 || row == last;
+            const bool yellowEdge = col == 0 || col == last;
+            if (redEdge && !yellowEdge)
+                square.setColor(1.0f, 0.7f, 0.7f, 1.0f);
+            else if (yellowEdge && !redEdge)
+                square.setColor(1.0f, 1.0f, 0.65f, 1.0f);
+            else
+                square.setColor(0.85f, 0.85f, 0.85f, 1.0f);
+        }
+    }
+    _board = HexBoard();
+
+    // the node arena is big, only allocate it once
+    if (!_mcts)
+        _mcts = std::make_unique<MonteCarloTreeSearch<HexBoard>>(1 << 21);
+    _mcts->reset();
+
+    startGame();
+}
+
+bool Hex::actionForEmptyHolder(BitHolder *holder)
+{
+    if (!holder)
+        return false;
+    return placeStone(holder->gameTag());
+}
+
+bool Hex::placeStone(int cell)
+{
+    if (cell < 0 || cell >= HexBoard::kCells || !_board.isEmpty(cell) || _board.winner() >= 0)
+        return false;
+
+    Square &square = _grid[cell / HexBoard::kSize][cell % HexBoard::kSize];
+    Bit *placeBit = PieceForPlayer(_board.sideToMove());
+    placeBit->setPosition(square.getPosition());
+    square.setBit(placeBit);
+    _board.place(cell);
+    if (_mcts)
+        _mcts->advance(static_cast<HexBoard::Move>(cell));
+    _lastMoveCode = cell;
+    return true;
+}
+
+bool Hex::canBitMoveFrom(Bit *bit, BitHolder *src)
+{
+    // stones stay where they're put
+    return false;
+}
+
+bool Hex::canBitMoveFromTo(Bit* bit, BitHolder*src, BitHolder*dst)
+{
+    return false;
+}
+
+//
+// free all the memory used by the game on the heap
+//
+void Hex::stopGame()
+{
+    // a search for the old board is no use any more
+    _ai.cancel();
+    for (int row = 0; row < HexBoard::kSize; ++row)
+    {
+        for (int col = 0; col < HexBoard::kSize; ++col)
+        {
+            _grid[row][col].destroyBit();
+        }
+    }
+    _board = HexBoard();
+    if (_mcts)
+        _mcts->reset();
+}
+
+Player* Hex::checkForWinner()
+{
+    const int winner = _board.winner();
+    return winner < 0 ? nullptr : getPlayerAt(winner);
+}
+
+bool Hex::checkForDraw()
+{
+    // a full hex board always has a winner
+    return false;
+}
+
+//
+// state strings
+//
+std::string Hex::initialStateString()
+{
+    return std::string(HexBoard::kCells, '0');
+}
+
+std::string Hex::stateString() const
+{
+    std::string state(HexBoard::kCells, '0');
+    for (int cell = 0; cell < HexBoard::kCells; ++cell)
+    {
+        if (!_board.isEmpty(cell))
+            state[cell] = static_cast<char>('1' + _board.at(cell));
+    }
+    return state;
+}
+
+void Hex::setStateString(const std::string &s)
+{
+    if (s.size() != HexBoard::kCells)
+        return;
+    stopGame();
+
+    // stones go down alternately, red first, so the counts have to allow that
+    int counts[2] = { 0, 0 };
+    for (char c : s)
+    {
+        if (c == '1' || c == '2')
+            ++counts[c - '1'];
+    }
+    if (counts[0] != counts[1] && counts[0] != counts[1] + 1)
+        return;
+
+    // the union-find only cares which stones are down, not the order, so
+    // they're placed by taking turns through each colour's cells
+    int next[2] = { 0, 0 };
+    for (int placed = 0; placed < counts[0] + counts[1]; ++placed)
+    {
+        const int player = placed & 1;
+        const char mark = static_cast<char>('1' + player);
+        while (s[next[player]] != mark)
+            ++next[player];
+        placeStone(next[player]++);
+    }
+    _lastMoveCode = kNoMoveCode;
+
+    _gameOptions.currentTurnNo = static_cast<unsigned int>(counts[0] + counts[1]);
+}
+
+//
+// called every frame while it's the AI's turn: the first call starts the
+// search on the worker thread, later calls play the move once it's ready
+//
+void Hex::updateAI()
+{
+    if (checkForWinner())
+        return;
+
+    if (!_ai.busy())
+    {
+        const HexBoard board = _board;
+        MonteCarloTreeSearch<HexBoard> *mcts = _mcts.get();
+        mcts->setThreads(_gameOptions.AIThreads);
+        _ai.start([mcts, board](const std::atomic<bool> &stop) {
+            return mcts->bestMove(board, ~uint64_t(0), &stop);
+        }, kThinkTime);
+        return;
+    }
+
+    int cell;
+    if (_ai.poll(cell) && placeStone(cell))
+        endTurn();
+}
+
+void Hex::drawSettings()
+{
+    // the worker is joined once the move is played, so the numbers are safe to read
+    const int hardwareThreads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    ImGui::SetNextItemWidth(150);
+    ImGui::SliderInt("AI threads", &_gameOptions.AIThreads, 1, hardwareThreads);
+    if (_mcts && !_ai.busy() && _mcts->playouts() > 0)
+    {
+        ImGui::Text("Last search: %llu playouts, %.0f playouts/s, %.0f%% wins, %zu nodes kept after the move",
+                    (unsigned long long)_mcts->playouts(), _mcts->playoutsPerSecond(), _mcts->winRate() * 100.0,
+                    _mcts->reusedNodes());
+    }
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include "Game.h"
+#include "Square.h"
+#include "AIWorker.h"
+#include "HexBoard.h"
+#include "MonteCarloTreeSearch.h"
+
+#include <memory>
+
+//
+// hex on an 11x11 rhombus
+//
+// red moves first and joins the top edge to the bottom one, yellow joins
+// left to right; the cells along each edge are tinted the colour of the
+// player who owns it. stones are placed by clicking an empty cell and the
+// winner comes straight from HexBoard's union-find.
+//
+// the state string is 121 characters, the cells left-to-right,
+// top-to-bottom ('0' empty, '1' red, '2' yellow); whose move it is follows
+// from the stone count.
+//
+// the AI plays yellow with MonteCarloTreeSearch on an AIWorker thread for a
+// fixed time per move, with GameOptions::AIThreads threads and the tree kept
+// from one move to the next; the Settings window shows how fast the last
+// search ran.
+//
+class Hex : public Game
+{
+public:
+    Hex();
+    ~Hex();
+
+    // set up the board
+    void        setUpBoard() override;
+
+    Player*     checkForWinner() override;
+    bool        checkForDraw() override;
+    std::string initialStateString() override;
+    std::string stateString() const override;
+    void        setStateString(const std::string &s) override;
+    bool        actionForEmptyHolder(BitHolder *holder) override;
+    bool        canBitMoveFrom(Bit*bit, BitHolder *src) override;
+    bool        canBitMoveFromTo(Bit* bit, BitHolder*src, BitHolder*dst) override;
+    void        stopGame() override;
+
+    void        updateAI() override;
+    bool        gameHasAI() override { return true; }
+    void        drawSettings() override;
+    BitHolder &getHolderAt(const int x, const int y) override { return _grid[y][x]; }
+
+private:
+    Bit *       PieceForPlayer(const int playerNumber);
+    // a stone for the side to move, false if the cell is taken
+    bool        placeStone(int cell);
+
+    Square                      _grid[HexBoard::kSize][HexBoard::kSize];
+    HexBoard                    _board;
+    AIWorker                    _ai;
+    std::unique_ptr<MonteCarloTreeSearch<HexBoard>> _mcts;
+};
@@ -0,0 +1,161 @@
+#include "HexBoard.h"
+
+#include <utility>
+
+static constexpr std::array<std::array<int8_t, 6>, HexBoard::kCells> buildNeighbours()
+{
+    constexpr int kRowStep[6] = { -1, -1, 0, 0, 1, 1 };
+    constexpr int kColStep[6] = { 0, 1, -1, 1, -1, 0 };
+    std::array<std::array<int8_t, 6>, HexBoard::kCells> table{};
+    for (int cell = 0; cell < HexBoard::kCells; ++cell)
+    {
+        for (int i = 0; i < 6; ++i)
+        {
+            const int row = cell / HexBoard::kSize + kRowStep[i];
+            const int col = cell % HexBoard::kSize + kColStep[i];
+            const bool inside = row >= 0 && row < HexBoard::kSize && col >= 0 && col < HexBoard::kSize;
+            table[cell][i] = static_cast<int8_t>(inside ? row * HexBoard::kSize + col : -1);
+        }
+    }
+    return table;
+}
+
+const std::array<std::array<int8_t, 6>, HexBoard::kCells> HexBoard::kNeighbours = buildNeighbours();
+
+HexBoard::HexBoard() : _moves(0)
+{
+    for (int cell = 0; cell < kCells; ++cell)
+        _cells[cell] = -1;
+    for (int node = 0; node < kNodes; ++node)
+    {
+        _parent[node] = static_cast<uint8_t>(node);
+        _rank[node] = 0;
+    }
+}
+
+int HexBoard::find(uint8_t parent[], int node)
+{
+    // path halving, every other node on the way up is pointed at its grandparent
+    while (parent[node] != node)
+    {
+        parent[node] = parent[parent[node]];
+        node = parent[node];
+    }
+    return node;
+}
+
+void HexBoard::unite(uint8_t parent[], uint8_t rank[], int a, int b)
+{
+    a = find(parent, a);
+    b = find(parent, b);
+    if (a == b)
+        return;
+    if (rank[a] < rank[b])
+        std::swap(a, b);
+    parent[b] = static_cast<uint8_t>(a);
+    if (rank[a] == rank[b])
+        ++rank[a];
+}
+
+void HexBoard::place(int cell)
+{
+    const int player = sideToMove();
+    _cells[cell] = static_cast<int8_t>(player);
+    ++_moves;
+
+    for (int n : kNeighbours[cell])
+    {
+        if (n >= 0 && _cells[n] == player)
+            unite(_parent, _rank, cell, n);
+    }
+    const int row = cell / kSize;
+    const int col = cell % kSize;
+    if (player == 0)
+    {
+        if (row == 0)
+            unite(_parent, _rank, cell, kTop);
+        if (row == kSize - 1)
+            unite(_parent, _rank, cell, kBottom);
+    }
+    else
+    {
+        if (col == 0)
+            unite(_parent, _rank, cell, kLeft);
+        if (col == kSize - 1)
+            unite(_parent, _rank, cell, kRight);
+    }
+}
+
+int HexBoard::winner() const
+{
+    if (find(_parent, kTop) == find(_parent, kBottom))
+        return 0;
+    if (find(_parent, kLeft) == find(_parent, kRight))
+        return 1;
+    return -1;
+}
+
+int HexBoard::fullBoardWinner(const int8_t cells[kCells])
+{
+    uint8_t parent[kNodes];
+    uint8_t rank[kNodes] = {};
+    for (int node = 0; node < kNodes; ++node)
+        parent[node] = static_cast<uint8_t>(node);
+
+    // only the neighbours to the right and below, the others have been seen already
+    for (int cell = 0; cell < kCells; ++cell)
+    {
+        if (cells[cell] != 0)
+            continue;
+        for (int i = 3; i < 6; ++i)
+        {
+            const int n = kNeighbours[cell][i];
+            if (n >= 0 && cells[n] == 0)
+                unite(parent, rank, cell, n);
+        }
+        if (cell < kSize)
+            unite(parent, rank, cell, kTop);
+        else if (cell >= kCells - kSize)
+            unite(parent, rank, cell, kBottom);
+    }
+    return find(parent, kTop) == find(parent, kBottom) ? 0 : 1;
+}
+
+int HexBoard::legalMoves(Move *moves) const
+{
+    int count = 0;
+    for (int cell = 0; cell < kCells; ++cell)
+    {
+        if (_cells[cell] < 0)
+            moves[count++] = static_cast<Move>(cell);
+    }
+    return count;
+}
+
+int HexBoard::rollout(uint64_t &rng) const
+{
+    int8_t cells[kCells];
+    uint8_t empty[kCells];
+    int count = 0;
+    for (int cell = 0; cell < kCells; ++cell)
+    {
+        cells[cell] = _cells[cell];
+        if (cells[cell] < 0)
+            empty[count++] = static_cast<uint8_t>(cell);
+    }
+    // a fisher-yates shuffle handed out alternately as it goes
+    int player = sideToMove();
+    for (int i = count; i > 0; --i)
+    {
+        // xorshift64*
+        rng ^= rng >> 12;
+        rng ^= rng << 25;
+        rng ^= rng >> 27;
+        const uint64_t random = rng * 0x2545F4914F6CDD1Dull;
+        const int pick = static_cast<int>(((random >> 32) * static_cast<uint64_t>(i)) >> 32);
+        cells[empty[pick]] = static_cast<int8_t>(player);
+        player ^= 1;
+        empty[pick] = empty[i - 1];
+    }
+    return fullBoardWinner(cells);
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include <array>
+#include <cstdint>
+
+//
+// headless hex board with incremental connectivity
+//
+// 11x11 cells numbered row * 11 + column, each row shifted half a cell to
+// the right of the one above so a cell touches two cells in the row above,
+// two beside it and two below. player 0 moves first and joins the top edge
+// to the bottom one, player 1 joins left to right; there are no draws.
+//
+// every stone is a node of a union-find forest, joined to the neighbouring
+// stones of the same colour as it's placed, and the four edges are extra
+// "virtual" nodes joined to the stones on them. a player has won when their
+// two edges are in the same set, which is two finds: no flood fill, however
+// full the board.
+//
+// it's a MonteCarloTreeSearch position, with its own playout: since a full
+// board always has exactly one winner and it's the same whatever order the
+// stones went down in, rollout() shuffles the empty cells, hands them out
+// alternately and asks the union-find who won once at the end, building
+// just player 0's sets in one pass over the filled cells.
+//
+class HexBoard
+{
+public:
+    static const int kSize = 11;
+    static const int kCells = kSize * kSize;
+    // the virtual edge nodes after the cells
+    static const int kTop = kCells;
+    static const int kBottom = kCells + 1;
+    static const int kLeft = kCells + 2;
+    static const int kRight = kCells + 3;
+    static const int kNodes = kCells + 4;
+
+    typedef uint8_t Move;
+    static const int kMaxMoves = kCells;
+    // UCT explores less than usual, which suits hex's many moves
+    static constexpr float kExploration = 0.7f;
+
+    HexBoard();
+
+    int         sideToMove() const { return _moves & 1; }
+    int         moves() const { return _moves; }
+    // the player with a stone on the cell, -1 for empty
+    int         at(int cell) const { return _cells[cell]; }
+    bool        isEmpty(int cell) const { return _cells[cell] < 0; }
+    // a stone for the side to move, the cell has to be empty
+    void        place(int cell);
+    // the player joining their edges, -1 while nobody has
+    int         winner() const;
+    // a full board has a winner, so the game is over exactly when there is one
+    bool        gameOver() const { return winner() >= 0; }
+    // the empty cells, returns how many
+    int         legalMoves(Move *moves) const;
+    void        play(Move move) { place(move); }
+    // fill the board at random from here, returns the winner; rng is the
+    // search's xorshift64* state
+    int         rollout(uint64_t &rng) const;
+    // the winner of a board with every cell filled, which always has one:
+    // player 1 wins exactly when player 0 doesn't join top to bottom
+    static int  fullBoardWinner(const int8_t cells[kCells]);
+    const int8_t *cells() const { return _cells; }
+
+    static int  cellAt(int row, int col) { return row * kSize + col; }
+    // the up to six cells around one, -1 past the edge
+    static const std::array<std::array<int8_t, 6>, kCells> kNeighbours;
+
+private:
+    static int  find(uint8_t parent[], int node);
+    static void unite(uint8_t parent[], uint8_t rank[], int a, int b);
+
+    int8_t              _cells[kCells];
+    mutable uint8_t     _parent[kNodes];
+    uint8_t             _rank[kNodes];
+    int                 _moves;
+};
@@ -0,0 +1,318 @@
+#include "MNK.h"
+#include "WorkStealingPool.h"
+
+#include <algorithm>
+#include <thread>
+
+// how long each AI player thinks about its move
+static const std::chrono::milliseconds kThinkTime(1000);
+// the AI search after the MNKAlgorithm ones in the Settings window
+static const int kMonteCarlo = 2;
+// how long Solve in the Settings window may take, and the table it gets
+static const std::chrono::milliseconds kSolveTime(10000);
+static const size_t kSolveTableMegabytes = 256;
+// the sprites are 100x100, drawn smaller so the board fits
+static const float kCellSize = 80.0f;
+
+MNK::MNK() : _position(kSize, kSize, lineLength(3), 3), _nextPlayers(3),
+    _algorithm(static_cast<int>(MNKAlgorithm::kMaxN)), _proofKey(0)
+{
+    _search.setThreadPool(&WorkStealingPool::shared());
+}
+
+MNK::~MNK()
+{
+    _ai.cancel();
+    _proofWorker.cancel();
+}
+
+Bit* MNK::PieceForPlayer(const int playerNumber)
+{
+    static const char *kSprites[MNKPosition::kMaxPlayers] = { "x.png", "o.png", "red.png", "yellow.png" };
+    Bit *bit = new Bit();
+    bit->LoadTextureFromFile(kSprites[playerNumber]);
+    bit->setSize(kCellSize, kCellSize);
+    bit->setOwner(getPlayerAt(playerNumber));
+    return bit;
+}
+
+void MNK::setUpPlayers(int players)
+{
+    setNumberOfPlayers(players);
+    for (int player = 1; player < players; ++player)
+        setAIPlayer(player);
+    _position = MNKPosition(kSize, kSize, lineLength(players), players);
+    if (_mcts)
+        _mcts->reset();
+}
+
+//
+// setup the game board, this is called once at the start of the game
+//
+void MNK::setUpBoard()
+{
+    setUpPlayers(_nextPlayers);
+
+    _gameOptions.rowX = kSize;
+    _gameOptions.rowY = kSize;
+
+    for (int row = 0; row < kSize; ++row)
+    {
+        for (int col = 0; col < kSize; ++col)
+        {
+            ImVec2 pos(col * kCellSize, row * kCellSize);
+            _grid[row][col].initHolder(pos, "square.png", col, row);
+            _grid[row][col].setSize(kCellSize, kCellSize);
+            _grid[row][col].setGameTag(row * kSize + col);
+        }
+    }
+    _lastSearch = MNKSearchResult();
+
+    startGame();
+}
+
+bool MNK::actionForEmptyHolder(BitHolder *holder)
+{
+    if (!holder)
+        return false;
+    return placeStone(holder->gameTag());
+}
+
+bool MNK::placeStone(int cell)
+{
+    if (cell < 0 || cell >= _position.cells() || _position.at(cell) >= 0 || _position.gameOver())
+        return false;
+
+    Square &square = _grid[cell / kSize][cell % kSize];
+    Bit *placeBit = PieceForPlayer(_position.sideToMove());
+    placeBit->setPosition(square.getPosition());
+    square.setBit(placeBit);
+    _position.play(cell);
+    if (_mcts)
+        _mcts->advance(static_cast<MNKPosition::Move>(cell));
+    _lastMoveCode = cell;
+    return true;
+}
+
+bool MNK::canBitMoveFrom(Bit *bit, BitHolder *src)
+{
+    // stones stay where they're put
+    return false;
+}
+
+bool MNK::canBitMoveFromTo(Bit* bit, BitHolder*src, BitHolder*dst)
+{
+    return false;
+}
+
+//
+// free all the memory used by the game on the heap
+//
+void MNK::stopGame()
+{
+    // a search for the old board is no use any more
+    _ai.cancel();
+    _proofWorker.cancel();
+    _proofKey = 0;
+    for (int row = 0; row < kSize; ++row)
+    {
+        for (int col = 0; col < kSize; ++col)
+        {
+            _grid[row][col].destroyBit();
+        }
+    }
+    _position = MNKPosition(kSize, kSize, _position.k(), _position.players());
+    if (_mcts)
+        _mcts->reset();
+}
+
+Player* MNK::checkForWinner()
+{
+    const int winner = _position.winner();
+    return winner < 0 ? nullptr : getPlayerAt(winner);
+}
+
+bool MNK::checkForDraw()
+{
+    return _position.winner() < 0 && _position.empty() == 0;
+}
+
+//
+// state strings
+//
+std::string MNK::initialStateString()
+{
+    std::string state(kSize * kSize, '0');
+    state += static_cast<char>('0' + _nextPlayers);
+    state += static_cast<char>('0' + lineLength(_nextPlayers));
+    return state;
+}
+
+std::string MNK::stateString() const
+{
+    std::string state(kSize * kSize, '0');
+    for (int cell = 0; cell < _position.cells(); ++cell)
+    {
+        const int player = _position.at(cell);
+        if (player >= 0)
+            state[cell] = static_cast<char>('1' + player);
+    }
+    state += static_cast<char>('0' + _position.players());
+    state += static_cast<char>('0' + _position.k());
+    return state;
+}
+
+void MNK::setStateString(const std::string &s)
+{
+    if (s.size() != kSize * kSize + 2)
+        return;
+    const int players = s[kSize * kSize] - '0';
+    const int k = s[kSize * kSize + 1] - '0';
+    if (players < 2 || players > MNKPosition::kMaxPlayers || k < 3 || k > kSize)
+        return;
+
+    // stones go down in turn, so nobody can be more than one ahead of the players after them
+    int counts[MNKPosition::kMaxPlayers] = { 0, 0, 0, 0 };
+    int total = 0;
+    for (int cell = 0; cell < kSize * kSize; ++cell)
+    {
+        const int player = s[cell] - '1';
+        if (player >= players || (s[cell] != '0' && player < 0))
+            return;
+        if (player >= 0)
+        {
+            ++counts[player];
+            ++total;
+        }
+    }
+    for (int player = 0; player < players; ++player)
+    {
+        if (counts[player] != total / players + (player < total % players ? 1 : 0))
+            return;
+    }
+
+    stopGame();
+    if (players != _position.players())
+        setUpPlayers(players);
+    _position = MNKPosition(kSize, kSize, k, players);
+
+    // only which stones are down matters, not the order, so they're placed
+    // by going round the players through each one's cells
+    int next[MNKPosition::kMaxPlayers] = { 0, 0, 0, 0 };
+    for (int placed = 0; placed < total; ++placed)
+    {
+        const int player = placed % players;
+        const char mark = static_cast<char>('1' + player);
+        while (s[next[player]] != mark)
+            ++next[player];
+        placeStone(next[player]++);
+    }
+    _lastMoveCode = kNoMoveCode;
+
+    _gameOptions.currentTurnNo = static_cast<unsigned int>(total);
+}
+
+//
+// called every frame while it's an AI's turn: the first call starts the
+// search on the worker thread, later calls play the move once it's ready
+//
+void MNK::updateAI()
+{
+    if (checkForWinner() || checkForDraw())
+        return;
+
+    if (!_ai.busy() && _algorithm == kMonteCarlo)
+    {
+        if (!_mcts)
+            _mcts = std::make_unique<MonteCarloTreeSearch<MNKPosition>>();
+        const MNKPosition position = _position;
+        MonteCarloTreeSearch<MNKPosition> *mcts = _mcts.get();
+        mcts->setThreads(_gameOptions.AIThreads);
+        _ai.start([mcts, position](const std::atomic<bool> &stop) {
+            return mcts->bestMove(position, ~uint64_t(0), &stop);
+        }, kThinkTime);
+        return;
+    }
+    if (!_ai.busy())
+    {
+        const MNKPosition position = _position;
+        const MNKAlgorithm algorithm = static_cast<MNKAlgorithm>(_algorithm);
+        MNKSearch *search = &_search;
+        MNKSearchResult *result = &_lastSearch;
+        _ai.start([search, result, position, algorithm](const std::atomic<bool> &stop) {
+            *result = search->search(position, algorithm, MNKPosition::kMaxCells, kThinkTime, &stop);
+            return result->move;
+        }, kThinkTime + std::chrono::milliseconds(500));
+        return;
+    }
+
+    int cell;
+    if (_ai.poll(cell) && placeStone(cell))
+        endTurn();
+}
+
+void MNK::drawSettings()
+{
+    ImGui::SetNextItemWidth(150);
+    ImGui::SliderInt("Players (on reset)", &_nextPlayers, 2, MNKPosition::kMaxPlayers);
+    static const char *kAlgorithms[] = { "max^n", "paranoid", "monte carlo" };
+    ImGui::SetNextItemWidth(150);
+    ImGui::Combo("AI search", &_algorithm, kAlgorithms, IM_ARRAYSIZE(kAlgorithms));
+    ImGui::Text("%d players, %d in a row", _position.players(), _position.k());
+    // the worker is joined once the move is played, so the numbers are safe to read
+    if (_algorithm == kMonteCarlo)
+    {
+        const int hardwareThreads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+        ImGui::SetNextItemWidth(150);
+        ImGui::SliderInt("AI threads", &_gameOptions.AIThreads, 1, hardwareThreads);
+        if (_mcts && !_ai.busy() && _mcts->playouts() > 0)
+        {
+            ImGui::Text("Last search: %llu playouts, %.0f playouts/s, %zu nodes, %zu kept after the move",
+                        (unsigned long long)_mcts->playouts(), _mcts->playoutsPerSecond(), _mcts->nodesUsed(),
+                        _mcts->reusedNodes());
+        }
+    }
+    else if (!_ai.busy() && _lastSearch.nodes > 0)
+    {
+        ImGui::Text("Last search: depth %d, %llu nodes, %.0f nodes/s", _lastSearch.depth,
+                    (unsigned long long)_lastSearch.nodes, _lastSearch.seconds > 0 ? _lastSearch.nodes / _lastSearch.seconds : 0.0);
+    }
+
+    // proof-number search is for two players only
+    if (_position.players() != 2)
+        return;
+    int move;
+    if (_proofWorker.busy() && !_proofWorker.poll(move))
+    {
+        ImGui::Text("Solving...");
+        return;
+    }
+    if (ImGui::Button("Solve position"))
+    {
+        if (!_proof)
+            _proof = std::make_unique<ProofNumberSearch<MNKPosition>>(kSolveTableMegabytes);
+        const MNKPosition position = _position;
+        ProofNumberSearch<MNKPosition> *proof = _proof.get();
+        ProofResult *result = &_proofResult;
+        _proofWorker.start([proof, result, position](const std::atomic<bool> &stop) {
+            *result = proof->solve(position, ~uint64_t(0), &stop);
+            return result->move;
+        }, kSolveTime);
+        _proofKey = _position.key();
+        return;
+    }
+    // only while the board is still the one that was solved
+    if (_proofKey != _position.key())
+        return;
+    if (_proofResult.value == ProofValue::kUnknown)
+        ImGui::Text("Not solved in %.0f s", _proofResult.seconds);
+    else if (_proofResult.move >= 0)
+    {
+        ImGui::Text("Side to move: %s, playing row %d column %d", proofValueName(_proofResult.value),
+                    _proofResult.move / kSize + 1, _proofResult.move % kSize + 1);
+    }
+    else
+        ImGui::Text("Side to move: %s", proofValueName(_proofResult.value));
+    ImGui::Text("%llu nodes, %.1f of %.0f MB table, %.2f s", (unsigned long long)_proofResult.nodes,
+                _proofResult.memory / 1048576.0, _proofResult.tableSize / 1048576.0, _proofResult.seconds);
+}
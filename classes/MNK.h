@@ -0,0 +1,81 @@
+#pragma once
+#include "Game.h"
+#include "Square.h"
+#include "AIWorker.h"
+#include "MNKSearch.h"
+#include "MonteCarloTreeSearch.h"
+#include "ProofNumberSearch.h"
+
+#include <memory>
+
+//
+// m,n,k for two to four players on an 8x8 board
+//
+// the players take turns clicking empty cells, the first to get k in a row
+// wins: five with two players, four with three or four, where the board
+// gets crowded enough that five rarely happens. the number of players and
+// the algorithm the AI uses are picked in the Settings window and take
+// effect on the next Reset Game.
+//
+// player 0 is the human, everybody else is an AI running MNKSearch on an
+// AIWorker thread, max^n or paranoid, or MonteCarloTreeSearch on
+// GameOptions::AIThreads threads, whose tree is kept from one move to the
+// next for whoever moves after it. with two players the Settings window
+// can also solve the position outright with ProofNumberSearch, on a second
+// worker.
+//
+// the state string is 66 characters: the cells left-to-right,
+// top-to-bottom ('0' empty, '1' to '4' the player), then the number of
+// players and k. whose move it is follows from the stone count.
+//
+class MNK : public Game
+{
+public:
+    static const int kSize = 8;
+
+    MNK();
+    ~MNK();
+
+    // set up the board
+    void        setUpBoard() override;
+
+    Player*     checkForWinner() override;
+    bool        checkForDraw() override;
+    std::string initialStateString() override;
+    std::string stateString() const override;
+    void        setStateString(const std::string &s) override;
+    bool        actionForEmptyHolder(BitHolder *holder) override;
+    bool        canBitMoveFrom(Bit*bit, BitHolder *src) override;
+    bool        canBitMoveFromTo(Bit* bit, BitHolder*src, BitHolder*dst) override;
+    void        stopGame() override;
+
+    void        updateAI() override;
+    bool        gameHasAI() override { return true; }
+    void        drawSettings() override;
+    BitHolder &getHolderAt(const int x, const int y) override { return _grid[y][x]; }
+
+private:
+    Bit *       PieceForPlayer(const int playerNumber);
+    // new players and an empty board for that many of them
+    void        setUpPlayers(int players);
+    // a stone for the side to move, false if the cell is taken
+    bool        placeStone(int cell);
+
+    static int  lineLength(int players) { return players == 2 ? 5 : 4; }
+
+    Square              _grid[kSize][kSize];
+    MNKPosition         _position;
+    AIWorker            _ai;
+    MNKSearch           _search;
+    MNKSearchResult     _lastSearch;
+    int                 _nextPlayers;       // what the Settings window asks for, used on the next reset
+    int                 _algorithm;         // an MNKAlgorithm, or kMonteCarlo
+    // made the first time monte carlo is picked, and told every move after that
+    std::unique_ptr<MonteCarloTreeSearch<MNKPosition>>  _mcts;
+
+    // the Settings window's Solve button, the table is only allocated once it's pressed
+    AIWorker                                            _proofWorker;
+    std::unique_ptr<ProofNumberSearch<MNKPosition>>     _proof;
+    ProofResult                                         _proofResult;
+    uint64_t                                            _proofKey;      // the position it was asked about, 0 for none
+};
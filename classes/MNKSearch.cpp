@@ -0,0 +1,484 @@
+#include "MNKSearch.h"
+#include "WorkStealingPool.h"
+
+#include <algorithm>
+#include <bit>
+
+MNKPosition::MNKPosition(int width, int height, int k, int players) :
+    _width(std::clamp(width, 1, 8)), _height(std::clamp(height, 1, kMaxCells / std::clamp(width, 1, 8))),
+    _k(std::max(k, 1)), _players(std::clamp(players, 2, kMaxPlayers)), _moves(0), _winner(-1),
+    _boardMask(0), _notFirstColumn(0), _notLastColumn(0), _stones{ 0, 0, 0, 0 }
+{
+    auto tables = std::make_shared<Tables>();
+    tables->cellWindows.resize(kMaxCells);
+    for (int cell = 0; cell < cells(); ++cell)
+    {
+        _boardMask |= uint64_t(1) << cell;
+        if (cell % _width != 0)
+            _notFirstColumn |= uint64_t(1) << cell;
+        if (cell % _width != _width - 1)
+            _notLastColumn |= uint64_t(1) << cell;
+    }
+
+    // every window of k cells in a line: across, down and both diagonals
+    const int kRowStep[4] = { 0, 1, 1, 1 };
+    const int kColStep[4] = { 1, 0, 1, -1 };
+    for (int row = 0; row < _height; ++row)
+    {
+        for (int col = 0; col < _width; ++col)
+        {
+            for (int d = 0; d < 4; ++d)
+            {
+                const int endRow = row + kRowStep[d] * (_k - 1);
+                const int endCol = col + kColStep[d] * (_k - 1);
+                if (endRow < 0 || endRow >= _height || endCol < 0 || endCol >= _width)
+                    continue;
+                uint64_t window = 0;
+                for (int i = 0; i < _k; ++i)
+                    window |= uint64_t(1) << ((row + kRowStep[d] * i) * _width + col + kColStep[d] * i);
+                for (uint64_t b = window; b; b &= b - 1)
+                    tables->cellWindows[std::countr_zero(b)].push_back(static_cast<int>(tables->windows.size()));
+                tables->windows.push_back(window);
+            }
+        }
+    }
+    _tables = std::move(tables);
+}
+
+uint64_t MNKPosition::occupied() const
+{
+    uint64_t all = 0;
+    for (int p = 0; p < _players; ++p)
+        all |= _stones[p];
+    return all;
+}
+
+int MNKPosition::at(int cell) const
+{
+    for (int p = 0; p < _players; ++p)
+    {
+        if (_stones[p] & (uint64_t(1) << cell))
+            return p;
+    }
+    return -1;
+}
+
+void MNKPosition::play(int cell)
+{
+    const int player = sideToMove();
+    _stones[player] |= uint64_t(1) << cell;
+    ++_moves;
+    for (int w : _tables->cellWindows[cell])
+    {
+        const uint64_t window = _tables->windows[w];
+        if ((_stones[player] & window) == window)
+        {
+            _winner = player;
+            break;
+        }
+    }
+}
+
+void MNKPosition::undo(int cell)
+{
+    --_moves;
+    _stones[sideToMove()] &= ~(uint64_t(1) << cell);
+    // nobody plays on after a win, so taking any stone back undoes it
+    _winner = -1;
+}
+
+uint64_t MNKPosition::candidates() const
+{
+    const uint64_t stones = occupied();
+    // small boards are searched in full
+    if (!stones || cells() <= 16)
+        return empty();
+    const uint64_t row = stones | ((stones & _notLastColumn) << 1) | ((stones & _notFirstColumn) >> 1);
+    const uint64_t around = row | (row << _width) | (row >> _width);
+    return around & empty();
+}
+
+int MNKPosition::legalMoves(uint8_t *moves) const
+{
+    int count = 0;
+    for (uint64_t cells = empty(); cells; cells &= cells - 1)
+        moves[count++] = static_cast<uint8_t>(std::countr_zero(cells));
+    return count;
+}
+
+uint64_t MNKPosition::threats(int player) const
+{
+    const uint64_t others = occupied() & ~_stones[player];
+    uint64_t cells = 0;
+    for (uint64_t window : _tables->windows)
+    {
+        if (!(window & others) && std::popcount(_stones[player] & window) == _k - 1)
+            cells |= window & ~_stones[player];
+    }
+    return cells;
+}
+
+bool MNKPosition::hasOpenLine(int player) const
+{
+    const uint64_t others = occupied() & ~_stones[player];
+    for (uint64_t window : _tables->windows)
+    {
+        if (!(window & others))
+            return true;
+    }
+    return false;
+}
+
+uint64_t MNKPosition::liveCells() const
+{
+    const uint64_t all = occupied();
+    uint64_t cells = 0;
+    for (uint64_t window : _tables->windows)
+    {
+        // open while one player at most has stones in it
+        const uint64_t taken = window & all;
+        for (int p = 0; p < _players; ++p)
+        {
+            if ((taken & _stones[p]) == taken)
+            {
+                cells |= window;
+                break;
+            }
+        }
+    }
+    return cells & ~all;
+}
+
+uint64_t MNKPosition::key() const
+{
+    // a different multiplier per player, so trading stones changes the key
+    static const uint64_t kMix[kMaxPlayers] = { 0x9E3779B97F4A7C15ull, 0xBF58476D1CE4E5B9ull, 0x94D049BB133111EBull,
+                                                0xD6E8FEB86659FD93ull };
+    uint64_t key = 0;
+    for (int p = 0; p < _players; ++p)
+    {
+        const uint64_t h = (_stones[p] ^ (key >> 29)) * kMix[p];
+        key ^= h ^ (h >> 32);
+    }
+    return key;
+}
+
+//
+// the search
+//
+
+// a window counts for a player only while nobody else has a stone in it, the
+// more of their stones in it the more it's worth
+static int windowWeight(int stones)
+{
+    return stones == 0 ? 0 : 1 << (2 * (stones - 1));
+}
+
+void MNKSearch::evaluate(const MNKPosition &position, int scores[MNKPosition::kMaxPlayers])
+{
+    const int players = position.players();
+    int weight[MNKPosition::kMaxPlayers] = { 1, 1, 1, 1 };
+    const uint64_t all = position.occupied();
+    for (uint64_t window : position.windows())
+    {
+        const uint64_t taken = window & all;
+        if (!taken)
+            continue;
+        for (int p = 0; p < players; ++p)
+        {
+            const uint64_t mine = window & position.stones(p);
+            if (mine == taken)
+            {
+                weight[p] += windowWeight(std::popcount(mine));
+                break;
+            }
+        }
+    }
+    int total = 0;
+    for (int p = 0; p < players; ++p)
+        total += weight[p];
+    // rounded down, so the sum never goes over kTotalScore and the pruning stays safe
+    for (int p = 0; p < MNKPosition::kMaxPlayers; ++p)
+        scores[p] = p < players ? kTotalScore * weight[p] / total : 0;
+}
+
+MNKSearch::Scores MNKSearch::terminalScores(const MNKPosition &position) const
+{
+    Scores scores{};
+    if (position.winner() >= 0)
+        scores[position.winner()] = kTotalScore;
+    else
+    {
+        for (int p = 0; p < position.players(); ++p)
+            scores[p] = kTotalScore / position.players();
+    }
+    return scores;
+}
+
+int MNKSearch::orderMoves(const MNKPosition &position, int moves[]) const
+{
+    // a cell is worth the windows through it it would extend or break up
+    int scores[MNKPosition::kMaxCells];
+    int count = 0;
+    const int side = position.sideToMove();
+    const uint64_t all = position.occupied();
+    for (uint64_t c = position.candidates(); c; c &= c - 1)
+    {
+        const int cell = std::countr_zero(c);
+        int score = 0;
+        for (int w : position.windowsThrough(cell))
+        {
+            const uint64_t window = position.windows()[w];
+            const uint64_t taken = window & all;
+            for (int p = 0; p < position.players(); ++p)
+            {
+                const uint64_t mine = window & position.stones(p);
+                if (mine == taken)
+                {
+                    score += windowWeight(std::popcount(mine) + 1) * (p == side ? 2 : 1);
+                    break;
+                }
+            }
+        }
+        int i = count++;
+        while (i > 0 && scores[i - 1] < score)
+        {
+            scores[i] = scores[i - 1];
+            moves[i] = moves[i - 1];
+            --i;
+        }
+        scores[i] = score;
+        moves[i] = cell;
+    }
+    return count;
+}
+
+bool MNKSearch::splitting() const
+{
+    return _pool && _pool->threads() > 1;
+}
+
+void MNKSearch::checkTime()
+{
+    if ((_stop && _stop->load(std::memory_order_relaxed)) ||
+        (_hasDeadline && std::chrono::steady_clock::now() >= _deadline))
+        _aborted = true;
+}
+
+MNKSearch::Scores MNKSearch::maxn(MNKPosition &position, int depth, int parentBest, uint64_t &nodes)
+{
+    if ((++nodes & 1023) == 0)
+        checkTime();
+    if (position.gameOver())
+        return terminalScores(position);
+    if (depth <= 0)
+    {
+        Scores scores;
+        evaluate(position, scores.data());
+        return scores;
+    }
+
+    int moves[MNKPosition::kMaxCells];
+    const int count = orderMoves(position, moves);
+    const int side = position.sideToMove();
+    Scores best{};
+    best[side] = -1;
+    for (int i = 0; i < count && !_aborted; ++i)
+    {
+        position.play(moves[i]);
+        const Scores child = maxn(position, depth - 1, best[side], nodes);
+        position.undo(moves[i]);
+        if (_aborted)
+            break;
+        if (child[side] > best[side])
+            best = child;
+        // the player above can't let us have this much, so it won't come here
+        if (best[side] >= kTotalScore - parentBest)
+            break;
+    }
+    return best;
+}
+
+int MNKSearch::paranoid(MNKPosition &position, int depth, int alpha, int beta, int ply, uint64_t &nodes)
+{
+    if ((++nodes & 1023) == 0)
+        checkTime();
+    if (position.gameOver())
+    {
+        // sooner wins and later losses are better for the root player
+        if (position.winner() == _rootPlayer)
+            return kTotalScore - ply;
+        if (position.winner() >= 0)
+            return ply;
+        return kTotalScore / position.players();
+    }
+    if (depth <= 0)
+    {
+        int scores[MNKPosition::kMaxPlayers];
+        evaluate(position, scores);
+        return scores[_rootPlayer];
+    }
+
+    int moves[MNKPosition::kMaxCells];
+    const int count = orderMoves(position, moves);
+    const bool maximizing = position.sideToMove() == _rootPlayer;
+    int best = maximizing ? -1 : kTotalScore + 1;
+    auto update = [&](int score) {
+        if (maximizing ? score > best : score < best)
+            best = score;
+        if (maximizing)
+            alpha = std::max(alpha, best);
+        else
+            beta = std::min(beta, best);
+        return alpha >= beta;
+    };
+
+    int next = 0;
+    for (; next < count && !_aborted; ++next)
+    {
+        // the eldest brother has been searched, the rest can go in parallel
+        if (next == 1 && depth >= kSplitDepth && splitting())
+            break;
+        position.play(moves[next]);
+        const int score = paranoid(position, depth - 1, alpha, beta, ply + 1, nodes);
+        position.undo(moves[next]);
+        if (_aborted || update(score))
+            return best;
+    }
+    if (next >= count || _aborted)
+        return best;
+
+    int scores[MNKPosition::kMaxCells];
+    uint64_t counts[MNKPosition::kMaxCells] = {};
+    {
+        WorkStealingPool::TaskGroup group(*_pool);
+        for (int i = next; i < count; ++i)
+        {
+            group.run([this, &position, &moves, &scores, &counts, i, depth, alpha, beta, ply]() {
+                MNKPosition child = position;
+                child.play(moves[i]);
+                scores[i] = paranoid(child, depth - 1, alpha, beta, ply + 1, counts[i]);
+            });
+        }
+        group.wait();
+    }
+    // taken in move order, as if they'd been searched one after another
+    for (int i = next; i < count; ++i)
+    {
+        nodes += counts[i];
+        if (!_aborted && update(scores[i]))
+            break;
+    }
+    return best;
+}
+
+MNKSearch::Scores MNKSearch::searchRoot(const MNKPosition &position, MNKAlgorithm algorithm, int depth, uint64_t &nodes)
+{
+    // the root is a node like any other, except it remembers which move was best
+    int moves[MNKPosition::kMaxCells];
+    const int count = orderMoves(position, moves);
+    const int side = position.sideToMove();
+    const bool parallel = splitting();
+    Scores best{};
+    best[side] = -1;
+    int alpha = -1;
+    auto search = [&](int move, int bound, uint64_t &counter) {
+        MNKPosition child = position;
+        child.play(move);
+        Scores scores{};
+        if (algorithm == MNKAlgorithm::kMaxN)
+            scores = maxn(child, depth - 1, bound, counter);
+        else
+            scores[side] = paranoid(child, depth - 1, bound, kTotalScore + 1, 1, counter);
+        return scores;
+    };
+    auto update = [&](const Scores &scores, int move) {
+        if (scores[side] > best[side])
+        {
+            best = scores;
+            alpha = scores[side];
+            _rootBest = move;
+        }
+    };
+
+    for (int i = 0; i < count && !_aborted; ++i)
+    {
+        // everything after the first move goes to the pool with the first move's bound
+        if (i == 1 && parallel)
+        {
+            Scores results[MNKPosition::kMaxCells];
+            uint64_t counts[MNKPosition::kMaxCells] = {};
+            {
+                WorkStealingPool::TaskGroup group(*_pool);
+                const int bound = alpha;
+                for (int j = 1; j < count; ++j)
+                    group.run([&, j, bound]() { results[j] = search(moves[j], bound, counts[j]); });
+                group.wait();
+            }
+            for (int j = 1; j < count; ++j)
+            {
+                nodes += counts[j];
+                update(results[j], moves[j]);
+            }
+            break;
+        }
+        const Scores scores = search(moves[i], alpha, nodes);
+        if (_aborted)
+            break;
+        update(scores, moves[i]);
+        // a win won't get any better
+        if (best[side] >= kTotalScore - (algorithm == MNKAlgorithm::kMaxN ? 0 : 1))
+            break;
+    }
+    return best;
+}
+
+MNKSearchResult MNKSearch::search(const MNKPosition &position, MNKAlgorithm algorithm, int maxDepth,
+                                  std::chrono::milliseconds budget, const std::atomic<bool> *stop)
+{
+    const auto start = std::chrono::steady_clock::now();
+    MNKSearchResult result;
+    _stop = stop;
+    _aborted = false;
+    _hasDeadline = budget.count() > 0;
+    _deadline = start + budget;
+    _rootPlayer = position.sideToMove();
+    if (position.gameOver())
+        return result;
+
+    uint64_t nodes = 0;
+    const int deepest = std::min(maxDepth, std::popcount(position.empty()));
+    for (int depth = 1; depth <= deepest; ++depth)
+    {
+        _rootBest = -1;
+        Scores scores = searchRoot(position, algorithm, depth, nodes);
+        if (_aborted)
+            break;
+        if (algorithm == MNKAlgorithm::kParanoid)
+        {
+            // the coalition shares what the root player doesn't get
+            const int value = scores[_rootPlayer];
+            for (int p = 0; p < position.players(); ++p)
+                scores[p] = p == _rootPlayer ? value : (kTotalScore - value) / (position.players() - 1);
+        }
+        result.move = _rootBest;
+        result.scores = scores;
+        result.depth = depth;
+        // a win for the root player won't get any better
+        if (scores[_rootPlayer] >= kTotalScore - depth)
+            break;
+        // the next iteration would most likely not finish
+        if (_hasDeadline && std::chrono::steady_clock::now() - start > budget / 2)
+            break;
+    }
+    // a search stopped before its first iteration still plays something
+    if (result.move < 0)
+    {
+        int moves[MNKPosition::kMaxCells];
+        if (orderMoves(position, moves) > 0)
+            result.move = moves[0];
+    }
+    result.nodes = nodes;
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
@@ -0,0 +1,175 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+//
+// headless m,n,k game for two to four players
+//
+// an m x n board (at most 64 cells) where the players take turns in order,
+// player 0 first, and the first to get k in a row across, down or
+// diagonally wins; a full board with no line is a draw. cells are numbered
+// row * width + column and every player's stones are a uint64_t.
+//
+// every k-cell window a line could be made in is a mask built once, with a
+// list of the windows through each cell, so checking a move for a win is a
+// handful of ands and the evaluation is a popcount per window. the tables
+// are shared between copies of a position, so a copy is cheap.
+//
+class MNKPosition
+{
+public:
+    static constexpr int kMaxPlayers = 4;
+    static constexpr int kMaxCells = 64;
+    // for MonteCarloTreeSearch
+    typedef uint8_t Move;
+    static constexpr int kMaxMoves = kMaxCells;
+
+    MNKPosition(int width = 8, int height = 8, int k = 4, int players = 3);
+
+    int         width() const { return _width; }
+    int         height() const { return _height; }
+    int         cells() const { return _width * _height; }
+    int         k() const { return _k; }
+    int         players() const { return _players; }
+    int         sideToMove() const { return _moves % _players; }
+    int         moves() const { return _moves; }
+    uint64_t    stones(int player) const { return _stones[player]; }
+    uint64_t    occupied() const;
+    uint64_t    empty() const { return ~occupied() & _boardMask; }
+    // the player on a cell, -1 for empty
+    int         at(int cell) const;
+
+    // the side to move puts a stone on an empty cell
+    void        play(int cell);
+    // take back the last stone, which was on "cell"
+    void        undo(int cell);
+    // the player with k in a row, -1 while nobody has one
+    int         winner() const { return _winner; }
+    bool        gameOver() const { return _winner >= 0 || empty() == 0; }
+
+    // the empty cells next to a stone, or every empty cell on an empty board
+    uint64_t    candidates() const;
+    // every empty cell, returns how many
+    int         legalMoves(uint8_t *moves) const;
+    // empty cells that would give the player k in a row
+    uint64_t    threats(int player) const;
+    // whether the player has a window left with nobody else's stones in it
+    bool        hasOpenLine(int player) const;
+    // empty cells in a window somebody could still complete
+    uint64_t    liveCells() const;
+    // a hash of everyone's stones, for transposition tables
+    uint64_t    key() const;
+
+    const std::vector<uint64_t> &windows() const { return _tables->windows; }
+    // indices into windows() of the ones through a cell
+    const std::vector<int> &windowsThrough(int cell) const { return _tables->cellWindows[cell]; }
+
+private:
+    struct Tables
+    {
+        std::vector<uint64_t>           windows;
+        std::vector<std::vector<int>>   cellWindows;    // the windows through each cell
+    };
+
+    int                             _width;
+    int                             _height;
+    int                             _k;
+    int                             _players;
+    int                             _moves;
+    int                             _winner;
+    uint64_t                        _boardMask;
+    uint64_t                        _notFirstColumn;
+    uint64_t                        _notLastColumn;
+    uint64_t                        _stones[kMaxPlayers];
+    std::shared_ptr<const Tables>   _tables;
+};
+
+enum class MNKAlgorithm
+{
+    kMaxN,          // every player maximizes their own score
+    kParanoid       // everyone else is assumed to be against the player to move at the root
+};
+
+struct MNKSearchResult
+{
+    int                                         move = -1;
+    int                                         depth = 0;      // last iteration that finished
+    std::array<int, MNKPosition::kMaxPlayers>   scores{};       // what the search expects each player to end up with
+    uint64_t                                    nodes = 0;
+    double                                      seconds = 0;
+};
+
+//
+// search for more than two players
+//
+// scores are a vector, one per player, that always adds up to kTotalScore:
+// a win takes all of it, a draw splits it evenly, and the evaluation shares
+// it out by the weight of the lines each player can still complete.
+//
+// max^n searches the vector, each player picking the child best for
+// themselves. shallow pruning comes from the constant sum: once a player can
+// get more than kTotalScore minus what the player above already has, the
+// player above won't come this way and the rest of the node is cut.
+//
+// paranoid search turns the game into two sides, the root player against a
+// coalition of everyone else minimizing the root player's score, so plain
+// alpha-beta applies and cuts much deeper, at the cost of assuming the worst
+// of everybody. with two players both are ordinary minimax.
+//
+// both are iterative deepening under a depth limit, a time budget and a stop
+// flag. moves are the candidates next to stones already down, the ones
+// taking or blocking the most promising windows first.
+//
+// given a thread pool with more than one thread the search splits, young
+// brothers wait style: the first move at a node is searched alone, then the
+// rest all at once on the pool with the bounds the first one left. at the
+// root this happens for both algorithms, below it for paranoid wherever
+// there are at least kSplitDepth plies left. every split task has a fixed
+// window, so a fixed depth search picks the same move with the same scores
+// as it does on one thread, whatever the thread count and timing.
+//
+class WorkStealingPool;
+
+class MNKSearch
+{
+public:
+    static constexpr int kTotalScore = 1000;
+    static constexpr int kSplitDepth = 4;
+
+    MNKSearchResult search(const MNKPosition &position, MNKAlgorithm algorithm, int maxDepth,
+                           std::chrono::milliseconds budget = std::chrono::milliseconds(0),
+                           const std::atomic<bool> *stop = nullptr);
+
+    // null, or a pool of one thread, searches on the calling thread alone
+    void        setThreadPool(WorkStealingPool *pool) { _pool = pool; }
+
+    // the evaluation every search uses, one score per player adding up to kTotalScore
+    static void evaluate(const MNKPosition &position, int scores[MNKPosition::kMaxPlayers]);
+
+private:
+    typedef std::array<int, MNKPosition::kMaxPlayers> Scores;
+
+    // one iteration from the root, sets _rootBest
+    Scores      searchRoot(const MNKPosition &position, MNKAlgorithm algorithm, int depth, uint64_t &nodes);
+    // parentBest is what the player moving above already has, for shallow pruning
+    Scores      maxn(MNKPosition &position, int depth, int parentBest, uint64_t &nodes);
+    // scores for the root player
+    int         paranoid(MNKPosition &position, int depth, int alpha, int beta, int ply, uint64_t &nodes);
+    // candidate moves best first, returns how many
+    int         orderMoves(const MNKPosition &position, int moves[]) const;
+    Scores      terminalScores(const MNKPosition &position) const;
+    bool        splitting() const;
+    void        checkTime();
+
+    WorkStealingPool                       *_pool = nullptr;
+    int                                     _rootPlayer = 0;
+    int                                     _rootBest = -1;
+    const std::atomic<bool>                *_stop = nullptr;
+    std::atomic<bool>                       _aborted = false;
+    bool                                    _hasDeadline = false;
+    std::chrono::steady_clock::time_point   _deadline;
+};
@@ -0,0 +1,144 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+MappedFile::MappedFile() : _data(nullptr), _size(0), _opened(false), _file(nullptr), _mapping(nullptr)
+{
+}
+
+bool MappedFile::open(const std::string &path, Access access)
+{
+    close();
+    DWORD flags = FILE_ATTRIBUTE_NORMAL;
+    if (access == kSequential)
+        flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+    else if (access == kRandom)
+        flags |= FILE_FLAG_RANDOM_ACCESS;
+
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flags, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size))
+    {
+        CloseHandle(file);
+        return false;
+    }
+    _file = file;
+    _size = static_cast<size_t>(size.QuadPart);
+    _opened = true;
+    if (_size == 0)
+        return true;
+
+    _mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (_mapping)
+        _data = static_cast<const uint8_t *>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+    if (!_data)
+    {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void MappedFile::close()
+{
+    if (_data)
+        UnmapViewOfFile(_data);
+    if (_mapping)
+        CloseHandle(_mapping);
+    if (_file)
+        CloseHandle(_file);
+    _data = nullptr;
+    _mapping = nullptr;
+    _file = nullptr;
+    _size = 0;
+    _opened = false;
+}
+
+void MappedFile::adviseWillNeed(size_t offset, size_t length) const
+{
+}
+
+#else
+
+MappedFile::MappedFile() : _data(nullptr), _size(0), _opened(false), _fd(-1)
+{
+}
+
+bool MappedFile::open(const std::string &path, Access access)
+{
+    close();
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        ::close(fd);
+        return false;
+    }
+    _fd = fd;
+    _size = static_cast<size_t>(st.st_size);
+    _opened = true;
+    if (_size == 0)
+        return true;
+
+    void *p = mmap(nullptr, _size, PROT_READ, MAP_SHARED, fd, 0);
+    if (p == MAP_FAILED)
+    {
+        close();
+        return false;
+    }
+    _data = static_cast<const uint8_t *>(p);
+
+    if (access == kSequential)
+        madvise(p, _size, MADV_SEQUENTIAL);
+    else if (access == kRandom)
+        madvise(p, _size, MADV_RANDOM);
+    return true;
+}
+
+void MappedFile::close()
+{
+    if (_data)
+        munmap(const_cast<uint8_t *>(_data), _size);
+    if (_fd >= 0)
+        ::close(_fd);
+    _data = nullptr;
+    _fd = -1;
+    _size = 0;
+    _opened = false;
+}
+
+void MappedFile::adviseWillNeed(size_t offset, size_t length) const
+{
+    if (!_data || offset >= _size)
+        return;
+    // madvise wants a page aligned start
+    const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t start = offset & ~(page - 1);
+    if (length > _size - offset)
+        length = _size - offset;
+    madvise(const_cast<uint8_t *>(_data) + start, length + (offset - start), MADV_WILLNEED);
+}
+
+#endif
+
+MappedFile::~MappedFile()
+{
+    close();
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+//
+// read-only memory mapping of a whole file (mmap on POSIX, a file mapping on Windows)
+// pages are shared with every other process mapping the same file
+//
+class MappedFile
+{
+public:
+    enum Access
+    {
+        kNormal,
+        kSequential,    // streamed once front to back
+        kRandom         // scattered probes, don't bother reading ahead
+    };
+
+    MappedFile();
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    bool            open(const std::string &path, Access access = kNormal);
+    void            close();
+
+    // hint the OS about how a byte range will be used next (no-op where unsupported)
+    void            adviseWillNeed(size_t offset, size_t length) const;
+
+    const uint8_t  *data() const { return _data; }
+    size_t          size() const { return _size; }
+    bool            isOpen() const { return _opened; }
+
+private:
+    const uint8_t  *_data;
+    size_t          _size;
+    bool            _opened;
+#ifdef _WIN32
+    void           *_file;
+    void           *_mapping;
+#else
+    int             _fd;
+#endif
+};
@@ -0,0 +1,375 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+//
+// monte carlo tree search for any turn-based game with a win/draw result
+//
+// the same search UltimateMCTS does, written once for every game whose
+// position can list its moves and play them: each playout walks down the
+// tree by UCT, gives children to the node it stops at if that's been played
+// out before, plays random moves to the end and scores the result back up
+// the path. a node's score is for the player who moved into it, so any
+// number of players works; the move played is the root child visited the
+// most.
+//
+// the tree is one node arena allocated up front, children handed out from
+// it a block per expanded node with an atomic counter, so no allocation
+// while searching. once it's full the tree stops growing.
+//
+// with more than one thread they all work on the one tree (tree
+// parallelism). a playout on its way down adds a virtual loss to every node
+// it passes, counted as a visit that lost, so the threads behind it are
+// steered to other branches instead of all piling onto the same leaf; it's
+// taken back when the result comes up. visits, scores and virtual losses
+// are updated with atomics, and a node gets its children from whichever
+// thread claims it first, the others carry on as if it were still a leaf.
+//
+// each thread picks a batch of leaves (setBatchSize(), virtual losses keep
+// them apart), plays them all out, then backs them all up, so the walks
+// down the shared tree are done together rather than between rollouts.
+//
+// the tree is kept between moves: advance() with each move played from the
+// root, the search's own and everybody else's, moves the subtree under it to
+// the front of the arena and drops the rest, so the next search starts from
+// every playout already made below it.
+//
+// Position needs:
+//   typedef Move (an integer type), static const int kMaxMoves
+//   int sideToMove() const, int winner() const (-1 for nobody),
+//   bool gameOver() const, int legalMoves(Move *moves) const,
+//   void play(Move move), and copying
+// UltimatePosition, MNKPosition and HexBoard all have them.
+//
+// and may have:
+//   int rollout(uint64_t &rng) const, a faster playout of its own, given
+//     the search's xorshift64* state and returning the winner as above
+//   static constexpr float kExploration, the UCT constant if sqrt(2) isn't
+//     the right one for the game
+// HexBoard has both.
+//
+template <typename Position>
+class MonteCarloTreeSearch
+{
+public:
+    typedef typename Position::Move Move;
+
+    explicit MonteCarloTreeSearch(size_t maxNodes = 1 << 20);
+
+    // the move to play after "playouts" more playouts, or fewer if the stop
+    // flag goes up first; -1 if the game is over. the position has to be the
+    // tree's root: the one advance() has been following, or any position
+    // after reset()
+    int         bestMove(const Position &position, uint64_t playouts, const std::atomic<bool> *stop = nullptr);
+    // a move was played from the root: keep the tree under it, or start over if there isn't one
+    void        advance(Move move);
+    // forget the tree, for a position that didn't come from advance()
+    void        reset() { _used = 0; _reused = 0; }
+
+    // threads for the search, the calling one included
+    void        setThreads(int threads) { _threads = threads < 1 ? 1 : threads; }
+    // leaves each thread picks before playing them out
+    void        setBatchSize(int leaves) { _batchSize = leaves < 1 ? 1 : leaves; }
+
+    // what the last search did
+    uint64_t    playouts() const { return _playouts; }
+    double      seconds() const { return _seconds; }
+    double      playoutsPerSecond() const { return _seconds > 0 ? _playouts / _seconds : 0.0; }
+    size_t      nodesUsed() const { return std::min<size_t>(_used, _nodes.size()); }
+    // nodes the last advance() kept
+    size_t      reusedNodes() const { return _reused; }
+    // how often the chosen move won its playouts, from the mover's side
+    double      winRate() const { return _winRate; }
+
+    static constexpr size_t nodeBytes() { return sizeof(Node); }
+    size_t      memory() const { return _nodes.size() * sizeof(Node); }
+
+private:
+    enum NodeState : uint8_t { kLeaf, kExpanding, kExpanded };
+    static const uint8_t kNobody = 0xFF;
+
+    struct Node
+    {
+        uint32_t    firstChild;     // index in the arena, once expanded
+        uint32_t    visits;
+        uint32_t    score;          // half points for the player who moved into the node: 2 a win, 1 a draw
+        uint16_t    virtualLoss;    // playouts on their way through the node and not back yet
+        uint16_t    childCount;
+        Move        move;
+        uint8_t     mover;
+        uint8_t     state;          // a NodeState
+    };
+
+    // a playout between being picked and being backed up
+    struct Leaf
+    {
+        Position                position;
+        std::vector<uint32_t>   path;
+        int                     winner;
+    };
+
+    template <typename T>
+    static std::atomic_ref<T> shared(T &field) { return std::atomic_ref<T>(field); }
+
+    void        search(const Position &root, uint64_t playouts, const std::atomic<bool> *stop, uint64_t seed);
+    // walk down from the root, virtual losses on the way, giving the leaf children if it's time
+    void        descend(Leaf &leaf);
+    void        backUp(const Leaf &leaf);
+    bool        expand(uint32_t index, const Position &position);
+    // pick a child of an expanded node by UCT, virtual losses counted as lost visits
+    uint32_t    select(Node &node);
+    // random moves to the end, returns the winner or -1 for a draw
+    static int  rollout(Position position, uint64_t &rng);
+    static uint64_t random(uint64_t &rng);
+
+    std::vector<Node>       _nodes;
+    std::atomic<size_t>     _used;
+    std::atomic<uint64_t>   _claimed;       // playouts the threads have taken on in this search
+    std::atomic<uint64_t>   _completed;
+    int                     _threads;
+    int                     _batchSize;
+    uint64_t                _seed;
+    size_t                  _reused;
+    uint64_t                _playouts;
+    double                  _seconds;
+    double                  _winRate;
+};
+
+template <typename Position>
+MonteCarloTreeSearch<Position>::MonteCarloTreeSearch(size_t maxNodes) : _nodes(std::max<size_t>(maxNodes, 2)), _used(0),
+    _claimed(0), _completed(0), _threads(1), _batchSize(8), _seed(0x9E3779B97F4A7C15ull), _reused(0), _playouts(0),
+    _seconds(0), _winRate(0)
+{
+}
+
+template <typename Position>
+uint64_t MonteCarloTreeSearch<Position>::random(uint64_t &rng)
+{
+    // xorshift64*
+    rng ^= rng >> 12;
+    rng ^= rng << 25;
+    rng ^= rng >> 27;
+    return rng * 0x2545F4914F6CDD1Dull;
+}
+
+template <typename Position>
+int MonteCarloTreeSearch<Position>::rollout(Position position, uint64_t &rng)
+{
+    if constexpr (requires(const Position &p, uint64_t &r) { { p.rollout(r) } -> std::convertible_to<int>; })
+        return position.rollout(rng);
+
+    Move moves[Position::kMaxMoves];
+    while (!position.gameOver())
+    {
+        const int count = position.legalMoves(moves);
+        position.play(moves[((random(rng) >> 32) * static_cast<uint64_t>(count)) >> 32]);
+    }
+    return position.winner();
+}
+
+template <typename Position>
+bool MonteCarloTreeSearch<Position>::expand(uint32_t index, const Position &position)
+{
+    Move moves[Position::kMaxMoves];
+    const int count = position.legalMoves(moves);
+    if (count == 0 || _used.load(std::memory_order_relaxed) + count > _nodes.size())
+        return false;
+
+    Node &node = _nodes[index];
+    uint8_t expected = kLeaf;
+    if (!shared(node.state).compare_exchange_strong(expected, kExpanding, std::memory_order_acquire))
+        return false;
+    const size_t first = _used.fetch_add(count, std::memory_order_relaxed);
+    if (first + count > _nodes.size())
+    {
+        // somebody else took the last of the arena in between
+        shared(node.state).store(kLeaf, std::memory_order_release);
+        return false;
+    }
+
+    const uint8_t mover = static_cast<uint8_t>(position.sideToMove());
+    for (int i = 0; i < count; ++i)
+        _nodes[first + i] = Node{ 0, 0, 0, 0, 0, moves[i], mover, kLeaf };
+    node.firstChild = static_cast<uint32_t>(first);
+    node.childCount = static_cast<uint16_t>(count);
+    shared(node.state).store(kExpanded, std::memory_order_release);
+    return true;
+}
+
+template <typename Position>
+uint32_t MonteCarloTreeSearch<Position>::select(Node &node)
+{
+    // UCT, with the usual exploration constant of sqrt(2) unless the position has its own
+    float exploration = 1.41421356f;
+    if constexpr (requires { Position::kExploration; })
+        exploration = Position::kExploration;
+    const uint32_t parentVisits = shared(node.visits).load(std::memory_order_relaxed) +
+                                  shared(node.virtualLoss).load(std::memory_order_relaxed);
+    const float logVisits = std::log(static_cast<float>(std::max<uint32_t>(parentVisits, 1)));
+    uint32_t best = node.firstChild;
+    float bestValue = -1.0f;
+    for (uint32_t i = node.firstChild; i < node.firstChild + node.childCount; ++i)
+    {
+        Node &child = _nodes[i];
+        const uint32_t visits = shared(child.visits).load(std::memory_order_relaxed) +
+                                shared(child.virtualLoss).load(std::memory_order_relaxed);
+        if (visits == 0)
+            return i;
+        const float score = static_cast<float>(shared(child.score).load(std::memory_order_relaxed)) * 0.5f;
+        const float value = score / visits + exploration * std::sqrt(logVisits / visits);
+        if (value > bestValue)
+        {
+            bestValue = value;
+            best = i;
+        }
+    }
+    return best;
+}
+
+template <typename Position>
+void MonteCarloTreeSearch<Position>::descend(Leaf &leaf)
+{
+    leaf.path.clear();
+    uint32_t index = 0;
+    for (;;)
+    {
+        leaf.path.push_back(index);
+        Node &node = _nodes[index];
+        shared(node.virtualLoss).fetch_add(1, std::memory_order_relaxed);
+        if (shared(node.state).load(std::memory_order_acquire) != kExpanded)
+        {
+            // a leaf that's been played out once before gets its children
+            if (shared(node.visits).load(std::memory_order_relaxed) == 0 || leaf.position.gameOver() ||
+                !expand(index, leaf.position))
+                return;
+        }
+        index = select(node);
+        leaf.position.play(_nodes[index].move);
+    }
+}
+
+template <typename Position>
+void MonteCarloTreeSearch<Position>::backUp(const Leaf &leaf)
+{
+    for (uint32_t index : leaf.path)
+    {
+        Node &node = _nodes[index];
+        const uint32_t points = leaf.winner < 0 ? 1 : leaf.winner == node.mover ? 2 : 0;
+        // the visit goes in before the virtual loss comes out, so the node never looks less visited than it is
+        shared(node.visits).fetch_add(1, std::memory_order_relaxed);
+        shared(node.score).fetch_add(points, std::memory_order_relaxed);
+        shared(node.virtualLoss).fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+template <typename Position>
+void MonteCarloTreeSearch<Position>::search(const Position &root, uint64_t playouts, const std::atomic<bool> *stop,
+                                            uint64_t seed)
+{
+    uint64_t rng = seed | 1;
+    std::vector<Leaf> batch(_batchSize, Leaf{ root, {}, -1 });
+    while (!(stop && stop->load(std::memory_order_relaxed)))
+    {
+        const uint64_t claimed = _claimed.fetch_add(_batchSize, std::memory_order_relaxed);
+        if (claimed >= playouts)
+            break;
+        const size_t count = static_cast<size_t>(std::min<uint64_t>(_batchSize, playouts - claimed));
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            batch[i].position = root;
+            descend(batch[i]);
+        }
+        for (size_t i = 0; i < count; ++i)
+            batch[i].winner = rollout(batch[i].position, rng);
+        for (size_t i = 0; i < count; ++i)
+            backUp(batch[i]);
+        _completed.fetch_add(count, std::memory_order_relaxed);
+    }
+}
+
+template <typename Position>
+int MonteCarloTreeSearch<Position>::bestMove(const Position &position, uint64_t playouts, const std::atomic<bool> *stop)
+{
+    const auto start = std::chrono::steady_clock::now();
+    _playouts = 0;
+    _winRate = 0;
+    _seconds = 0;
+    if (position.gameOver())
+        return -1;
+
+    // a new tree is just the root
+    if (_used == 0)
+    {
+        _nodes[0] = Node{ 0, 0, 0, 0, 0, Move(), kNobody, kLeaf };
+        _used = 1;
+    }
+    if (_nodes[0].state != kExpanded && !expand(0, position))
+        return -1;
+
+    _claimed = 0;
+    _completed = 0;
+    std::vector<std::thread> threads;
+    for (int i = 1; i < _threads; ++i)
+        threads.emplace_back([this, &position, playouts, stop, i]() { search(position, playouts, stop, _seed + i * 0x9E3779B97F4A7C15ull); });
+    search(position, playouts, stop, _seed);
+    for (std::thread &thread : threads)
+        thread.join();
+    _seed = random(_seed);
+
+    const Node &root = _nodes[0];
+    uint32_t best = root.firstChild;
+    for (uint32_t i = root.firstChild; i < root.firstChild + root.childCount; ++i)
+    {
+        if (_nodes[i].visits > _nodes[best].visits)
+            best = i;
+    }
+    _playouts = _completed;
+    _seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    _winRate = _nodes[best].visits ? _nodes[best].score * 0.5 / _nodes[best].visits : 0.0;
+    return static_cast<int>(_nodes[best].move);
+}
+
+template <typename Position>
+void MonteCarloTreeSearch<Position>::advance(Move move)
+{
+    _reused = 0;
+    if (_used == 0 || _nodes[0].state != kExpanded)
+    {
+        reset();
+        return;
+    }
+    const Node &root = _nodes[0];
+    uint32_t child = 0;
+    for (uint32_t i = root.firstChild; i < root.firstChild + root.childCount && !child; ++i)
+    {
+        if (_nodes[i].move == move)
+            child = i;
+    }
+    if (!child)
+    {
+        reset();
+        return;
+    }
+
+    // copy the subtree out breadth first, each node's children still in one block, then back to the front
+    std::vector<Node> kept;
+    kept.push_back(_nodes[child]);
+    for (size_t i = 0; i < kept.size(); ++i)
+    {
+        if (kept[i].state != kExpanded)
+            continue;
+        const uint32_t first = kept[i].firstChild;
+        kept[i].firstChild = static_cast<uint32_t>(kept.size());
+        kept.insert(kept.end(), _nodes.begin() + first, _nodes.begin() + first + kept[i].childCount);
+    }
+    std::copy(kept.begin(), kept.end(), _nodes.begin());
+    _used = kept.size();
+    _reused = kept.size();
+}
@@ -0,0 +1,244 @@
+#include "OpeningBook.h"
+#include "BinaryIO.h"
+#include "Crc32.h"
+#include "FileIO.h"
+
+#include <algorithm>
+
+static const size_t kHeaderSize = 28;
+static const int kKeysPerBucket = 4;
+static const int kSeedAttempts = 16;
+
+static uint64_t mix(uint64_t x)
+{
+    // splitmix64's finalizer
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ull;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+static uint32_t fingerprint(uint64_t key)
+{
+    return static_cast<uint32_t>(mix(key ^ 0x2545F4914F6CDD1Dull) >> 32);
+}
+
+size_t OpeningBook::bucketOf(uint64_t key) const
+{
+    return static_cast<size_t>(mix(key ^ _seed) % _pilots.size());
+}
+
+size_t OpeningBook::slotOf(uint64_t key, uint16_t pilot) const
+{
+    return static_cast<size_t>(mix(key ^ _seed ^ (uint64_t(pilot) * 0x9E3779B97F4A7C15ull + 1)) % _moves.size());
+}
+
+bool OpeningBook::build(const std::vector<Entry> &entries, int boardSize)
+{
+    _boardSize = boardSize;
+    _moves.assign(entries.size(), 0);
+    _fingerprints.assign(entries.size(), 0);
+    _pilots.assign(std::max<size_t>(1, entries.size() / kKeysPerBucket), 0);
+    if (entries.empty())
+        return true;
+
+    for (int attempt = 0; attempt < kSeedAttempts; ++attempt)
+    {
+        _seed = mix(0x6A09E667F3BCC909ull + attempt);
+        std::vector<std::vector<size_t>> buckets(_pilots.size());
+        for (size_t i = 0; i < entries.size(); ++i)
+            buckets[bucketOf(entries[i].key)].push_back(i);
+        std::vector<size_t> order(buckets.size());
+        for (size_t b = 0; b < order.size(); ++b)
+            order[b] = b;
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return buckets[a].size() > buckets[b].size(); });
+
+        // the big buckets go first, while most slots are still free
+        std::vector<bool> taken(entries.size(), false);
+        std::vector<size_t> slots;
+        bool placed = true;
+        for (size_t b : order)
+        {
+            if (buckets[b].empty())
+                break;
+            bool found = false;
+            for (uint32_t pilot = 0; pilot <= 0xFFFF && !found; ++pilot)
+            {
+                slots.clear();
+                found = true;
+                for (size_t i : buckets[b])
+                {
+                    const size_t slot = slotOf(entries[i].key, static_cast<uint16_t>(pilot));
+                    if (taken[slot] || std::find(slots.begin(), slots.end(), slot) != slots.end())
+                    {
+                        found = false;
+                        break;
+                    }
+                    slots.push_back(slot);
+                }
+                if (found)
+                    _pilots[b] = static_cast<uint16_t>(pilot);
+            }
+            if (!found)
+            {
+                placed = false;
+                break;
+            }
+            for (size_t j = 0; j < slots.size(); ++j)
+            {
+                const Entry &entry = entries[buckets[b][j]];
+                taken[slots[j]] = true;
+                _fingerprints[slots[j]] = fingerprint(entry.key);
+                _moves[slots[j]] = entry.move;
+            }
+        }
+        if (placed)
+            return true;
+    }
+    _moves.clear();
+    _fingerprints.clear();
+    _pilots.clear();
+    return false;
+}
+
+bool OpeningBook::save(const std::string &path) const
+{
+    std::vector<uint8_t> body;
+    ByteWriter b(body);
+    for (uint16_t pilot : _pilots)
+        b.u16(pilot);
+    for (size_t i = 0; i < _moves.size(); ++i)
+    {
+        b.u32(_fingerprints[i]);
+        b.u16(_moves[i]);
+    }
+
+    std::vector<uint8_t> out;
+    out.reserve(kHeaderSize + body.size());
+    ByteWriter w(out);
+    w.u32(kMagic);
+    w.u16(kVersion);
+    w.u16(static_cast<uint16_t>(_boardSize));
+    w.u32(static_cast<uint32_t>(_moves.size()));
+    w.u32(static_cast<uint32_t>(_pilots.size()));
+    w.u64(_seed);
+    w.u32(Crc32::compute(body.data(), body.size()));
+    w.bytes(body.data(), body.size());
+    return FileIO::writeAtomic(path, out);
+}
+
+bool OpeningBook::load(const std::string &path, std::string &error)
+{
+    std::vector<uint8_t> bytes;
+    if (!FileIO::readAll(path, bytes))
+    {
+        error = "can't read " + path;
+        return false;
+    }
+    ByteReader r(bytes.data(), bytes.size());
+    const uint32_t magic = r.u32();
+    const uint16_t version = r.u16();
+    const uint16_t boardSize = r.u16();
+    const uint32_t positions = r.u32();
+    const uint32_t buckets = r.u32();
+    const uint64_t seed = r.u64();
+    const uint32_t crc = r.u32();
+    if (!r.ok() || magic != kMagic)
+    {
+        error = "not an opening book";
+        return false;
+    }
+    if (version != kVersion)
+    {
+        error = "unsupported book version";
+        return false;
+    }
+    if (positions == 0 || buckets == 0 || bytes.size() != kHeaderSize + size_t(buckets) * 2 + size_t(positions) * 6 ||
+        Crc32::compute(bytes.data() + kHeaderSize, bytes.size() - kHeaderSize) != crc)
+    {
+        error = "book is damaged";
+        return false;
+    }
+
+    _boardSize = boardSize;
+    _seed = seed;
+    _pilots.resize(buckets);
+    _fingerprints.resize(positions);
+    _moves.resize(positions);
+    for (uint16_t &pilot : _pilots)
+        pilot = r.u16();
+    for (size_t i = 0; i < positions; ++i)
+    {
+        _fingerprints[i] = r.u32();
+        _moves[i] = r.u16();
+    }
+    return true;
+}
+
+int OpeningBook::find(uint64_t key) const
+{
+    if (_moves.empty())
+        return -1;
+    const size_t slot = slotOf(key, _pilots[bucketOf(key)]);
+    return _fingerprints[slot] == fingerprint(key) ? _moves[slot] : -1;
+}
+
+int OpeningBook::probe(const int8_t *cells) const
+{
+    if (_moves.empty())
+        return -1;
+    int symmetry;
+    const int move = find(canonicalKey(cells, _boardSize, symmetry));
+    return move < 0 || move >= _boardSize * _boardSize ? -1 : untransformCell(move, _boardSize, symmetry);
+}
+
+//
+// symmetries of the square: bit 0 mirrors the columns, bit 1 the rows, and
+// bit 2 then swaps rows and columns
+//
+int OpeningBook::transformCell(int cell, int size, int symmetry)
+{
+    int col = cell % size;
+    int row = cell / size;
+    if (symmetry & 1)
+        col = size - 1 - col;
+    if (symmetry & 2)
+        row = size - 1 - row;
+    if (symmetry & 4)
+        std::swap(col, row);
+    return row * size + col;
+}
+
+int OpeningBook::untransformCell(int cell, int size, int symmetry)
+{
+    int col = cell % size;
+    int row = cell / size;
+    if (symmetry & 4)
+        std::swap(col, row);
+    if (symmetry & 2)
+        row = size - 1 - row;
+    if (symmetry & 1)
+        col = size - 1 - col;
+    return row * size + col;
+}
+
+uint64_t OpeningBook::canonicalKey(const int8_t *cells, int size, int &symmetry)
+{
+    // a zobrist style key, each stone hashed from its cell and owner
+    uint64_t keys[kSymmetries] = {};
+    for (int cell = 0; cell < size * size; ++cell)
+    {
+        if (cells[cell] < 0)
+            continue;
+        for (int s = 0; s < kSymmetries; ++s)
+            keys[s] ^= mix(uint64_t(transformCell(cell, size, s)) * 2 + cells[cell] + 1);
+    }
+    symmetry = 0;
+    for (int s = 1; s < kSymmetries; ++s)
+    {
+        if (keys[s] < keys[symmetry])
+            symmetry = s;
+    }
+    return keys[symmetry];
+}
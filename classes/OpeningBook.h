@@ -0,0 +1,77 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//
+// opening book: positions worked out offline by a deep search, and the move to play in each
+//
+// a book is built once by a tool and only ever looked up by the game, so it
+// doesn't have to support adding positions, only finding them quickly in as
+// little space as possible. the keys go into a minimal perfect hash: every
+// key lands in its own slot of an array exactly as long as the book, so no
+// key is stored at all. what's kept per position is a 32-bit fingerprint of
+// its key, to turn away positions that aren't in the book, and the move.
+//
+// the hash is hash-and-displace: the keys are split into buckets of about
+// four, and each bucket, biggest first, gets the first 16-bit pilot value
+// that sends all of its keys to slots nobody has yet. a lookup is two hashes
+// and one pilot read. the whole thing is a little over six bytes a position.
+//
+// positions on a square board are stored once for all eight rotations and
+// reflections: canonicalKey() picks the frame whose key is smallest and the
+// move is stored in that frame, probe() turns it back into the board's own.
+//
+// file layout (little-endian):
+//   u32 magic 'BOOK'  u16 version  u16 board size  u32 positions
+//   u32 buckets  u64 seed  u32 crc32 of everything after the header
+//   then u16 pilot per bucket, u32 fingerprint and u16 move per position
+//
+class OpeningBook
+{
+public:
+    static const uint32_t kMagic = 0x4B4F4F42;      // "BOOK"
+    static const uint16_t kVersion = 1;
+    static const int kSymmetries = 8;
+
+    struct Entry
+    {
+        uint64_t    key;        // a canonicalKey()
+        uint16_t    move;       // in the key's frame
+    };
+
+    // make the hash for these positions, which all have to be different; false if no seed worked
+    bool        build(const std::vector<Entry> &entries, int boardSize);
+    bool        save(const std::string &path) const;
+    // false with a reason if the file isn't a complete, undamaged book
+    bool        load(const std::string &path, std::string &error);
+
+    bool        isLoaded() const { return !_moves.empty(); }
+    size_t      size() const { return _moves.size(); }
+    // bytes of pilots, fingerprints and moves
+    size_t      bytes() const { return _pilots.size() * 2 + _moves.size() * 6; }
+    int         boardSize() const { return _boardSize; }
+
+    // the move stored under a canonical key, in its frame, -1 if it's not in the book
+    int         find(uint64_t key) const;
+    // the book move for a board of boardSize() squared cells (-1 empty,
+    // otherwise the player), in the board's own frame; -1 if it's not in the book
+    int         probe(const int8_t *cells) const;
+
+    // the same key for all eight symmetries of a size x size board; "symmetry"
+    // is the one that takes this board to the frame the key stands for
+    static uint64_t canonicalKey(const int8_t *cells, int size, int &symmetry);
+    // a cell moved by one of the symmetries, and moved back
+    static int  transformCell(int cell, int size, int symmetry);
+    static int  untransformCell(int cell, int size, int symmetry);
+
+private:
+    size_t      bucketOf(uint64_t key) const;
+    size_t      slotOf(uint64_t key, uint16_t pilot) const;
+
+    int                     _boardSize = 0;
+    uint64_t                _seed = 0;
+    std::vector<uint16_t>   _pilots;
+    std::vector<uint32_t>   _fingerprints;
+    std::vector<uint16_t>   _moves;
+};
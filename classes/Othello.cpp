@@ -0,0 +1,216 @@
+#include "Othello.h"
+
+// how long the AI thinks about each move
+static const std::chrono::milliseconds kThinkTime(1000);
+
+Othello::Othello()
+{
+}
+
+Othello::~Othello()
+{
+    _ai.cancel();
+}
+
+Bit* Othello::PieceForPlayer(int playerNumber)
+{
+    Bit *bit = new Bit();
+    bit->LoadTextureFromFile(playerNumber == 0 ? "red.png" : "yellow.png");
+    bit->setOwner(getPlayerAt(playerNumber));
+    bit->setGameTag(playerNumber);
+    return bit;
+}
+
+//
+// setup the game board, this is called once at the start of the game
+//
+void Othello::setUpBoard()
+{
+    setNumberOfPlayers(2);
+    setAIPlayer(1);
+
+    _gameOptions.rowX = 8;
+    _gameOptions.rowY = 8;
+
+    // the sprites are 100x100
+    const float cellSize = 100.0f;
+    for (int row = 0; row < 8; ++row)
+    {
+        for (int col = 0; col < 8; ++col)
+        {
+            ImVec2 pos(col * cellSize, row * cellSize);
+            _grid[row][col].initHolder(pos, "square.png", col, row);
+            _grid[row][col].setGameTag(row * 8 + col);
+        }
+    }
+
+    _position = OthelloPosition();
+    syncBoard();
+
+    // the tables are big, only allocate them once
+    if (!_search)
+        _search = std::make_unique<OthelloSearch>();
+    else
+        _search->clear();
+
+    startGame();
+}
+
+void Othello::syncBoard()
+{
+    const uint64_t legal = _position.legalMoves();
+    for (int sq = 0; sq < 64; ++sq)
+    {
+        Square &square = _grid[sq / 8][sq % 8];
+        const uint64_t bit = OthelloBitboard::squareBit(sq);
+        const int player = (_position.discs(0) & bit) ? 0 : (_position.discs(1) & bit) ? 1 : -1;
+        if (legal & bit)
+            square.setColor(0.55f, 0.85f, 0.6f, 1.0f);
+        else
+            square.setColor(0.3f, 0.65f, 0.35f, 1.0f);
+
+        Bit *b = square.bit();
+        if (b && b->gameTag() == player)
+            continue;
+        if (b)
+            square.destroyBit();
+        if (player < 0)
+            continue;
+        Bit *placeBit = PieceForPlayer(player);
+        placeBit->setPosition(square.getPosition());
+        square.setBit(placeBit);
+    }
+}
+
+bool Othello::actionForEmptyHolder(BitHolder *holder)
+{
+    if (!holder || getCurrentPlayer()->playerNumber() != _position.sideToMove() || !_position.isLegal(holder->gameTag()))
+        return false;
+    playMove(holder->gameTag());
+    return true;
+}
+
+void Othello::playMove(int sq)
+{
+    _position.play(sq);
+    _lastMoveCode = sq;
+    if (_position.mustPass())
+    {
+        // the other side's turn comes and goes, and the archive keeps the pass
+        // so the moves after it stay with the right player
+        _position.pass();
+        endTurn();
+        _lastMoveCode = kPassMoveCode;
+    }
+    syncBoard();
+}
+
+bool Othello::canBitMoveFrom(Bit *bit, BitHolder *src)
+{
+    // discs stay where they're put
+    return false;
+}
+
+bool Othello::canBitMoveFromTo(Bit* bit, BitHolder*src, BitHolder*dst)
+{
+    return false;
+}
+
+//
+// free all the memory used by the game on the heap
+//
+void Othello::stopGame()
+{
+    _ai.cancel();
+    for (int row = 0; row < 8; ++row)
+    {
+        for (int col = 0; col < 8; ++col)
+        {
+            _grid[row][col].destroyBit();
+        }
+    }
+}
+
+Player* Othello::checkForWinner()
+{
+    const int winner = _position.winner();
+    return winner < 0 ? nullptr : getPlayerAt(winner);
+}
+
+bool Othello::checkForDraw()
+{
+    return _position.gameOver() && _position.winner() < 0;
+}
+
+//
+// state strings
+//
+std::string Othello::initialStateString()
+{
+    return "00000000000000000000000000021000000120000000000000000000000000001";
+}
+
+std::string Othello::stateString() const
+{
+    std::string state;
+    state.reserve(65);
+    for (int sq = 0; sq < 64; ++sq)
+    {
+        const uint64_t bit = OthelloBitboard::squareBit(sq);
+        state.push_back((_position.discs(0) & bit) ? '1' : (_position.discs(1) & bit) ? '2' : '0');
+    }
+    state.push_back(_position.sideToMove() == 0 ? '1' : '2');
+    return state;
+}
+
+void Othello::setStateString(const std::string &s)
+{
+    if (s.size() != 65)
+        return;
+
+    uint64_t discs[2] = { 0, 0 };
+    for (int sq = 0; sq < 64; ++sq)
+    {
+        if (s[sq] == '1')
+            discs[0] |= OthelloBitboard::squareBit(sq);
+        else if (s[sq] == '2')
+            discs[1] |= OthelloBitboard::squareBit(sq);
+    }
+
+    stopGame();
+    _position = OthelloPosition(discs[0], discs[1], s[64] == '2' ? 1 : 0);
+    if (_position.mustPass())
+        _position.pass();
+    syncBoard();
+
+    // the current player has to be the side to move
+    if ((_gameOptions.currentTurnNo & 1) != static_cast<unsigned int>(_position.sideToMove()))
+        _gameOptions.currentTurnNo++;
+}
+
+//
+// called every frame while it's the AI's turn: the first call starts the
+// search on the worker thread, later calls play the move once it's ready
+//
+void Othello::updateAI()
+{
+    if (checkForWinner() || checkForDraw())
+        return;
+
+    if (!_ai.busy())
+    {
+        const OthelloPosition position = _position;
+        OthelloSearch *search = _search.get();
+        _ai.start([search, position](const std::atomic<bool> &stop) {
+            return search->search(position, kThinkTime, &stop).move;
+        }, kThinkTime);
+        return;
+    }
+
+    int move;
+    if (_ai.poll(move) && _position.isLegal(move))
+    {
+        playMove(move);
+        endTurn();
+    }
+}
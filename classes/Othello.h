@@ -0,0 +1,62 @@
+#pragma once
+#include "Game.h"
+#include "Square.h"
+#include "AIWorker.h"
+#include "OthelloPosition.h"
+#include "OthelloSearch.h"
+
+#include <memory>
+
+//
+// othello (reversi), red plays black and moves first, yellow plays white
+//
+// discs are placed by clicking an empty square, the squares where the side
+// to move may play are drawn lighter. flipped discs are brought in line
+// with OthelloPosition after each move. a player with no move passes
+// without being asked: the turn goes straight back to the other side.
+//
+// the state string is 65 characters: the 64 squares left-to-right,
+// top-to-bottom ('0' empty, '1' black, '2' white), then whose move it is
+// ('1' or '2').
+//
+// the AI plays white with OthelloSearch on an AIWorker thread, solving the
+// endgame exactly once there are few enough empty squares.
+//
+class Othello : public Game
+{
+public:
+    Othello();
+    ~Othello();
+
+    // set up the board
+    void        setUpBoard() override;
+
+    Player*     checkForWinner() override;
+    bool        checkForDraw() override;
+    std::string initialStateString() override;
+    std::string stateString() const override;
+    void        setStateString(const std::string &s) override;
+    bool        actionForEmptyHolder(BitHolder *holder) override;
+    bool        canBitMoveFrom(Bit*bit, BitHolder *src) override;
+    bool        canBitMoveFromTo(Bit* bit, BitHolder*src, BitHolder*dst) override;
+    void        stopGame() override;
+
+    void        updateAI() override;
+    bool        gameHasAI() override { return true; }
+    BitHolder &getHolderAt(const int x, const int y) override { return _grid[y][x]; }
+
+private:
+    // the bit's game tag is the player
+    Bit *       PieceForPlayer(int playerNumber);
+    // make the sprites and the legal move marks match _position
+    void        syncBoard();
+    // play a legal move, passing for the other side if it has nothing to play;
+    // the caller ends the turn
+    void        playMove(int sq);
+
+    // row 0 at the top, the holder's game tag is its square
+    Square                          _grid[8][8];
+    OthelloPosition                 _position;
+    AIWorker                        _ai;
+    std::unique_ptr<OthelloSearch>  _search;
+};
@@ -0,0 +1,145 @@
+#pragma once
+#include <bit>
+#include <cstdint>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+//
+// bitboard kernels for othello
+//
+// squares are numbered row * 8 + column with row 0 at the top, so bit n of
+// a bitboard is square n. both kernels look along the 8 directions with the
+// usual shift-and-mask fill: a shift moves every disc one square, masking
+// with the opponent's discs keeps only runs of them, and six rounds cover
+// the longest run that fits on the board. the a and h files are masked out
+// of the opponent for everything but the vertical direction so a run can't
+// wrap from one row to the next.
+//
+// shifting left by 1, 8, 9 and 7 is east, south, south-east and south-west,
+// shifting right by the same is the four opposite directions. with AVX2
+// (where the compiler targets it) the four shift amounts sit in the lanes of
+// one 256-bit register and the variable shift instructions do four
+// directions at once, so all eight are two registers worth of work; the
+// portable versions run the same fill one direction at a time.
+//
+namespace OthelloBitboard
+{
+    const uint64_t kNotEdgeFiles = 0x7E7E7E7E7E7E7E7Eull;
+    const uint64_t kCorners = 0x8100000000000081ull;
+
+    inline uint64_t squareBit(int sq) { return uint64_t(1) << sq; }
+
+    // empty squares where the player's disc would flip something
+    inline uint64_t movesPortable(uint64_t player, uint64_t opponent)
+    {
+        static const int kShifts[4] = { 1, 8, 9, 7 };
+        uint64_t moves = 0;
+        for (int s : kShifts)
+        {
+            const uint64_t runs = s == 8 ? opponent : opponent & kNotEdgeFiles;
+            uint64_t left = runs & (player << s);
+            uint64_t right = runs & (player >> s);
+            for (int i = 0; i < 5; ++i)
+            {
+                left |= runs & (left << s);
+                right |= runs & (right >> s);
+            }
+            moves |= (left << s) | (right >> s);
+        }
+        return moves & ~(player | opponent);
+    }
+
+    // the opponent discs a disc on "sq" would flip, 0 if it isn't a legal move
+    inline uint64_t flipsPortable(uint64_t player, uint64_t opponent, int sq)
+    {
+        static const int kShifts[4] = { 1, 8, 9, 7 };
+        const uint64_t move = squareBit(sq);
+        uint64_t flips = 0;
+        for (int s : kShifts)
+        {
+            const uint64_t runs = s == 8 ? opponent : opponent & kNotEdgeFiles;
+            uint64_t left = runs & (move << s);
+            uint64_t right = runs & (move >> s);
+            for (int i = 0; i < 5; ++i)
+            {
+                left |= runs & (left << s);
+                right |= runs & (right >> s);
+            }
+            // a run only flips if it ends on one of the player's discs
+            if ((left << s) & player)
+                flips |= left;
+            if ((right >> s) & player)
+                flips |= right;
+        }
+        return flips;
+    }
+
+#if defined(__AVX2__)
+    inline uint64_t orLanes(__m256i v)
+    {
+        const __m128i half = _mm_or_si128(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+        return static_cast<uint64_t>(_mm_cvtsi128_si64(half) | _mm_extract_epi64(half, 1));
+    }
+
+    inline uint64_t movesAvx2(uint64_t player, uint64_t opponent)
+    {
+        const __m256i shifts = _mm256_set_epi64x(7, 9, 8, 1);
+        const __m256i edges = _mm256_set_epi64x(kNotEdgeFiles, kNotEdgeFiles, -1, kNotEdgeFiles);
+        const __m256i p = _mm256_set1_epi64x(static_cast<long long>(player));
+        const __m256i runs = _mm256_and_si256(_mm256_set1_epi64x(static_cast<long long>(opponent)), edges);
+
+        __m256i left = _mm256_and_si256(runs, _mm256_sllv_epi64(p, shifts));
+        __m256i right = _mm256_and_si256(runs, _mm256_srlv_epi64(p, shifts));
+        for (int i = 0; i < 5; ++i)
+        {
+            left = _mm256_or_si256(left, _mm256_and_si256(runs, _mm256_sllv_epi64(left, shifts)));
+            right = _mm256_or_si256(right, _mm256_and_si256(runs, _mm256_srlv_epi64(right, shifts)));
+        }
+        const __m256i moves = _mm256_or_si256(_mm256_sllv_epi64(left, shifts), _mm256_srlv_epi64(right, shifts));
+        return orLanes(moves) & ~(player | opponent);
+    }
+
+    inline uint64_t flipsAvx2(uint64_t player, uint64_t opponent, int sq)
+    {
+        const __m256i shifts = _mm256_set_epi64x(7, 9, 8, 1);
+        const __m256i edges = _mm256_set_epi64x(kNotEdgeFiles, kNotEdgeFiles, -1, kNotEdgeFiles);
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i p = _mm256_set1_epi64x(static_cast<long long>(player));
+        const __m256i move = _mm256_set1_epi64x(static_cast<long long>(squareBit(sq)));
+        const __m256i runs = _mm256_and_si256(_mm256_set1_epi64x(static_cast<long long>(opponent)), edges);
+
+        __m256i left = _mm256_and_si256(runs, _mm256_sllv_epi64(move, shifts));
+        __m256i right = _mm256_and_si256(runs, _mm256_srlv_epi64(move, shifts));
+        for (int i = 0; i < 5; ++i)
+        {
+            left = _mm256_or_si256(left, _mm256_and_si256(runs, _mm256_sllv_epi64(left, shifts)));
+            right = _mm256_or_si256(right, _mm256_and_si256(runs, _mm256_srlv_epi64(right, shifts)));
+        }
+        // keep the lanes whose run ends on one of the player's discs
+        const __m256i leftEnds = _mm256_and_si256(_mm256_sllv_epi64(left, shifts), p);
+        const __m256i rightEnds = _mm256_and_si256(_mm256_srlv_epi64(right, shifts), p);
+        left = _mm256_andnot_si256(_mm256_cmpeq_epi64(leftEnds, zero), left);
+        right = _mm256_andnot_si256(_mm256_cmpeq_epi64(rightEnds, zero), right);
+        return orLanes(_mm256_or_si256(left, right));
+    }
+#endif
+
+    inline uint64_t moves(uint64_t player, uint64_t opponent)
+    {
+#if defined(__AVX2__)
+        return movesAvx2(player, opponent);
+#else
+        return movesPortable(player, opponent);
+#endif
+    }
+
+    inline uint64_t flips(uint64_t player, uint64_t opponent, int sq)
+    {
+#if defined(__AVX2__)
+        return flipsAvx2(player, opponent, sq);
+#else
+        return flipsPortable(player, opponent, sq);
+#endif
+    }
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include "OthelloBitboard.h"
+
+#include <string>
+
+//
+// headless othello position, one bitboard of discs per player
+//
+// player 0 is black and moves first. a player with no legal move passes, the
+// game is over when neither side can move and the player with more discs
+// wins.
+//
+class OthelloPosition
+{
+public:
+    // the starting position, white on d4 and e5, black on d5 and e4
+    OthelloPosition() : _discs{ OthelloBitboard::squareBit(28) | OthelloBitboard::squareBit(35),
+                                OthelloBitboard::squareBit(27) | OthelloBitboard::squareBit(36) }, _side(0) {}
+    OthelloPosition(uint64_t black, uint64_t white, int sideToMove) : _discs{ black, white & ~black }, _side(sideToMove & 1) {}
+
+    int         sideToMove() const { return _side; }
+    uint64_t    discs(int player) const { return _discs[player]; }
+    uint64_t    mover() const { return _discs[_side]; }
+    uint64_t    opponent() const { return _discs[_side ^ 1]; }
+    uint64_t    empties() const { return ~(_discs[0] | _discs[1]); }
+    int         emptyCount() const { return std::popcount(empties()); }
+
+    uint64_t    legalMoves() const { return OthelloBitboard::moves(mover(), opponent()); }
+    bool        isLegal(int sq) const { return sq >= 0 && sq < 64 && (legalMoves() & OthelloBitboard::squareBit(sq)); }
+    // the side to move has nothing to play but the game goes on
+    bool        mustPass() const { return !legalMoves() && OthelloBitboard::moves(opponent(), mover()); }
+    bool        gameOver() const { return !legalMoves() && !OthelloBitboard::moves(opponent(), mover()); }
+    // the player with more discs once the game is over, -1 for a draw or a game still going
+    int         winner() const
+    {
+        if (!gameOver() || std::popcount(_discs[0]) == std::popcount(_discs[1]))
+            return -1;
+        return std::popcount(_discs[0]) > std::popcount(_discs[1]) ? 0 : 1;
+    }
+
+    // false, and nothing changes, if the move isn't legal
+    bool        play(int sq)
+    {
+        const uint64_t flips = OthelloBitboard::flips(mover(), opponent(), sq);
+        if (!flips || !(empties() & OthelloBitboard::squareBit(sq)))
+            return false;
+        _discs[_side] |= flips | OthelloBitboard::squareBit(sq);
+        _discs[_side ^ 1] &= ~flips;
+        _side ^= 1;
+        return true;
+    }
+    void        pass() { _side ^= 1; }
+
+    // squares by name, "a1" is the top left and "h8" the bottom right
+    static std::string squareName(int sq) { return sq < 0 ? "pass" : std::string(1, static_cast<char>('a' + sq % 8)) + static_cast<char>('1' + sq / 8); }
+
+private:
+    uint64_t    _discs[2];
+    int         _side;
+};
@@ -0,0 +1,391 @@
+#include "OthelloSearch.h"
+
+#include <algorithm>
+
+using namespace OthelloBitboard;
+
+// the squares diagonally next to each corner, dangerous while the corner is empty
+static const uint64_t kXSquares = 0x0042000000004200ull;
+// below this many empties the solver runs without its table and move ordering
+static const int kShallowEmpties = 6;
+
+static uint64_t positionKey(uint64_t player, uint64_t opponent)
+{
+    uint64_t h = player * 0x9E3779B97F4A7C15ull ^ (opponent + 0x632BE59BD9B4E019ull) * 0xC2B2AE3D27D4EB4Full;
+    return h ^ (h >> 29);
+}
+
+// every empty square next to any of the discs
+static uint64_t neighbours(uint64_t discs)
+{
+    const uint64_t west = (discs >> 1) & 0x7F7F7F7F7F7F7F7Full;
+    const uint64_t east = (discs << 1) & 0xFEFEFEFEFEFEFEFEull;
+    const uint64_t row = discs | west | east;
+    return (row | (row << 8) | (row >> 8)) & ~discs;
+}
+
+// final score: the disc difference with the empty squares going to the winner
+static int finalScore(uint64_t player, uint64_t opponent, int empties)
+{
+    const int diff = std::popcount(player) - std::popcount(opponent);
+    return diff > 0 ? diff + empties : diff < 0 ? diff - empties : 0;
+}
+
+OthelloSearch::OthelloSearch(size_t tableEntries) : _nodes(0), _stop(nullptr), _aborted(false), _hasDeadline(false),
+    _rootBest(-1)
+{
+    // a power of two so the key's low bits pick the slot
+    size_t size = 1;
+    while (size * 2 <= tableEntries)
+        size *= 2;
+    _midTable.resize(size);
+    _endTable.resize(size);
+    _mask = size - 1;
+    clear();
+}
+
+void OthelloSearch::clear()
+{
+    std::fill(_midTable.begin(), _midTable.end(), Entry{ 0, 0, 0, 0, -1 });
+    std::fill(_endTable.begin(), _endTable.end(), Entry{ 0, 0, 0, 0, -1 });
+}
+
+//
+// mobility counts most: the side with fewer moves is the one that gets
+// squeezed into giving up corners. corners are kept, the squares next to an
+// empty corner hand it over, and discs next to empty squares (the frontier)
+// give the opponent moves.
+//
+int OthelloSearch::evaluate(uint64_t player, uint64_t opponent)
+{
+    const uint64_t empty = ~(player | opponent);
+    int score = 10 * (std::popcount(moves(player, opponent)) - std::popcount(moves(opponent, player)));
+    score += 40 * (std::popcount(player & kCorners) - std::popcount(opponent & kCorners));
+
+    // x-squares whose corner is still empty
+    uint64_t openCorners = empty & kCorners;
+    const uint64_t openX = ((openCorners & 0x0000000000000001ull) ? 0x0000000000000200ull : 0) |
+                           ((openCorners & 0x0000000000000080ull) ? 0x0000000000004000ull : 0) |
+                           ((openCorners & 0x0100000000000000ull) ? 0x0002000000000000ull : 0) |
+                           ((openCorners & 0x8000000000000000ull) ? 0x0040000000000000ull : 0);
+    score -= 20 * (std::popcount(player & openX & kXSquares) - std::popcount(opponent & openX & kXSquares));
+
+    const uint64_t frontier = neighbours(empty);
+    score -= 3 * (std::popcount(player & frontier) - std::popcount(opponent & frontier));
+    return score;
+}
+
+void OthelloSearch::startClock(const std::atomic<bool> *stop, std::chrono::milliseconds budget)
+{
+    _nodes = 0;
+    _stop = stop;
+    _aborted = false;
+    _hasDeadline = budget.count() > 0;
+    _deadline = std::chrono::steady_clock::now() + budget;
+}
+
+void OthelloSearch::checkTime()
+{
+    if ((_stop && _stop->load(std::memory_order_relaxed)) ||
+        (_hasDeadline && std::chrono::steady_clock::now() >= _deadline))
+        _aborted = true;
+}
+
+int OthelloSearch::orderMoves(uint64_t player, uint64_t opponent, uint64_t moves, int ttMove, int *order) const
+{
+    int scores[64];
+    int count = 0;
+    for (uint64_t m = moves; m; m &= m - 1)
+    {
+        const int sq = std::countr_zero(m);
+        const uint64_t flipped = flips(player, opponent, sq);
+        const uint64_t nextPlayer = player | flipped | squareBit(sq);
+        const uint64_t nextOpponent = opponent & ~flipped;
+        // fewest replies first, corners ahead of that and the table move ahead of everything
+        int score = -16 * std::popcount(OthelloBitboard::moves(nextOpponent, nextPlayer));
+        if (squareBit(sq) & kCorners)
+            score += 64;
+        if (sq == ttMove)
+            score = 1 << 20;
+        int i = count++;
+        while (i > 0 && scores[i - 1] < score)
+        {
+            scores[i] = scores[i - 1];
+            order[i] = order[i - 1];
+            --i;
+        }
+        scores[i] = score;
+        order[i] = sq;
+    }
+    return count;
+}
+
+int OthelloSearch::midgame(uint64_t player, uint64_t opponent, int depth, int alpha, int beta, int ply, bool passed)
+{
+    if ((++_nodes & 4095) == 0)
+        checkTime();
+    if (_aborted)
+        return 0;
+
+    const uint64_t legal = moves(player, opponent);
+    if (!legal)
+    {
+        // two passes in a row end the game, a win or loss scored well beyond any evaluation
+        if (passed)
+        {
+            const int final = finalScore(player, opponent, std::popcount(~(player | opponent)));
+            return final == 0 ? 0 : (final > 0 ? kWonGame : -kWonGame) + final * 100;
+        }
+        return -midgame(opponent, player, depth, -beta, -alpha, ply, true);
+    }
+    if (depth <= 0)
+        return evaluate(player, opponent);
+
+    const uint64_t key = positionKey(player, opponent);
+    Entry &entry = _midTable[key & _mask];
+    int ttMove = -1;
+    if (entry.key == key)
+    {
+        ttMove = entry.move;
+        if (ply > 0 && entry.depth >= depth &&
+            (entry.bound == kExact || (entry.bound == kLower && entry.score >= beta) || (entry.bound == kUpper && entry.score <= alpha)))
+            return entry.score;
+    }
+
+    int order[64];
+    const int count = orderMoves(player, opponent, legal, ttMove, order);
+    const int originalAlpha = alpha;
+    int bestScore = -kInfinite;
+    int bestMove = order[0];
+    for (int i = 0; i < count; ++i)
+    {
+        const int sq = order[i];
+        const uint64_t flipped = flips(player, opponent, sq);
+        const int score = -midgame(opponent & ~flipped, player | flipped | squareBit(sq), depth - 1, -beta, -alpha, ply + 1, false);
+        if (_aborted)
+            return 0;
+        if (score > bestScore)
+        {
+            bestScore = score;
+            bestMove = sq;
+        }
+        if (score > alpha)
+        {
+            alpha = score;
+            if (alpha >= beta)
+                break;
+        }
+    }
+    if (ply == 0)
+        _rootBest = bestMove;
+
+    entry.key = key;
+    entry.score = static_cast<int16_t>(bestScore);
+    entry.depth = static_cast<int8_t>(depth);
+    entry.bound = static_cast<uint8_t>(bestScore <= originalAlpha ? kUpper : bestScore >= beta ? kLower : kExact);
+    entry.move = static_cast<int8_t>(bestMove);
+    return bestScore;
+}
+
+int OthelloSearch::endgameShallow(uint64_t player, uint64_t opponent, int alpha, int beta, int empties, bool passed)
+{
+    ++_nodes;
+    if (empties == 0)
+        return std::popcount(player) - std::popcount(opponent);
+
+    int bestScore = -kInfinite;
+    for (uint64_t e = ~(player | opponent); e; e &= e - 1)
+    {
+        const int sq = std::countr_zero(e);
+        const uint64_t flipped = flips(player, opponent, sq);
+        if (!flipped)
+            continue;
+        const int score = -endgameShallow(opponent & ~flipped, player | flipped | squareBit(sq), -beta, -alpha, empties - 1, false);
+        if (score > bestScore)
+        {
+            bestScore = score;
+            if (score > alpha)
+            {
+                alpha = score;
+                if (alpha >= beta)
+                    break;
+            }
+        }
+    }
+    if (bestScore != -kInfinite)
+        return bestScore;
+
+    if (passed)
+        return finalScore(player, opponent, empties);
+    return -endgameShallow(opponent, player, -beta, -alpha, empties, true);
+}
+
+int OthelloSearch::endgame(uint64_t player, uint64_t opponent, int alpha, int beta, int empties, bool passed)
+{
+    if (empties <= kShallowEmpties)
+        return endgameShallow(player, opponent, alpha, beta, empties, passed);
+
+    if ((++_nodes & 4095) == 0)
+        checkTime();
+    if (_aborted)
+        return 0;
+
+    const uint64_t legal = moves(player, opponent);
+    if (!legal)
+    {
+        if (passed)
+            return finalScore(player, opponent, empties);
+        return -endgame(opponent, player, -beta, -alpha, empties, true);
+    }
+
+    // the depth stored is the number of empties, which is always the same for a
+    // position, so every entry is deep enough and only the bound matters
+    const uint64_t key = positionKey(player, opponent);
+    Entry &entry = _endTable[key & _mask];
+    int ttMove = -1;
+    if (entry.key == key)
+    {
+        ttMove = entry.move;
+        if (entry.bound == kExact || (entry.bound == kLower && entry.score >= beta) || (entry.bound == kUpper && entry.score <= alpha))
+            return entry.score;
+        if (entry.bound == kLower)
+            alpha = std::max(alpha, static_cast<int>(entry.score));
+        else if (entry.bound == kUpper)
+            beta = std::min(beta, static_cast<int>(entry.score));
+    }
+
+    int order[64];
+    const int count = orderMoves(player, opponent, legal, ttMove, order);
+    const int originalAlpha = alpha;
+    int bestScore = -kInfinite;
+    int bestMove = order[0];
+    for (int i = 0; i < count; ++i)
+    {
+        const int sq = order[i];
+        const uint64_t flipped = flips(player, opponent, sq);
+        const uint64_t nextPlayer = opponent & ~flipped;
+        const uint64_t nextOpponent = player | flipped | squareBit(sq);
+        // the first move gets the full window, the rest only have to be shown worse
+        int score;
+        if (i == 0)
+            score = -endgame(nextPlayer, nextOpponent, -beta, -alpha, empties - 1, false);
+        else
+        {
+            score = -endgame(nextPlayer, nextOpponent, -alpha - 1, -alpha, empties - 1, false);
+            if (score > alpha && score < beta)
+                score = -endgame(nextPlayer, nextOpponent, -beta, -alpha, empties - 1, false);
+        }
+        if (_aborted)
+            return 0;
+        if (score > bestScore)
+        {
+            bestScore = score;
+            bestMove = sq;
+        }
+        if (score > alpha)
+        {
+            alpha = score;
+            if (alpha >= beta)
+                break;
+        }
+    }
+
+    entry.key = key;
+    entry.score = static_cast<int16_t>(bestScore);
+    entry.depth = static_cast<int8_t>(empties);
+    entry.bound = static_cast<uint8_t>(bestScore <= originalAlpha ? kUpper : bestScore >= beta ? kLower : kExact);
+    entry.move = static_cast<int8_t>(bestMove);
+    return bestScore;
+}
+
+OthelloSearchResult OthelloSearch::solve(const OthelloPosition &position, const std::atomic<bool> *stop,
+                                         std::chrono::milliseconds budget)
+{
+    const auto start = std::chrono::steady_clock::now();
+    startClock(stop, budget);
+    OthelloSearchResult result;
+    const uint64_t player = position.mover();
+    const uint64_t opponent = position.opponent();
+    const int empties = position.emptyCount();
+
+    const uint64_t legal = moves(player, opponent);
+    int score = -kInfinite;
+    if (!legal)
+        score = moves(opponent, player) ? -endgame(opponent, player, -65, 65, empties, true) : finalScore(player, opponent, empties);
+    else
+    {
+        // the root keeps its own best move, the table entries below it are for other positions
+        int order[64];
+        const int count = orderMoves(player, opponent, legal, -1, order);
+        for (int i = 0; i < count && !_aborted; ++i)
+        {
+            const int sq = order[i];
+            const uint64_t flipped = flips(player, opponent, sq);
+            const uint64_t nextPlayer = opponent & ~flipped;
+            const uint64_t nextOpponent = player | flipped | squareBit(sq);
+            const int alpha = std::max(score, -65);
+            int value = i == 0 ? -endgame(nextPlayer, nextOpponent, -65, 65, empties - 1, false)
+                               : -endgame(nextPlayer, nextOpponent, -alpha - 1, -alpha, empties - 1, false);
+            if (i > 0 && value > alpha)
+                value = -endgame(nextPlayer, nextOpponent, -65, -alpha, empties - 1, false);
+            if (!_aborted && value > score)
+            {
+                score = value;
+                result.move = sq;
+            }
+        }
+    }
+    if (!_aborted)
+    {
+        result.exact = true;
+        result.score = score;
+        result.depth = empties;
+    }
+    result.nodes = _nodes;
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+OthelloSearchResult OthelloSearch::search(const OthelloPosition &position, std::chrono::milliseconds budget,
+                                          const std::atomic<bool> *stop)
+{
+    const auto start = std::chrono::steady_clock::now();
+    startClock(stop, budget);
+    OthelloSearchResult result;
+    const uint64_t legal = position.legalMoves();
+    if (!legal)
+        return result;
+    result.move = std::countr_zero(legal);
+    if (std::popcount(legal) == 1)
+        return result;
+
+    // the solver gets what's left if it has a chance, so the middle game search stops sooner
+    const int empties = position.emptyCount();
+    const bool trySolve = empties <= kSolveEmpties;
+    const auto middleGameBudget = trySolve ? budget / 3 : budget / 2;
+    for (int depth = 1; depth <= empties; ++depth)
+    {
+        _rootBest = -1;
+        const int score = midgame(position.mover(), position.opponent(), depth, -kInfinite, kInfinite, 0, false);
+        if (_aborted)
+            break;
+        result.move = _rootBest;
+        result.score = score;
+        result.depth = depth;
+        if (budget.count() > 0 && std::chrono::steady_clock::now() - start > middleGameBudget)
+            break;
+    }
+    uint64_t nodes = _nodes;
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    if (trySolve && !(stop && stop->load()) && (budget.count() == 0 || elapsed < budget))
+    {
+        const OthelloSearchResult solved = solve(position, stop, budget.count() ? budget - elapsed : budget);
+        nodes += solved.nodes;
+        if (solved.exact && solved.move >= 0)
+            result = solved;
+    }
+    result.nodes = nodes;
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
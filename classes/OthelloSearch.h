@@ -0,0 +1,94 @@
+#pragma once
+#include "OthelloPosition.h"
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+struct OthelloSearchResult
+{
+    int         move = -1;          // the square to play, -1 to pass
+    int         score = 0;          // evaluation, or the final disc difference when exact
+    int         depth = 0;          // last iteration that finished
+    bool        exact = false;      // solved to the end of the game
+    uint64_t    nodes = 0;
+    double      seconds = 0;
+};
+
+//
+// othello search: alpha-beta with an evaluation for the middle game and an
+// exact solver for the endgame
+//
+// the middle game search is iterative deepening negamax with a
+// transposition table; the evaluation weighs mobility, corners, the squares
+// next to empty corners and frontier discs, for the side to move.
+//
+// solve() plays the game out to the end and scores it as the final disc
+// difference for the side to move, empty squares going to the winner. it
+// looks at the moves that leave the opponent the fewest replies first
+// ("fastest first") and keeps bounds in its own transposition table; the
+// last few empties skip the move list and try each empty square in turn.
+// twenty empties is a second or so.
+//
+// search() is what the game plays: the middle game search for part of the
+// budget and then, with few enough empties, the solver for the rest of it,
+// its answer replacing the estimate if it finishes.
+//
+class OthelloSearch
+{
+public:
+    static const int kInfinite = 32000;
+    // a game the middle game search sees to the end scores this plus 100 a disc
+    static const int kWonGame = 20000;
+    // search() tries to solve positions with this many empties or fewer
+    static const int kSolveEmpties = 18;
+
+    explicit OthelloSearch(size_t tableEntries = 1 << 20);
+
+    OthelloSearchResult search(const OthelloPosition &position, std::chrono::milliseconds budget,
+                               const std::atomic<bool> *stop = nullptr);
+    // the exact result, with only the stop flag (and budget, 0 for none) to end it early
+    OthelloSearchResult solve(const OthelloPosition &position, const std::atomic<bool> *stop = nullptr,
+                              std::chrono::milliseconds budget = std::chrono::milliseconds(0));
+
+    // forget everything learned, for a new game
+    void        clear();
+
+    static int  evaluate(uint64_t player, uint64_t opponent);
+
+private:
+    enum Bound
+    {
+        kUpper = 1,
+        kLower = 2,
+        kExact = 3
+    };
+
+    struct Entry
+    {
+        uint64_t    key;
+        int16_t     score;
+        int8_t      depth;
+        uint8_t     bound;
+        int8_t      move;
+    };
+
+    int         midgame(uint64_t player, uint64_t opponent, int depth, int alpha, int beta, int ply, bool passed);
+    int         endgame(uint64_t player, uint64_t opponent, int alpha, int beta, int empties, bool passed);
+    // the last few empties: no move list, table or ordering
+    int         endgameShallow(uint64_t player, uint64_t opponent, int alpha, int beta, int empties, bool passed);
+    // moves worth looking at first, best first, returns how many
+    int         orderMoves(uint64_t player, uint64_t opponent, uint64_t moves, int ttMove, int *order) const;
+    void        startClock(const std::atomic<bool> *stop, std::chrono::milliseconds budget);
+    void        checkTime();
+
+    std::vector<Entry>                      _midTable;
+    std::vector<Entry>                      _endTable;
+    uint64_t                                _mask;
+    uint64_t                                _nodes;
+    const std::atomic<bool>                *_stop;
+    bool                                    _aborted;
+    bool                                    _hasDeadline;
+    std::chrono::steady_clock::time_point   _deadline;
+    int                                     _rootBest;
+};
@@ -0,0 +1,405 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+enum class ProofValue
+{
+    kUnknown,       // the node limit or the stop flag came first
+    kWin,
+    kDraw,
+    kLoss,
+    kNoWin          // proveWin() only: a draw or a loss, not told apart
+};
+
+inline const char *proofValueName(ProofValue value)
+{
+    static const char *kNames[] = { "unknown", "win", "draw", "loss", "no win" };
+    return kNames[static_cast<int>(value)];
+}
+
+struct ProofResult
+{
+    ProofValue  value = ProofValue::kUnknown;      // for the side to move
+    int         move = -1;      // the winning or drawing move, the longest resisting one in a loss
+    uint64_t    nodes = 0;
+    size_t      memory = 0;     // bytes of transposition table in use
+    size_t      tableSize = 0;  // bytes of transposition table allocated
+    double      seconds = 0;
+};
+
+//
+// depth-first proof-number search (df-pn) for two player placement games
+//
+// a proof-number search grows the tree towards whichever leaf is cheapest
+// to settle: every node keeps the number of leaves that still have to be
+// won to prove it (phi) and the number that would disprove it (delta),
+// from the point of view of the side to move there, and the search always
+// goes down the child that's closest to deciding its parent. unlike
+// alpha-beta it never needs a depth limit or an evaluation, it either
+// proves the result or runs out of nodes.
+//
+// the depth-first form keeps no tree at all: the only memory is the
+// transposition table, one arena of entries allocated up front, and a node
+// is re-expanded from the table whenever the search comes back to it. each
+// call below a node gets thresholds, and returns once its phi or delta
+// reaches them, so the recursion only ever holds the current path. the
+// child's delta threshold is the second best child's delta times 1 + 1/4
+// rather than + 1, which cuts the thrashing between two close siblings.
+// when the table is full the cluster entry with the smallest subtree makes
+// way.
+//
+// the attacker is proving a win; a draw counts as the defender holding.
+// solve() tells all three results apart by proving a win for the side to
+// move and, if there's none, a win for the other side.
+//
+// every node first checks the threats: a side to move with a cell that
+// completes a line has won, two cells to block have lost, and one cell to
+// block is the only move searched. once every line the attacker could still
+// make has a defender's stone in it the node is disproven, and cells on no
+// line either side could still complete aren't searched at all. a child
+// with no table entry yet gets the same checks, and if they don't settle it
+// it starts at one move to refute and one per reply to prove, so forcing
+// moves are tried first.
+//
+// Position needs, all cells as bits of a uint64_t:
+//   int sideToMove() const, int winner() const (-1 for nobody)
+//   uint64_t empty() const, uint64_t threats(int player) const,
+//   bool hasOpenLine(int player) const, uint64_t liveCells() const
+//   void play(int cell), void undo(int cell), uint64_t key() const
+// MNKPosition (with two players) and QubicPosition both have them.
+//
+template <typename Position>
+class ProofNumberSearch
+{
+public:
+    explicit ProofNumberSearch(size_t tableMegabytes = 64);
+
+    // win, draw or loss for the side to move, up to nodeLimit nodes
+    ProofResult solve(const Position &position, uint64_t nodeLimit = ~uint64_t(0),
+                      const std::atomic<bool> *stop = nullptr);
+    // only whether the side to move wins, about half the work when it doesn't
+    ProofResult proveWin(const Position &position, uint64_t nodeLimit = ~uint64_t(0),
+                         const std::atomic<bool> *stop = nullptr);
+
+    size_t      tableBytes() const { return _table.size() * sizeof(Entry); }
+    // the entries the last solve filled, which only grows until the next one
+    size_t      usedBytes() const { return _occupied * sizeof(Entry); }
+
+private:
+    static const uint32_t kInfinity = 0x7FFFFFFF;
+    static const int kCluster = 4;
+
+    struct Entry
+    {
+        uint64_t    key;            // 0 for empty
+        uint32_t    phi;
+        uint32_t    delta;
+        uint64_t    work;           // nodes spent under it, what decides replacement
+    };
+
+    // what the root looked like after one proof attempt
+    struct Outcome
+    {
+        bool        proven;         // the attacker wins
+        bool        disproven;      // the attacker doesn't
+        int         move;
+    };
+
+    Outcome     run(const Position &position, int attacker);
+    void        mid(Position &position, uint32_t thPhi, uint32_t thDelta);
+    // true if the node is decided without moves, otherwise the cells to search
+    bool        settle(const Position &position, uint32_t &phi, uint32_t &delta, uint64_t &moves) const;
+    uint64_t    tableKey(const Position &position) const;
+    // false, with phi and delta untouched, if the key isn't in the table
+    bool        lookup(uint64_t key, uint32_t &phi, uint32_t &delta, uint64_t &work) const;
+    // a child's values before it has been searched: settled, or one move to
+    // refute it and one per reply to prove it
+    void        estimate(const Position &child, uint32_t &phi, uint32_t &delta) const;
+    void        store(uint64_t key, uint32_t phi, uint32_t delta, uint64_t work);
+    ProofResult finish(ProofValue value, int move, std::chrono::steady_clock::time_point start) const;
+
+    std::vector<Entry>          _table;
+    int                         _attacker = 0;
+    uint64_t                    _nodes = 0;
+    uint64_t                    _nodeLimit = 0;
+    size_t                      _occupied = 0;      // entries with a key
+    bool                        _aborted = false;
+    const std::atomic<bool>    *_stop = nullptr;
+};
+
+template <typename Position>
+ProofNumberSearch<Position>::ProofNumberSearch(size_t tableMegabytes)
+{
+    // a power of two number of entries, so a cluster is a mask away
+    const size_t entries = std::max<size_t>(kCluster, tableMegabytes * 1024 * 1024 / sizeof(Entry));
+    _table.resize(std::bit_floor(entries));
+}
+
+template <typename Position>
+uint64_t ProofNumberSearch<Position>::tableKey(const Position &position) const
+{
+    // proofs for one attacker say nothing about the other
+    const uint64_t key = position.key() ^ (_attacker ? 0x5851F42D4C957F2Dull : 0);
+    return key ? key : 1;
+}
+
+template <typename Position>
+bool ProofNumberSearch<Position>::lookup(uint64_t key, uint32_t &phi, uint32_t &delta, uint64_t &work) const
+{
+    const size_t first = static_cast<size_t>(key) & (_table.size() - kCluster);
+    for (size_t i = first; i < first + kCluster; ++i)
+    {
+        if (_table[i].key == key)
+        {
+            phi = _table[i].phi;
+            delta = _table[i].delta;
+            work = _table[i].work;
+            return true;
+        }
+    }
+    work = 0;
+    return false;
+}
+
+template <typename Position>
+void ProofNumberSearch<Position>::estimate(const Position &child, uint32_t &phi, uint32_t &delta) const
+{
+    uint64_t moves;
+    if (!settle(child, phi, delta, moves))
+    {
+        phi = 1;
+        delta = static_cast<uint32_t>(std::popcount(moves));
+    }
+}
+
+template <typename Position>
+void ProofNumberSearch<Position>::store(uint64_t key, uint32_t phi, uint32_t delta, uint64_t work)
+{
+    const size_t first = static_cast<size_t>(key) & (_table.size() - kCluster);
+    Entry *slot = &_table[first];
+    for (size_t i = first; i < first + kCluster; ++i)
+    {
+        if (_table[i].key == key || _table[i].key == 0)
+        {
+            slot = &_table[i];
+            break;
+        }
+        if (_table[i].work < slot->work)
+            slot = &_table[i];
+    }
+    _occupied += slot->key == 0;
+    *slot = Entry{ key, phi, delta, work };
+}
+
+template <typename Position>
+bool ProofNumberSearch<Position>::settle(const Position &position, uint32_t &phi, uint32_t &delta, uint64_t &moves) const
+{
+    const int me = position.sideToMove();
+    const uint64_t empty = position.empty();
+    // winning now is good for either side, a draw only for the defender
+    if (position.threats(me) & empty)
+    {
+        phi = 0;
+        delta = kInfinity;
+        return true;
+    }
+    // a board full, or with every line the attacker could make blocked, is a draw at best
+    if (!empty || !position.hasOpenLine(_attacker))
+    {
+        phi = me == _attacker ? kInfinity : 0;
+        delta = me == _attacker ? 0 : kInfinity;
+        return true;
+    }
+    const uint64_t theirs = position.threats(me ^ 1) & empty;
+    if (std::popcount(theirs) >= 2)
+    {
+        phi = kInfinity;
+        delta = 0;
+        return true;
+    }
+    // a cell on no line anyone can finish is a pass, and passing never helps
+    moves = theirs ? theirs : position.liveCells();
+    return false;
+}
+
+template <typename Position>
+void ProofNumberSearch<Position>::mid(Position &position, uint32_t thPhi, uint32_t thDelta)
+{
+    ++_nodes;
+    if ((_nodes & 1023) == 0 && _stop && _stop->load(std::memory_order_relaxed))
+        _aborted = true;
+    if (_nodes >= _nodeLimit)
+        _aborted = true;
+
+    const uint64_t key = tableKey(position);
+    const uint64_t startNodes = _nodes;
+    uint32_t phi, delta;
+    uint64_t moves;
+    if (settle(position, phi, delta, moves))
+    {
+        store(key, phi, delta, 1);
+        return;
+    }
+
+    int cells[64];
+    uint64_t childKeys[64];
+    uint32_t firstPhi[64], firstDelta[64];
+    int count = 0;
+    for (uint64_t m = moves; m; m &= m - 1)
+    {
+        cells[count] = std::countr_zero(m);
+        position.play(cells[count]);
+        childKeys[count] = tableKey(position);
+        estimate(position, firstPhi[count], firstDelta[count]);
+        position.undo(cells[count]);
+        ++count;
+    }
+
+    for (;;)
+    {
+        // phi is the cheapest child to refute, delta the sum of what proving them all takes
+        uint32_t bestDelta = kInfinity, secondDelta = kInfinity, bestPhi = 0;
+        uint64_t sumPhi = 0;
+        int best = 0;
+        for (int i = 0; i < count; ++i)
+        {
+            uint32_t childPhi = firstPhi[i], childDelta = firstDelta[i];
+            uint64_t work;
+            lookup(childKeys[i], childPhi, childDelta, work);
+            sumPhi = childPhi == kInfinity || sumPhi == kInfinity ? kInfinity : sumPhi + childPhi;
+            if (childDelta < bestDelta)
+            {
+                secondDelta = bestDelta;
+                bestDelta = childDelta;
+                bestPhi = childPhi;
+                best = i;
+            }
+            else if (childDelta < secondDelta)
+                secondDelta = childDelta;
+        }
+        phi = bestDelta;
+        // only a child that's really lost makes the sum infinite
+        delta = sumPhi == kInfinity ? kInfinity : static_cast<uint32_t>(std::min<uint64_t>(sumPhi, kInfinity - 1));
+        if (phi >= thPhi || delta >= thDelta || _aborted)
+            break;
+
+        const uint32_t childThPhi = static_cast<uint32_t>(std::min<uint64_t>(uint64_t(thDelta) - delta + bestPhi, kInfinity));
+        const uint32_t childThDelta = static_cast<uint32_t>(std::min<uint64_t>(thPhi, uint64_t(secondDelta) + secondDelta / 4 + 1));
+        position.play(cells[best]);
+        mid(position, childThPhi, childThDelta);
+        position.undo(cells[best]);
+    }
+    store(key, phi, delta, _nodes - startNodes + 1);
+}
+
+template <typename Position>
+typename ProofNumberSearch<Position>::Outcome ProofNumberSearch<Position>::run(const Position &position, int attacker)
+{
+    _attacker = attacker;
+    Position root = position;
+    mid(root, kInfinity, kInfinity);
+
+    uint32_t phi = 1, delta = 1;
+    uint64_t work;
+    lookup(tableKey(root), phi, delta, work);
+    const bool attackerMoves = root.sideToMove() == attacker;
+    Outcome outcome;
+    outcome.proven = attackerMoves ? phi == 0 : delta == 0;
+    outcome.disproven = attackerMoves ? delta == 0 : phi == 0;
+    outcome.move = -1;
+
+    // a settled root has its move in the threats, otherwise it's the child
+    // that settled it, or the one that took longest to refute
+    const int me = root.sideToMove();
+    const uint64_t empty = root.empty();
+    const uint64_t wins = root.threats(me) & empty;
+    const uint64_t blocks = root.threats(me ^ 1) & empty;
+    if (wins)
+        outcome.move = std::countr_zero(wins);
+    else if (blocks)
+        outcome.move = std::countr_zero(blocks);
+    if (wins || std::popcount(blocks) >= 2 || !empty)
+        return outcome;
+
+    uint64_t mostWork = 0;
+    const uint64_t live = root.liveCells();
+    for (uint64_t m = live ? live : empty; m; m &= m - 1)
+    {
+        const int cell = std::countr_zero(m);
+        root.play(cell);
+        uint32_t childPhi, childDelta;
+        if (!lookup(tableKey(root), childPhi, childDelta, work))
+            estimate(root, childPhi, childDelta);
+        root.undo(cell);
+        if (childDelta == 0)
+        {
+            outcome.move = cell;
+            break;
+        }
+        if (!blocks && (outcome.move < 0 || work > mostWork))
+        {
+            outcome.move = cell;
+            mostWork = work;
+        }
+    }
+    return outcome;
+}
+
+template <typename Position>
+ProofResult ProofNumberSearch<Position>::finish(ProofValue value, int move, std::chrono::steady_clock::time_point start) const
+{
+    ProofResult result;
+    result.value = value;
+    result.move = move;
+    result.nodes = _nodes;
+    result.memory = usedBytes();
+    result.tableSize = tableBytes();
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+template <typename Position>
+ProofResult ProofNumberSearch<Position>::proveWin(const Position &position, uint64_t nodeLimit, const std::atomic<bool> *stop)
+{
+    const auto start = std::chrono::steady_clock::now();
+    std::fill(_table.begin(), _table.end(), Entry{ 0, 0, 0, 0 });
+    _occupied = 0;
+    _nodes = 0;
+    _nodeLimit = nodeLimit;
+    _aborted = false;
+    _stop = stop;
+
+    const int me = position.sideToMove();
+    if (position.winner() >= 0)
+        return finish(position.winner() == me ? ProofValue::kWin : ProofValue::kNoWin, -1, start);
+    const Outcome outcome = run(position, me);
+    if (outcome.proven)
+        return finish(ProofValue::kWin, outcome.move, start);
+    return finish(outcome.disproven ? ProofValue::kNoWin : ProofValue::kUnknown, -1, start);
+}
+
+template <typename Position>
+ProofResult ProofNumberSearch<Position>::solve(const Position &position, uint64_t nodeLimit, const std::atomic<bool> *stop)
+{
+    const auto start = std::chrono::steady_clock::now();
+    ProofResult result = proveWin(position, nodeLimit, stop);
+    if (result.value != ProofValue::kNoWin || position.winner() >= 0)
+    {
+        if (result.value == ProofValue::kNoWin)
+            result.value = ProofValue::kLoss;
+        result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return result;
+    }
+    if (!position.empty())
+        return finish(ProofValue::kDraw, -1, start);
+
+    // no win, so the question is whether the other side has one
+    const Outcome outcome = run(position, position.sideToMove() ^ 1);
+    if (outcome.proven)
+        return finish(ProofValue::kLoss, outcome.move, start);
+    return finish(outcome.disproven ? ProofValue::kDraw : ProofValue::kUnknown, outcome.move, start);
+}
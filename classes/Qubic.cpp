@@ -0,0 +1,237 @@
+#include "Qubic.h"
+
+// how long the AI thinks about each move
+static const std::chrono::milliseconds kThinkTime(1000);
+// how long Solve in the Settings window may take, and the table it gets
+static const std::chrono::milliseconds kSolveTime(10000);
+static const size_t kSolveTableMegabytes = 256;
+// the sprites are 100x100, drawn at half size so the four layers fit side by side
+static const float kCellSize = 50.0f;
+static const float kLayerGap = 25.0f;
+
+Qubic::Qubic() : _proofKey(0)
+{
+}
+
+Qubic::~Qubic()
+{
+    _ai.cancel();
+    _proofWorker.cancel();
+}
+
+Bit* Qubic::PieceForPlayer(const int playerNumber)
+{
+    Bit *bit = new Bit();
+    bit->LoadTextureFromFile(playerNumber == 0 ? "x.png" : "o.png");
+    bit->setSize(kCellSize, kCellSize);
+    bit->setOwner(getPlayerAt(playerNumber));
+    return bit;
+}
+
+//
+// setup the game board, this is called once at the start of the game
+//
+void Qubic::setUpBoard()
+{
+    setNumberOfPlayers(2);
+    setAIPlayer(1);
+
+    _gameOptions.rowX = kSize * kSize;
+    _gameOptions.rowY = kSize;
+
+    for (int layer = 0; layer < kSize; ++layer)
+    {
+        for (int row = 0; row < kSize; ++row)
+        {
+            for (int col = 0; col < kSize; ++col)
+            {
+                ImVec2 pos(layer * (kSize * kCellSize + kLayerGap) + col * kCellSize, row * kCellSize);
+                Square &square = _grid[layer][row][col];
+                square.initHolder(pos, "square.png", col, row);
+                square.setSize(kCellSize, kCellSize);
+                square.setGameTag(QubicPosition::cellIndex(col, row, layer));
+            }
+        }
+    }
+    _position = QubicPosition();
+
+    // the tables are big, only allocate them once
+    if (!_solver)
+        _solver = std::make_unique<QubicSolver>();
+    else
+        _solver->clearTables();
+
+    startGame();
+}
+
+bool Qubic::actionForEmptyHolder(BitHolder *holder)
+{
+    if (!holder)
+        return false;
+    return placePiece(holder->gameTag());
+}
+
+bool Qubic::placePiece(int cell)
+{
+    if (cell < 0 || cell >= QubicPosition::kCells || (_position.occupied() & (uint64_t(1) << cell)))
+        return false;
+    // nothing more to play once somebody has won
+    if (checkForWinner())
+        return false;
+
+    Square &square = squareAt(cell);
+    Bit *placeBit = PieceForPlayer(getCurrentPlayer()->playerNumber());
+    placeBit->setPosition(square.getPosition());
+    square.setBit(placeBit);
+    _position.play(cell);
+    _lastMoveCode = cell;
+    return true;
+}
+
+bool Qubic::canBitMoveFrom(Bit *bit, BitHolder *src)
+{
+    // pieces stay where they're put
+    return false;
+}
+
+bool Qubic::canBitMoveFromTo(Bit* bit, BitHolder*src, BitHolder*dst)
+{
+    return false;
+}
+
+//
+// free all the memory used by the game on the heap
+//
+void Qubic::stopGame()
+{
+    // a search for the old board is no use any more
+    _ai.cancel();
+    _proofWorker.cancel();
+    _proofKey = 0;
+    for (int cell = 0; cell < QubicPosition::kCells; ++cell)
+        squareAt(cell).destroyBit();
+    _position = QubicPosition();
+}
+
+Player* Qubic::checkForWinner()
+{
+    for (int player = 0; player < 2; ++player)
+    {
+        if (_position.hasWon(player))
+            return getPlayerAt(player);
+    }
+    return nullptr;
+}
+
+bool Qubic::checkForDraw()
+{
+    return _position.full() && !checkForWinner();
+}
+
+//
+// state strings, 64 characters in cell order (layer by layer, each one
+// top-to-bottom and left-to-right), '0' empty, '1' player 1, '2' player 2
+//
+std::string Qubic::initialStateString()
+{
+    return std::string(QubicPosition::kCells, '0');
+}
+
+std::string Qubic::stateString() const
+{
+    std::string state;
+    state.reserve(QubicPosition::kCells);
+    for (int cell = 0; cell < QubicPosition::kCells; ++cell)
+    {
+        const uint64_t bit = uint64_t(1) << cell;
+        state.push_back((_position.stones(0) & bit) ? '1' : (_position.stones(1) & bit) ? '2' : '0');
+    }
+    return state;
+}
+
+void Qubic::setStateString(const std::string &s)
+{
+    stopGame();
+
+    uint64_t stones[2] = { 0, 0 };
+    for (int cell = 0; cell < QubicPosition::kCells && cell < static_cast<int>(s.size()); ++cell)
+    {
+        const int savedPlayerIndex = s[cell] - '1';
+        if (savedPlayerIndex < 0 || savedPlayerIndex > 1)
+            continue;
+
+        Square &square = squareAt(cell);
+        Bit *b = PieceForPlayer(savedPlayerIndex);
+        b->setPosition(square.getPosition());
+        square.setBit(b);
+        stones[savedPlayerIndex] |= uint64_t(1) << cell;
+    }
+    _position = QubicPosition(stones[0], stones[1]);
+
+    _gameOptions.currentTurnNo = static_cast<unsigned int>(_position.moves());
+}
+
+//
+// called every frame while it's the AI's turn: the first call starts the
+// search on the worker thread, later calls play the move once it's ready
+//
+void Qubic::updateAI()
+{
+    if (checkForWinner() || checkForDraw())
+        return;
+
+    if (!_ai.busy())
+    {
+        const QubicPosition position = _position;
+        QubicSolver *solver = _solver.get();
+        _ai.start([solver, position](const std::atomic<bool> &stop) {
+            solver->setStopFlag(&stop);
+            const int cell = solver->bestMove(position, kThinkTime);
+            solver->setStopFlag(nullptr);
+            return cell;
+        }, kThinkTime);
+        return;
+    }
+
+    int cell;
+    if (_ai.poll(cell) && placePiece(cell))
+        endTurn();
+}
+
+void Qubic::drawSettings()
+{
+    int move;
+    if (_proofWorker.busy() && !_proofWorker.poll(move))
+    {
+        ImGui::Text("Solving...");
+        return;
+    }
+    if (ImGui::Button("Solve position"))
+    {
+        if (!_proof)
+            _proof = std::make_unique<ProofNumberSearch<QubicPosition>>(kSolveTableMegabytes);
+        const QubicPosition position = _position;
+        ProofNumberSearch<QubicPosition> *proof = _proof.get();
+        ProofResult *result = &_proofResult;
+        _proofWorker.start([proof, result, position](const std::atomic<bool> &stop) {
+            *result = proof->solve(position, ~uint64_t(0), &stop);
+            return result->move;
+        }, kSolveTime);
+        _proofKey = _position.key();
+        return;
+    }
+    // only while the board is still the one that was solved
+    if (_proofKey != _position.key())
+        return;
+    if (_proofResult.value == ProofValue::kUnknown)
+        ImGui::Text("Not solved in %.0f s", _proofResult.seconds);
+    else if (_proofResult.move >= 0)
+    {
+        ImGui::Text("Side to move: %s, playing layer %d row %d column %d", proofValueName(_proofResult.value),
+                    _proofResult.move / 16 + 1, (_proofResult.move / kSize) % kSize + 1, _proofResult.move % kSize + 1);
+    }
+    else
+        ImGui::Text("Side to move: %s", proofValueName(_proofResult.value));
+    ImGui::Text("%llu nodes, %.1f of %.0f MB table, %.2f s", (unsigned long long)_proofResult.nodes,
+                _proofResult.memory / 1048576.0, _proofResult.tableSize / 1048576.0, _proofResult.seconds);
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include "Game.h"
+#include "Square.h"
+#include "AIWorker.h"
+#include "QubicSolver.h"
+#include "ProofNumberSearch.h"
+
+#include <memory>
+
+//
+// Qubic, tic-tac-toe on a 4x4x4 cube
+//
+// the cube is drawn as its four 4x4 layers side by side; four in a row wins
+// along any row, column or diagonal of a layer, straight down through the
+// layers, or diagonally through them. clicking an empty cell plays it. the
+// AI is QubicSolver on an AIWorker thread.
+//
+// the Settings window can also solve the position on the board outright
+// with ProofNumberSearch, on a second worker so the game carries on.
+//
+// for the Game's holder walk the layers make one 16 column, 4 row grid.
+//
+class Qubic : public Game
+{
+public:
+    static const int kSize = 4;
+
+    Qubic();
+    ~Qubic();
+
+    // set up the board
+    void        setUpBoard() override;
+
+    Player*     checkForWinner() override;
+    bool        checkForDraw() override;
+    std::string initialStateString() override;
+    std::string stateString() const override;
+    void        setStateString(const std::string &s) override;
+    bool        actionForEmptyHolder(BitHolder *holder) override;
+    bool        canBitMoveFrom(Bit*bit, BitHolder *src) override;
+    bool        canBitMoveFromTo(Bit* bit, BitHolder*src, BitHolder*dst) override;
+    void        stopGame() override;
+
+    void        updateAI() override;
+    bool        gameHasAI() override { return true; }
+    void        drawSettings() override;
+    BitHolder &getHolderAt(const int x, const int y) override { return _grid[x / kSize][y][x % kSize]; }
+private:
+    Bit *       PieceForPlayer(const int playerNumber);
+    // put the current player's piece on a cell, false if it's taken
+    bool        placePiece(int cell);
+    Square &    squareAt(int cell) { return _grid[cell / 16][(cell / kSize) % kSize][cell % kSize]; }
+
+    // [layer][row][column], the same order as the cell numbers
+    Square                          _grid[kSize][kSize][kSize];
+    QubicPosition                   _position;
+    AIWorker                        _ai;
+    std::unique_ptr<QubicSolver>    _solver;
+
+    // the Settings window's Solve button, the table is only allocated once it's pressed
+    AIWorker                                            _proofWorker;
+    std::unique_ptr<ProofNumberSearch<QubicPosition>>   _proof;
+    ProofResult                                         _proofResult;
+    uint64_t                                            _proofKey;      // the position it was asked about, 0 for none
+};
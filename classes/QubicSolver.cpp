@@ -0,0 +1,418 @@
+#include "QubicSolver.h"
+
+#include <algorithm>
+#include <sstream>
+
+//
+// every line of four: start from each cell in each of the 13 directions
+// (counting a direction and its reverse once) and keep the ones that stay
+// on the board for four cells
+//
+static constexpr std::array<uint64_t, QubicPosition::kLineCount> buildLines()
+{
+    std::array<uint64_t, QubicPosition::kLineCount> lines{};
+    int count = 0;
+    for (int dz = 0; dz <= 1; ++dz)
+    {
+        for (int dy = -1; dy <= 1; ++dy)
+        {
+            for (int dx = -1; dx <= 1; ++dx)
+            {
+                const bool forward = dz > 0 || (dz == 0 && dy > 0) || (dz == 0 && dy == 0 && dx > 0);
+                if (!forward)
+                    continue;
+                for (int z = 0; z < 4; ++z)
+                {
+                    for (int y = 0; y < 4; ++y)
+                    {
+                        for (int x = 0; x < 4; ++x)
+                        {
+                            const int ex = x + 3 * dx, ey = y + 3 * dy, ez = z + 3 * dz;
+                            if (ex < 0 || ex > 3 || ey < 0 || ey > 3 || ez < 0 || ez > 3)
+                                continue;
+                            uint64_t mask = 0;
+                            for (int i = 0; i < 4; ++i)
+                                mask |= uint64_t(1) << ((z + i * dz) * 16 + (y + i * dy) * 4 + (x + i * dx));
+                            lines[count++] = mask;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return lines;
+}
+
+const std::array<uint64_t, QubicPosition::kLineCount> QubicPosition::kLines = buildLines();
+
+// how many lines go through each cell: 7 for the corners and the middle 8, 4 for the rest
+static constexpr std::array<int, QubicPosition::kCells> buildLinesThrough()
+{
+    constexpr std::array<uint64_t, QubicPosition::kLineCount> lines = buildLines();
+    std::array<int, QubicPosition::kCells> through{};
+    for (uint64_t line : lines)
+    {
+        for (int cell = 0; cell < QubicPosition::kCells; ++cell)
+        {
+            if (line & (uint64_t(1) << cell))
+                ++through[cell];
+        }
+    }
+    return through;
+}
+
+static constexpr std::array<int, QubicPosition::kCells> kLinesThrough = buildLinesThrough();
+
+// what a line holding only one player's stones is worth, by how many
+static const int kLineValue[5] = { 0, 1, 4, 16, 0 };
+
+int QubicPosition::playSequence(const std::string &cells)
+{
+    std::istringstream in(cells);
+    int cell;
+    int played = 0;
+    while (in >> cell)
+    {
+        if (cell < 0 || cell >= kCells || (occupied() & (uint64_t(1) << cell)))
+            break;
+        play(cell);
+        ++played;
+    }
+    return played;
+}
+
+bool QubicPosition::hasWon(int player) const
+{
+    for (uint64_t line : kLines)
+    {
+        if ((_stones[player] & line) == line)
+            return true;
+    }
+    return false;
+}
+
+uint64_t QubicPosition::threats(int player) const
+{
+    uint64_t cells = 0;
+    for (uint64_t line : kLines)
+    {
+        if (!(_stones[player ^ 1] & line) && std::popcount(_stones[player] & line) == 3)
+            cells |= line & ~_stones[player];
+    }
+    return cells;
+}
+
+bool QubicPosition::hasOpenLine(int player) const
+{
+    for (uint64_t line : kLines)
+    {
+        if (!(_stones[player ^ 1] & line))
+            return true;
+    }
+    return false;
+}
+
+uint64_t QubicPosition::liveCells() const
+{
+    uint64_t cells = 0;
+    for (uint64_t line : kLines)
+    {
+        if (!(_stones[0] & line) || !(_stones[1] & line))
+            cells |= line;
+    }
+    return cells & empty();
+}
+
+uint64_t QubicPosition::threatMakers(int player) const
+{
+    uint64_t cells = 0;
+    for (uint64_t line : kLines)
+    {
+        if (!(_stones[player ^ 1] & line) && std::popcount(_stones[player] & line) == 2)
+            cells |= line & ~_stones[player];
+    }
+    return cells;
+}
+
+int QubicPosition::evaluate() const
+{
+    const int me = sideToMove();
+    int score = 0;
+    for (uint64_t line : kLines)
+    {
+        const int mine = std::popcount(_stones[me] & line);
+        const int theirs = std::popcount(_stones[me ^ 1] & line);
+        if (!theirs)
+            score += kLineValue[mine];
+        else if (!mine)
+            score -= kLineValue[theirs];
+    }
+    return score;
+}
+
+uint64_t QubicPosition::key() const
+{
+    // two independent mixes so swapping the players gives a different key
+    uint64_t a = _stones[0] * 0x9E3779B97F4A7C15ull;
+    uint64_t b = (_stones[1] ^ 0xD1B54A32D192ED03ull) * 0xBF58476D1CE4E5B9ull;
+    uint64_t key = a ^ (b >> 29) ^ (b << 35);
+    key ^= key >> 31;
+    return key * 0x94D049BB133111EBull;
+}
+
+//
+// the search
+//
+QubicSolver::QubicSolver() : _failTable(kTableSize), _searchTable(kTableSize), _nodes(0), _nodeLimit(~uint64_t(0)),
+    _completedDepth(0), _aborted(false), _hasDeadline(false), _stop(nullptr)
+{
+    clearTables();
+}
+
+void QubicSolver::clearTables()
+{
+    std::fill(_failTable.begin(), _failTable.end(), FailEntry{ 0, -1 });
+    std::fill(_searchTable.begin(), _searchTable.end(), SearchEntry{ 0, 0, -1, 0, -1 });
+}
+
+void QubicSolver::checkTime()
+{
+    if ((_stop && _stop->load(std::memory_order_relaxed)) ||
+        (_hasDeadline && std::chrono::steady_clock::now() >= _deadline))
+        _aborted = true;
+}
+
+int QubicSolver::findForcedWin(const QubicPosition &position, int maxThreats, uint64_t nodeLimit)
+{
+    _nodeLimit = nodeLimit == ~uint64_t(0) ? nodeLimit : _nodes + nodeLimit;
+    int move = -1;
+    const bool win = forcedWin(position, maxThreats, &move);
+    _nodeLimit = ~uint64_t(0);
+    return win ? move : -1;
+}
+
+bool QubicSolver::forcedWin(const QubicPosition &position, int threatsLeft, int *firstMove)
+{
+    if ((++_nodes & 4095) == 0)
+        checkTime();
+    if (_aborted || _nodes > _nodeLimit)
+        return false;
+
+    const int me = position.sideToMove();
+    const int opponent = me ^ 1;
+    const uint64_t wins = position.threats(me) & position.empty();
+    if (wins)
+    {
+        if (firstMove)
+            *firstMove = std::countr_zero(wins);
+        return true;
+    }
+    if (threatsLeft <= 0)
+        return false;
+
+    // their threat has to be blocked first, and the block has to make one of ours
+    const uint64_t theirs = position.threats(opponent) & position.empty();
+    if (std::popcount(theirs) >= 2)
+        return false;
+
+    const uint64_t key = position.key();
+    FailEntry &failed = _failTable[key & (kTableSize - 1)];
+    if (failed.key == key && failed.threats >= threatsLeft)
+        return false;
+
+    uint64_t candidates = position.threatMakers(me) & position.empty();
+    if (theirs)
+        candidates &= theirs;
+    while (candidates)
+    {
+        const int cell = std::countr_zero(candidates);
+        candidates &= candidates - 1;
+
+        QubicPosition next = position;
+        next.play(cell);
+        const uint64_t made = next.threats(me) & next.empty();
+        bool win = std::popcount(made) >= 2;
+        if (!win)
+        {
+            next.play(std::countr_zero(made));
+            win = forcedWin(next, threatsLeft - 1, nullptr);
+        }
+        if (win)
+        {
+            if (firstMove)
+                *firstMove = cell;
+            return true;
+        }
+    }
+
+    // only a search that ran to the end proves anything
+    if (!_aborted && _nodes <= _nodeLimit)
+        failed = FailEntry{ key, threatsLeft };
+    return false;
+}
+
+int QubicSolver::orderMoves(const QubicPosition &position, int *moves, int ttMove) const
+{
+    const int me = position.sideToMove();
+    const uint64_t mine = position.threatMakers(me);
+    const uint64_t theirs = position.threatMakers(me ^ 1);
+    int scores[QubicPosition::kCells];
+    int count = 0;
+    uint64_t empty = position.empty();
+    while (empty)
+    {
+        const int cell = std::countr_zero(empty);
+        empty &= empty - 1;
+        const uint64_t bit = uint64_t(1) << cell;
+        scores[cell] = (cell == ttMove ? 1000 : 0) + ((mine & bit) ? 100 : 0) + ((theirs & bit) ? 50 : 0) + kLinesThrough[cell];
+        moves[count++] = cell;
+    }
+    std::sort(moves, moves + count, [&scores](int a, int b) { return scores[a] > scores[b]; });
+    return count;
+}
+
+int QubicSolver::search(const QubicPosition &position, int depth)
+{
+    _aborted = false;
+    return negamax(position, depth, -kWinScore - 1, kWinScore + 1, 0);
+}
+
+int QubicSolver::negamax(const QubicPosition &position, int depth, int alpha, int beta, int ply)
+{
+    if ((++_nodes & 4095) == 0)
+        checkTime();
+    if (_aborted)
+        return 0;
+
+    const int me = position.sideToMove();
+    const int opponent = me ^ 1;
+    if (position.hasWon(opponent))
+        return -(kWinScore - ply);
+    if (position.full())
+        return 0;
+    if (position.threats(me) & position.empty())
+        return kWinScore - ply - 1;
+
+    const uint64_t theirs = position.threats(opponent) & position.empty();
+    if (std::popcount(theirs) >= 2)
+        return -(kWinScore - ply - 2);
+    if (!theirs && depth <= 0)
+        return position.evaluate();
+
+    // win scores are stored relative to the position so they hold at any ply
+    const uint64_t key = position.key();
+    SearchEntry &entry = _searchTable[key & (kTableSize - 1)];
+    int ttMove = -1;
+    if (entry.key == key)
+    {
+        ttMove = entry.move;
+        if (entry.depth >= depth)
+        {
+            int score = entry.score;
+            if (score > kWinScore - 100)
+                score -= ply;
+            else if (score < -kWinScore + 100)
+                score += ply;
+            if (entry.bound == 0 || (entry.bound > 0 && score >= beta) || (entry.bound < 0 && score <= alpha))
+                return score;
+        }
+    }
+
+    int moves[QubicPosition::kCells];
+    int count;
+    if (theirs)
+    {
+        // the only move there is, searched without using up depth
+        moves[0] = std::countr_zero(theirs);
+        count = 1;
+        ++depth;
+    }
+    else
+        count = orderMoves(position, moves, ttMove);
+
+    const int originalAlpha = alpha;
+    int best = -kWinScore - 1;
+    int bestMove = moves[0];
+    for (int i = 0; i < count; ++i)
+    {
+        QubicPosition next = position;
+        next.play(moves[i]);
+        const int score = -negamax(next, depth - 1, -beta, -alpha, ply + 1);
+        if (_aborted)
+            return 0;
+        if (score > best)
+        {
+            best = score;
+            bestMove = moves[i];
+            alpha = std::max(alpha, score);
+            if (alpha >= beta)
+                break;
+        }
+    }
+
+    int stored = best;
+    if (stored > kWinScore - 100)
+        stored += ply;
+    else if (stored < -kWinScore + 100)
+        stored -= ply;
+    entry.key = key;
+    entry.score = stored;
+    entry.depth = static_cast<int8_t>(depth);
+    entry.bound = static_cast<int8_t>(best >= beta ? 1 : best > originalAlpha ? 0 : -1);
+    entry.move = static_cast<int8_t>(bestMove);
+    return best;
+}
+
+int QubicSolver::bestMove(const QubicPosition &position, std::chrono::milliseconds budget)
+{
+    _hasDeadline = true;
+    _deadline = std::chrono::steady_clock::now() + budget;
+    _aborted = false;
+    _nodes = 0;
+    _completedDepth = 0;
+
+    int best = -1;
+    const int me = position.sideToMove();
+    const uint64_t wins = position.threats(me) & position.empty();
+    const uint64_t blocks = position.threats(me ^ 1) & position.empty();
+    if (position.full())
+        best = -1;
+    else if (wins)
+        best = std::countr_zero(wins);
+    else if (blocks)
+        best = std::countr_zero(blocks);
+    else if ((best = findForcedWin(position, 16, 500000)) < 0)
+    {
+        int moves[QubicPosition::kCells];
+        const int count = orderMoves(position, moves, -1);
+        best = moves[0];
+        for (int depth = 1; depth <= QubicPosition::kCells - position.moves() && !_aborted; ++depth)
+        {
+            int alpha = -kWinScore - 1;
+            int iterationBest = -1;
+            for (int i = 0; i < count; ++i)
+            {
+                QubicPosition next = position;
+                next.play(moves[i]);
+                const int score = -negamax(next, depth - 1, -kWinScore - 1, -alpha, 1);
+                if (_aborted)
+                    break;
+                if (score > alpha)
+                {
+                    alpha = score;
+                    iterationBest = i;
+                }
+            }
+            if (_aborted)
+                break;
+            best = moves[iterationBest];
+            _completedDepth = depth;
+            if (alpha > kWinScore - 100 || alpha < -kWinScore + 100)
+                break;
+            // the best move goes first next time, the rest keep their order
+            std::rotate(moves, moves + iterationBest, moves + iterationBest + 1);
+        }
+    }
+    _hasDeadline = false;
+    return best;
+}
@@ -0,0 +1,134 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//
+// headless Qubic (4x4x4 tic-tac-toe) position and search
+//
+// the 64 cells are one bit each, cell = layer * 16 + row * 4 + column, and
+// every player has a single uint64_t of stones. the 76 ways to get four in a
+// row (48 rows and columns, 24 diagonals across the faces and layers, and
+// the 4 through the middle of the cube) are masks built at compile time, so
+// "did that win" and "where can they win next" are a handful of ands and
+// popcounts.
+//
+class QubicPosition
+{
+public:
+    static const int kCells = 64;
+    static const int kLineCount = 76;
+    static const std::array<uint64_t, kLineCount> kLines;
+
+    QubicPosition() : _stones{ 0, 0 } {}
+    QubicPosition(uint64_t first, uint64_t second) : _stones{ first, second } {}
+
+    // the first player moves when the stone counts are level
+    int         sideToMove() const { return std::popcount(_stones[0]) > std::popcount(_stones[1]) ? 1 : 0; }
+    int         moves() const { return std::popcount(occupied()); }
+    uint64_t    stones(int player) const { return _stones[player]; }
+    uint64_t    occupied() const { return _stones[0] | _stones[1]; }
+    uint64_t    empty() const { return ~occupied(); }
+    bool        full() const { return occupied() == ~uint64_t(0); }
+
+    void        play(int cell) { _stones[sideToMove()] |= uint64_t(1) << cell; }
+    // take the stone off a cell, whoever's it is
+    void        undo(int cell) { _stones[0] &= ~(uint64_t(1) << cell); _stones[1] &= ~(uint64_t(1) << cell); }
+    // play space separated cell numbers, returns how many were played
+    int         playSequence(const std::string &cells);
+
+    bool        hasWon(int player) const;
+    // the player with four in a row, -1 if nobody has
+    int         winner() const { return hasWon(0) ? 0 : hasWon(1) ? 1 : -1; }
+    // empty cells that complete a line for the player
+    uint64_t    threats(int player) const;
+    // whether any line is still free of the other player's stones
+    bool        hasOpenLine(int player) const;
+    // empty cells on a line one of the players could still complete
+    uint64_t    liveCells() const;
+    // cells that would give the player a threat (three in a line, the fourth empty)
+    uint64_t    threatMakers(int player) const;
+    // lines the player can still complete, weighted by how many stones they hold;
+    // side to move minus the other side
+    int         evaluate() const;
+
+    uint64_t    key() const;
+
+    static int  cellIndex(int column, int row, int layer) { return layer * 16 + row * 4 + column; }
+
+private:
+    uint64_t    _stones[2];
+};
+
+//
+// the search: threat sequences for forced wins, alpha-beta for the rest
+//
+// findForcedWin() only tries moves that make a threat, so every reply is
+// forced, and wins when a move makes two threats at once (or the defender's
+// forced block doesn't stop the next one). it's the search that proves the
+// known Qubic wins and has a table of positions already shown not to work.
+//
+// bestMove() is what the game plays: an immediate win, a block, a forced win
+// if there's one in reach, otherwise iterative deepening alpha-beta with a
+// transposition table over all empty cells, threat-making moves first.
+//
+// scores are for the side to move, kWinScore - ply for a win.
+//
+class QubicSolver
+{
+public:
+    static const int kWinScore = 1000000;
+
+    QubicSolver();
+
+    // the first move of a forced win for the side to move in at most
+    // "maxThreats" threats, -1 if there's none (or the node limit ran out)
+    int         findForcedWin(const QubicPosition &position, int maxThreats, uint64_t nodeLimit = ~uint64_t(0));
+    // the cell to play for the side to move inside the time budget, -1 if the board is full
+    int         bestMove(const QubicPosition &position, std::chrono::milliseconds budget);
+    // fixed depth alpha-beta score, used to check forced wins and for speed
+    int         search(const QubicPosition &position, int depth);
+
+    void        setStopFlag(const std::atomic<bool> *stop) { _stop = stop; }
+    uint64_t    nodeCount() const { return _nodes; }
+    void        resetNodeCount() { _nodes = 0; }
+    int         completedDepth() const { return _completedDepth; }
+    void        clearTables();
+
+private:
+    bool        forcedWin(const QubicPosition &position, int threatsLeft, int *firstMove);
+    int         negamax(const QubicPosition &position, int depth, int alpha, int beta, int ply);
+    // empty cells best first: threat makers, then the cells on the most open lines
+    int         orderMoves(const QubicPosition &position, int *moves, int ttMove) const;
+    void        checkTime();
+
+    // positions shown to have no forced win within some number of threats
+    struct FailEntry
+    {
+        uint64_t    key;
+        int         threats;
+    };
+    struct SearchEntry
+    {
+        uint64_t    key;
+        int         score;
+        int8_t      depth;
+        int8_t      bound;
+        int8_t      move;
+    };
+    static const size_t kTableSize = 1 << 20;
+
+    std::vector<FailEntry>                  _failTable;
+    std::vector<SearchEntry>                _searchTable;
+    uint64_t                                _nodes;
+    uint64_t                                _nodeLimit;
+    int                                     _completedDepth;
+    bool                                    _aborted;
+    bool                                    _hasDeadline;
+    const std::atomic<bool>                *_stop;
+    std::chrono::steady_clock::time_point   _deadline;
+};
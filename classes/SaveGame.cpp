@@ -0,0 +1,316 @@
+#include "SaveGame.h"
+#include "BinaryIO.h"
+#include "Crc32.h"
+#include "FileIO.h"
+
+namespace SaveGame
+{
+    std::string slotPath(int slot)
+    {
+        return "tictactoe_save_" + std::to_string(slot) + ".sav";
+    }
+
+    SaveGameData capture(Game &game)
+    {
+        SaveGameData data;
+        data.options = game._gameOptions;
+        data.gameNumber = game._gameNumber;
+        data.score = game._score;
+        data.board = game.stateString();
+
+        for (Player *player : game._players)
+            data.players.push_back({ player->playerNumber(), player->isAIPlayer() });
+
+        data.turns.reserve(game._turns.size());
+        for (const Turn *turn : game._turns)
+        {
+            data.turns.push_back({ static_cast<int>(turn->_status), turn->_move, turn->_boardState,
+                                   turn->_date, turn->_score, turn->_gameNumber });
+        }
+        return data;
+    }
+
+    bool apply(Game &game, const SaveGameData &data)
+    {
+        // a save from a different board or player setup can't be applied
+        if (data.players.size() != game._players.size())
+            return false;
+        if (data.options.rowX != game._gameOptions.rowX || data.options.rowY != game._gameOptions.rowY)
+            return false;
+        if (data.board.size() != game.initialStateString().size())
+            return false;
+
+        game.setStateString(data.board);
+
+        for (size_t i = 0; i < data.players.size(); ++i)
+            game._players[i]->setAIPlayer(data.players[i].isAI);
+
+        for (Turn *turn : game._turns)
+            delete turn;
+        game._turns.clear();
+        for (const SavedTurn &saved : data.turns)
+        {
+            Turn *turn = new Turn();
+            turn->_game = &game;
+            turn->_status = static_cast<TurnStatus>(saved.status);
+            turn->_move = saved.move;
+            turn->_boardState = saved.boardState;
+            turn->_date = saved.date;
+            turn->_score = saved.score;
+            turn->_gameNumber = saved.gameNumber;
+            game._turns.push_back(turn);
+        }
+
+        game._gameOptions = data.options;
+        game._gameNumber = data.gameNumber;
+        game._score = data.score;
+        return true;
+    }
+
+    static void encodeOptions(ByteWriter &w, const GameOptions &o)
+    {
+        w.u8(o.AIPlaying ? 1 : 0);
+        w.i32(o.numberOfPlayers);
+        w.i32(o.AIPlayer);
+        w.i32(o.rowX);
+        w.i32(o.rowY);
+        w.i32(o.gameNumber);
+        w.u32(o.currentTurnNo);
+        w.i32(o.score);
+        w.i32(o.AIDepthSearches);
+        w.i32(o.AIMAXDepth);
+        w.i32(o.AIThreads);
+        w.u8(o.AIvsAI ? 1 : 0);
+    }
+
+    static void decodeOptions(ByteReader &r, GameOptions &o, uint16_t version)
+    {
+        o.AIPlaying = r.u8() != 0;
+        o.numberOfPlayers = r.i32();
+        o.AIPlayer = r.i32();
+        o.rowX = r.i32();
+        o.rowY = r.i32();
+        o.gameNumber = r.i32();
+        o.currentTurnNo = r.u32();
+        o.score = r.i32();
+        o.AIDepthSearches = r.i32();
+        o.AIMAXDepth = r.i32();
+        o.AIThreads = version >= 2 ? r.i32() : 1;
+        o.AIvsAI = r.u8() != 0;
+    }
+
+    void encode(const SaveGameData &data, int slot, std::vector<uint8_t> &out)
+    {
+        std::vector<uint8_t> payload;
+        ByteWriter p(payload);
+        encodeOptions(p, data.options);
+        p.i32(data.gameNumber);
+        p.i32(data.score);
+        p.u8(static_cast<uint8_t>(data.players.size()));
+        for (const SavedPlayer &player : data.players)
+        {
+            p.u8(static_cast<uint8_t>(player.playerNumber));
+            p.u8(player.isAI ? 1 : 0);
+        }
+        p.str(data.board);
+        p.u32(static_cast<uint32_t>(data.turns.size()));
+        for (const SavedTurn &turn : data.turns)
+        {
+            p.u8(static_cast<uint8_t>(turn.status));
+            p.i32(turn.date);
+            p.i32(turn.score);
+            p.i32(turn.gameNumber);
+            p.str(turn.move);
+            p.str(turn.boardState);
+        }
+
+        out.clear();
+        ByteWriter w(out);
+        w.u32(kMagic);
+        w.u16(kVersion);
+        w.u16(static_cast<uint16_t>(slot));
+        w.u32(static_cast<uint32_t>(payload.size()));
+        w.bytes(payload.data(), payload.size());
+        w.u32(Crc32::compute(out.data(), out.size()));
+    }
+
+    bool decode(const std::vector<uint8_t> &bytes, SaveGameData &data, std::string &error)
+    {
+        const size_t headerSize = 12;
+        if (bytes.size() < headerSize + 4)
+        {
+            error = "save file is truncated";
+            return false;
+        }
+
+        const size_t crcOffset = bytes.size() - 4;
+        ByteReader trailer(bytes.data() + crcOffset, 4);
+        if (trailer.u32() != Crc32::compute(bytes.data(), crcOffset))
+        {
+            error = "save file checksum mismatch";
+            return false;
+        }
+
+        ByteReader r(bytes.data(), crcOffset);
+        if (r.u32() != kMagic)
+        {
+            error = "not a save file";
+            return false;
+        }
+        const uint16_t version = r.u16();
+        if (version < 1 || version > kVersion)
+        {
+            error = "unsupported save file version";
+            return false;
+        }
+        r.u16();    // slot, informational only
+        if (r.u32() != crcOffset - headerSize)
+        {
+            error = "save file size mismatch";
+            return false;
+        }
+
+        decodeOptions(r, data.options, version);
+        data.gameNumber = r.i32();
+        data.score = r.i32();
+
+        data.players.resize(r.u8());
+        for (SavedPlayer &player : data.players)
+        {
+            player.playerNumber = r.u8();
+            player.isAI = r.u8() != 0;
+        }
+        data.board = r.str();
+
+        uint32_t turnCount = r.u32();
+        // every turn takes at least 17 bytes, so a bogus count can't make us allocate wildly
+        if (!r.ok() || turnCount > r.remaining() / 17)
+        {
+            error = "save file turn list is damaged";
+            return false;
+        }
+        data.turns.resize(turnCount);
+        for (SavedTurn &turn : data.turns)
+        {
+            turn.status = r.u8();
+            turn.date = r.i32();
+            turn.score = r.i32();
+            turn.gameNumber = r.i32();
+            turn.move = r.str();
+            turn.boardState = r.str();
+        }
+
+        if (!r.ok() || r.remaining() != 0)
+        {
+            error = "save file payload is damaged";
+            return false;
+        }
+        return true;
+    }
+
+    bool writeSlot(int slot, const SaveGameData &data, std::string &error)
+    {
+        std::vector<uint8_t> bytes;
+        encode(data, slot, bytes);
+        if (!FileIO::writeAtomic(slotPath(slot), bytes))
+        {
+            error = "failed to write " + slotPath(slot);
+            return false;
+        }
+        return true;
+    }
+
+    bool readSlot(int slot, SaveGameData &data, std::string &error)
+    {
+        std::vector<uint8_t> bytes;
+        if (!FileIO::readAll(slotPath(slot), bytes))
+        {
+            error = "no save in slot " + std::to_string(slot + 1);
+            return false;
+        }
+        return decode(bytes, data, error);
+    }
+}
+
+//
+// background I/O thread
+//
+SaveGameIO::SaveGameIO() : _pending(0), _quit(false)
+{
+    _thread = std::thread(&SaveGameIO::run, this);
+}
+
+SaveGameIO::~SaveGameIO()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _quit = true;
+    }
+    _wake.notify_one();
+    // queued saves are still written before the thread exits
+    _thread.join();
+}
+
+void SaveGameIO::requestSave(int slot, const SaveGameData &data)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _jobs.push_back({ kSave, slot, data });
+        ++_pending;
+    }
+    _wake.notify_one();
+}
+
+void SaveGameIO::requestLoad(int slot)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _jobs.push_back({ kLoad, slot, SaveGameData() });
+        ++_pending;
+    }
+    _wake.notify_one();
+}
+
+bool SaveGameIO::poll(Result &result)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_results.empty())
+        return false;
+    result = std::move(_results.front());
+    _results.pop_front();
+    return true;
+}
+
+bool SaveGameIO::busy()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _pending > 0;
+}
+
+void SaveGameIO::run()
+{
+    for (;;)
+    {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _wake.wait(lock, [this] { return _quit || !_jobs.empty(); });
+            if (_jobs.empty())
+                return;
+            job = std::move(_jobs.front());
+            _jobs.pop_front();
+        }
+
+        Result result;
+        result.type = job.type;
+        result.slot = job.slot;
+        if (job.type == kSave)
+            result.ok = SaveGame::writeSlot(job.slot, job.data, result.error);
+        else
+            result.ok = SaveGame::readSlot(job.slot, result.data, result.error);
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        _results.push_back(std::move(result));
+        --_pending;
+    }
+}
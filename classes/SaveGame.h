@@ -0,0 +1,119 @@
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Game.h"
+
+//
+// versioned binary save files
+//
+// layout (all integers little-endian):
+//   u32 magic 'TTSV'  u16 version  u16 slot  u32 payload size
+//   payload: game options, game number, score, players, board, turn history
+//   u32 crc32 of everything before it
+//
+// files are written with FileIO::writeAtomic so a crash mid-save leaves the
+// previous save intact, and the crc rejects anything that was damaged on disk
+//
+
+const int kSaveSlotCount = 3;
+
+struct SavedPlayer
+{
+    int     playerNumber;
+    bool    isAI;
+};
+
+struct SavedTurn
+{
+    int         status;
+    std::string move;
+    std::string boardState;
+    int         date;
+    int         score;
+    int         gameNumber;
+};
+
+// a plain copy of everything needed to restore a game, safe to hand to another thread
+struct SaveGameData
+{
+    GameOptions                 options;
+    int                         gameNumber;
+    int                         score;
+    std::vector<SavedPlayer>    players;
+    std::string                 board;
+    std::vector<SavedTurn>      turns;
+};
+
+namespace SaveGame
+{
+    const uint32_t kMagic = 0x56535454;     // "TTSV"
+    // version 2 added GameOptions::AIThreads, version 1 files still load
+    const uint16_t kVersion = 2;
+
+    std::string slotPath(int slot);
+
+    // copy the game into a SaveGameData (UI thread, cheap)
+    SaveGameData capture(Game &game);
+    // put a loaded SaveGameData back into the game (UI thread)
+    bool apply(Game &game, const SaveGameData &data);
+
+    void encode(const SaveGameData &data, int slot, std::vector<uint8_t> &out);
+    // returns false with a reason if the bytes are not a valid save
+    bool decode(const std::vector<uint8_t> &bytes, SaveGameData &data, std::string &error);
+
+    bool writeSlot(int slot, const SaveGameData &data, std::string &error);
+    bool readSlot(int slot, SaveGameData &data, std::string &error);
+}
+
+//
+// background thread that does the disk work for saving and loading so the
+// render loop never waits on the file system. requests are queued from the
+// UI thread and finished jobs are picked up with poll() once per frame.
+//
+class SaveGameIO
+{
+public:
+    enum JobType { kSave, kLoad };
+
+    struct Result
+    {
+        JobType         type;
+        int             slot;
+        bool            ok;
+        std::string     error;
+        SaveGameData    data;       // filled in for loads
+    };
+
+    SaveGameIO();
+    ~SaveGameIO();
+
+    void    requestSave(int slot, const SaveGameData &data);
+    void    requestLoad(int slot);
+    // hand back one finished job, false if nothing is ready
+    bool    poll(Result &result);
+    bool    busy();
+
+private:
+    struct Job
+    {
+        JobType         type;
+        int             slot;
+        SaveGameData    data;
+    };
+
+    void    run();
+
+    std::thread             _thread;
+    std::mutex              _mutex;
+    std::condition_variable _wake;
+    std::deque<Job>         _jobs;
+    std::deque<Result>      _results;
+    int                     _pending;
+    bool                    _quit;
+};
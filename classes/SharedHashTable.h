@@ -0,0 +1,70 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+//
+// a hash table any number of search threads read and write at once, without locks
+//
+// an entry is two 64-bit words: the data, and the key xor'd with the data.
+// they're stored and loaded one at a time with relaxed atomics, so two
+// threads writing the same slot can leave one's data next to the other's
+// check word; that entry no longer xors back to either key and simply reads
+// as a miss. what the data means is up to the search, it only has to fit
+// in 64 bits.
+//
+// the number of entries is rounded down to a power of two and every store
+// replaces whatever was in the slot.
+//
+class SharedHashTable
+{
+public:
+    explicit SharedHashTable(size_t entries) : _mask(0)
+    {
+        size_t size = 1;
+        while (size * 2 <= entries)
+            size *= 2;
+        _entries = std::make_unique<Entry[]>(size);
+        _mask = size - 1;
+        clear();
+    }
+
+    // false for an empty slot, another key or a torn entry
+    bool        probe(uint64_t key, uint64_t &data) const
+    {
+        const Entry &entry = _entries[key & _mask];
+        data = entry.data.load(std::memory_order_relaxed);
+        return (entry.check.load(std::memory_order_relaxed) ^ data) == key;
+    }
+
+    void        store(uint64_t key, uint64_t data)
+    {
+        Entry &entry = _entries[key & _mask];
+        entry.check.store(key ^ data, std::memory_order_relaxed);
+        entry.data.store(data, std::memory_order_relaxed);
+    }
+
+    // not safe while anybody is searching
+    void        clear()
+    {
+        // a zero key with zero data would match an empty slot, so the check starts at all ones
+        for (size_t i = 0; i <= _mask; ++i)
+        {
+            _entries[i].check.store(~uint64_t(0), std::memory_order_relaxed);
+            _entries[i].data.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    size_t      size() const { return _mask + 1; }
+
+private:
+    struct Entry
+    {
+        std::atomic<uint64_t>   check;
+        std::atomic<uint64_t>   data;
+    };
+
+    std::unique_ptr<Entry[]>    _entries;
+    size_t                      _mask;
+};
@@ -0,0 +1,312 @@
+#include "TablebaseFile.h"
+#include "BinaryIO.h"
+#include "Crc32.h"
+#include "FileIO.h"
+
+#include <algorithm>
+
+namespace TablebaseFormat
+{
+    void runLengthEncode(const uint8_t *data, size_t size, std::vector<uint8_t> &out)
+    {
+        out.clear();
+        size_t i = 0;
+        while (i < size)
+        {
+            // a run of three or more is worth a repeat
+            size_t run = 1;
+            while (i + run < size && run < 130 && data[i + run] == data[i])
+                ++run;
+            if (run >= 3)
+            {
+                out.push_back(static_cast<uint8_t>(run + 125));
+                out.push_back(data[i]);
+                i += run;
+                continue;
+            }
+
+            // otherwise copy bytes up to the next run of three
+            size_t literal = 0;
+            while (i + literal < size && literal < 128)
+            {
+                const size_t at = i + literal;
+                if (at + 2 < size && data[at] == data[at + 1] && data[at] == data[at + 2])
+                    break;
+                ++literal;
+            }
+            out.push_back(static_cast<uint8_t>(literal - 1));
+            out.insert(out.end(), data + i, data + i + literal);
+            i += literal;
+        }
+    }
+
+    bool runLengthDecode(const uint8_t *data, size_t size, uint8_t *out, size_t outSize)
+    {
+        size_t in = 0;
+        size_t written = 0;
+        while (in < size)
+        {
+            const uint8_t control = data[in++];
+            if (control < 128)
+            {
+                const size_t count = size_t(control) + 1;
+                if (in + count > size || written + count > outSize)
+                    return false;
+                std::copy(data + in, data + in + count, out + written);
+                in += count;
+                written += count;
+            }
+            else
+            {
+                const size_t count = size_t(control) - 125;
+                if (in >= size || written + count > outSize)
+                    return false;
+                std::fill(out + written, out + written + count, data[in++]);
+                written += count;
+            }
+        }
+        return written == outSize;
+    }
+
+    bool write(const std::string &path, uint32_t tag, uint32_t tagVersion, const uint8_t *data, uint64_t size,
+               uint32_t blockSize, bool compress, std::string &error)
+    {
+        if (blockSize == 0)
+            blockSize = kDefaultBlockSize;
+        const uint32_t blockCount = static_cast<uint32_t>((size + blockSize - 1) / blockSize);
+
+        std::vector<uint8_t> out;
+        ByteWriter w(out);
+        w.u32(kMagic);
+        w.u16(kVersion);
+        w.u16(0);
+        w.u32(tag);
+        w.u32(tagVersion);
+        w.u64(size);
+        w.u32(blockSize);
+        w.u32(blockCount);
+        w.u64(kHeaderSize);
+        while (out.size() < kHeaderSize - 4)
+            w.u8(0);
+        w.u32(Crc32::compute(out.data(), out.size()));
+
+        // the index is filled in as the blocks go down after it
+        out.resize(kHeaderSize + size_t(blockCount) * kIndexEntrySize, 0);
+        std::vector<uint8_t> coded;
+        for (uint32_t block = 0; block < blockCount; ++block)
+        {
+            const uint8_t *raw = data + uint64_t(block) * blockSize;
+            const size_t length = static_cast<size_t>(std::min<uint64_t>(blockSize, size - uint64_t(block) * blockSize));
+            Codec codec = kRaw;
+            if (compress)
+            {
+                runLengthEncode(raw, length, coded);
+                if (coded.size() < length)
+                    codec = kRunLength;
+            }
+            const uint8_t *stored = codec == kRaw ? raw : coded.data();
+            const size_t storedSize = codec == kRaw ? length : coded.size();
+
+            // raw blocks are probed in place, so one of them never straddles more pages than it has to;
+            // coded ones are copied out whole and packed in after the last block
+            if (codec == kRaw)
+                out.resize((out.size() + kBlockAlignment - 1) / kBlockAlignment * kBlockAlignment, 0);
+            std::vector<uint8_t> entry;
+            ByteWriter e(entry);
+            e.u64(out.size());
+            e.u32(static_cast<uint32_t>(storedSize));
+            e.u32(Crc32::compute(raw, length));
+            e.u8(codec);
+            while (entry.size() < kIndexEntrySize)
+                e.u8(0);
+            std::copy(entry.begin(), entry.end(), out.begin() + kHeaderSize + size_t(block) * kIndexEntrySize);
+            out.insert(out.end(), stored, stored + storedSize);
+        }
+
+        if (!FileIO::writeAtomic(path, out))
+        {
+            error = "can't write " + path;
+            return false;
+        }
+        return true;
+    }
+}
+
+using namespace TablebaseFormat;
+
+TablebaseReader::TablebaseReader(size_t cachedBlocks) : _index(nullptr), _tag(0), _tagVersion(0), _tableSize(0),
+    _blockSize(0), _blockCount(0), _cachedBlocks(std::max<size_t>(1, cachedBlocks)), _clock(0), _hits(0), _misses(0)
+{
+}
+
+bool TablebaseReader::open(const std::string &path, std::string &error)
+{
+    close();
+    if (!_map.open(path, MappedFile::kRandom))
+    {
+        error = "can't open " + path;
+        return false;
+    }
+    const uint8_t *data = _map.data();
+    if (_map.size() < kHeaderSize || Crc32::compute(data, kHeaderSize - 4) != ByteReader(data + kHeaderSize - 4, 4).u32())
+    {
+        close();
+        error = "not a tablebase file";
+        return false;
+    }
+
+    ByteReader r(data, kHeaderSize);
+    const uint32_t magic = r.u32();
+    const uint16_t version = r.u16();
+    r.u16();    // flags, none yet
+    _tag = r.u32();
+    _tagVersion = r.u32();
+    _tableSize = r.u64();
+    _blockSize = r.u32();
+    _blockCount = r.u32();
+    const uint64_t indexOffset = r.u64();
+    if (magic != kMagic || version != kVersion)
+    {
+        close();
+        error = "unsupported tablebase file";
+        return false;
+    }
+    if (_blockSize == 0 || _blockCount != (_tableSize + _blockSize - 1) / _blockSize ||
+        indexOffset > _map.size() || uint64_t(_blockCount) * kIndexEntrySize > _map.size() - indexOffset)
+    {
+        close();
+        error = "tablebase index is damaged";
+        return false;
+    }
+    _index = data + indexOffset;
+
+    // every block has to be inside the file and no bigger than it could be coded
+    for (uint32_t block = 0; block < _blockCount; ++block)
+    {
+        const uint64_t offset = blockOffset(block);
+        const uint32_t stored = storedSize(block);
+        const uint8_t codec = blockCodec(block);
+        if (offset > _map.size() || stored > _map.size() - offset || codec > kRunLength ||
+            (codec == kRaw && stored != blockLength(block)))
+        {
+            close();
+            error = "tablebase index is damaged";
+            return false;
+        }
+    }
+    // the index is read on every probe, so it may as well come in now
+    _map.adviseWillNeed(indexOffset, size_t(_blockCount) * kIndexEntrySize);
+    return true;
+}
+
+void TablebaseReader::close()
+{
+    _map.close();
+    _index = nullptr;
+    _tableSize = 0;
+    _blockCount = 0;
+    std::lock_guard<std::mutex> lock(_cacheMutex);
+    _cache.clear();
+    _hits = _misses = 0;
+}
+
+uint64_t TablebaseReader::blockOffset(uint32_t block) const
+{
+    return ByteReader(_index + size_t(block) * kIndexEntrySize, 8).u64();
+}
+
+uint32_t TablebaseReader::storedSize(uint32_t block) const
+{
+    return ByteReader(_index + size_t(block) * kIndexEntrySize + 8, 4).u32();
+}
+
+uint32_t TablebaseReader::blockCrc(uint32_t block) const
+{
+    return ByteReader(_index + size_t(block) * kIndexEntrySize + 12, 4).u32();
+}
+
+uint8_t TablebaseReader::blockCodec(uint32_t block) const
+{
+    return _index[size_t(block) * kIndexEntrySize + 16];
+}
+
+uint32_t TablebaseReader::blockLength(uint32_t block) const
+{
+    const uint64_t start = uint64_t(block) * _blockSize;
+    return static_cast<uint32_t>(std::min<uint64_t>(_blockSize, _tableSize - start));
+}
+
+bool TablebaseReader::decode(uint32_t block, std::vector<uint8_t> &out) const
+{
+    out.resize(blockLength(block));
+    const uint8_t *stored = _map.data() + blockOffset(block);
+    if (blockCodec(block) == kRaw)
+        std::copy(stored, stored + out.size(), out.begin());
+    else if (!runLengthDecode(stored, storedSize(block), out.data(), out.size()))
+        return false;
+    return Crc32::compute(out.data(), out.size()) == blockCrc(block);
+}
+
+int TablebaseReader::byteAt(uint64_t offset) const
+{
+    if (offset >= _tableSize)
+        return -1;
+    const uint32_t block = static_cast<uint32_t>(offset / _blockSize);
+    const size_t within = static_cast<size_t>(offset % _blockSize);
+    // raw blocks straight from the mapping, verify() is what checks those
+    if (blockCodec(block) == kRaw)
+        return _map.data()[blockOffset(block) + within];
+
+    std::lock_guard<std::mutex> lock(_cacheMutex);
+    ++_clock;
+    for (CachedBlock &cached : _cache)
+    {
+        if (cached.block == block)
+        {
+            ++_hits;
+            cached.lastUse = _clock;
+            return cached.data[within];
+        }
+    }
+    ++_misses;
+
+    // the least recently used block makes way once the cache is full
+    CachedBlock *slot;
+    if (_cache.size() < _cachedBlocks)
+    {
+        _cache.push_back(CachedBlock{ block, 0, {} });
+        slot = &_cache.back();
+    }
+    else
+    {
+        slot = &*std::min_element(_cache.begin(), _cache.end(),
+                                  [](const CachedBlock &a, const CachedBlock &b) { return a.lastUse < b.lastUse; });
+    }
+    if (!decode(block, slot->data))
+    {
+        // don't keep a damaged block around as if it were good
+        slot->lastUse = 0;
+        slot->block = ~uint32_t(0);
+        return -1;
+    }
+    slot->block = block;
+    slot->lastUse = _clock;
+    return slot->data[within];
+}
+
+void TablebaseReader::prefetch() const
+{
+    _map.adviseWillNeed(0, _map.size());
+}
+
+size_t TablebaseReader::verify() const
+{
+    size_t bad = 0;
+    std::vector<uint8_t> block;
+    for (uint32_t i = 0; i < _blockCount; ++i)
+    {
+        if (!decode(i, block))
+            ++bad;
+    }
+    return bad;
+}
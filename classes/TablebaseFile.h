@@ -0,0 +1,126 @@
+#pragma once
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "MappedFile.h"
+
+//
+// on-disk format for solved-position tables, probed straight from a memory mapping
+//
+// layout (all integers little-endian):
+//   header      64 bytes, see below
+//   index       one 24 byte entry per block:
+//                 u64 file offset, u32 stored size, u32 crc32 of the block's
+//                 table bytes, u8 codec, 7 bytes zero
+//   blocks      the table cut into blockSize pieces (the last one may be
+//               shorter), stored raw or run length coded, whichever is
+//               smaller. raw blocks start on a 4096 byte boundary so a
+//               probe touches as few pages as it can; coded blocks are
+//               copied out whole anyway and are packed in between
+//
+// header:
+//   u32 magic 'TTTB'  u16 version  u16 flags  u32 tag  u32 tag version
+//   u64 table size  u32 block size  u32 block count  u64 index offset
+//   zero padding  u32 crc32 of the first 60 bytes
+//
+// the tag and its version say what the table holds, the format doesn't care.
+//
+// the reader maps the file instead of reading it, so opening costs the same
+// for a table of any size and every process probing the same file shares
+// one copy of it in the page cache. the mapping is marked for random access
+// so a probe doesn't read ahead pages nobody asked for. raw blocks are read
+// in place; coded blocks are decoded into a small LRU of blocks, private to
+// the reader, and checked against their crc on the way in. a probe that
+// misses the cache costs a whole block's decode, which is what keeps the
+// default block a page long: tens of microseconds instead of the hundreds
+// a 64 KB block takes, for a file a point or so bigger.
+//
+namespace TablebaseFormat
+{
+    const uint32_t kMagic = 0x42545454;     // "TTTB"
+    const uint16_t kVersion = 1;
+
+    const size_t kHeaderSize = 64;
+    const size_t kIndexEntrySize = 24;
+    const size_t kBlockAlignment = 4096;
+    const uint32_t kDefaultBlockSize = 4096;
+
+    enum Codec : uint8_t
+    {
+        kRaw = 0,
+        kRunLength = 1
+    };
+
+    // write a table as a tablebase file (through FileIO::writeAtomic), with
+    // its blocks run length coded where that makes them smaller
+    bool    write(const std::string &path, uint32_t tag, uint32_t tagVersion, const uint8_t *data, uint64_t size,
+                  uint32_t blockSize, bool compress, std::string &error);
+
+    // PackBits style: a control byte below 128 is followed by that many plus
+    // one bytes to copy, 128 and up by one byte to repeat control - 125 times
+    void    runLengthEncode(const uint8_t *data, size_t size, std::vector<uint8_t> &out);
+    // false if the coded bytes don't decode to exactly outSize bytes
+    bool    runLengthDecode(const uint8_t *data, size_t size, uint8_t *out, size_t outSize);
+}
+
+//
+// read-only access to a tablebase file, safe to share between threads
+//
+class TablebaseReader
+{
+public:
+    explicit TablebaseReader(size_t cachedBlocks = 32);
+
+    bool            open(const std::string &path, std::string &error);
+    void            close();
+    bool            isOpen() const { return _map.isOpen(); }
+
+    uint32_t        tag() const { return _tag; }
+    uint32_t        tagVersion() const { return _tagVersion; }
+    uint64_t        tableSize() const { return _tableSize; }
+    uint32_t        blockCount() const { return _blockCount; }
+    size_t          fileSize() const { return _map.size(); }
+
+    // one byte of the table, -1 past the end or in a damaged block
+    int             byteAt(uint64_t offset) const;
+    // ask the OS to start reading the whole file in, for a process that's about to probe all over it
+    void            prefetch() const;
+    // check the crc of every block, returns the number of bad ones
+    size_t          verify() const;
+
+    // how the decoded block cache has done since the file was opened
+    uint64_t        cacheHits() const { return _hits; }
+    uint64_t        cacheMisses() const { return _misses; }
+
+private:
+    struct CachedBlock
+    {
+        uint32_t                block;
+        uint64_t                lastUse;
+        std::vector<uint8_t>    data;
+    };
+
+    // the entry fields of a block
+    uint64_t        blockOffset(uint32_t block) const;
+    uint32_t        storedSize(uint32_t block) const;
+    uint32_t        blockCrc(uint32_t block) const;
+    uint8_t         blockCodec(uint32_t block) const;
+    uint32_t        blockLength(uint32_t block) const;
+    bool            decode(uint32_t block, std::vector<uint8_t> &out) const;
+
+    MappedFile                          _map;
+    const uint8_t                      *_index;
+    uint32_t                            _tag;
+    uint32_t                            _tagVersion;
+    uint64_t                            _tableSize;
+    uint32_t                            _blockSize;
+    uint32_t                            _blockCount;
+    size_t                              _cachedBlocks;
+    mutable std::mutex                  _cacheMutex;
+    mutable std::vector<CachedBlock>    _cache;
+    mutable uint64_t                    _clock;
+    mutable uint64_t                    _hits;
+    mutable uint64_t                    _misses;
+};
@@ -1,4 +1,6 @@
 #include "TicTacToe.h"
+#include "TicTacToeSolver.h"
+#include "WorkStealingPool.h"
 
 // -----------------------------------------------------------------------------
 // TicTacToe.cpp
@@ -113,6 +115,8 @@ bool TicTacToe::actionForEmptyHolder(BitHolder *holder)
     Bit *placeBit = PieceForPlayer(getCurrentPlayer()->playerNumber());
     placeBit->setPosition(holder->getPosition());
     holder->setBit(placeBit);
+    // the holders are _grid in state string order
+    _lastMoveCode = static_cast<int>(static_cast<Square *>(holder) - &_grid[0][0]);
     
     // 4) Return whether we actually placed a piece. true = acted, false = ignored.
     
@@ -344,24 +348,48 @@ void TicTacToe::setStateString(const std::string &s)
 //
 void TicTacToe::updateAI()
 {
-    std::string s = stateString();
+    // the search itself runs on bitboards in TicTacToeSolver so the benchmarks
+    // in tools/ measure exactly what the game plays with
+    const std::string s = stateString();
+    uint16_t human = 0;     // '1'
+    uint16_t ai = 0;        // '2'
+    for (int i = 0; i < 9; ++i)
+    {
+        if (s[i] == '1') human |= 1 << i;
+        if (s[i] == '2') ai |= 1 << i;
+    }
 
-    int bestScore = -100000;
-    int bestMove = -1;
+    // each root move is its own task on the shared pool; the scores are
+    // compared in cell order afterwards, so the move doesn't depend on
+    // which task finished first
+    int scores[9];
+    uint64_t nodes[9] = {};
+    {
+        WorkStealingPool::TaskGroup group(WorkStealingPool::shared());
+        for (int i = 0; i < 9; ++i)
+        {
+            const uint16_t bit = static_cast<uint16_t>(1 << i);
+            if ((human | ai) & bit)
+                continue;
+
+            // try AI move, next turn is HUMAN; negate to score it for the AI
+            group.run([&scores, &nodes, human, ai, bit, i]() {
+                scores[i] = -TicTacToeSolver::negamax(human, ai | bit, 1, nodes[i]);
+            });
+        }
+        group.wait();
+    }
 
     // AI is '2' (second player)
+    int bestScore = -100000;
+    int bestMove = -1;
     for (int i = 0; i < 9; ++i)
     {
-        if (s[i] != '0')
+        if ((human | ai) & (1 << i))
             continue;
-
-        s[i] = '2';                             // try AI move
-        int score = negamax(s, '1', 1);         // next turn is HUMAN (player = +1)
-        s[i] = '0';
-
-        if (score > bestScore)
+        if (scores[i] > bestScore)
         {
-            bestScore = score;
+            bestScore = scores[i];
             bestMove = i;
         }
     }
@@ -375,56 +403,3 @@ void TicTacToe::updateAI()
         endTurn(); // Game.cpp does NOT endTurn() for AI, so this stays here
     }
 }
-
-
-int TicTacToe::negamax(const std::string& state, char turnChar, int depth)
-{
-    static const int wins[8][3] = {
-        {0,1,2},{3,4,5},{6,7,8},
-        {0,3,6},{1,4,7},{2,5,8},
-        {0,4,8},{2,4,6}
-    };
-
-    // Terminal winner check
-    for (const auto& w : wins)
-    {
-        char a = state[w[0]];
-        if (a != '0' && a == state[w[1]] && a == state[w[2]])
-        {
-            // Score from AI perspective, prefer faster outcomes
-            if (a == '2') return 10 - depth;      // AI win
-            else          return -(10 - depth);   // Human win
-        }
-    }
-
-    // Draw check
-    bool full = true;
-    for (char c : state)
-    {
-        if (c == '0') { full = false; break; }
-    }
-    if (full) return 0;
-
-    // Recurrence: maximize for AI, minimize for human
-    bool maximizing = (turnChar == '2');
-    int best = maximizing ? -100000 : 100000;
-
-    for (int i = 0; i < 9; ++i)
-    {
-        if (state[i] != '0')
-            continue;
-
-        std::string next = state;
-        next[i] = turnChar;
-
-        char nextTurn = (turnChar == '1') ? '2' : '1';
-        int score = negamax(next, nextTurn, depth + 1);
-
-        if (maximizing)
-            best = (score > best) ? score : best;
-        else
-            best = (score < best) ? score : best;
-    }
-
-    return best;
-}
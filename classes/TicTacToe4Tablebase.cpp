@@ -0,0 +1,232 @@
+#include "TicTacToe4Tablebase.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <thread>
+
+// the ten ways to get four in a row: rows, columns and the two diagonals
+static const uint16_t kLines[10] = { 0x000F, 0x00F0, 0x0F00, 0xF000, 0x1111, 0x2222, 0x4444, 0x8888, 0x8421, 0x1248 };
+
+//
+// 3^cell, and the base 3 value of each half of a mask with a one in every
+// set cell, so an index is four table lookups
+//
+static constexpr std::array<uint32_t, 16> buildPow3()
+{
+    std::array<uint32_t, 16> pow3{};
+    uint32_t p = 1;
+    for (uint32_t &v : pow3)
+    {
+        v = p;
+        p *= 3;
+    }
+    return pow3;
+}
+
+static constexpr std::array<uint32_t, 16> kPow3 = buildPow3();
+
+static constexpr std::array<uint32_t, 256> buildTrits(int shift)
+{
+    std::array<uint32_t, 256> trits{};
+    for (int mask = 0; mask < 256; ++mask)
+    {
+        for (int bit = 0; bit < 8; ++bit)
+        {
+            if (mask & (1 << bit))
+                trits[mask] += kPow3[bit + shift];
+        }
+    }
+    return trits;
+}
+
+static constexpr std::array<uint32_t, 256> kLowTrits = buildTrits(0);
+static constexpr std::array<uint32_t, 256> kHighTrits = buildTrits(8);
+
+uint32_t TicTacToe4Tablebase::index(uint16_t x, uint16_t o)
+{
+    return kLowTrits[x & 0xFF] + kHighTrits[x >> 8] + 2 * (kLowTrits[o & 0xFF] + kHighTrits[o >> 8]);
+}
+
+bool TicTacToe4Tablebase::hasLine(uint16_t mask)
+{
+    for (uint16_t line : kLines)
+    {
+        if ((mask & line) == line)
+            return true;
+    }
+    return false;
+}
+
+bool TicTacToe4Tablebase::isReachable(uint16_t x, uint16_t o)
+{
+    const int xCount = std::popcount(x);
+    const int oCount = std::popcount(o);
+    if ((x & o) || (xCount != oCount && xCount != oCount + 1))
+        return false;
+    const bool xToMove = xCount == oCount;
+    return !hasLine(xToMove ? x : o);
+}
+
+//
+// the code of one position from the codes of the layer after it
+//
+static uint8_t solvePosition(const std::vector<uint8_t> &codes, uint16_t x, uint16_t o)
+{
+    const bool xToMove = std::popcount(x) == std::popcount(o);
+    const uint16_t mover = xToMove ? x : o;
+    const uint16_t last = xToMove ? o : x;
+    // a line for the side to move can't happen; left as 0 and never probed
+    if (TicTacToe4Tablebase::hasLine(mover))
+        return 0;
+    // lost on the spot
+    if (TicTacToe4Tablebase::hasLine(last))
+        return 1;
+
+    const uint32_t index = TicTacToe4Tablebase::index(x, o);
+    const uint32_t stone = xToMove ? 1 : 2;
+    int bestWin = 99;
+    int worstLoss = -1;
+    bool draw = false;
+    for (uint16_t empty = static_cast<uint16_t>(~(x | o)); empty; empty &= empty - 1)
+    {
+        const int reply = codes[index + stone * kPow3[std::countr_zero(empty)]];
+        if (reply == 0)
+            draw = true;
+        else if ((reply - 1) % 2 == 0)
+            bestWin = std::min(bestWin, reply);     // they lose, reply - 1 plies from there
+        else
+            worstLoss = std::max(worstLoss, reply);
+    }
+    // one more ply than the reply's distance is one more than its code
+    if (bestWin != 99)
+        return static_cast<uint8_t>(bestWin + 1);
+    if (draw)
+        return 0;
+    return static_cast<uint8_t>(worstLoss + 1);
+}
+
+bool TicTacToe4Tablebase::generate(unsigned threads, const std::atomic<bool> *stop)
+{
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+
+    // a byte a position while solving, so threads never share a byte
+    std::vector<uint8_t> codes(kPositions, 0);
+    for (int stones = kCells; stones >= 0; --stones)
+    {
+        const int xCount = (stones + 1) / 2;
+        const int oCount = stones / 2;
+        // the X masks are handed out one at a time, every O mask for one goes with it
+        std::atomic<uint32_t> nextX(0);
+        auto work = [&]() {
+            for (uint32_t x = nextX++; x < 0x10000; x = nextX++)
+            {
+                if (stop && stop->load(std::memory_order_relaxed))
+                    return;
+                if (std::popcount(x) != xCount)
+                    continue;
+                const uint16_t free = static_cast<uint16_t>(~x);
+                for (uint32_t o = free;; o = (o - 1) & free)
+                {
+                    if (std::popcount(o) == oCount)
+                        codes[index(static_cast<uint16_t>(x), static_cast<uint16_t>(o))] =
+                            solvePosition(codes, static_cast<uint16_t>(x), static_cast<uint16_t>(o));
+                    if (o == 0)
+                        break;
+                }
+            }
+        };
+        std::vector<std::thread> pool;
+        for (unsigned t = 1; t < threads; ++t)
+            pool.emplace_back(work);
+        work();
+        for (std::thread &thread : pool)
+            thread.join();
+        if (stop && *stop)
+            return false;
+    }
+
+    _file.close();
+    _table.assign((kPositions + 1) / 2, 0);
+    for (uint32_t i = 0; i < kPositions; ++i)
+        _table[i >> 1] |= static_cast<uint8_t>(codes[i] << ((i & 1) * 4));
+    return true;
+}
+
+bool TicTacToe4Tablebase::save(const std::string &path, uint32_t blockSize, bool compress) const
+{
+    if (_table.empty())
+        return false;
+    std::string error;
+    return TablebaseFormat::write(path, kMagic, kVersion, _table.data(), _table.size(), blockSize, compress, error);
+}
+
+bool TicTacToe4Tablebase::load(const std::string &path, std::string &error)
+{
+    if (!_file.open(path, error))
+        return false;
+    if (_file.tag() != kMagic)
+    {
+        _file.close();
+        error = "not a 4x4 tablebase";
+        return false;
+    }
+    if (_file.tagVersion() != kVersion || _file.tableSize() != bytes())
+    {
+        _file.close();
+        error = "unsupported tablebase version";
+        return false;
+    }
+    _table.clear();
+    _table.shrink_to_fit();
+    return true;
+}
+
+int TicTacToe4Tablebase::code(uint32_t index) const
+{
+    const int packed = _table.empty() ? _file.byteAt(index >> 1) : _table[index >> 1];
+    return packed < 0 ? -1 : (packed >> ((index & 1) * 4)) & 0xF;
+}
+
+bool TicTacToe4Tablebase::probe(uint16_t x, uint16_t o, Probe &result) const
+{
+    if (!isReady() || !isReachable(x, o))
+        return false;
+    const int c = code(index(x, o));
+    if (c < 0)
+        return false;
+    if (c == 0)
+    {
+        result.value = 0;
+        result.plies = static_cast<int8_t>(kCells - std::popcount(static_cast<uint16_t>(x | o)));
+    }
+    else
+    {
+        result.plies = static_cast<int8_t>(c - 1);
+        result.value = static_cast<int8_t>((c - 1) % 2 ? 1 : -1);
+    }
+    return true;
+}
+
+int TicTacToe4Tablebase::bestMove(uint16_t x, uint16_t o) const
+{
+    Probe here;
+    if (!probe(x, o, here) || here.plies == 0)
+        return -1;
+
+    const bool xToMove = std::popcount(x) == std::popcount(o);
+    // the move that keeps the value and the distance, one ply shorter and from the other side
+    for (int cell = 0; cell < kCells; ++cell)
+    {
+        const uint16_t bit = static_cast<uint16_t>(1 << cell);
+        if ((x | o) & bit)
+            continue;
+        Probe reply;
+        if (probe(xToMove ? x | bit : x, xToMove ? o : o | bit, reply) && reply.value == -here.value &&
+            reply.plies == here.plies - 1)
+            return cell;
+    }
+    return -1;
+}
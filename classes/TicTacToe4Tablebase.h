@@ -0,0 +1,87 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "TablebaseFile.h"
+
+//
+// tablebase for 4x4 tic tac toe, four in a row to win, solved by retrograde analysis
+//
+// positions are indexed the way TicTacToeSolver does it: the base 3
+// encoding of the 16 cells, left-to-right, top-to-bottom, 0 empty, 1 X,
+// 2 O, which gives 3^16 = 43,046,721 indices. a board is two 16-bit masks,
+// X moves first.
+//
+// every index gets 4 bits: 0 for a draw (and for the unreachable
+// encodings, which are never probed), otherwise 1 + the number of plies
+// to the end of the game with perfect play. whoever wins makes the last
+// move, so an odd distance is a win for the side to move and an even one
+// a loss; a drawn game always ends with the board full, so its distance
+// is the number of empty cells. at two positions a byte the whole table
+// is 21.5 MB.
+//
+// generate() solves the positions one layer of stone counts at a time,
+// from the full board back to the empty one: every position in a layer
+// only depends on the layer after it, so a layer is split over the
+// threads with no locking at all. it checks the stop flag it's given
+// between X masks and gives up, keeping no part of the new table, as soon
+// as the flag goes up.
+//
+// the file is a TablebaseFormat file tagged 'TTB4' holding the packed
+// table. load() maps it rather than reading it in, so the game starts
+// probing straight away and every process on the machine shares the pages;
+// most of the table is draws and unreachable encodings, which run length
+// coding shrinks well, and those blocks go through the reader's cache.
+// a freshly generated table is probed from memory.
+//
+class TicTacToe4Tablebase
+{
+public:
+    static const int kCells = 16;
+    static const uint32_t kPositions = 43046721;     // 3^16
+    static const uint32_t kMagic = 0x34425454;       // "TTB4"
+    static const uint32_t kVersion = 2;
+
+    struct Probe
+    {
+        int8_t  value;          // for the side to move: 1 win, 0 draw, -1 loss
+        int8_t  plies;          // moves left until the game ends with perfect play
+    };
+
+    // solve every position, "threads" 0 is one per hardware thread; false
+    // if "stop" was raised first, the table is left as it was
+    bool        generate(unsigned threads = 0, const std::atomic<bool> *stop = nullptr);
+    bool        save(const std::string &path, uint32_t blockSize = TablebaseFormat::kDefaultBlockSize,
+                     bool compress = true) const;
+    // false with a reason if the file isn't a tablebase of this version; a
+    // damaged block only shows up when it's probed
+    bool        load(const std::string &path, std::string &error);
+    bool        isReady() const { return !_table.empty() || _file.isOpen(); }
+    // the size of the packed table, wherever it's probed from
+    size_t      bytes() const { return (kPositions + 1) / 2; }
+    // the loaded file, for its size and cache counts
+    const TablebaseReader &file() const { return _file; }
+
+    // the value of a position in O(1), false for a board that can't come up
+    // in a game or whose block of the file is damaged
+    bool        probe(uint16_t x, uint16_t o, Probe &result) const;
+    // the quickest win, else a draw, else the slowest loss; ties go to the
+    // lowest cell. -1 when the game is over or the board is unreachable
+    int         bestMove(uint16_t x, uint16_t o) const;
+
+    static uint32_t index(uint16_t x, uint16_t o);
+    static bool hasLine(uint16_t mask);
+    // X moves first, so X has as many stones as O or one more, and only the
+    // player who just moved can have four in a row
+    static bool isReachable(uint16_t x, uint16_t o);
+
+private:
+    // -1 if the file can't be read there
+    int         code(uint32_t index) const;
+
+    std::vector<uint8_t>    _table;     // two positions a byte, the even index in the low half
+    TablebaseReader         _file;      // or the same bytes, mapped
+};
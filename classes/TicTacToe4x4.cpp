@@ -0,0 +1,242 @@
+#include "TicTacToe4x4.h"
+
+#include <bit>
+
+const char *TicTacToe4x4::kTablebasePath = "tictactoe4.tb";
+
+// the table answers at once
+static const std::chrono::milliseconds kThinkTime(1000);
+// generating it the first time is left to finish, only stopGame() stops it
+static const std::chrono::milliseconds kGenerateTime(std::chrono::hours(1));
+
+TicTacToe4x4::TicTacToe4x4() : _stones{ 0, 0 }
+{
+}
+
+TicTacToe4x4::~TicTacToe4x4()
+{
+    _ai.cancel();
+}
+
+Bit* TicTacToe4x4::PieceForPlayer(const int playerNumber)
+{
+    Bit *bit = new Bit();
+    bit->LoadTextureFromFile(playerNumber == 0 ? "x.png" : "o.png");
+    bit->setOwner(getPlayerAt(playerNumber));
+    return bit;
+}
+
+//
+// setup the game board, this is called once at the start of the game
+//
+void TicTacToe4x4::setUpBoard()
+{
+    setNumberOfPlayers(2);
+    setAIPlayer(1);
+
+    _gameOptions.rowX = kSize;
+    _gameOptions.rowY = kSize;
+
+    // the sprites are 100x100
+    for (int row = 0; row < kSize; ++row)
+    {
+        for (int col = 0; col < kSize; ++col)
+        {
+            ImVec2 pos(col * 100.0f, row * 100.0f);
+            _grid[row][col].initHolder(pos, "square.png", col, row);
+            _grid[row][col].setGameTag(row * kSize + col);
+        }
+    }
+    _stones[0] = _stones[1] = 0;
+
+    if (!_tablebase.isReady())
+    {
+        std::string error;
+        _tablebaseStatus = _tablebase.load(kTablebasePath, error) ? "loaded" : error;
+    }
+
+    startGame();
+}
+
+bool TicTacToe4x4::gameOver() const
+{
+    return TicTacToe4Tablebase::hasLine(_stones[0]) || TicTacToe4Tablebase::hasLine(_stones[1]) ||
+           (_stones[0] | _stones[1]) == 0xFFFF;
+}
+
+bool TicTacToe4x4::actionForEmptyHolder(BitHolder *holder)
+{
+    if (!holder)
+        return false;
+    return placeStone(holder->gameTag());
+}
+
+bool TicTacToe4x4::placeStone(int cell)
+{
+    const uint16_t bit = static_cast<uint16_t>(1 << cell);
+    if (cell < 0 || cell >= kSize * kSize || ((_stones[0] | _stones[1]) & bit) || gameOver())
+        return false;
+
+    // X moves when the stone counts are level
+    const int player = std::popcount(_stones[0]) > std::popcount(_stones[1]) ? 1 : 0;
+    Square &square = _grid[cell / kSize][cell % kSize];
+    Bit *placeBit = PieceForPlayer(player);
+    placeBit->setPosition(square.getPosition());
+    square.setBit(placeBit);
+    _stones[player] |= bit;
+    _lastMoveCode = cell;
+    return true;
+}
+
+bool TicTacToe4x4::canBitMoveFrom(Bit *bit, BitHolder *src)
+{
+    // stones stay where they're put
+    return false;
+}
+
+bool TicTacToe4x4::canBitMoveFromTo(Bit* bit, BitHolder*src, BitHolder*dst)
+{
+    return false;
+}
+
+//
+// free all the memory used by the game on the heap
+//
+void TicTacToe4x4::stopGame()
+{
+    // a search for the old board is no use any more
+    _ai.cancel();
+    for (int row = 0; row < kSize; ++row)
+    {
+        for (int col = 0; col < kSize; ++col)
+        {
+            _grid[row][col].destroyBit();
+        }
+    }
+    _stones[0] = _stones[1] = 0;
+}
+
+Player* TicTacToe4x4::checkForWinner()
+{
+    for (int player = 0; player < 2; ++player)
+    {
+        if (TicTacToe4Tablebase::hasLine(_stones[player]))
+            return getPlayerAt(player);
+    }
+    return nullptr;
+}
+
+bool TicTacToe4x4::checkForDraw()
+{
+    return gameOver() && !checkForWinner();
+}
+
+//
+// state strings
+//
+std::string TicTacToe4x4::initialStateString()
+{
+    return std::string(kSize * kSize, '0');
+}
+
+std::string TicTacToe4x4::stateString() const
+{
+    std::string state(kSize * kSize, '0');
+    for (int cell = 0; cell < kSize * kSize; ++cell)
+    {
+        if (_stones[0] & (1 << cell))
+            state[cell] = '1';
+        else if (_stones[1] & (1 << cell))
+            state[cell] = '2';
+    }
+    return state;
+}
+
+void TicTacToe4x4::setStateString(const std::string &s)
+{
+    if (s.size() != kSize * kSize)
+        return;
+    uint16_t stones[2] = { 0, 0 };
+    for (int cell = 0; cell < kSize * kSize; ++cell)
+    {
+        if (s[cell] == '1')
+            stones[0] |= static_cast<uint16_t>(1 << cell);
+        else if (s[cell] == '2')
+            stones[1] |= static_cast<uint16_t>(1 << cell);
+    }
+    // a finished game is fine too, as long as only the player who moved last has a line
+    const int counts[2] = { std::popcount(stones[0]), std::popcount(stones[1]) };
+    if (counts[0] != counts[1] && counts[0] != counts[1] + 1)
+        return;
+    if (TicTacToe4Tablebase::hasLine(stones[counts[0] == counts[1] ? 0 : 1]))
+        return;
+
+    stopGame();
+    for (int cell = 0; cell < kSize * kSize; ++cell)
+    {
+        const int player = (stones[0] & (1 << cell)) ? 0 : (stones[1] & (1 << cell)) ? 1 : -1;
+        if (player < 0)
+            continue;
+        Square &square = _grid[cell / kSize][cell % kSize];
+        Bit *placeBit = PieceForPlayer(player);
+        placeBit->setPosition(square.getPosition());
+        square.setBit(placeBit);
+    }
+    _stones[0] = stones[0];
+    _stones[1] = stones[1];
+
+    _gameOptions.currentTurnNo = static_cast<unsigned int>(counts[0] + counts[1]);
+}
+
+//
+// called every frame while it's the AI's turn: the first call starts the
+// job on the worker thread, later calls play the move once it's ready
+//
+void TicTacToe4x4::updateAI()
+{
+    if (gameOver())
+        return;
+
+    if (!_ai.busy())
+    {
+        const uint16_t x = _stones[0];
+        const uint16_t o = _stones[1];
+        TicTacToe4Tablebase *tablebase = &_tablebase;
+        std::string *status = &_tablebaseStatus;
+        _ai.start([tablebase, status, x, o](const std::atomic<bool> &stop) {
+            if (!tablebase->isReady())
+            {
+                // cancelled part way, nothing is kept or written
+                if (!tablebase->generate(0, &stop))
+                    return -1;
+                *status = tablebase->save(kTablebasePath) ? "generated" : "generated, not saved";
+            }
+            return tablebase->bestMove(x, o);
+        }, _tablebase.isReady() ? kThinkTime : kGenerateTime);
+        return;
+    }
+
+    int cell;
+    if (_ai.poll(cell) && placeStone(cell))
+        endTurn();
+}
+
+void TicTacToe4x4::drawSettings()
+{
+    // the worker is joined once the move is played, so the table is safe to look at
+    if (_ai.busy())
+        return;
+    ImGui::Text("Tablebase: %s", _tablebaseStatus.c_str());
+    const TablebaseReader &file = _tablebase.file();
+    if (file.isOpen())
+    {
+        ImGui::Text("Mapped %.1f MB, block cache %llu hits, %llu misses", file.fileSize() / 1048576.0,
+                    (unsigned long long)file.cacheHits(), (unsigned long long)file.cacheMisses());
+    }
+    TicTacToe4Tablebase::Probe probe;
+    if (_tablebase.probe(_stones[0], _stones[1], probe))
+    {
+        static const char *kValues[] = { "loses", "draws", "wins" };
+        ImGui::Text("Side to move %s, %d plies left with perfect play", kValues[probe.value + 1], probe.plies);
+    }
+}
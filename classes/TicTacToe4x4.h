@@ -0,0 +1,57 @@
+#pragma once
+#include "Game.h"
+#include "Square.h"
+#include "AIWorker.h"
+#include "TicTacToe4Tablebase.h"
+
+//
+// tic tac toe on a 4x4 board, four in a row to win
+//
+// X (the human) moves first by clicking an empty cell. the AI plays O
+// perfectly by probing TicTacToe4Tablebase: the quickest win, else a draw,
+// else the slowest loss. the table is mapped from kTablebasePath, so
+// several copies of the demo share it; if it isn't there it's generated on
+// the AI's first move and saved for next time.
+//
+// the state string is 16 characters, the cells left-to-right,
+// top-to-bottom ('0' empty, '1' X, '2' O).
+//
+class TicTacToe4x4 : public Game
+{
+public:
+    static const int kSize = 4;
+    static const char *kTablebasePath;
+
+    TicTacToe4x4();
+    ~TicTacToe4x4();
+
+    // set up the board
+    void        setUpBoard() override;
+
+    Player*     checkForWinner() override;
+    bool        checkForDraw() override;
+    std::string initialStateString() override;
+    std::string stateString() const override;
+    void        setStateString(const std::string &s) override;
+    bool        actionForEmptyHolder(BitHolder *holder) override;
+    bool        canBitMoveFrom(Bit*bit, BitHolder *src) override;
+    bool        canBitMoveFromTo(Bit* bit, BitHolder*src, BitHolder*dst) override;
+    void        stopGame() override;
+
+    void        updateAI() override;
+    bool        gameHasAI() override { return true; }
+    void        drawSettings() override;
+    BitHolder &getHolderAt(const int x, const int y) override { return _grid[y][x]; }
+
+private:
+    Bit *       PieceForPlayer(const int playerNumber);
+    // a stone for the side to move, false if the cell is taken or the game is over
+    bool        placeStone(int cell);
+    bool        gameOver() const;
+
+    Square                  _grid[kSize][kSize];
+    uint16_t                _stones[2];
+    AIWorker                _ai;
+    TicTacToe4Tablebase     _tablebase;
+    std::string             _tablebaseStatus;
+};
@@ -0,0 +1,128 @@
+#include "TicTacToeSolver.h"
+
+#include <bit>
+
+const uint16_t TicTacToeSolver::kWinMasks[8] = {
+    0x007, 0x038, 0x1C0,        // rows
+    0x049, 0x092, 0x124,        // columns
+    0x111, 0x054                // diagonals
+};
+
+static const int kPow3[9] = { 1, 3, 9, 27, 81, 243, 729, 2187, 6561 };
+
+int TicTacToeSolver::encodingIndex(const char *state)
+{
+    int index = 0;
+    for (int i = 0; i < kCells; ++i)
+    {
+        const unsigned digit = static_cast<unsigned>(state[i] - '0');
+        if (digit > 2)
+            return -1;
+        index += static_cast<int>(digit) * kPow3[i];
+    }
+    return index;
+}
+
+//
+// solve every encoding: first decode it into masks and check it could
+// really come up in a game, then run a memoized negamax from it
+//
+TicTacToeSolver::TicTacToeSolver() : _table(kEncodings), _solved(kEncodings, false)
+{
+    for (int index = 0; index < kEncodings; ++index)
+    {
+        uint16_t x = 0;
+        uint16_t o = 0;
+        int rest = index;
+        for (int cell = 0; cell < kCells; ++cell, rest /= 3)
+        {
+            if (rest % 3 == 1) x |= 1 << cell;
+            if (rest % 3 == 2) o |= 1 << cell;
+        }
+        solve(index, x, o);
+    }
+}
+
+const TicTacToeSolver::Analysis &TicTacToeSolver::solve(int index, uint16_t x, uint16_t o)
+{
+    Analysis &a = _table[index];
+    if (_solved[index])
+        return a;
+    _solved[index] = true;
+
+    const int xCount = std::popcount(x);
+    const int oCount = std::popcount(o);
+    const bool xWins = hasWin(x);
+    const bool oWins = hasWin(o);
+    const bool player2ToMove = (xCount == oCount + 1);
+
+    a.bestMove = -1;
+    a.value = 0;
+    a.plies = 0;
+    a.flags = 0;
+
+    // X moves first, so X has as many or one more piece, and only the player
+    // who just moved can have three in a row
+    if (!(xCount == oCount || player2ToMove) || (xWins && oWins) ||
+        (xWins && !player2ToMove) || (oWins && player2ToMove))
+        return a;
+
+    a.flags = kValid | (player2ToMove ? kPlayer2ToMove : 0);
+    if (xWins || oWins)
+    {
+        a.flags |= kTerminal;
+        a.value = -1;
+        return a;
+    }
+    if ((x | o) == 0x1FF)
+    {
+        a.flags |= kTerminal;
+        return a;
+    }
+
+    // prefer the quickest win, then a draw, then the slowest loss; ties go to the lowest cell
+    int bestScore = -100;
+    for (int cell = 0; cell < kCells; ++cell)
+    {
+        const uint16_t bit = static_cast<uint16_t>(1 << cell);
+        if ((x | o) & bit)
+            continue;
+
+        const int child = index + kPow3[cell] * (player2ToMove ? 2 : 1);
+        const Analysis &reply = player2ToMove ? solve(child, x, o | bit) : solve(child, x | bit, o);
+        const int value = -reply.value;
+        const int plies = reply.plies + 1;
+        const int score = value > 0 ? 20 - plies : value < 0 ? -20 + plies : 0;
+        if (score > bestScore)
+        {
+            bestScore = score;
+            a.bestMove = static_cast<int8_t>(cell);
+            a.value = static_cast<int8_t>(value);
+            a.plies = static_cast<int8_t>(plies);
+        }
+    }
+    return a;
+}
+
+int TicTacToeSolver::negamax(uint16_t me, uint16_t them, int depth, uint64_t &nodes)
+{
+    ++nodes;
+    // only the player who just moved can have completed a line
+    if (hasWin(them))
+        return -(10 - depth);
+
+    uint16_t empty = emptyCells(me, them);
+    if (!empty)
+        return 0;
+
+    int best = -100000;
+    while (empty)
+    {
+        const uint16_t bit = empty & static_cast<uint16_t>(-empty);
+        empty ^= bit;
+        const int score = -negamax(them, me | bit, depth + 1, nodes);
+        if (score > best)
+            best = score;
+    }
+    return best;
+}
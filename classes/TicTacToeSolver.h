@@ -0,0 +1,73 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+//
+// headless perfect-play solver for 3x3 tic tac toe
+//
+// boards use the same encoding as TicTacToe::stateString(): 9 characters,
+// left-to-right, top-to-bottom, '0' empty, '1' player 1 (X), '2' player 2 (O).
+// internally a board is two 9-bit masks, one per player.
+//
+// there are only 3^9 = 19683 encodings, so every one is solved once up front
+// and analyzing a position afterwards is a table lookup.
+//
+
+class TicTacToeSolver
+{
+public:
+    static const int kCells = 9;
+    static const int kEncodings = 19683;        // 3^9
+    static const uint16_t kWinMasks[8];
+
+    struct Analysis
+    {
+        int8_t  bestMove;       // cell 0..8, -1 if the game is over
+        int8_t  value;          // for the side to move: 1 win, 0 draw, -1 loss
+        int8_t  plies;          // moves left until the game ends with perfect play
+        uint8_t flags;          // kValid, kTerminal, kPlayer2ToMove
+    };
+    enum
+    {
+        kValid = 1,             // reachable piece counts, at most one winner
+        kTerminal = 2,
+        kPlayer2ToMove = 4
+    };
+
+    TicTacToeSolver();
+
+    // base 3 encoding index of a 9 character state, -1 if malformed
+    static int  encodingIndex(const char *state);
+
+    // look up a solved encoding / state string
+    const Analysis &analysis(int index) const { return _table[index]; }
+    const Analysis *analyze(const char *state) const
+    {
+        const int index = encodingIndex(state);
+        return index < 0 ? nullptr : &_table[index];
+    }
+
+    static bool hasWin(uint16_t mask)
+    {
+        for (uint16_t w : kWinMasks)
+            if ((mask & w) == w)
+                return true;
+        return false;
+    }
+
+    // cells nobody has played in yet
+    static uint16_t emptyCells(uint16_t x, uint16_t o) { return static_cast<uint16_t>(~(x | o) & 0x1FF); }
+
+    // plain negamax over the whole remaining tree (no pruning, no table), the
+    // search TicTacToe::updateAI runs. scores are for the side to move (me):
+    // a win found at depth d is worth 10 - d, a loss -(10 - d), a draw 0.
+    // nodes counts every position visited.
+    static int  negamax(uint16_t me, uint16_t them, int depth, uint64_t &nodes);
+
+private:
+    const Analysis &solve(int index, uint16_t x, uint16_t o);
+
+    std::vector<Analysis>   _table;
+    std::vector<bool>       _solved;
+};
@@ -0,0 +1,251 @@
+#include "UltimateMCTS.h"
+
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cmath>
+
+//
+// every 9-bit mask with three in a row, worked out at compile time
+//
+static constexpr std::array<bool, 512> buildLineTable()
+{
+    constexpr uint16_t kLines[8] = { 0007, 0070, 0700, 0111, 0222, 0444, 0421, 0124 };
+    std::array<bool, 512> table{};
+    for (int mask = 0; mask < 512; ++mask)
+    {
+        for (uint16_t line : kLines)
+        {
+            if ((mask & line) == line)
+                table[mask] = true;
+        }
+    }
+    return table;
+}
+
+const std::array<bool, 512> UltimatePosition::kLineTable = buildLineTable();
+
+UltimatePosition::UltimatePosition() : _won{ 0, 0 }, _closed(0), _forced(kAnyBoard), _side(0)
+{
+    for (int board = 0; board < kBoards; ++board)
+        _cells[0][board] = _cells[1][board] = 0;
+}
+
+UltimatePosition::UltimatePosition(const uint16_t cells[2][kBoards], int forcedBoard, int sideToMove) :
+    _won{ 0, 0 }, _closed(0), _forced(static_cast<int8_t>(forcedBoard)), _side(static_cast<int8_t>(sideToMove))
+{
+    for (int board = 0; board < kBoards; ++board)
+    {
+        for (int player = 0; player < 2; ++player)
+        {
+            _cells[player][board] = cells[player][board] & 0x1FF;
+            if (isLine(_cells[player][board]))
+                _won[player] |= static_cast<uint16_t>(1 << board);
+        }
+        if (((_won[0] | _won[1]) & (1 << board)) || emptyCells(board) == 0)
+            _closed |= static_cast<uint16_t>(1 << board);
+    }
+    if (_forced != kAnyBoard && (_closed & (1 << _forced)))
+        _forced = kAnyBoard;
+}
+
+uint16_t UltimatePosition::playableBoards() const
+{
+    if (gameOver())
+        return 0;
+    if (_forced != kAnyBoard)
+        return static_cast<uint16_t>(1 << _forced);
+    return static_cast<uint16_t>(~_closed & 0x1FF);
+}
+
+bool UltimatePosition::isLegal(int move) const
+{
+    if (move < 0 || move >= kMoves)
+        return false;
+    const int board = move / 9;
+    return (playableBoards() & (1 << board)) && (emptyCells(board) & (1 << (move % 9)));
+}
+
+int UltimatePosition::legalMoves(uint8_t *moves) const
+{
+    int count = 0;
+    uint16_t boards = playableBoards();
+    while (boards)
+    {
+        const int board = std::countr_zero(boards);
+        boards &= boards - 1;
+        uint16_t empty = emptyCells(board);
+        while (empty)
+        {
+            moves[count++] = static_cast<uint8_t>(board * 9 + std::countr_zero(empty));
+            empty &= empty - 1;
+        }
+    }
+    return count;
+}
+
+void UltimatePosition::play(int move)
+{
+    const int board = move / 9;
+    const int cell = move % 9;
+    uint16_t &mine = _cells[_side][board];
+    mine |= static_cast<uint16_t>(1 << cell);
+    if (isLine(mine))
+    {
+        _won[_side] |= static_cast<uint16_t>(1 << board);
+        _closed |= static_cast<uint16_t>(1 << board);
+    }
+    else if (emptyCells(board) == 0)
+        _closed |= static_cast<uint16_t>(1 << board);
+
+    _forced = static_cast<int8_t>((_closed & (1 << cell)) ? kAnyBoard : cell);
+    _side ^= 1;
+}
+
+//
+// the search
+//
+UltimateMCTS::UltimateMCTS(size_t maxNodes) : _nodes(maxNodes), _used(0), _rng(0x9E3779B97F4A7C15ull), _playouts(0),
+    _seconds(0), _winRate(0)
+{
+}
+
+uint64_t UltimateMCTS::random()
+{
+    // xorshift64*
+    _rng ^= _rng >> 12;
+    _rng ^= _rng << 25;
+    _rng ^= _rng >> 27;
+    return _rng * 0x2545F4914F6CDD1Dull;
+}
+
+int UltimateMCTS::rollout(UltimatePosition position)
+{
+    while (!position.gameOver())
+    {
+        const uint16_t boards = position.playableBoards();
+        int total = 0;
+        for (uint16_t b = boards; b; b &= b - 1)
+            total += std::popcount(position.emptyCells(std::countr_zero(b)));
+
+        // skip "pick" empty cells across the playable boards
+        int pick = static_cast<int>(((random() >> 32) * static_cast<uint64_t>(total)) >> 32);
+        for (uint16_t b = boards; b; b &= b - 1)
+        {
+            const int board = std::countr_zero(b);
+            uint16_t empty = position.emptyCells(board);
+            const int count = std::popcount(empty);
+            if (pick >= count)
+            {
+                pick -= count;
+                continue;
+            }
+            while (pick-- > 0)
+                empty &= empty - 1;
+            position.play(board * 9 + std::countr_zero(empty));
+            break;
+        }
+    }
+    return position.winner();
+}
+
+bool UltimateMCTS::expand(uint32_t index, const UltimatePosition &position)
+{
+    uint8_t moves[UltimatePosition::kMoves];
+    const int count = position.legalMoves(moves);
+    if (count == 0 || _used + count > _nodes.size())
+        return false;
+
+    Node &node = _nodes[index];
+    node.firstChild = static_cast<uint32_t>(_used);
+    node.childCount = static_cast<uint8_t>(count);
+    node.expanded = 1;
+    for (int i = 0; i < count; ++i)
+    {
+        Node &child = _nodes[_used++];
+        child = Node{ 0, 0, 0.0f, 0, moves[i], static_cast<uint8_t>(position.sideToMove()), 0 };
+    }
+    return true;
+}
+
+uint32_t UltimateMCTS::select(const Node &node) const
+{
+    // UCT with the usual exploration constant of sqrt(2)
+    const float logVisits = std::log(static_cast<float>(node.visits));
+    uint32_t best = node.firstChild;
+    float bestValue = -1.0f;
+    for (uint32_t i = node.firstChild; i < node.firstChild + node.childCount; ++i)
+    {
+        const Node &child = _nodes[i];
+        if (child.visits == 0)
+            return i;
+        const float value = child.score / child.visits + 1.41421356f * std::sqrt(logVisits / child.visits);
+        if (value > bestValue)
+        {
+            bestValue = value;
+            best = i;
+        }
+    }
+    return best;
+}
+
+int UltimateMCTS::bestMove(const UltimatePosition &position, int playouts, const std::atomic<bool> *stop)
+{
+    const auto start = std::chrono::steady_clock::now();
+    _playouts = 0;
+    _winRate = 0;
+    if (position.gameOver())
+    {
+        _seconds = 0;
+        return -1;
+    }
+
+    // reset the arena to just the root
+    _used = 1;
+    _nodes[0] = Node{ 0, 0, 0.0f, 0, 0, static_cast<uint8_t>(position.sideToMove() ^ 1), 0 };
+    expand(0, position);
+
+    uint32_t path[UltimatePosition::kMoves + 1];
+    for (; _playouts < playouts; ++_playouts)
+    {
+        if ((_playouts & 255) == 0 && stop && stop->load(std::memory_order_relaxed))
+            break;
+
+        UltimatePosition current = position;
+        int depth = 0;
+        uint32_t index = 0;
+        path[depth++] = index;
+        while (_nodes[index].expanded)
+        {
+            index = select(_nodes[index]);
+            current.play(_nodes[index].move);
+            path[depth++] = index;
+        }
+        // a leaf that's been played out once before gets its children
+        if (_nodes[index].visits > 0 && !current.gameOver() && expand(index, current))
+        {
+            index = _nodes[index].firstChild;
+            current.play(_nodes[index].move);
+            path[depth++] = index;
+        }
+
+        const int winner = rollout(current);
+        for (int i = 0; i < depth; ++i)
+        {
+            Node &node = _nodes[path[i]];
+            ++node.visits;
+            node.score += winner < 0 ? 0.5f : winner == node.mover ? 1.0f : 0.0f;
+        }
+    }
+
+    const Node &root = _nodes[0];
+    uint32_t best = root.firstChild;
+    for (uint32_t i = root.firstChild; i < root.firstChild + root.childCount; ++i)
+    {
+        if (_nodes[i].visits > _nodes[best].visits)
+            best = i;
+    }
+    _seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    _winRate = _nodes[best].visits ? _nodes[best].score / _nodes[best].visits : 0.0;
+    return _nodes[best].move;
+}
@@ -0,0 +1,124 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+//
+// headless ultimate tic-tac-toe position
+//
+// nine 3x3 sub-boards, each a 9-bit mask per player with the same cell
+// numbering as TicTacToe (0..8, left-to-right, top-to-bottom), and a 9-bit
+// meta-board per player of the sub-boards they've won. a move is
+// board * 9 + cell. the cell a move is played in picks the sub-board the
+// opponent has to play in next; if that one is won or full they may play in
+// any open sub-board. three sub-boards in a line wins, a game with every
+// sub-board closed and no line is a draw.
+//
+class UltimatePosition
+{
+public:
+    static const int kBoards = 9;
+    static const int kMoves = kBoards * 9;
+    static const int kAnyBoard = -1;
+    // for MonteCarloTreeSearch
+    typedef uint8_t Move;
+    static const int kMaxMoves = kMoves;
+
+    UltimatePosition();
+    // from the cells of each player, the board the side to move has to play
+    // in (kAnyBoard for free choice) and the side to move
+    UltimatePosition(const uint16_t cells[2][kBoards], int forcedBoard, int sideToMove);
+
+    int         sideToMove() const { return _side; }
+    int         forcedBoard() const { return _forced; }
+    uint16_t    cells(int player, int board) const { return _cells[player][board]; }
+    uint16_t    wonBoards(int player) const { return _won[player]; }
+    // boards nobody can play in any more, won or full
+    uint16_t    closedBoards() const { return _closed; }
+
+    // the sub-boards the side to move may play in, as a 9-bit mask
+    uint16_t    playableBoards() const;
+    uint16_t    emptyCells(int board) const { return static_cast<uint16_t>(~(_cells[0][board] | _cells[1][board]) & 0x1FF); }
+    bool        isLegal(int move) const;
+    // every legal move, returns how many
+    int         legalMoves(uint8_t *moves) const;
+    void        play(int move);
+
+    // the player with three sub-boards in a line, -1 if nobody has
+    int         winner() const { return isLine(_won[0]) ? 0 : isLine(_won[1]) ? 1 : -1; }
+    bool        gameOver() const { return winner() >= 0 || _closed == 0x1FF; }
+
+    // three in a row on a 3x3 mask
+    static bool isLine(uint16_t mask) { return kLineTable[mask & 0x1FF]; }
+
+private:
+    static const std::array<bool, 512> kLineTable;
+
+    uint16_t    _cells[2][kBoards];
+    uint16_t    _won[2];
+    uint16_t    _closed;
+    int8_t      _forced;
+    int8_t      _side;
+};
+
+//
+// monte carlo tree search for ultimate tic-tac-toe
+//
+// each playout walks down the tree picking children by UCT, adds the
+// children of the node it stops at, plays random moves to the end of the
+// game and scores the result back up the path. the move played is the root
+// child visited the most.
+//
+// the tree lives in one contiguous node arena allocated up front; a search
+// starts by resetting it to just the root and children are handed out from
+// it in one block per expanded node, so there's no allocation while
+// searching. once the arena is full the tree stops growing and playouts
+// carry on from its leaves.
+//
+// random playouts pick moves straight from the bit masks: a random index
+// into the playable cells, then that many set bits skipped.
+//
+class UltimateMCTS
+{
+public:
+    explicit UltimateMCTS(size_t maxNodes = 1 << 20);
+
+    // the move to play after "playouts" playouts, or fewer if the stop flag
+    // goes up first; -1 if the game is over
+    int         bestMove(const UltimatePosition &position, int playouts, const std::atomic<bool> *stop = nullptr);
+
+    // what the last search did
+    int         playouts() const { return _playouts; }
+    double      seconds() const { return _seconds; }
+    double      playoutsPerSecond() const { return _seconds > 0 ? _playouts / _seconds : 0.0; }
+    size_t      nodesUsed() const { return _used; }
+    // how often the chosen move won its playouts, from the mover's side
+    double      winRate() const { return _winRate; }
+
+private:
+    struct Node
+    {
+        uint32_t    firstChild;     // index in the arena, 0 before expansion
+        uint32_t    visits;
+        float       score;          // wins + half the draws for the player who moved into the node
+        uint8_t     childCount;
+        uint8_t     move;
+        uint8_t     mover;
+        uint8_t     expanded;
+    };
+
+    // pick a child of a visited node by UCT
+    uint32_t    select(const Node &node) const;
+    bool        expand(uint32_t index, const UltimatePosition &position);
+    // random moves to the end, returns the winner or -1 for a draw
+    int         rollout(UltimatePosition position);
+    uint64_t    random();
+
+    std::vector<Node>   _nodes;
+    size_t              _used;
+    uint64_t            _rng;
+    int                 _playouts;
+    double              _seconds;
+    double              _winRate;
+};
@@ -0,0 +1,237 @@
+#include "UltimateTicTacToe.h"
+
+// the playout budget is the limit, this only stops a huge one from hanging the game
+static const std::chrono::milliseconds kMaxThinkTime(10000);
+// the sprites are 100x100, drawn at half size with a gap between the sub-boards
+static const float kCellSize = 50.0f;
+static const float kBoardGap = 10.0f;
+
+UltimateTicTacToe::UltimateTicTacToe() : _playoutBudget(100000)
+{
+}
+
+UltimateTicTacToe::~UltimateTicTacToe()
+{
+    _ai.cancel();
+}
+
+Bit* UltimateTicTacToe::PieceForPlayer(const int playerNumber)
+{
+    Bit *bit = new Bit();
+    bit->LoadTextureFromFile(playerNumber == 0 ? "x.png" : "o.png");
+    bit->setSize(kCellSize, kCellSize);
+    bit->setOwner(getPlayerAt(playerNumber));
+    return bit;
+}
+
+//
+// setup the game board, this is called once at the start of the game
+//
+void UltimateTicTacToe::setUpBoard()
+{
+    setNumberOfPlayers(2);
+    setAIPlayer(1);
+
+    _gameOptions.rowX = kSize;
+    _gameOptions.rowY = kSize;
+
+    for (int row = 0; row < kSize; ++row)
+    {
+        for (int col = 0; col < kSize; ++col)
+        {
+            ImVec2 pos(col * kCellSize + (col / 3) * kBoardGap, row * kCellSize + (row / 3) * kBoardGap);
+            _grid[row][col].initHolder(pos, "square.png", col, row);
+            _grid[row][col].setSize(kCellSize, kCellSize);
+            _grid[row][col].setGameTag(moveAt(row, col));
+        }
+    }
+    _position = UltimatePosition();
+    refreshHighlights();
+
+    // the node arena is big, only allocate it once
+    if (!_mcts)
+        _mcts = std::make_unique<UltimateMCTS>();
+
+    startGame();
+}
+
+bool UltimateTicTacToe::actionForEmptyHolder(BitHolder *holder)
+{
+    if (!holder)
+        return false;
+    return playMove(holder->gameTag());
+}
+
+bool UltimateTicTacToe::playMove(int move)
+{
+    if (!_position.isLegal(move))
+        return false;
+
+    Square &square = squareForMove(move);
+    Bit *placeBit = PieceForPlayer(getCurrentPlayer()->playerNumber());
+    placeBit->setPosition(square.getPosition());
+    square.setBit(placeBit);
+    _position.play(move);
+    _lastMoveCode = move;
+    refreshHighlights();
+    return true;
+}
+
+void UltimateTicTacToe::refreshHighlights()
+{
+    for (int row = 0; row < kSize; ++row)
+    {
+        for (int col = 0; col < kSize; ++col)
+        {
+            Square &square = _grid[row][col];
+            const int move = square.gameTag();
+            const uint16_t board = static_cast<uint16_t>(1 << (move / 9));
+            if (_position.isLegal(move))
+                square.setColor(1.0f, 1.0f, 1.0f, 1.0f);
+            else if (_position.wonBoards(0) & board)
+                square.setColor(0.75f, 0.45f, 0.45f, 1.0f);
+            else if (_position.wonBoards(1) & board)
+                square.setColor(0.45f, 0.45f, 0.75f, 1.0f);
+            else
+                square.setColor(0.5f, 0.5f, 0.5f, 1.0f);
+        }
+    }
+}
+
+bool UltimateTicTacToe::canBitMoveFrom(Bit *bit, BitHolder *src)
+{
+    // pieces stay where they're put
+    return false;
+}
+
+bool UltimateTicTacToe::canBitMoveFromTo(Bit* bit, BitHolder*src, BitHolder*dst)
+{
+    return false;
+}
+
+//
+// free all the memory used by the game on the heap
+//
+void UltimateTicTacToe::stopGame()
+{
+    // a search for the old board is no use any more
+    _ai.cancel();
+    for (int row = 0; row < kSize; ++row)
+    {
+        for (int col = 0; col < kSize; ++col)
+        {
+            _grid[row][col].destroyBit();
+        }
+    }
+    _position = UltimatePosition();
+}
+
+Player* UltimateTicTacToe::checkForWinner()
+{
+    const int winner = _position.winner();
+    return winner < 0 ? nullptr : getPlayerAt(winner);
+}
+
+bool UltimateTicTacToe::checkForDraw()
+{
+    return _position.gameOver() && _position.winner() < 0;
+}
+
+//
+// state strings, 82 characters: the 81 cells left-to-right, top-to-bottom
+// across the whole board ('0' empty, '1' player 1, '2' player 2), then the
+// sub-board the next move has to go in ('0'..'8') or '-' for any
+//
+std::string UltimateTicTacToe::initialStateString()
+{
+    return std::string(kSize * kSize, '0') + "-";
+}
+
+std::string UltimateTicTacToe::stateString() const
+{
+    std::string state;
+    state.reserve(kSize * kSize + 1);
+    for (int row = 0; row < kSize; ++row)
+    {
+        for (int col = 0; col < kSize; ++col)
+        {
+            const int move = moveAt(row, col);
+            const uint16_t bit = static_cast<uint16_t>(1 << (move % 9));
+            const int board = move / 9;
+            state.push_back((_position.cells(0, board) & bit) ? '1' : (_position.cells(1, board) & bit) ? '2' : '0');
+        }
+    }
+    const int forced = _position.forcedBoard();
+    state.push_back(forced == UltimatePosition::kAnyBoard ? '-' : static_cast<char>('0' + forced));
+    return state;
+}
+
+void UltimateTicTacToe::setStateString(const std::string &s)
+{
+    if (s.size() != kSize * kSize + 1)
+        return;
+    stopGame();
+
+    uint16_t cells[2][UltimatePosition::kBoards] = {};
+    int placedCount = 0;
+    for (int row = 0; row < kSize; ++row)
+    {
+        for (int col = 0; col < kSize; ++col)
+        {
+            const int savedPlayerIndex = s[row * kSize + col] - '1';
+            if (savedPlayerIndex < 0 || savedPlayerIndex > 1)
+                continue;
+
+            Square &square = _grid[row][col];
+            const int move = square.gameTag();
+            Bit *b = PieceForPlayer(savedPlayerIndex);
+            b->setPosition(square.getPosition());
+            square.setBit(b);
+            cells[savedPlayerIndex][move / 9] |= static_cast<uint16_t>(1 << (move % 9));
+            ++placedCount;
+        }
+    }
+    const char forced = s[kSize * kSize];
+    _position = UltimatePosition(cells, forced >= '0' && forced <= '8' ? forced - '0' : UltimatePosition::kAnyBoard,
+                                 placedCount & 1);
+    refreshHighlights();
+
+    _gameOptions.currentTurnNo = static_cast<unsigned int>(placedCount);
+}
+
+//
+// called every frame while it's the AI's turn: the first call starts the
+// search on the worker thread, later calls play the move once it's ready
+//
+void UltimateTicTacToe::updateAI()
+{
+    if (checkForWinner() || checkForDraw())
+        return;
+
+    if (!_ai.busy())
+    {
+        const UltimatePosition position = _position;
+        UltimateMCTS *mcts = _mcts.get();
+        const int playouts = _playoutBudget;
+        _ai.start([mcts, position, playouts](const std::atomic<bool> &stop) {
+            return mcts->bestMove(position, playouts, &stop);
+        }, kMaxThinkTime);
+        return;
+    }
+
+    int move;
+    if (_ai.poll(move) && playMove(move))
+        endTurn();
+}
+
+void UltimateTicTacToe::drawSettings()
+{
+    ImGui::SetNextItemWidth(150);
+    ImGui::SliderInt("Playouts", &_playoutBudget, 1000, 1000000, "%d", ImGuiSliderFlags_Logarithmic);
+    // the worker is joined once the move is played, so the numbers are safe to read
+    if (_mcts && !_ai.busy() && _mcts->playouts() > 0)
+    {
+        ImGui::Text("Last search: %d playouts, %.0f playouts/s, %.0f%% wins", _mcts->playouts(),
+                    _mcts->playoutsPerSecond(), _mcts->winRate() * 100.0);
+    }
+}
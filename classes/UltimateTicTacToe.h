@@ -0,0 +1,58 @@
+#pragma once
+#include "Game.h"
+#include "Square.h"
+#include "AIWorker.h"
+#include "UltimateMCTS.h"
+
+#include <memory>
+
+//
+// ultimate tic-tac-toe, nine tic-tac-toe boards in a 3x3 meta-board
+//
+// the cell you play in sends your opponent to the matching sub-board; win
+// three sub-boards in a line to win. the cells that can be played next are
+// drawn bright, the rest dimmed. the AI is UltimateMCTS on an AIWorker
+// thread, its playout budget is set from the Settings window which also
+// shows how fast the last search ran.
+//
+class UltimateTicTacToe : public Game
+{
+public:
+    static const int kSize = 9;
+
+    UltimateTicTacToe();
+    ~UltimateTicTacToe();
+
+    // set up the board
+    void        setUpBoard() override;
+
+    Player*     checkForWinner() override;
+    bool        checkForDraw() override;
+    std::string initialStateString() override;
+    std::string stateString() const override;
+    void        setStateString(const std::string &s) override;
+    bool        actionForEmptyHolder(BitHolder *holder) override;
+    bool        canBitMoveFrom(Bit*bit, BitHolder *src) override;
+    bool        canBitMoveFromTo(Bit* bit, BitHolder*src, BitHolder*dst) override;
+    void        stopGame() override;
+
+    void        updateAI() override;
+    bool        gameHasAI() override { return true; }
+    void        drawSettings() override;
+    BitHolder &getHolderAt(const int x, const int y) override { return _grid[y][x]; }
+private:
+    Bit *       PieceForPlayer(const int playerNumber);
+    // play a move (board * 9 + cell) for the current player, false if it's not legal
+    bool        playMove(int move);
+    // brighten the cells that can be played next and dim the rest
+    void        refreshHighlights();
+    static int  moveAt(int row, int col) { return ((row / 3) * 3 + col / 3) * 9 + (row % 3) * 3 + col % 3; }
+    Square &    squareForMove(int move) { return _grid[(move / 27) * 3 + (move % 9) / 3][((move / 9) % 3) * 3 + move % 3]; }
+
+    // rows and columns of the whole 9x9 board, row 0 at the top
+    Square                          _grid[kSize][kSize];
+    UltimatePosition                _position;
+    AIWorker                        _ai;
+    std::unique_ptr<UltimateMCTS>   _mcts;
+    int                             _playoutBudget;
+};
@@ -0,0 +1,123 @@
+#include "WorkStealingPool.h"
+
+#include <algorithm>
+
+// which pool the current thread works for and its queue there
+static thread_local const WorkStealingPool *tlsPool = nullptr;
+static thread_local unsigned tlsIndex = 0;
+
+void WorkStealingPool::TaskGroup::run(Task task)
+{
+    _pending.fetch_add(1, std::memory_order_relaxed);
+    _pool.push(Item{ std::move(task), this });
+}
+
+void WorkStealingPool::TaskGroup::wait()
+{
+    while (_pending.load(std::memory_order_acquire) > 0)
+    {
+        if (!_pool.runOne())
+            std::this_thread::yield();
+    }
+}
+
+WorkStealingPool::WorkStealingPool(unsigned threads) :
+    _threads(threads ? threads : std::max(1u, std::thread::hardware_concurrency())), _queued(0), _sleeping(0), _stopping(false)
+{
+    for (unsigned i = 0; i < _threads; ++i)
+        _queues.push_back(std::make_unique<Queue>());
+    for (unsigned i = 0; i + 1 < _threads; ++i)
+        _workers.emplace_back(&WorkStealingPool::workerLoop, this, i);
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(_sleepMutex);
+        _stopping = true;
+    }
+    _wake.notify_all();
+    for (std::thread &worker : _workers)
+        worker.join();
+}
+
+WorkStealingPool &WorkStealingPool::shared()
+{
+    static WorkStealingPool pool;
+    return pool;
+}
+
+unsigned WorkStealingPool::queueIndex() const
+{
+    return tlsPool == this ? tlsIndex : _threads - 1;
+}
+
+void WorkStealingPool::push(Item item)
+{
+    Queue &queue = *_queues[queueIndex()];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.items.push_back(std::move(item));
+    }
+    // a worker going to sleep counts itself before it checks _queued, so
+    // one of the two sees the other and the task can't be missed; the
+    // lock only has to be taken when somebody is actually asleep
+    _queued.fetch_add(1);
+    if (_sleeping.load() > 0)
+    {
+        { std::lock_guard<std::mutex> lock(_sleepMutex); }
+        _wake.notify_one();
+    }
+}
+
+bool WorkStealingPool::runOne()
+{
+    if (_queued.load(std::memory_order_relaxed) == 0)
+        return false;
+
+    const unsigned own = queueIndex();
+    Item item{ nullptr, nullptr };
+    for (unsigned i = 0; i < _threads && !item.task; ++i)
+    {
+        const unsigned index = (own + i) % _threads;
+        Queue &queue = *_queues[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.items.empty())
+            continue;
+        // newest of our own, oldest of anyone else's
+        if (i == 0)
+        {
+            item = std::move(queue.items.back());
+            queue.items.pop_back();
+        }
+        else
+        {
+            item = std::move(queue.items.front());
+            queue.items.pop_front();
+        }
+    }
+    if (!item.task)
+        return false;
+
+    _queued.fetch_sub(1, std::memory_order_relaxed);
+    item.task();
+    item.group->_pending.fetch_sub(1, std::memory_order_release);
+    return true;
+}
+
+void WorkStealingPool::workerLoop(unsigned index)
+{
+    tlsPool = this;
+    tlsIndex = index;
+    while (true)
+    {
+        if (runOne())
+            continue;
+        std::unique_lock<std::mutex> lock(_sleepMutex);
+        _sleeping.fetch_add(1);
+        _wake.wait(lock, [this] { return _stopping || _queued.load() > 0; });
+        _sleeping.fetch_sub(1);
+        if (_stopping)
+            return;
+    }
+}
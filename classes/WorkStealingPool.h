@@ -0,0 +1,86 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//
+// a fixed set of worker threads sharing small tasks by work stealing
+//
+// every worker has its own deque of tasks. a worker takes its newest task
+// from the back, which keeps a recursive search depth-first and its data
+// in cache, and an idle worker steals the oldest task from the front of
+// somebody else's, which is the biggest piece of work left there. threads
+// that aren't workers put their tasks on one extra shared deque.
+//
+// tasks are run through a TaskGroup and waited for together. a thread
+// waiting on a group runs queued tasks (its own first, then stolen ones)
+// until the group is done instead of blocking, so tasks can start and wait
+// for groups of their own without tying up the pool.
+//
+// the calling thread counts as one of the threads: a pool of n threads
+// starts n - 1 workers, and a pool of one runs every task inline in wait().
+//
+class WorkStealingPool
+{
+public:
+    typedef std::function<void()> Task;
+
+    class TaskGroup
+    {
+    public:
+        explicit TaskGroup(WorkStealingPool &pool) : _pool(pool), _pending(0) {}
+        ~TaskGroup() { wait(); }
+
+        void        run(Task task);
+        // returns once every task run through the group has finished
+        void        wait();
+
+    private:
+        friend class WorkStealingPool;
+
+        WorkStealingPool   &_pool;
+        std::atomic<int>    _pending;
+    };
+
+    // 0 threads is one per hardware thread
+    explicit WorkStealingPool(unsigned threads = 0);
+    ~WorkStealingPool();
+
+    unsigned    threads() const { return _threads; }
+
+    // the pool the games share, one thread per hardware thread
+    static WorkStealingPool &shared();
+
+private:
+    struct Item
+    {
+        Task        task;
+        TaskGroup  *group;
+    };
+    struct Queue
+    {
+        std::mutex          mutex;
+        std::deque<Item>    items;
+    };
+
+    void        push(Item item);
+    // run one queued task if there is one, the caller's own queue first
+    bool        runOne();
+    void        workerLoop(unsigned index);
+    // this thread's queue: its own for a worker, the shared one otherwise
+    unsigned    queueIndex() const;
+
+    unsigned                                _threads;
+    std::vector<std::unique_ptr<Queue>>     _queues;        // one per worker and the shared one last
+    std::vector<std::thread>                _workers;
+    std::atomic<int>                        _queued;
+    std::atomic<int>                        _sleeping;
+    std::atomic<bool>                       _stopping;
+    std::mutex                              _sleepMutex;
+    std::condition_variable                 _wake;
+};
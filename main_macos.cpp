@@ -172,6 +172,8 @@ int main(int, char**)
     EMSCRIPTEN_MAINLOOP_END;
 #endif
 
+    ClassGame::GameShutDown();
+
     // Cleanup
     ImGui_ImplOpenGL3_Shutdown();
     ImGui_ImplGlfw_Shutdown();
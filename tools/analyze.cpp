@@ -0,0 +1,253 @@
+//
+// analyze: score a file of tic tac toe positions with the perfect-play solver
+//
+//   analyze <positions> [-o <output>] [-t <threads>] [-q]
+//
+// the input has one stateString() style position per line ("100020000").
+// every line produces "<state> <best move> <value> <plies>" where value is
+// 1 / 0 / -1 for the side to move and plies is how long the game lasts with
+// perfect play. finished games print "-" as the move; malformed lines print
+// "<line> invalid" and blank lines are skipped.
+//
+// the input is memory mapped and cut into blocks that worker threads score
+// independently. a single writer puts the finished blocks out in order with
+// large writes, so the output lines up with the input line for line.
+//
+
+#include "../classes/MappedFile.h"
+#include "../classes/TicTacToeSolver.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+static const size_t kBlockSize = 4 * 1024 * 1024;
+
+struct Block
+{
+    size_t              begin;
+    size_t              end;
+    std::vector<char>   output;
+    uint64_t            positions = 0;
+    bool                done = false;
+};
+
+//
+// score every line in [begin, end) into out
+//
+static uint64_t analyzeBlock(const TicTacToeSolver &solver, const char *data, size_t begin, size_t end, std::vector<char> &out)
+{
+    // a scored line is at most 8 characters longer than its 10 input characters
+    out.resize(2 * (end - begin) + 64);
+    char *w = out.data();
+    uint64_t positions = 0;
+
+    const char *p = data + begin;
+    const char *stop = data + end;
+    while (p < stop)
+    {
+        // nearly every line is exactly one position, check for that before searching
+        const char *eol = p + TicTacToeSolver::kCells;
+        if (eol >= stop || *eol != '\n')
+        {
+            eol = static_cast<const char *>(std::memchr(p, '\n', stop - p));
+            if (!eol)
+                eol = stop;
+        }
+        size_t len = eol - p;
+        if (len && p[len - 1] == '\r')
+            --len;
+
+        if (len)
+        {
+            // make sure a long malformed line still fits
+            const size_t used = w - out.data();
+            if (used + len + 16 > out.size())
+            {
+                out.resize(out.size() * 2 + len + 16);
+                w = out.data() + used;
+            }
+
+            const TicTacToeSolver::Analysis *a = (len == TicTacToeSolver::kCells) ? solver.analyze(p) : nullptr;
+            std::memcpy(w, p, len);
+            w += len;
+            if (!a || !(a->flags & TicTacToeSolver::kValid))
+            {
+                std::memcpy(w, " invalid\n", 9);
+                w += 9;
+            }
+            else
+            {
+                *w++ = ' ';
+                *w++ = a->bestMove < 0 ? '-' : char('0' + a->bestMove);
+                *w++ = ' ';
+                if (a->value < 0)
+                    *w++ = '-';
+                *w++ = char('0' + (a->value < 0 ? -a->value : a->value));
+                *w++ = ' ';
+                *w++ = char('0' + a->plies);
+                *w++ = '\n';
+            }
+            ++positions;
+        }
+        p = eol + 1;
+    }
+    out.resize(w - out.data());
+    return positions;
+}
+
+static int usage()
+{
+    std::fprintf(stderr, "usage: analyze <positions> [-o <output>] [-t <threads>] [-q]\n");
+    return 2;
+}
+
+int main(int argc, char **argv)
+{
+    const char *inputPath = nullptr;
+    const char *outputPath = nullptr;
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    bool quiet = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+            outputPath = argv[++i];
+        else if (std::strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+            threads = std::max(1, std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "-q") == 0)
+            quiet = true;
+        else if (!inputPath)
+            inputPath = argv[i];
+        else
+            return usage();
+    }
+    if (!inputPath)
+        return usage();
+
+    MappedFile input;
+    if (!input.open(inputPath, MappedFile::kSequential))
+    {
+        std::fprintf(stderr, "can't map %s\n", inputPath);
+        return 1;
+    }
+    FILE *out = outputPath ? std::fopen(outputPath, "wb") : stdout;
+    if (!out)
+    {
+        std::fprintf(stderr, "can't create %s\n", outputPath);
+        return 1;
+    }
+
+    const TicTacToeSolver solver;
+    const char *data = reinterpret_cast<const char *>(input.data());
+    const size_t size = input.size();
+
+    // cut the input into blocks that end on a line break
+    std::vector<Block> blocks;
+    for (size_t begin = 0; begin < size;)
+    {
+        size_t end = std::min(size, begin + kBlockSize);
+        if (end < size)
+        {
+            const char *eol = static_cast<const char *>(std::memchr(data + end, '\n', size - end));
+            end = eol ? static_cast<size_t>(eol - data) + 1 : size;
+        }
+        blocks.emplace_back();
+        blocks.back().begin = begin;
+        blocks.back().end = end;
+        begin = end;
+    }
+
+    // workers may only run a bounded distance ahead of the writer
+    const size_t window = 4 * static_cast<size_t>(threads);
+    std::mutex mutex;
+    std::condition_variable blockDone;
+    std::condition_variable blockWritten;
+    size_t nextBlock = 0;
+    size_t writtenBlocks = 0;
+
+    auto worker = [&]() {
+        for (;;)
+        {
+            size_t i;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                blockWritten.wait(lock, [&] { return nextBlock >= blocks.size() || nextBlock < writtenBlocks + window; });
+                if (nextBlock >= blocks.size())
+                    return;
+                i = nextBlock++;
+            }
+            Block &block = blocks[i];
+            block.positions = analyzeBlock(solver, data, block.begin, block.end, block.output);
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                block.done = true;
+            }
+            blockDone.notify_one();
+        }
+    };
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> pool;
+    for (unsigned t = 0; t < threads; ++t)
+        pool.emplace_back(worker);
+
+    // this thread is the writer, and reports progress while it waits
+    uint64_t positions = 0;
+    auto lastReport = start;
+    bool writeFailed = false;
+    for (size_t i = 0; i < blocks.size(); ++i)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (!blocks[i].done)
+                blockDone.wait_for(lock, std::chrono::milliseconds(250));
+        }
+        Block &block = blocks[i];
+        if (!block.output.empty() && std::fwrite(block.output.data(), 1, block.output.size(), out) != block.output.size())
+            writeFailed = true;
+        positions += block.positions;
+        std::vector<char>().swap(block.output);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            writtenBlocks = i + 1;
+        }
+        blockWritten.notify_all();
+
+        const auto now = std::chrono::steady_clock::now();
+        if (!quiet && now - lastReport > std::chrono::milliseconds(500))
+        {
+            const double seconds = std::chrono::duration<double>(now - start).count();
+            std::fprintf(stderr, "\r  %5.1f%%  %12llu positions  %8.2f M pos/s", 100.0 * block.end / size,
+                         (unsigned long long)positions, positions / seconds / 1e6);
+            lastReport = now;
+        }
+    }
+    for (std::thread &t : pool)
+        t.join();
+    if (std::fflush(out) != 0)
+        writeFailed = true;
+    if (outputPath)
+        std::fclose(out);
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (!quiet)
+    {
+        std::fprintf(stderr, "\r%llu positions in %.3f s with %u threads: %.2f M pos/s, %.1f MB/s in\n",
+                     (unsigned long long)positions, seconds, threads,
+                     seconds > 0 ? positions / seconds / 1e6 : 0.0, seconds > 0 ? size / seconds / 1e6 : 0.0);
+    }
+    if (writeFailed)
+    {
+        std::fprintf(stderr, "writing the output failed\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,253 @@
+//
+// archive_tool: inspect, merge and compact game archives (see classes/GameArchive.h)
+//
+//   archive_tool info <archive>
+//   archive_tool dump <archive> [first] [count]
+//   archive_tool find <archive> <game number>
+//   archive_tool merge [--renumber] [--drop-unfinished] <out> <in> [in...]
+//   archive_tool compact [--drop-unfinished] <archive>
+//
+
+#include "../classes/GameArchive.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using namespace GameArchiveFormat;
+
+static int usage()
+{
+    std::fprintf(stderr,
+        "usage:\n"
+        "  archive_tool info <archive>\n"
+        "  archive_tool dump <archive> [first] [count]\n"
+        "  archive_tool find <archive> <game number>\n"
+        "  archive_tool merge [--renumber] [--drop-unfinished] <out> <in> [in...]\n"
+        "  archive_tool compact [--drop-unfinished] <archive>\n");
+    return 2;
+}
+
+static void printGame(const GameRecordView &game)
+{
+    std::printf("game %llu  cells %u  moves %u  result ", (unsigned long long)game.gameNumber, game.cells, game.moveCount);
+    if (game.result == kResultUnfinished)
+        std::printf("unfinished");
+    else if (game.result == kResultDraw)
+        std::printf("draw");
+    else
+        std::printf("player %d", game.result - 1);
+    std::printf("  [");
+    for (uint16_t i = 0; i < game.moveCount; ++i)
+        std::printf(i ? " %u" : "%u", game.moves[i]);
+    std::printf("]\n");
+}
+
+//
+// walk every game once: this is the zero-copy iteration path, timed
+//
+static int info(const std::string &path)
+{
+    GameArchiveReader reader;
+    std::string error;
+    if (!reader.open(path, error))
+    {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    uint64_t moves = 0;
+    uint64_t results[3] = { 0, 0, 0 };        // draws, wins, unfinished
+    for (GameRecordView game : reader)
+    {
+        moves += game.moveCount;
+        results[game.result == kResultDraw ? 0 : game.result == kResultUnfinished ? 2 : 1]++;
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    const size_t bad = reader.verify();
+    std::printf("%s\n", path.c_str());
+    std::printf("  games       %zu\n", reader.gameCount());
+    std::printf("  moves       %llu\n", (unsigned long long)moves);
+    std::printf("  wins        %llu\n", (unsigned long long)results[1]);
+    std::printf("  draws       %llu\n", (unsigned long long)results[0]);
+    std::printf("  unfinished  %llu\n", (unsigned long long)results[2]);
+    std::printf("  bad crc     %zu\n", bad);
+    if (seconds > 0)
+        std::printf("  scan        %.1f M games/s\n", reader.gameCount() / seconds / 1e6);
+    return bad ? 1 : 0;
+}
+
+static int dump(const std::string &path, size_t first, size_t count)
+{
+    GameArchiveReader reader;
+    std::string error;
+    if (!reader.open(path, error))
+    {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+    for (size_t i = first; i < reader.gameCount() && i - first < count; ++i)
+        printGame(reader.at(i));
+    return 0;
+}
+
+static int find(const std::string &path, uint64_t gameNumber)
+{
+    GameArchiveReader reader;
+    std::string error;
+    if (!reader.open(path, error))
+    {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+    GameRecordView game;
+    if (!reader.find(gameNumber, game))
+    {
+        std::fprintf(stderr, "game %llu not found\n", (unsigned long long)gameNumber);
+        return 1;
+    }
+    printGame(game);
+    return 0;
+}
+
+//
+// copy games from the inputs into a fresh archive. archives from different
+// machines all count games from zero, so --renumber assigns new numbers in
+// input order instead of keeping the originals.
+//
+static bool mergeInto(const std::string &out, const std::vector<std::string> &inputs, bool renumber, bool dropUnfinished)
+{
+    std::error_code ec;
+    std::filesystem::remove(out, ec);
+
+    GameArchiveWriter writer;
+    std::string error;
+    if (!writer.open(out, error))
+    {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return false;
+    }
+
+    uint64_t nextNumber = 0;
+    size_t dropped = 0;
+    size_t bad = 0;
+    for (const std::string &input : inputs)
+    {
+        // an input that was never closed has to be compacted before it can be read
+        GameArchiveReader reader;
+        if (!reader.open(input, error))
+        {
+            std::fprintf(stderr, "%s\n", error.c_str());
+            return false;
+        }
+        for (GameRecordView game : reader)
+        {
+            if (dropUnfinished && game.result == kResultUnfinished)
+            {
+                ++dropped;
+                continue;
+            }
+            if (!game.moves)
+            {
+                ++bad;
+                continue;
+            }
+            const uint64_t number = renumber ? nextNumber++ : game.gameNumber;
+            if (!writer.addGame(number, game.result, game.cells, game.moves, game.moveCount))
+            {
+                std::fprintf(stderr, "write to %s failed\n", out.c_str());
+                return false;
+            }
+        }
+    }
+
+    const size_t games = writer.gameCount();
+    if (!writer.close())
+    {
+        std::fprintf(stderr, "closing %s failed\n", out.c_str());
+        return false;
+    }
+    std::printf("%s: %zu games written, %zu unfinished dropped, %zu damaged skipped\n", out.c_str(), games, dropped, bad);
+    return true;
+}
+
+//
+// rewrite an archive in place: rebuilds the index of one that was never closed
+// and packs the blocks in game number order
+//
+static int compact(const std::string &path, bool dropUnfinished)
+{
+    std::error_code ec;
+    if (!std::filesystem::exists(path, ec))
+    {
+        std::fprintf(stderr, "%s does not exist\n", path.c_str());
+        return 1;
+    }
+
+    // reopening with the writer recovers the index, closing makes it readable
+    {
+        GameArchiveWriter writer;
+        std::string error;
+        if (!writer.open(path, error) || !writer.close())
+        {
+            std::fprintf(stderr, "%s\n", error.empty() ? "recovery failed" : error.c_str());
+            return 1;
+        }
+    }
+
+    const std::string tmp = path + ".compact";
+    if (!mergeInto(tmp, { path }, false, dropUnfinished))
+        return 1;
+    std::filesystem::rename(tmp, path, ec);
+    if (ec)
+    {
+        std::fprintf(stderr, "can't replace %s\n", path.c_str());
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3)
+        return usage();
+
+    const std::string command = argv[1];
+    bool renumber = false;
+    bool dropUnfinished = false;
+    std::vector<std::string> args;
+    for (int i = 2; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--renumber") == 0)
+            renumber = true;
+        else if (std::strcmp(argv[i], "--drop-unfinished") == 0)
+            dropUnfinished = true;
+        else
+            args.push_back(argv[i]);
+    }
+    if (args.empty())
+        return usage();
+
+    if (command == "info")
+        return info(args[0]);
+    if (command == "dump")
+    {
+        size_t first = args.size() > 1 ? std::strtoull(args[1].c_str(), nullptr, 10) : 0;
+        size_t count = args.size() > 2 ? std::strtoull(args[2].c_str(), nullptr, 10) : SIZE_MAX;
+        return dump(args[0], first, count);
+    }
+    if (command == "find" && args.size() == 2)
+        return find(args[0], std::strtoull(args[1].c_str(), nullptr, 10));
+    if (command == "merge" && args.size() >= 2)
+        return mergeInto(args[0], std::vector<std::string>(args.begin() + 1, args.end()), renumber, dropUnfinished) ? 0 : 1;
+    if (command == "compact")
+        return compact(args[0], dropUnfinished);
+    return usage();
+}
@@ -0,0 +1,109 @@
+//
+// checkers_perft: count the leaf nodes of the checkers move tree from the
+// starting position as a move generator check and speed test
+//
+//   checkers_perft [-d <depth>] [-divide]
+//
+// every depth from 1 to -d (default 12) is counted and checked against the
+// published english draughts numbers, which go to 12 here. -divide lists the
+// count under each first move at the last depth, which is how a mismatch is
+// tracked down.
+//
+// the counts go through CheckersPosition::generate and makeMove exactly as
+// the game and the search play them, copying the position for every move;
+// the last ply is counted from the length of the move list. speed is
+// reported in millions of leaf nodes per second.
+//
+// exits non-zero if any count is wrong.
+//
+
+#include "../classes/CheckersPosition.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// by depth from the starting position
+static const uint64_t kReference[] = {
+    1, 7, 49, 302, 1469, 7361, 36768, 179740, 845931, 3963680, 18391564, 85242128, 388623673,
+};
+static const int kReferenceDepth = sizeof(kReference) / sizeof(kReference[0]) - 1;
+
+static uint64_t perft(const CheckersPosition &position, int depth)
+{
+    CheckersMoveList list;
+    position.generate(list);
+    if (depth <= 1)
+        return depth == 1 ? static_cast<uint64_t>(list.size) : 1;
+
+    uint64_t nodes = 0;
+    for (const CheckersMove &m : list)
+    {
+        CheckersPosition next = position;
+        next.makeMove(m);
+        nodes += perft(next, depth - 1);
+    }
+    return nodes;
+}
+
+// squares numbered 1..32 the way checkers notation has them, jumps with an x
+static void printMove(const CheckersMove &m, uint64_t count)
+{
+    std::printf("%d%c%d: %llu\n", m.from + 1, m.captures ? 'x' : '-', m.to + 1, (unsigned long long)count);
+}
+
+int main(int argc, char **argv)
+{
+    int depth = 12;
+    bool divide = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "-d") == 0 && i + 1 < argc)
+            depth = std::max(1, std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "-divide") == 0)
+            divide = true;
+        else
+        {
+            std::fprintf(stderr, "usage: checkers_perft [-d <depth>] [-divide]\n");
+            return 2;
+        }
+    }
+
+    const CheckersPosition start;
+    bool ok = true;
+    uint64_t totalNodes = 0;
+    double totalSeconds = 0;
+    for (int d = 1; d <= depth; ++d)
+    {
+        const auto begin = std::chrono::steady_clock::now();
+        uint64_t nodes = 0;
+        if (divide && d == depth)
+        {
+            CheckersMoveList list;
+            start.generate(list);
+            for (const CheckersMove &m : list)
+            {
+                CheckersPosition next = start;
+                next.makeMove(m);
+                const uint64_t count = perft(next, d - 1);
+                printMove(m, count);
+                nodes += count;
+            }
+        }
+        else
+            nodes = perft(start, d);
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        totalNodes += nodes;
+        totalSeconds += seconds;
+
+        const bool checked = d <= kReferenceDepth;
+        const bool match = !checked || nodes == kReference[d];
+        ok &= match;
+        std::printf("depth %2d  %12llu nodes  %9.3f s  %8.2f Mnps  %s\n", d, (unsigned long long)nodes, seconds,
+                    seconds > 0 ? nodes / seconds / 1e6 : 0.0, !checked ? "" : match ? "ok" : "MISMATCH");
+    }
+    std::printf("\ntotal %llu nodes in %.3f s, %.2f Mnps\n", (unsigned long long)totalNodes, totalSeconds,
+                totalSeconds > 0 ? totalNodes / totalSeconds / 1e6 : 0.0);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,227 @@
+//
+// chess_bench: fixed depth ChessSearch runs over an EPD test suite
+//
+//   chess_bench [-d <depth>] [-hash <mb>] <file.epd>
+//
+// every line of the suite is a position (the first four FEN fields) followed
+// by operations, of which "bm" (the best move or moves, in SAN) and "id" are
+// used; tools/wac.epd has the first positions of Win At Chess. each position
+// is searched to -d plies (default 7) with a cleared table so runs can be
+// compared, and the move found is checked against bm. the report has the
+// move, score, nodes and time per position, then how many were solved and
+// the overall nodes per second.
+//
+// exits non-zero if the file can't be read or a position can't be parsed.
+//
+
+#include "../classes/ChessSearch.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+struct EpdEntry
+{
+    std::string                 fen;
+    std::string                 id;
+    std::vector<std::string>    bestMoves;
+};
+
+static std::string trim(const std::string &s)
+{
+    const size_t first = s.find_first_not_of(" \t\r\n");
+    if (first == std::string::npos)
+        return std::string();
+    return s.substr(first, s.find_last_not_of(" \t\r\n") - first + 1);
+}
+
+//
+// "<board> <side> <castling> <ep> op arg...; op arg...;"
+//
+static bool parseEpd(const std::string &line, EpdEntry &entry)
+{
+    std::istringstream in(line);
+    std::string fields[4];
+    for (std::string &field : fields)
+    {
+        if (!(in >> field))
+            return false;
+    }
+    entry.fen = fields[0] + " " + fields[1] + " " + fields[2] + " " + fields[3] + " 0 1";
+
+    std::string rest;
+    std::getline(in, rest);
+    std::istringstream operations(rest);
+    std::string operation;
+    while (std::getline(operations, operation, ';'))
+    {
+        std::istringstream words(trim(operation));
+        std::string opcode;
+        words >> opcode;
+        if (opcode == "bm")
+        {
+            std::string move;
+            while (words >> move)
+                entry.bestMoves.push_back(move);
+        }
+        else if (opcode == "id")
+        {
+            std::getline(words, entry.id);
+            entry.id = trim(entry.id);
+            if (entry.id.size() >= 2 && entry.id.front() == '"' && entry.id.back() == '"')
+                entry.id = entry.id.substr(1, entry.id.size() - 2);
+        }
+    }
+    return true;
+}
+
+//
+// standard algebraic notation without the check suffix, which is what the
+// suites are compared on
+//
+static std::string toSan(const ChessPosition &position, ChessMove m)
+{
+    static const char kPieceLetters[] = "PNBRQK";
+    const int from = moveFrom(m);
+    const int to = moveTo(m);
+    const int flags = moveFlags(m);
+    if (flags == ChessMoveFlags::kKingCastle)
+        return "O-O";
+    if (flags == ChessMoveFlags::kQueenCastle)
+        return "O-O-O";
+
+    const int type = pieceType(position.pieceAt(from));
+    std::string san;
+    if (type == kPawn)
+    {
+        if (isCapture(m))
+            san.push_back(static_cast<char>('a' + ChessBitboard::fileOf(from)));
+    }
+    else
+    {
+        san.push_back(kPieceLetters[type]);
+
+        // another piece of the same kind that can go to the same square
+        ChessMoveList list;
+        position.generateLegal(list);
+        bool ambiguous = false, sameFile = false, sameRank = false;
+        for (ChessMove other : list)
+        {
+            const int otherFrom = moveFrom(other);
+            if (moveTo(other) != to || otherFrom == from || pieceType(position.pieceAt(otherFrom)) != type)
+                continue;
+            ambiguous = true;
+            sameFile |= ChessBitboard::fileOf(otherFrom) == ChessBitboard::fileOf(from);
+            sameRank |= ChessBitboard::rankOf(otherFrom) == ChessBitboard::rankOf(from);
+        }
+        if (ambiguous && (!sameFile || sameRank))
+            san.push_back(static_cast<char>('a' + ChessBitboard::fileOf(from)));
+        if (ambiguous && sameFile)
+            san.push_back(static_cast<char>('1' + ChessBitboard::rankOf(from)));
+    }
+    if (isCapture(m))
+        san.push_back('x');
+    san += ChessPosition::squareName(to);
+    if (isPromotion(m))
+    {
+        san.push_back('=');
+        san.push_back(kPieceLetters[promotionType(m)]);
+    }
+    return san;
+}
+
+static std::string withoutCheck(std::string san)
+{
+    while (!san.empty() && (san.back() == '+' || san.back() == '#' || san.back() == '!' || san.back() == '?'))
+        san.pop_back();
+    return san;
+}
+
+static int usage()
+{
+    std::fprintf(stderr, "usage: chess_bench [-d <depth>] [-hash <mb>] <file.epd>\n");
+    return 2;
+}
+
+int main(int argc, char **argv)
+{
+    int depth = 7;
+    int hashMegabytes = 16;
+    const char *path = nullptr;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "-d") == 0 && i + 1 < argc)
+            depth = std::max(1, std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "-hash") == 0 && i + 1 < argc)
+            hashMegabytes = std::max(1, std::atoi(argv[++i]));
+        else if (argv[i][0] != '-' && !path)
+            path = argv[i];
+        else
+            return usage();
+    }
+    if (!path)
+        return usage();
+
+    std::ifstream file(path);
+    if (!file)
+    {
+        std::fprintf(stderr, "can't open %s\n", path);
+        return 1;
+    }
+
+    ChessSearch search(static_cast<size_t>(hashMegabytes));
+    ChessSearchLimits limits;
+    limits.depth = depth;
+
+    int positions = 0;
+    int solved = 0;
+    uint64_t totalNodes = 0;
+    double totalSeconds = 0;
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line))
+    {
+        ++lineNumber;
+        line = trim(line);
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        EpdEntry entry;
+        ChessPosition position;
+        if (!parseEpd(line, entry) || !position.setFen(entry.fen))
+        {
+            std::fprintf(stderr, "%s:%d: can't parse position\n", path, lineNumber);
+            return 1;
+        }
+        if (entry.id.empty())
+            entry.id = "line " + std::to_string(lineNumber);
+
+        search.clear();
+        const ChessSearchResult result = search.search(position, limits);
+        const std::string san = result.bestMove != kNoMove ? toSan(position, result.bestMove) : "-";
+
+        bool ok = false;
+        std::string expected;
+        for (const std::string &bm : entry.bestMoves)
+        {
+            ok |= withoutCheck(bm) == san;
+            expected += (expected.empty() ? "" : " ") + bm;
+        }
+
+        ++positions;
+        solved += ok ? 1 : 0;
+        totalNodes += result.nodes;
+        totalSeconds += result.seconds;
+        std::printf("%-10s %-8s %-12s %7d %12llu %8.3f s   %s\n", entry.id.c_str(), san.c_str(), expected.c_str(),
+                    result.score, (unsigned long long)result.nodes, result.seconds,
+                    entry.bestMoves.empty() ? "" : ok ? "ok" : "missed");
+    }
+
+    std::printf("\nsolved %d of %d at depth %d, %llu nodes in %.3f s, %.2f Mnps\n", solved, positions, depth,
+                (unsigned long long)totalNodes, totalSeconds, totalSeconds > 0 ? totalNodes / totalSeconds / 1e6 : 0.0);
+    return 0;
+}
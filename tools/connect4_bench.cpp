@@ -0,0 +1,227 @@
+//
+// connect4_bench: solve fixed sets of Connect Four positions and time them
+//
+//   connect4_bench [-weak] [-empty]
+//
+// the positions are grouped the way the usual solver benchmarks are, by how
+// far into the game they are and how hard they are to solve:
+//   end-easy       28+ stones played
+//   middle-easy    20-27 stones played
+//   middle-medium  14-19 stones played
+//   begin-medium   8-13 stones played
+//   opening        1-11 stones played, answered the way ConnectFour's AI
+//                  answers: from ConnectFourBook where it has the position,
+//                  otherwise with a weak bestMove()
+// every position is a string of 1-based columns played from the empty board
+// with the exact score for the side to move (see ConnectFourSolver.h). the
+// scores were cross checked against the score of every child position, and
+// for the first two sets against a plain alpha-beta search without a table.
+//
+// each position is solved with a cleared transposition table and the mean
+// time, mean nodes and nodes/sec per set are printed. -weak only asks for
+// win / draw / loss, which is all the opening set is checked on; its
+// slowest position is also marked if it took longer than the AI may think.
+// -empty also solves the empty board without the book (score 1, the first
+// player wins with their 21st stone), which takes minutes on one core.
+//
+// exits non-zero if any score is wrong.
+//
+
+#include "../classes/ConnectFourBook.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+struct BenchPosition
+{
+    const char *moves;
+    int         score;
+};
+
+struct BenchSet
+{
+    const char          *name;
+    const BenchPosition *positions;
+    int                  count;
+    bool                 asAI;      // answered with the book and a weak bestMove()
+};
+
+// ConnectFour's kThinkTime
+static const double kAIBudget = 2.0;
+
+static const BenchPosition kEndEasy[] = {
+    { "1224163273654663444355211417", 1 },
+    { "562234167364175775337554234123", 1 },
+    { "57261766532221756112765724731", 1 },
+    { "1312677272316111642733242376", -1 },
+    { "147327627123775765323563131644", -1 },
+    { "7611346152773313376576365156", 1 },
+    { "3234757613674226743623316715", 0 },
+    { "1511467513212243724532631624573", 1 },
+    { "4526531224677611172332476425", 0 },
+    { "5766726567556651754443413374174", 0 },
+    { "2252576253462244111563365343671351441", -1 },
+};
+
+static const BenchPosition kMiddleEasy[] = {
+    { "245764336776267245525", 3 },
+    { "4553714574731166674476", -2 },
+    { "66744553232644771172", -4 },
+    { "46675513267164474172", 2 },
+    { "26121722566711556444", -1 },
+    { "773667522572134511363", 1 },
+    { "31317277566117224372", -3 },
+    { "4161522467461365357672", 0 },
+    { "455437356433637472424", -1 },
+    { "611432657151212716756", 2 },
+};
+
+static const BenchPosition kMiddleMedium[] = {
+    { "277335177366713", 0 },
+    { "52556452366127", 3 },
+    { "56331167777115", 0 },
+    { "43753556232211", -1 },
+    { "67733376552661", -2 },
+    { "67711446776445", 2 },
+    { "63755621721277", 0 },
+    { "57344323337552", 0 },
+    { "633773651147355", 1 },
+    { "2342573273173622", 0 },
+};
+
+static const BenchPosition kBeginMedium[] = {
+    { "176337723", -2 },
+    { "62771525", -3 },
+    { "351771725", 2 },
+    { "33347516", 0 },
+    { "6673162566", -1 },
+    { "13227735", 2 },
+    { "41765276", 0 },
+    { "56161467", 0 },
+};
+
+// checked on win / draw / loss only. the first move decides the one-stone
+// scores (only the center wins for the first player, the columns next to it
+// draw); the nine-stone ones are book positions and the eleven-stone ones
+// the first the solver has to answer, both cross checked like the sets above
+static const BenchPosition kOpening[] = {
+    { "1", 1 },
+    { "2", 1 },
+    { "3", 0 },
+    { "4", -1 },
+    { "5", 0 },
+    { "6", 1 },
+    { "7", 1 },
+    { "232244144", 1 },
+    { "231444426", 1 },
+    { "444414164", 3 },
+    { "144444221", 3 },
+    { "23333274731", 1 },
+    { "14245444277", 4 },
+    { "44441416116", 3 },
+    { "23442422441", 1 },
+    { "34334444436", 0 },
+};
+
+static const BenchPosition kEmpty[] = {
+    { "", 1 },
+};
+
+#define BENCH_SET(name, positions) { name, positions, int(sizeof(positions) / sizeof(positions[0])), false }
+
+static const BenchSet kSets[] = {
+    BENCH_SET("end-easy", kEndEasy),
+    BENCH_SET("middle-easy", kMiddleEasy),
+    BENCH_SET("middle-medium", kMiddleMedium),
+    BENCH_SET("begin-medium", kBeginMedium),
+    { "opening", kOpening, int(sizeof(kOpening) / sizeof(kOpening[0])), true },
+};
+
+static int sign(int v)
+{
+    return (v > 0) - (v < 0);
+}
+
+//
+// solve every position of a set, returns the number of wrong scores
+//
+static int runSet(ConnectFourSolver &solver, const BenchSet &set, bool weak)
+{
+    int wrong = 0;
+    uint64_t nodes = 0;
+    double seconds = 0;
+    double slowest = 0;
+    for (int i = 0; i < set.count; ++i)
+    {
+        const BenchPosition &bench = set.positions[i];
+        ConnectFourPosition position;
+        if (position.playSequence(bench.moves) != static_cast<int>(std::strlen(bench.moves)))
+        {
+            std::printf("  %-14s bad move sequence %s\n", set.name, bench.moves);
+            ++wrong;
+            continue;
+        }
+
+        solver.clearTable();
+        solver.resetNodeCount();
+        const auto start = std::chrono::steady_clock::now();
+        int score;
+        if (set.asAI)
+        {
+            if (ConnectFourBook::probe(position, &score) < 0)
+                solver.bestMove(position, true, &score);
+            score = sign(score);
+        }
+        else
+            score = solver.solve(position, weak);
+        const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        const int expected = weak || set.asAI ? sign(bench.score) : bench.score;
+        if (score != expected)
+        {
+            std::printf("  %-14s %s scored %d, expected %d   MISMATCH\n", set.name, bench.moves, score, expected);
+            ++wrong;
+        }
+        nodes += solver.nodeCount();
+        seconds += elapsed;
+        if (elapsed > slowest)
+            slowest = elapsed;
+    }
+
+    std::printf("  %-14s %3d  %10.3f ms  %10.3f ms  %12.0f  %8.2f M nodes/s   %s%s\n", set.name, set.count,
+                seconds / set.count * 1e3, slowest * 1e3, double(nodes) / set.count,
+                seconds > 0 ? nodes / seconds / 1e6 : 0.0, wrong ? "MISMATCH" : "ok",
+                set.asAI && slowest > kAIBudget ? ", slowest over the AI's budget" : "");
+    return wrong;
+}
+
+int main(int argc, char **argv)
+{
+    bool weak = false;
+    bool empty = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "-weak") == 0)
+            weak = true;
+        else if (std::strcmp(argv[i], "-empty") == 0)
+            empty = true;
+        else
+        {
+            std::fprintf(stderr, "usage: connect4_bench [-weak] [-empty]\n");
+            return 2;
+        }
+    }
+
+    ConnectFourSolver solver;
+    std::printf("connect four %s solve, one thread, table cleared per position\n\n", weak ? "weak" : "strong");
+    std::printf("  %-14s %3s  %13s  %13s  %12s  %17s\n", "set", "n", "mean", "slowest", "mean nodes", "speed");
+
+    int wrong = 0;
+    for (const BenchSet &set : kSets)
+        wrong += runSet(solver, set, weak);
+    if (empty)
+        wrong += runSet(solver, BENCH_SET("empty", kEmpty), weak);
+
+    return wrong ? 1 : 0;
+}
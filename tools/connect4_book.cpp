@@ -0,0 +1,174 @@
+//
+// connect4_book: build ConnectFour's compiled-in opening book offline
+//
+//   connect4_book [-o <file>] [-p <stones>]
+//
+// walks the opening tree from the empty board for the second player, the
+// one ConnectFour's AI plays. in every position with the second player to
+// move and fewer than -p stones (default 10, so its first five moves) the
+// column the AI's weak bestMove() would play is found and only that one is
+// followed; where the first player is to move every column that doesn't win
+// on the spot is. a position is kept once for both its mirror images and
+// every order of reaching it.
+//
+// the book is written as C++ source to -o (default
+// classes/ConnectFourBookData.cpp, run from the top of the tree) and is
+// compiled into the game and connect4_bench, so rebuild after running.
+// reported: the positions solved and how long it took. the defaults give
+// 2680 positions in about 40 minutes on one core, most of it on the few
+// positions near the empty board; a line of progress is printed every
+// kProgressEvery positions.
+//
+
+#include "../classes/ConnectFourBook.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+static const size_t kProgressEvery = 50;
+
+//
+// the column bestMove(position, true) picks, with fewer solves: the
+// position's own score first, then the columns in bestMove()'s order until
+// one keeps it. when it's lost any column that doesn't lose on the spot is
+// as good as the others, so the center-most is taken without a solve.
+//
+static int bookMove(ConnectFourSolver &solver, const ConnectFourPosition &position, int &score)
+{
+    static const int kOrder[ConnectFourPosition::kWidth] = { 3, 2, 4, 1, 5, 0, 6 };
+    if (position.canWinNext())
+        return solver.bestMove(position, true, &score);
+
+    score = solver.solve(position, true);
+    if (score < 0)
+    {
+        const uint64_t safe = position.possibleNonLosingMoves();
+        for (int col : kOrder)
+        {
+            if (safe & ConnectFourPosition::columnMask(col))
+                return col;
+        }
+        // every column loses on the spot, which is quick to see
+        return solver.bestMove(position, true, &score);
+    }
+    for (int col : kOrder)
+    {
+        if (!position.canPlay(col))
+            continue;
+        ConnectFourPosition child = position;
+        child.play(col);
+        if (-solver.solve(child, true) >= score)
+            return col;
+    }
+    return solver.bestMove(position, true, &score);
+}
+
+struct BookBuilder
+{
+    ConnectFourSolver               solver;
+    int                             maxStones;
+    std::vector<ConnectFourBook::Entry> entries;
+    std::unordered_set<uint64_t>    seen;
+    std::chrono::steady_clock::time_point start;
+
+    void walk(const ConnectFourPosition &position)
+    {
+        if (position.moves() >= maxStones)
+            return;
+
+        if (position.moves() % 2 == 0)
+        {
+            // the first player's turn, every reply that doesn't end the game
+            for (int col = 0; col < ConnectFourPosition::kWidth; ++col)
+            {
+                if (!position.canPlay(col) || position.isWinningMove(col))
+                    continue;
+                ConnectFourPosition next = position;
+                next.play(col);
+                walk(next);
+            }
+            return;
+        }
+
+        bool mirrored;
+        const uint64_t key = ConnectFourBook::canonicalKey(position, mirrored);
+        if (!seen.insert(key).second)
+            return;
+
+        // the table is kept from one position to the next, they share most of their trees
+        int score = 0;
+        const int col = bookMove(solver, position, score);
+        const int move = mirrored ? ConnectFourBook::mirrorColumn(col) : col;
+        entries.push_back({ key, static_cast<int8_t>(move), static_cast<int8_t>((score > 0) - (score < 0)) });
+        if (entries.size() % kProgressEvery == 0)
+        {
+            std::printf("  %zu positions solved (%.1f s so far)\n", entries.size(),
+                        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+            std::fflush(stdout);
+        }
+
+        if (position.isWinningMove(col))
+            return;
+        ConnectFourPosition next = position;
+        next.play(col);
+        walk(next);
+    }
+};
+
+static bool writeBook(const std::string &path, const std::vector<ConnectFourBook::Entry> &entries, int maxStones)
+{
+    FILE *file = std::fopen(path.c_str(), "w");
+    if (!file)
+        return false;
+    std::fprintf(file, "//\n// written by tools/connect4_book -p %d, don't edit\n//\n\n", maxStones);
+    std::fprintf(file, "#include \"ConnectFourBook.h\"\n\n");
+    std::fprintf(file, "const ConnectFourBook::Entry ConnectFourBook::kEntries[] = {\n");
+    for (const ConnectFourBook::Entry &entry : entries)
+        std::fprintf(file, "    { 0x%013llXull, %d, %d },\n", (unsigned long long)entry.key, entry.move, entry.score);
+    std::fprintf(file, "};\n\n");
+    std::fprintf(file, "const size_t ConnectFourBook::kSize = sizeof(kEntries) / sizeof(kEntries[0]);\n");
+    return std::fclose(file) == 0;
+}
+
+int main(int argc, char **argv)
+{
+    std::string path = "classes/ConnectFourBookData.cpp";
+    int maxStones = 10;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+            path = argv[++i];
+        else if (std::strcmp(argv[i], "-p") == 0 && i + 1 < argc)
+            maxStones = std::clamp(std::atoi(argv[++i]), 2, ConnectFourPosition::kCells);
+        else
+        {
+            std::fprintf(stderr, "usage: connect4_book [-o <file>] [-p <stones>]\n");
+            return 2;
+        }
+    }
+
+    BookBuilder builder;
+    builder.maxStones = maxStones;
+    builder.start = std::chrono::steady_clock::now();
+    std::printf("connect four book, second player's positions with fewer than %d stones\n", maxStones);
+    builder.walk(ConnectFourPosition());
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - builder.start).count();
+    std::printf("  %zu positions solved in %.1f s, %.3f s a position\n", builder.entries.size(), seconds,
+                builder.entries.empty() ? 0.0 : seconds / builder.entries.size());
+
+    std::sort(builder.entries.begin(), builder.entries.end(),
+              [](const ConnectFourBook::Entry &a, const ConnectFourBook::Entry &b) { return a.key < b.key; });
+    if (!writeBook(path, builder.entries, maxStones))
+    {
+        std::fprintf(stderr, "can't write %s\n", path.c_str());
+        return 1;
+    }
+    std::printf("  written to %s, %zu bytes of table\n", path.c_str(), builder.entries.size() * sizeof(ConnectFourBook::Entry));
+    return 0;
+}
@@ -0,0 +1,201 @@
+//
+// enumerate: walk the complete 3x3 game tree as a fixed performance and correctness reference
+//
+//   enumerate [-n <iterations>] [-t <threads>]
+//
+// starting from the empty board every legal game is played out to a win or a
+// full board. the counts are known exactly and checked:
+//   255,168 games, 5,478 distinct reachable positions, 549,946 tree nodes,
+//   and the split of X wins / O wins / draws by the ply the game ended on.
+//
+// the walk runs single threaded and then split over the 9 root moves, and the
+// full negamax the AI uses is timed from the empty board, all reported in
+// nodes/sec. the tree walk and negamax share TicTacToeSolver's move generation
+// and win detection, so changes there show up here.
+//
+
+#include "../classes/TicTacToeSolver.h"
+
+#include <algorithm>
+#include <bitset>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+struct TreeCounts
+{
+    uint64_t    nodes = 0;
+    uint64_t    xWins[10] = {};     // by ply
+    uint64_t    oWins[10] = {};
+    uint64_t    draws[10] = {};
+    // one bit per (x, o) mask pair seen
+    std::unique_ptr<std::bitset<1 << 18>> seen = std::make_unique<std::bitset<1 << 18>>();
+
+    uint64_t games() const
+    {
+        uint64_t n = 0;
+        for (int ply = 0; ply < 10; ++ply)
+            n += xWins[ply] + oWins[ply] + draws[ply];
+        return n;
+    }
+    void add(const TreeCounts &other)
+    {
+        nodes += other.nodes;
+        for (int ply = 0; ply < 10; ++ply)
+        {
+            xWins[ply] += other.xWins[ply];
+            oWins[ply] += other.oWins[ply];
+            draws[ply] += other.draws[ply];
+        }
+        *seen |= *other.seen;
+    }
+};
+
+//
+// visit a position after ply moves, X moves on even plies
+//
+static void walk(uint16_t x, uint16_t o, int ply, TreeCounts &counts)
+{
+    ++counts.nodes;
+    counts.seen->set((x << 9) | o);
+
+    // the side that just moved is the only one that can have won
+    if (ply & 1)
+    {
+        if (TicTacToeSolver::hasWin(x)) { counts.xWins[ply]++; return; }
+    }
+    else if (ply && TicTacToeSolver::hasWin(o))
+    {
+        counts.oWins[ply]++;
+        return;
+    }
+
+    uint16_t empty = TicTacToeSolver::emptyCells(x, o);
+    if (!empty)
+    {
+        counts.draws[ply]++;
+        return;
+    }
+    while (empty)
+    {
+        const uint16_t bit = empty & static_cast<uint16_t>(-empty);
+        empty ^= bit;
+        if (ply & 1)
+            walk(x, o | bit, ply + 1, counts);
+        else
+            walk(x | bit, o, ply + 1, counts);
+    }
+}
+
+//
+// the root node, then each of the 9 first moves as its own task
+//
+static void walkParallel(unsigned threads, TreeCounts &total)
+{
+    std::vector<TreeCounts> perMove(9);
+    std::vector<std::thread> pool;
+    for (unsigned t = 0; t < threads; ++t)
+    {
+        pool.emplace_back([&, t]() {
+            for (unsigned move = t; move < 9; move += threads)
+                walk(static_cast<uint16_t>(1 << move), 0, 1, perMove[move]);
+        });
+    }
+    for (std::thread &thread : pool)
+        thread.join();
+
+    ++total.nodes;
+    total.seen->set(0);
+    for (const TreeCounts &counts : perMove)
+        total.add(counts);
+}
+
+static bool check(const char *what, uint64_t got, uint64_t expected)
+{
+    const bool ok = got == expected;
+    std::printf("  %-22s %10llu   %s\n", what, (unsigned long long)got, ok ? "ok" : "MISMATCH");
+    if (!ok)
+        std::printf("  %-22s %10llu expected\n", "", (unsigned long long)expected);
+    return ok;
+}
+
+template <typename F>
+static double timeIt(int iterations, F body)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i)
+        body();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / iterations;
+}
+
+int main(int argc, char **argv)
+{
+    int iterations = 20;
+    unsigned threads = std::min(9u, std::max(1u, std::thread::hardware_concurrency()));
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+            iterations = std::max(1, std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+            threads = std::min(9, std::max(1, std::atoi(argv[++i])));
+        else
+        {
+            std::fprintf(stderr, "usage: enumerate [-n <iterations>] [-t <threads>]\n");
+            return 2;
+        }
+    }
+
+    // the reference numbers for the whole tree, ply by ply
+    static const uint64_t kXWins[10] = { 0, 0, 0, 0, 0, 1440, 0, 47952, 0, 81792 };
+    static const uint64_t kOWins[10] = { 0, 0, 0, 0, 0, 0, 5328, 0, 72576, 0 };
+    static const uint64_t kDraws[10] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 46080 };
+
+    TreeCounts counts;
+    walk(0, 0, 0, counts);
+    TreeCounts parallelCounts;
+    walkParallel(threads, parallelCounts);
+
+    std::printf("3x3 game tree from the initial state\n");
+    bool ok = true;
+    ok &= check("games", counts.games(), 255168);
+    ok &= check("distinct positions", counts.seen->count(), 5478);
+    ok &= check("tree nodes", counts.nodes, 549946);
+
+    std::printf("\n  ply     X wins     O wins      draws\n");
+    for (int ply = 0; ply < 10; ++ply)
+    {
+        if (!counts.xWins[ply] && !counts.oWins[ply] && !counts.draws[ply] && !kXWins[ply] && !kOWins[ply] && !kDraws[ply])
+            continue;
+        const bool plyOk = counts.xWins[ply] == kXWins[ply] && counts.oWins[ply] == kOWins[ply] && counts.draws[ply] == kDraws[ply];
+        std::printf("  %3d %10llu %10llu %10llu   %s\n", ply, (unsigned long long)counts.xWins[ply],
+                    (unsigned long long)counts.oWins[ply], (unsigned long long)counts.draws[ply], plyOk ? "ok" : "MISMATCH");
+        ok &= plyOk;
+    }
+
+    const bool parallelOk = parallelCounts.games() == counts.games() && parallelCounts.nodes == counts.nodes &&
+                            parallelCounts.seen->count() == counts.seen->count();
+    std::printf("\n  parallel walk matches  %s\n", parallelOk ? "ok" : "MISMATCH");
+    ok &= parallelOk;
+
+    // timings
+    const double single = timeIt(iterations, [] { TreeCounts c; walk(0, 0, 0, c); });
+    const double parallel = timeIt(iterations, [threads] { TreeCounts c; walkParallel(threads, c); });
+    uint64_t negamaxNodes = 0;
+    int rootValue = 0;
+    const double negamaxTime = timeIt(iterations, [&] { negamaxNodes = 0; rootValue = TicTacToeSolver::negamax(0, 0, 0, negamaxNodes); });
+    ok &= check("negamax root value", static_cast<uint64_t>(rootValue), 0);
+    ok &= check("negamax nodes", negamaxNodes, 549946);
+
+    std::printf("\n  %-38s %9.3f ms  %8.2f M nodes/s\n", "tree walk, 1 thread", single * 1e3, counts.nodes / single / 1e6);
+    char label[64];
+    std::snprintf(label, sizeof(label), "tree walk, %u threads over root moves", threads);
+    std::printf("  %-38s %9.3f ms  %8.2f M nodes/s\n", label, parallel * 1e3, counts.nodes / parallel / 1e6);
+    std::printf("  %-38s %9.3f ms  %8.2f M nodes/s\n", "negamax from the empty board", negamaxTime * 1e3, negamaxNodes / negamaxTime / 1e6);
+    std::printf("  (%d iterations each)\n", iterations);
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,266 @@
+//
+// gomoku_book: build the gomoku opening book offline
+//
+//   gomoku_book [-o <file>] [-p <stones>] [-s <side>] [-t <ms>] [-d <depth>] [-j <threads>]
+//
+// walks the opening tree from the empty board (what Gomoku's
+// initialStateString() starts from) up to positions with -p stones (default
+// 3). where the book side is to move (-s, default 1: the second player, the
+// one the game's AI plays), GomokuSearch searches for -t milliseconds
+// (default 1000) or to depth -d (default GomokuSearch::kMaxDepth) on -j
+// threads and only its move is followed; where the other side is to move,
+// every empty cell within two of a stone is (every cell on the empty board).
+// positions are only kept once for all eight symmetries of the board and for
+// every order of reaching them, so on the way each reply is turned into its
+// key and dropped if the key has been seen.
+//
+// the book goes to -o (default gomoku.book, where the game looks for it).
+// reported: the positions searched and how long it took, the book's size
+// per position, the time to build the hash and to look a position up. the
+// search takes about -t per book position, and the defaults give around 960
+// of them, so a default run takes 16 minutes; a line of progress is printed
+// every kProgressEvery searches.
+//
+// exits non-zero if a book position, in any of its symmetries, doesn't
+// come back with its move, or if too many positions that aren't in the book
+// are found in it.
+//
+
+#include "../classes/GomokuSearch.h"
+#include "../classes/OpeningBook.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+static const size_t kProgressEvery = 50;
+
+static double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void playMoves(GomokuBoard &board, const std::vector<int> &moves)
+{
+    board.clear();
+    for (int cell : moves)
+        board.place(cell, board.sideToMove());
+}
+
+// a board's cells moved by one of the symmetries
+static void transformBoard(const GomokuBoard &board, int symmetry, int8_t *cells)
+{
+    for (int cell = 0; cell < GomokuBoard::kCells; ++cell)
+        cells[OpeningBook::transformCell(cell, GomokuBoard::kSize, symmetry)] = static_cast<int8_t>(board.cell(cell));
+}
+
+int main(int argc, char **argv)
+{
+    std::string path = "gomoku.book";
+    int maxStones = 3;
+    int bookSide = 1;
+    int budgetMs = 1000;
+    int depth = GomokuSearch::kMaxDepth;
+    int threads = 1;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+            path = argv[++i];
+        else if (std::strcmp(argv[i], "-p") == 0 && i + 1 < argc)
+            maxStones = std::max(0, std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+            bookSide = std::atoi(argv[++i]) ? 1 : 0;
+        else if (std::strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+            budgetMs = std::max(1, std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "-d") == 0 && i + 1 < argc)
+            depth = std::clamp(std::atoi(argv[++i]), 1, GomokuSearch::kMaxDepth);
+        else if (std::strcmp(argv[i], "-j") == 0 && i + 1 < argc)
+            threads = std::max(1, std::atoi(argv[++i]));
+        else
+        {
+            std::fprintf(stderr, "usage: gomoku_book [-o <file>] [-p <stones>] [-s <side>] [-t <ms>] [-d <depth>] [-j <threads>]\n");
+            return 2;
+        }
+    }
+
+    GomokuSearch search;
+    search.setThreads(threads);
+    GomokuBoard board;
+    std::vector<OpeningBook::Entry> entries;
+    std::unordered_set<uint64_t> seen;
+    std::vector<std::vector<int>> frontier(1);
+    int symmetry;
+    seen.insert(OpeningBook::canonicalKey(board.cells(), GomokuBoard::kSize, symmetry));
+
+    // one layer of stones at a time, every position in a layer reached from the one before
+    const auto start = std::chrono::steady_clock::now();
+    for (int stones = 0; stones <= maxStones && !frontier.empty(); ++stones)
+    {
+        std::vector<std::vector<int>> next;
+        size_t searched = 0;
+        for (std::vector<int> &moves : frontier)
+        {
+            playMoves(board, moves);
+            if (board.winner() != GomokuBoard::kEmpty || board.full())
+                continue;
+
+            if (board.sideToMove() == bookSide)
+            {
+                search.clearTable();
+                const int move = search.bestMove(board, std::chrono::milliseconds(budgetMs), depth);
+                if (move < 0)
+                    continue;
+                const uint64_t key = OpeningBook::canonicalKey(board.cells(), GomokuBoard::kSize, symmetry);
+                entries.push_back({ key, static_cast<uint16_t>(OpeningBook::transformCell(move, GomokuBoard::kSize, symmetry)) });
+                if (++searched % kProgressEvery == 0)
+                {
+                    std::printf("  %d stones: %zu of %zu positions searched (%.1f s so far)\n", stones, searched,
+                                frontier.size(), secondsSince(start));
+                    std::fflush(stdout);
+                }
+
+                board.place(move, board.sideToMove());
+                if (seen.insert(OpeningBook::canonicalKey(board.cells(), GomokuBoard::kSize, symmetry)).second)
+                {
+                    moves.push_back(move);
+                    next.push_back(moves);
+                }
+                continue;
+            }
+
+            for (int cell = 0; cell < GomokuBoard::kCells; ++cell)
+            {
+                if (board.cell(cell) != GomokuBoard::kEmpty || (board.stoneCount() > 0 && !board.isNearStones(cell)))
+                    continue;
+                board.place(cell, board.sideToMove());
+                if (seen.insert(OpeningBook::canonicalKey(board.cells(), GomokuBoard::kSize, symmetry)).second)
+                {
+                    std::vector<int> reply = moves;
+                    reply.push_back(cell);
+                    next.push_back(std::move(reply));
+                }
+                board.undo();
+            }
+        }
+        std::printf("%d stones: %zu positions, %zu searched (%.1f s so far)\n", stones, frontier.size(), searched,
+                    secondsSince(start));
+        std::fflush(stdout);
+        frontier = std::move(next);
+    }
+
+    OpeningBook book;
+    auto timer = std::chrono::steady_clock::now();
+    if (!book.build(entries, GomokuBoard::kSize))
+    {
+        std::fprintf(stderr, "no perfect hash found for %zu positions\n", entries.size());
+        return 1;
+    }
+    const double buildSeconds = secondsSince(timer);
+    if (!book.save(path))
+    {
+        std::fprintf(stderr, "can't write %s\n", path.c_str());
+        return 1;
+    }
+    OpeningBook loaded;
+    std::string error;
+    if (!loaded.load(path, error))
+    {
+        std::fprintf(stderr, "%s: %s\n", path.c_str(), error.c_str());
+        return 1;
+    }
+    std::printf("wrote %s: %zu positions, %zu bytes (%.2f a position), hash built in %.3f ms\n", path.c_str(),
+                loaded.size(), loaded.bytes(), entries.empty() ? 0.0 : double(loaded.bytes()) / entries.size(),
+                buildSeconds * 1e3);
+
+    // every position in the book, in all eight frames, has to give its move back in that frame
+    bool ok = true;
+    std::vector<int8_t> cells(GomokuBoard::kCells);
+    size_t probes = 0;
+    double probeSeconds = 0;
+    frontier.assign(1, std::vector<int>());
+    size_t checked = 0;
+    std::mt19937 rng(1);
+    for (int stones = 0; stones <= maxStones && ok; ++stones)
+    {
+        std::vector<std::vector<int>> next;
+        for (const std::vector<int> &moves : frontier)
+        {
+            playMoves(board, moves);
+            if (board.sideToMove() != bookSide)
+            {
+                // one reply in a few keeps the check quick
+                for (int cell = 0; cell < GomokuBoard::kCells; ++cell)
+                {
+                    if (board.cell(cell) == GomokuBoard::kEmpty && (board.stoneCount() == 0 || board.isNearStones(cell)) &&
+                        rng() % 4 == 0)
+                    {
+                        std::vector<int> reply = moves;
+                        reply.push_back(cell);
+                        next.push_back(std::move(reply));
+                    }
+                }
+                continue;
+            }
+            const int move = loaded.probe(board.cells());
+            if (move < 0 || board.cell(move) != GomokuBoard::kEmpty)
+            {
+                ok = false;
+                break;
+            }
+            for (int s = 0; s < OpeningBook::kSymmetries; ++s)
+            {
+                transformBoard(board, s, cells.data());
+                const auto t = std::chrono::steady_clock::now();
+                const int mirrored = loaded.probe(cells.data());
+                probeSeconds += secondsSince(t);
+                ++probes;
+                // a symmetric position may answer with an equivalent cell: the boards after the two moves have to match
+                int8_t moved[GomokuBoard::kCells];
+                std::copy(cells.begin(), cells.end(), moved);
+                if (mirrored < 0 || moved[mirrored] != GomokuBoard::kEmpty)
+                {
+                    ok = false;
+                    break;
+                }
+                moved[mirrored] = static_cast<int8_t>(board.sideToMove());
+                int8_t original[GomokuBoard::kCells];
+                std::copy(board.cells(), board.cells() + GomokuBoard::kCells, original);
+                original[move] = static_cast<int8_t>(board.sideToMove());
+                ok &= OpeningBook::canonicalKey(moved, GomokuBoard::kSize, symmetry) ==
+                      OpeningBook::canonicalKey(original, GomokuBoard::kSize, symmetry);
+            }
+            ++checked;
+            std::vector<int> followed = moves;
+            followed.push_back(move);
+            next.push_back(std::move(followed));
+        }
+        frontier = std::move(next);
+    }
+    std::printf("checked %zu book positions in all 8 symmetries: %s, %.2f us a lookup\n", checked, ok ? "ok" : "WRONG",
+                probes ? probeSeconds / probes * 1e6 : 0.0);
+
+    // random positions a few stones past the book shouldn't be found in it
+    size_t found = 0;
+    const size_t kStrangers = 100000;
+    for (size_t i = 0; i < kStrangers; ++i)
+    {
+        board.clear();
+        const int stones = maxStones + 2 + static_cast<int>(rng() % 4);
+        while (board.stoneCount() < stones)
+        {
+            const int cell = static_cast<int>(rng() % GomokuBoard::kCells);
+            if (board.cell(cell) == GomokuBoard::kEmpty)
+                board.place(cell, board.sideToMove());
+        }
+        found += loaded.probe(board.cells()) >= 0;
+    }
+    std::printf("%zu of %zu positions not in the book found in it\n", found, kStrangers);
+    ok &= found <= 2;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,488 @@
+//
+// gomoku_nnue: train a GomokuNetwork, check it and time it against the handcrafted eval
+//
+//   gomoku_nnue [-o <file>] [-n <positions>] [-e <epochs>]
+//
+// plays -n positions (default 60000) of semi-random gomoku, each move the
+// best of three random cells near the stones by how much it adds to both
+// players' windows, stopping a game once either side has a cell that makes
+// five (the search settles those without the eval). each position is
+// labelled with GomokuBoard::evaluate(), so this distils the handcrafted
+// eval into the network; a stronger network would need labels from search
+// or the results of self-play games, which the file doesn't care about.
+//
+// a tenth of the positions are held out, the rest train the network in
+// floating point for -e epochs (default 10) of Adam, on minibatches of 256,
+// with the loss on the eval squashed by tanh so that won-looking positions
+// don't swamp the rest. the weights are then quantized, written to -o
+// (default gomoku.nnue, where the game looks for it) and read back, and
+// everything after that uses the network from the file.
+//
+// reported: the held-out loss of the float network, how far the quantized
+// scores are from the float ones, how well they follow the handcrafted eval,
+// evaluations per second from a ready accumulator and from scratch, what
+// keeping the accumulator adds to GomokuBoard::place() / undo(), and the
+// search's nodes per second with each eval.
+//
+// exits non-zero if the accumulator GomokuBoard keeps through random place
+// and undo sequences ever differs from one built from scratch, if
+// evaluate() and evaluatePortable() ever disagree, or if the file doesn't
+// load back.
+//
+
+#include "../classes/GomokuNetwork.h"
+#include "../classes/GomokuSearch.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+using Network = GomokuNetwork;
+
+struct Sample
+{
+    std::array<int8_t, GomokuBoard::kCells> cells;
+    int         side;
+    int         eval;
+};
+
+static double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// seconds per call, run for about half a second
+template <typename Kernel>
+static double timeCalls(Kernel kernel)
+{
+    const auto start = std::chrono::steady_clock::now();
+    int calls = 0;
+    double seconds = 0;
+    do
+    {
+        kernel();
+        ++calls;
+        seconds = secondsSince(start);
+    } while (seconds < 0.5);
+    return seconds / calls;
+}
+
+static int randomNearCell(const GomokuBoard &board, std::mt19937_64 &rng)
+{
+    for (;;)
+    {
+        const int cell = static_cast<int>(rng() % GomokuBoard::kCells);
+        if (board.cell(cell) == GomokuBoard::kEmpty && board.isNearStones(cell))
+            return cell;
+    }
+}
+
+static std::vector<Sample> generate(size_t count, std::mt19937_64 &rng)
+{
+    std::vector<Sample> samples;
+    samples.reserve(count);
+    GomokuBoard board;
+    while (samples.size() < count)
+    {
+        board.clear();
+        board.place(GomokuBoard::cellIndex(5 + rng() % 5, 5 + rng() % 5), 0);
+        const int length = 8 + static_cast<int>(rng() % 60);
+        while (board.stoneCount() < length && samples.size() < count)
+        {
+            const int side = board.sideToMove();
+            int best = -1, bestGain = -1;
+            for (int i = 0; i < 3; ++i)
+            {
+                const int cell = randomNearCell(board, rng);
+                const int gain = board.gain(cell, side) + board.gain(cell, side ^ 1);
+                if (gain > bestGain)
+                {
+                    best = cell;
+                    bestGain = gain;
+                }
+            }
+            board.place(best, side);
+            if (board.hasWinningCell(0) || board.hasWinningCell(1))
+                break;
+            if (rng() & 1)
+            {
+                Sample sample;
+                std::copy(board.cells(), board.cells() + GomokuBoard::kCells, sample.cells.begin());
+                sample.side = board.sideToMove();
+                sample.eval = board.evaluate();
+                samples.push_back(sample);
+            }
+        }
+    }
+    return samples;
+}
+
+static float squash(int eval)
+{
+    return std::tanh(float(eval) / Network::kOutputScale);
+}
+
+//
+// the float network with what a backward pass needs
+//
+struct Trainer
+{
+    Network::FloatWeights   weights;
+    Network::FloatWeights   gradient;
+    Network::FloatWeights   mean;           // Adam's moments
+    Network::FloatWeights   variance;
+    int                     steps = 0;
+
+    float   acc[2][Network::kHidden];
+    float   input[2 * Network::kHidden];
+    float   layer2[Network::kLayer2];
+    float   hidden2[Network::kLayer2];
+
+    explicit Trainer(std::mt19937_64 &rng)
+    {
+        std::normal_distribution<float> first(0.0f, 0.1f);
+        std::normal_distribution<float> second(0.0f, 1.0f / std::sqrt(float(2 * Network::kHidden)));
+        std::normal_distribution<float> third(0.0f, 0.25f);
+        for (float &w : weights.w1)
+            w = first(rng);
+        for (float &b : weights.b1)
+            b = 0.25f;
+        for (float &w : weights.w2)
+            w = second(rng);
+        for (float &w : weights.w3)
+            w = third(rng);
+    }
+
+    // the output, 1.0 being kOutputScale
+    float forward(const Sample &sample)
+    {
+        for (int side = 0; side < 2; ++side)
+            std::copy(weights.b1.begin(), weights.b1.end(), acc[side]);
+        for (int cell = 0; cell < GomokuBoard::kCells; ++cell)
+        {
+            if (sample.cells[cell] == GomokuBoard::kEmpty)
+                continue;
+            for (int side = 0; side < 2; ++side)
+            {
+                const float *row = &weights.w1[size_t(Network::feature(cell, sample.cells[cell], sample.side ^ side)) * Network::kHidden];
+                for (int h = 0; h < Network::kHidden; ++h)
+                    acc[side][h] += row[h];
+            }
+        }
+        for (int side = 0; side < 2; ++side)
+        {
+            for (int h = 0; h < Network::kHidden; ++h)
+                input[side * Network::kHidden + h] = std::clamp(acc[side][h], 0.0f, 1.0f);
+        }
+        float out = weights.b3;
+        for (int o = 0; o < Network::kLayer2; ++o)
+        {
+            const float *w = &weights.w2[o * 2 * Network::kHidden];
+            float sum = weights.b2[o];
+            for (int i = 0; i < 2 * Network::kHidden; ++i)
+                sum += input[i] * w[i];
+            layer2[o] = sum;
+            hidden2[o] = std::clamp(sum, 0.0f, 1.0f);
+            out += hidden2[o] * weights.w3[o];
+        }
+        return out;
+    }
+
+    // add the gradient of the loss for the sample forward() last saw; returns the loss
+    float backward(const Sample &sample, float out)
+    {
+        const float predicted = std::tanh(out);
+        const float error = predicted - squash(sample.eval);
+        const float dOut = 2 * error * (1 - predicted * predicted);
+
+        gradient.b3 += dOut;
+        float dInput[2 * Network::kHidden] = {};
+        for (int o = 0; o < Network::kLayer2; ++o)
+        {
+            gradient.w3[o] += dOut * hidden2[o];
+            if (layer2[o] <= 0 || layer2[o] >= 1)
+                continue;
+            const float dLayer2 = dOut * weights.w3[o];
+            gradient.b2[o] += dLayer2;
+            const float *w = &weights.w2[o * 2 * Network::kHidden];
+            float *g = &gradient.w2[o * 2 * Network::kHidden];
+            for (int i = 0; i < 2 * Network::kHidden; ++i)
+            {
+                g[i] += dLayer2 * input[i];
+                dInput[i] += dLayer2 * w[i];
+            }
+        }
+        float dAcc[2][Network::kHidden];
+        for (int side = 0; side < 2; ++side)
+        {
+            for (int h = 0; h < Network::kHidden; ++h)
+            {
+                const float a = acc[side][h];
+                dAcc[side][h] = a > 0 && a < 1 ? dInput[side * Network::kHidden + h] : 0;
+                gradient.b1[h] += dAcc[side][h];
+            }
+        }
+        for (int cell = 0; cell < GomokuBoard::kCells; ++cell)
+        {
+            if (sample.cells[cell] == GomokuBoard::kEmpty)
+                continue;
+            for (int side = 0; side < 2; ++side)
+            {
+                float *g = &gradient.w1[size_t(Network::feature(cell, sample.cells[cell], sample.side ^ side)) * Network::kHidden];
+                for (int h = 0; h < Network::kHidden; ++h)
+                    g[h] += dAcc[side][h];
+            }
+        }
+        return error * error;
+    }
+
+    static void adam(float *p, float *g, float *m, float *v, size_t count, float rate, float scale, float correction1, float correction2)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            const float grad = g[i] * scale;
+            m[i] = 0.9f * m[i] + 0.1f * grad;
+            v[i] = 0.999f * v[i] + 0.001f * grad * grad;
+            p[i] -= rate * (m[i] / correction1) / (std::sqrt(v[i] / correction2) + 1e-8f);
+            g[i] = 0;
+        }
+    }
+
+    void step(int batchSize, float rate)
+    {
+        ++steps;
+        const float scale = 1.0f / batchSize;
+        const float correction1 = 1 - std::pow(0.9f, float(steps));
+        const float correction2 = 1 - std::pow(0.999f, float(steps));
+        auto update = [&](std::vector<float> Network::FloatWeights::*member) {
+            adam((weights.*member).data(), (gradient.*member).data(), (mean.*member).data(), (variance.*member).data(),
+                 (weights.*member).size(), rate, scale, correction1, correction2);
+        };
+        update(&Network::FloatWeights::w1);
+        update(&Network::FloatWeights::b1);
+        update(&Network::FloatWeights::w2);
+        update(&Network::FloatWeights::b2);
+        update(&Network::FloatWeights::w3);
+        adam(&weights.b3, &gradient.b3, &mean.b3, &variance.b3, 1, rate, scale, correction1, correction2);
+
+        // keep the later layers' weights inside what an int8 can hold
+        const float limit = 127.0f / Network::kWeightScale;
+        for (float &w : weights.w2)
+            w = std::clamp(w, -limit, limit);
+        for (float &w : weights.w3)
+            w = std::clamp(w, -limit, limit);
+    }
+};
+
+static void setUp(GomokuBoard &board, const Sample &sample)
+{
+    board.clear();
+    for (int cell = 0; cell < GomokuBoard::kCells; ++cell)
+    {
+        if (sample.cells[cell] != GomokuBoard::kEmpty)
+            board.place(cell, sample.cells[cell]);
+    }
+}
+
+static double correlation(const std::vector<double> &x, const std::vector<double> &y)
+{
+    const double n = double(x.size());
+    double sx = 0, sy = 0, sxx = 0, syy = 0, sxy = 0;
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        sx += x[i];
+        sy += y[i];
+        sxx += x[i] * x[i];
+        syy += y[i] * y[i];
+        sxy += x[i] * y[i];
+    }
+    const double denominator = std::sqrt((n * sxx - sx * sx) * (n * syy - sy * sy));
+    return denominator > 0 ? (n * sxy - sx * sy) / denominator : 0;
+}
+
+int main(int argc, char **argv)
+{
+    std::string path = "gomoku.nnue";
+    size_t positions = 60000;
+    int epochs = 10;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+            path = argv[++i];
+        else if (std::strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+            positions = static_cast<size_t>(std::max(100, std::atoi(argv[++i])));
+        else if (std::strcmp(argv[i], "-e") == 0 && i + 1 < argc)
+            epochs = std::max(0, std::atoi(argv[++i]));
+        else
+        {
+            std::fprintf(stderr, "usage: gomoku_nnue [-o <file>] [-n <positions>] [-e <epochs>]\n");
+            return 2;
+        }
+    }
+
+    std::mt19937_64 rng(1);
+    auto start = std::chrono::steady_clock::now();
+    std::vector<Sample> samples = generate(positions, rng);
+    std::shuffle(samples.begin(), samples.end(), rng);
+    const size_t held = samples.size() / 10;
+    const std::vector<Sample> test(samples.end() - held, samples.end());
+    samples.resize(samples.size() - held);
+    std::printf("%zu positions played in %.1f s, %zu to train on and %zu held out\n", positions, secondsSince(start),
+                samples.size(), test.size());
+
+    // train
+    const int kBatch = 256;
+    Trainer trainer(rng);
+    start = std::chrono::steady_clock::now();
+    for (int epoch = 0; epoch < epochs; ++epoch)
+    {
+        std::shuffle(samples.begin(), samples.end(), rng);
+        const float rate = epoch < epochs * 2 / 3 ? 1e-3f : 3e-4f;
+        double loss = 0;
+        for (size_t first = 0; first < samples.size(); first += kBatch)
+        {
+            const size_t last = std::min(samples.size(), first + kBatch);
+            for (size_t i = first; i < last; ++i)
+                loss += trainer.backward(samples[i], trainer.forward(samples[i]));
+            trainer.step(static_cast<int>(last - first), rate);
+        }
+        double testLoss = 0;
+        for (const Sample &sample : test)
+        {
+            const float error = std::tanh(trainer.forward(sample)) - squash(sample.eval);
+            testLoss += error * error;
+        }
+        std::printf("epoch %2d: loss %.4f, held out %.4f  (%.1f s)\n", epoch + 1, loss / samples.size(),
+                    testLoss / test.size(), secondsSince(start));
+    }
+
+    // quantize, save and read back
+    {
+        Network quantized;
+        quantized.quantize(trainer.weights);
+        if (!quantized.save(path))
+        {
+            std::fprintf(stderr, "can't write %s\n", path.c_str());
+            return 1;
+        }
+    }
+    Network network;
+    std::string error;
+    if (!network.load(path, error))
+    {
+        std::fprintf(stderr, "%s: %s\n", path.c_str(), error.c_str());
+        return 1;
+    }
+    std::printf("\nwrote %s, evaluate() is %s\n", path.c_str(), Network::kernelName());
+
+    // the accumulator kept through place and undo against one from scratch,
+    // and the two kernels against each other
+    size_t accumulatorMismatches = 0, kernelMismatches = 0, checks = 0;
+    GomokuBoard board;
+    board.setNetwork(&network);
+    GomokuAccumulator fresh;
+    for (int game = 0; game < 200; ++game)
+    {
+        board.clear();
+        board.place(GomokuBoard::cellIndex(7, 7), 0);
+        for (int move = 0; move < 200 && !board.full(); ++move)
+        {
+            if (board.stoneCount() > 1 && rng() % 3 == 0)
+                board.undo();
+            else
+                board.place(randomNearCell(board, rng), board.sideToMove());
+            network.refresh(fresh, board.cells());
+            accumulatorMismatches += std::memcmp(&fresh, &board.accumulator(), sizeof(fresh)) != 0;
+            for (int side = 0; side < 2; ++side)
+                kernelMismatches += network.evaluate(board.accumulator(), side) != network.evaluatePortable(board.accumulator(), side);
+            ++checks;
+        }
+    }
+    std::printf("accumulator after place/undo: %zu of %zu differ from a refresh\n", accumulatorMismatches, checks);
+    std::printf("evaluate() against evaluatePortable(): %zu of %zu differ\n", kernelMismatches, checks * 2);
+
+    // the quantized network against the float one and against the handcrafted eval
+    std::vector<GomokuAccumulator> accumulators(test.size());
+    std::vector<double> scores(test.size()), targets(test.size());
+    double quantizationError = 0;
+    size_t sameSign = 0;
+    for (size_t i = 0; i < test.size(); ++i)
+    {
+        network.refresh(accumulators[i], test[i].cells.data());
+        const int score = network.evaluate(accumulators[i], test[i].side);
+        quantizationError += std::fabs(score - trainer.forward(test[i]) * Network::kOutputScale);
+        scores[i] = std::tanh(double(score) / Network::kOutputScale);
+        targets[i] = squash(test[i].eval);
+        sameSign += (score > 0) == (test[i].eval > 0);
+    }
+    std::printf("quantized against float: %.1f mean difference (%d is 1.0)\n", quantizationError / test.size(),
+                Network::kOutputScale);
+    std::printf("against the handcrafted eval, held out: correlation %.3f, same sign %.1f%%\n",
+                correlation(scores, targets), 100.0 * sameSign / test.size());
+
+    // speed
+    // the calls are into another file, so there's no need to keep the results
+    size_t next = 0;
+    const double incremental = timeCalls([&]() {
+        for (int i = 0; i < 1000; ++i, next = (next + 1) % test.size())
+            network.evaluate(accumulators[next], test[next].side);
+    }) / 1000;
+    const double scratch = timeCalls([&]() {
+        GomokuAccumulator accumulator;
+        for (int i = 0; i < 1000; ++i, next = (next + 1) % test.size())
+        {
+            network.refresh(accumulator, test[next].cells.data());
+            network.evaluate(accumulator, test[next].side);
+        }
+    }) / 1000;
+    std::printf("\nnetwork from the accumulator %8.2f M evals/s\n", 1e-6 / incremental);
+    std::printf("network from scratch         %8.2f M evals/s\n", 1e-6 / scratch);
+
+    GomokuBoard plain;
+    setUp(plain, test[0]);
+    setUp(board, test[0]);
+    const auto placeUndo = [&](GomokuBoard &b) {
+        for (int cell = 0; cell < GomokuBoard::kCells; ++cell)
+        {
+            if (b.cell(cell) == GomokuBoard::kEmpty)
+            {
+                b.place(cell, b.sideToMove());
+                b.undo();
+            }
+        }
+    };
+    const int empty = GomokuBoard::kCells - plain.stoneCount();
+    const double plainTime = timeCalls([&]() { placeUndo(plain); }) / empty;
+    const double networkTime = timeCalls([&]() { placeUndo(board); }) / empty;
+    std::printf("place + undo, handcrafted    %8.1f ns\n", plainTime * 1e9);
+    std::printf("place + undo, with network   %8.1f ns\n", networkTime * 1e9);
+
+    GomokuSearch search;
+    for (int useNetwork = 0; useNetwork < 2; ++useNetwork)
+    {
+        search.setNetwork(useNetwork ? &network : nullptr);
+        uint64_t nodes = 0;
+        int depths = 0;
+        const int kSearches = 8;
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < kSearches; ++i)
+        {
+            search.clearTable();
+            setUp(plain, test[i]);
+            search.bestMove(plain, std::chrono::milliseconds(250));
+            nodes += search.nodeCount();
+            depths += search.completedDepth();
+        }
+        std::printf("search, %-20s %8.0f k nodes/s, depth %.1f in 250 ms\n", useNetwork ? "network eval" : "handcrafted eval",
+                    nodes / secondsSince(start) / 1e3, double(depths) / kSearches);
+    }
+
+    return accumulatorMismatches || kernelMismatches ? 1 : 0;
+}
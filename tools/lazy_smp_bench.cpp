@@ -0,0 +1,93 @@
+//
+// lazy_smp_bench: time-to-depth of the gomoku search by thread count
+//
+//   lazy_smp_bench [-d <depth>] [-t <max threads>]
+//
+// GomokuSearch searches a few opening positions (cells played in turn from
+// the empty board, black first) until its main thread finishes depth -d
+// (default 8), with a cleared table each time, on 1, 2, 4 and 8 threads (up
+// to -t). lazy SMP doesn't split the tree, the helpers only fill the shared
+// table, so the number that matters is how much sooner the main thread gets
+// to the depth: the time over all the positions is reported with the
+// speedup over one thread, along with the nodes every thread searched.
+//
+// the helper threads make the search nondeterministic, so the moves can
+// differ from one run to the next; they're printed for comparison only.
+// with more threads than the machine has hardware threads the times only
+// show the overhead.
+//
+
+#include "../classes/GomokuSearch.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+static const char *kPositions[] = {
+    "7,7 8,8 8,6",
+    "7,7 7,8 8,8 6,6 9,7",
+    "7,7 8,7 6,8 8,9 7,9 6,9",
+    "7,7 8,6 7,6 7,5 9,6 6,8 8,8",
+};
+
+// "col,row" pairs separated by spaces
+static void playSequence(GomokuBoard &board, const char *cells)
+{
+    int col, row, used;
+    while (std::sscanf(cells, " %d,%d%n", &col, &row, &used) == 2)
+    {
+        board.place(GomokuBoard::cellIndex(col, row), board.sideToMove());
+        cells += used;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int depth = 8;
+    int maxThreads = 8;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "-d") == 0 && i + 1 < argc)
+            depth = std::min(GomokuSearch::kMaxDepth, std::max(1, std::atoi(argv[++i])));
+        else if (std::strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+            maxThreads = std::max(1, std::atoi(argv[++i]));
+        else
+        {
+            std::fprintf(stderr, "usage: lazy_smp_bench [-d <depth>] [-t <max threads>]\n");
+            return 2;
+        }
+    }
+    std::printf("%u hardware threads, depth %d\n\n", std::max(1u, std::thread::hardware_concurrency()), depth);
+
+    GomokuSearch search;
+    double serialSeconds = 0;
+    for (int threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        search.setThreads(threads);
+        std::printf("%2d threads\n", threads);
+        uint64_t totalNodes = 0;
+        double totalSeconds = 0;
+        for (const char *cells : kPositions)
+        {
+            GomokuBoard board;
+            playSequence(board, cells);
+            search.clearTable();
+            const auto start = std::chrono::steady_clock::now();
+            const int move = search.bestMove(board, std::chrono::hours(1), depth);
+            const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            totalNodes += search.nodeCount();
+            totalSeconds += seconds;
+            std::printf("  %2d stones  move %2d,%-2d  depth %2d  %11llu nodes  %9.3f ms\n", board.stoneCount(),
+                        move % GomokuBoard::kSize, move / GomokuBoard::kSize, search.completedDepth(),
+                        (unsigned long long)search.nodeCount(), seconds * 1e3);
+        }
+        if (threads == 1)
+            serialSeconds = totalSeconds;
+        const double speedup = totalSeconds > 0 ? serialSeconds / totalSeconds : 0.0;
+        std::printf("  total %.3f s, %.2f M nodes/s, time-to-depth speedup %.2f, efficiency %.0f%%\n\n", totalSeconds,
+                    totalSeconds > 0 ? totalNodes / totalSeconds / 1e6 : 0.0, speedup, speedup / threads * 100.0);
+    }
+    return 0;
+}
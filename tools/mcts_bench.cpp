@@ -0,0 +1,145 @@
+//
+// mcts_bench: measure MonteCarloTreeSearch against UltimateMCTS
+//
+//   mcts_bench [-p <playouts>] [-j <threads>] [-b <batch>]
+//
+// runs -p playouts (default 200000) from the empty ultimate tic-tac-toe
+// board with UltimateMCTS, which is written for the game, and with the
+// generic MonteCarloTreeSearch over UltimatePosition: playouts per second,
+// nodes in the tree and bytes per node. then the generic one again with
+// 1, 2, 4 ... up to -j threads (default the hardware's) and with batches of
+// 1, 4, 16 and 64 leaves (-b sets the batch for everything else, default 8),
+// on the 8x8 three player m,n,k board MNK plays, and on the empty 11x11 hex
+// board with one thread and with -j, where HexBoard's own full-board
+// playout stands in for random moves.
+//
+// the last part plays a game of ultimate tic-tac-toe against itself,
+// advancing the tree after each move, and reports how many of the nodes
+// each search ended with were kept for the next one.
+//
+// exits non-zero if the search misses a win in one on a small m,n,k board.
+//
+
+#include "../classes/HexBoard.h"
+#include "../classes/MNKSearch.h"
+#include "../classes/MonteCarloTreeSearch.h"
+#include "../classes/UltimateMCTS.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+template <typename Position>
+static void report(const char *name, const MonteCarloTreeSearch<Position> &mcts)
+{
+    std::printf("  %-34s %9llu playouts  %8.3f s  %9.0f playouts/s  %8zu nodes  %2zu bytes a node\n", name,
+                (unsigned long long)mcts.playouts(), mcts.seconds(), mcts.playoutsPerSecond(), mcts.nodesUsed(),
+                mcts.nodeBytes());
+}
+
+int main(int argc, char **argv)
+{
+    uint64_t playouts = 200000;
+    int maxThreads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    int batch = 8;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "-p") == 0 && i + 1 < argc)
+            playouts = std::max(1ull, std::strtoull(argv[++i], nullptr, 10));
+        else if (std::strcmp(argv[i], "-j") == 0 && i + 1 < argc)
+            maxThreads = std::max(1, std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "-b") == 0 && i + 1 < argc)
+            batch = std::max(1, std::atoi(argv[++i]));
+        else
+        {
+            std::fprintf(stderr, "usage: mcts_bench [-p <playouts>] [-j <threads>] [-b <batch>]\n");
+            return 2;
+        }
+    }
+
+    const UltimatePosition empty;
+    MonteCarloTreeSearch<UltimatePosition> generic;
+    generic.setBatchSize(batch);
+
+    std::printf("ultimate tic-tac-toe, empty board:\n");
+    UltimateMCTS specific;
+    specific.bestMove(empty, static_cast<int>(std::min<uint64_t>(playouts, 0x7FFFFFFF)));
+    std::printf("  %-34s %9d playouts  %8.3f s  %9.0f playouts/s  %8zu nodes  16 bytes a node\n", "UltimateMCTS",
+                specific.playouts(), specific.seconds(), specific.playoutsPerSecond(), specific.nodesUsed());
+    generic.reset();
+    generic.bestMove(empty, playouts);
+    report("MonteCarloTreeSearch", generic);
+
+    std::printf("\nthreads:\n");
+    for (int threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        char name[64];
+        std::snprintf(name, sizeof(name), "%d thread%s", threads, threads > 1 ? "s" : "");
+        generic.setThreads(threads);
+        generic.reset();
+        generic.bestMove(empty, playouts);
+        report(name, generic);
+    }
+    generic.setThreads(maxThreads);
+
+    std::printf("\nleaves a batch:\n");
+    for (int leaves : { 1, 4, 16, 64 })
+    {
+        char name[64];
+        std::snprintf(name, sizeof(name), "batch of %d", leaves);
+        generic.setBatchSize(leaves);
+        generic.reset();
+        generic.bestMove(empty, playouts);
+        report(name, generic);
+    }
+    generic.setBatchSize(batch);
+
+    std::printf("\nm,n,k 8x8, four in a row, three players:\n");
+    MonteCarloTreeSearch<MNKPosition> mnk;
+    mnk.setThreads(maxThreads);
+    mnk.setBatchSize(batch);
+    mnk.bestMove(MNKPosition(8, 8, 4, 3), playouts);
+    report("MonteCarloTreeSearch", mnk);
+
+    std::printf("\nhex 11x11, empty board:\n");
+    MonteCarloTreeSearch<HexBoard> hex(1 << 21);
+    hex.setBatchSize(batch);
+    hex.bestMove(HexBoard(), playouts);
+    report("1 thread", hex);
+    char hexThreads[64];
+    std::snprintf(hexThreads, sizeof(hexThreads), "%d thread%s", maxThreads, maxThreads > 1 ? "s" : "");
+    hex.setThreads(maxThreads);
+    hex.reset();
+    hex.bestMove(HexBoard(), playouts);
+    report(hexThreads, hex);
+
+    // every search's tree is handed on to the next through both sides' moves
+    std::printf("\nself-play with the tree kept between moves, %llu playouts a move:\n", (unsigned long long)(playouts / 10));
+    UltimatePosition position;
+    generic.reset();
+    size_t kept = 0, ended = 0;
+    int moves = 0;
+    while (!position.gameOver())
+    {
+        const int move = generic.bestMove(position, playouts / 10);
+        ended += generic.nodesUsed();
+        position.play(move);
+        generic.advance(static_cast<UltimatePosition::Move>(move));
+        kept += generic.reusedNodes();
+        ++moves;
+    }
+    std::printf("  %d moves, %s, %.1f%% of the nodes kept on average\n", moves,
+                position.winner() < 0 ? "drawn" : position.winner() == 0 ? "X won" : "O won",
+                ended ? 100.0 * kept / ended : 0.0);
+
+    // a win in one has to be found: X has 0 and 1, O has 3 and 4
+    MNKPosition small(3, 3, 3, 2);
+    for (int cell : { 0, 3, 1, 4 })
+        small.play(cell);
+    MonteCarloTreeSearch<MNKPosition> check(1 << 16);
+    check.setThreads(maxThreads);
+    const int win = check.bestMove(small, 20000);
+    std::printf("\nwin in one on 3x3: played %d, %s\n", win, win == 2 ? "ok" : "WRONG");
+    return win == 2 ? 0 : 1;
+}
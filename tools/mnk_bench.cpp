@@ -0,0 +1,96 @@
+//
+// mnk_bench: nodes per second of MNKSearch against the two-player engine
+//
+//   mnk_bench [-d <depth>]
+//
+// the baseline is TicTacToeSolver::negamax, the two-player search the
+// TicTacToe AI runs, over the whole tree from the empty board. MNKSearch
+// then solves the same 3x3 board with two players, where max^n and paranoid
+// are both plain minimax and have to agree it's a draw.
+//
+// after that max^n and paranoid search the same 8x8 positions with two,
+// three and four players to a fixed depth (-d plies, default 4) and the
+// nodes, time and nodes per second of each are printed. max^n only has
+// shallow pruning so it visits far more nodes than paranoid's alpha-beta;
+// the nodes per second show what each node costs.
+//
+// exits non-zero if the 3x3 board doesn't come out a draw.
+//
+
+#include "../classes/MNKSearch.h"
+#include "../classes/TicTacToeSolver.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// the first few stones of each position, played in turn from the empty board
+static const int kOpening[] = { 27, 28, 36, 35, 19, 44 };
+
+static double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void report(const char *name, uint64_t nodes, double seconds)
+{
+    std::printf("  %-26s %12llu nodes  %9.3f ms  %7.2f M nodes/s\n", name, (unsigned long long)nodes, seconds * 1e3,
+                seconds > 0 ? nodes / seconds / 1e6 : 0.0);
+}
+
+int main(int argc, char **argv)
+{
+    int depth = 4;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "-d") == 0 && i + 1 < argc)
+            depth = std::max(1, std::atoi(argv[++i]));
+        else
+        {
+            std::fprintf(stderr, "usage: mnk_bench [-d <depth>]\n");
+            return 2;
+        }
+    }
+
+    MNKSearch search;
+    bool ok = true;
+
+    std::printf("3x3, two players\n");
+    uint64_t nodes = 0;
+    auto start = std::chrono::steady_clock::now();
+    const int score = TicTacToeSolver::negamax(0, 0, 0, nodes);
+    report("TicTacToeSolver::negamax", nodes, secondsSince(start));
+    ok &= score == 0;
+    for (MNKAlgorithm algorithm : { MNKAlgorithm::kMaxN, MNKAlgorithm::kParanoid })
+    {
+        const MNKPosition position(3, 3, 3, 2);
+        const MNKSearchResult result = search.search(position, algorithm, position.cells());
+        const bool draw = result.scores[0] == MNKSearch::kTotalScore / 2 && result.scores[1] == MNKSearch::kTotalScore / 2;
+        ok &= draw;
+        report(algorithm == MNKAlgorithm::kMaxN ? "max^n" : "paranoid", result.nodes, result.seconds);
+        if (!draw)
+            std::printf("  WRONG: expected a draw, got %d / %d\n", result.scores[0], result.scores[1]);
+    }
+
+    for (int players = 2; players <= MNKPosition::kMaxPlayers; ++players)
+    {
+        const int k = players == 2 ? 5 : 4;
+        std::printf("\n8x8, %d players, %d in a row, depth %d\n", players, k, depth);
+        for (int stones : { 0, players, 2 * players })
+        {
+            MNKPosition position(8, 8, k, players);
+            for (int i = 0; i < stones && i < static_cast<int>(sizeof(kOpening) / sizeof(kOpening[0])); ++i)
+                position.play(kOpening[i]);
+            for (MNKAlgorithm algorithm : { MNKAlgorithm::kMaxN, MNKAlgorithm::kParanoid })
+            {
+                const MNKSearchResult result = search.search(position, algorithm, depth);
+                char name[64];
+                std::snprintf(name, sizeof(name), "%2d stones %-8s move %2d", position.moves(),
+                              algorithm == MNKAlgorithm::kMaxN ? "max^n" : "paranoid", result.move);
+                report(name, result.nodes, result.seconds);
+            }
+        }
+    }
+    return ok ? 0 : 1;
+}
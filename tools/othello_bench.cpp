@@ -0,0 +1,143 @@
+//
+// othello_bench: check and time the othello bitboard kernels and endgame solver
+//
+//   othello_bench [-d <depth>] [-e <empties>]
+//
+// perft counts the leaf nodes of the move tree from the starting position to
+// every depth up to -d (default 11) and checks them against the published
+// numbers (which go to 12 here); a pass counts as a move and a finished
+// game as a leaf. every interior node goes through OthelloBitboard::moves
+// and flips, so this is a direct measure of the kernels. the build says
+// whether it used the AVX2 or the portable versions.
+//
+// the endgame set is positions from the FFO endgame test suite with their
+// known best move and final disc difference, solved from an empty table.
+// only the ones with at most -e empties are run (default 22, the full set
+// goes to 23).
+//
+// exits non-zero if any count, score or move is wrong.
+//
+
+#include "../classes/OthelloSearch.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+static const uint64_t kPerft[] = {
+    1, 4, 12, 56, 244, 1396, 8200, 55092, 390216, 3005288, 24571284, 212258800, 1939886636,
+};
+static const int kPerftDepth = sizeof(kPerft) / sizeof(kPerft[0]) - 1;
+
+struct EndgamePosition
+{
+    const char *name;
+    const char *board;      // a1..h1, a2..h2 and so on, 'X' black, 'O' white, '-' empty
+    char        toMove;
+    const char *bestMove;
+    int         score;
+};
+
+static const EndgamePosition kEndgames[] = {
+    { "ffo #40", "O--OOOOX-OOOOOOXOOXXOOOXOOXOOOXXOOOOOOXX---OOOOX----O--X--------", 'X', "a2", 38 },
+    { "ffo #41", "-OOOOO----OOOOX--OOOOOO-XXXXXOO--XXOOX--OOXOXX----OXXO---OOO--O-", 'X', "h4", 0 },
+    { "ffo #43", "--XXXXX---XXXX---OOOXX---OOXXXX--OOXXXO-OOOOXOO----XOX----XXXXX-", 'O', "c7", -12 },
+    { "ffo #44", "--O-X-O---O-XO-O-OOXXXOOOOOOXXXOOOOOXX--XXOOXO----XXXX-----XXX--", 'O', "b8", -14 },
+};
+
+static uint64_t perft(uint64_t player, uint64_t opponent, int depth, bool passed)
+{
+    if (depth == 0)
+        return 1;
+    uint64_t moves = OthelloBitboard::moves(player, opponent);
+    if (!moves)
+        return passed ? 1 : perft(opponent, player, depth - 1, true);
+    if (depth == 1)
+        return static_cast<uint64_t>(std::popcount(moves));
+
+    uint64_t nodes = 0;
+    for (; moves; moves &= moves - 1)
+    {
+        const int sq = std::countr_zero(moves);
+        const uint64_t flipped = OthelloBitboard::flips(player, opponent, sq);
+        nodes += perft(opponent & ~flipped, player | flipped | OthelloBitboard::squareBit(sq), depth - 1, false);
+    }
+    return nodes;
+}
+
+static OthelloPosition parseBoard(const char *board, char toMove)
+{
+    uint64_t black = 0;
+    uint64_t white = 0;
+    for (int sq = 0; sq < 64; ++sq)
+    {
+        if (board[sq] == 'X')
+            black |= OthelloBitboard::squareBit(sq);
+        else if (board[sq] == 'O')
+            white |= OthelloBitboard::squareBit(sq);
+    }
+    return OthelloPosition(black, white, toMove == 'X' ? 0 : 1);
+}
+
+int main(int argc, char **argv)
+{
+    int depth = 11;
+    int maxEmpties = 22;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "-d") == 0 && i + 1 < argc)
+            depth = std::max(1, std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "-e") == 0 && i + 1 < argc)
+            maxEmpties = std::atoi(argv[++i]);
+        else
+        {
+            std::fprintf(stderr, "usage: othello_bench [-d <depth>] [-e <empties>]\n");
+            return 2;
+        }
+    }
+
+#if defined(__AVX2__)
+    std::printf("perft with the AVX2 kernels\n");
+#else
+    std::printf("perft with the portable kernels\n");
+#endif
+    bool ok = true;
+    const OthelloPosition start;
+    for (int d = 1; d <= depth; ++d)
+    {
+        const auto begin = std::chrono::steady_clock::now();
+        const uint64_t nodes = perft(start.mover(), start.opponent(), d, false);
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        const bool checked = d <= kPerftDepth;
+        const bool match = !checked || nodes == kPerft[d];
+        ok &= match;
+        std::printf("  depth %2d  %12llu nodes  %9.3f s  %8.2f Mnps  %s\n", d, (unsigned long long)nodes, seconds,
+                    seconds > 0 ? nodes / seconds / 1e6 : 0.0, !checked ? "" : match ? "ok" : "MISMATCH");
+    }
+
+    std::printf("\nendgame\n");
+    OthelloSearch search;
+    uint64_t totalNodes = 0;
+    double totalSeconds = 0;
+    for (const EndgamePosition &e : kEndgames)
+    {
+        const OthelloPosition position = parseBoard(e.board, e.toMove);
+        if (position.emptyCount() > maxEmpties)
+            continue;
+        search.clear();
+        const OthelloSearchResult result = search.solve(position);
+        const std::string move = OthelloPosition::squareName(result.move);
+        const bool match = result.exact && result.score == e.score && move == e.bestMove;
+        ok &= match;
+        totalNodes += result.nodes;
+        totalSeconds += result.seconds;
+        std::printf("  %-8s %2d empties  %-4s %+3d  %12llu nodes  %8.3f s  %6.2f Mnps  %s\n", e.name, position.emptyCount(),
+                    move.c_str(), result.score, (unsigned long long)result.nodes, result.seconds,
+                    result.seconds > 0 ? result.nodes / result.seconds / 1e6 : 0.0, match ? "ok" : "WRONG");
+    }
+    std::printf("\ntotal %llu nodes in %.3f s, %.2f Mnps\n", (unsigned long long)totalNodes, totalSeconds,
+                totalSeconds > 0 ? totalNodes / totalSeconds / 1e6 : 0.0);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,104 @@
+//
+// parallel_bench: how the split search scales with the number of threads
+//
+//   parallel_bench [-d <depth>] [-t <max threads>]
+//
+// MNKSearch searches a few 8x8 positions to a fixed depth (-d plies, default
+// 6 for paranoid and one less for max^n, which prunes far less) on a
+// WorkStealingPool of 1, 2, 4, 8 and 16 threads (up to -t, default 16). for
+// each thread count the time over all the positions is reported with the
+// speedup over one thread and the efficiency, speedup / threads.
+//
+// the split search picks its moves deterministically, so every thread count
+// has to come up with the same move and scores as one thread; the exit
+// status is non-zero if any of them doesn't. with more threads than the
+// machine has hardware threads the times only show the overhead.
+//
+
+#include "../classes/MNKSearch.h"
+#include "../classes/WorkStealingPool.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+struct BenchPosition
+{
+    int             players;
+    int             k;
+    MNKAlgorithm    algorithm;
+    int             depthOffset;    // added to -d
+    const char     *name;
+    int             moves[8];       // played in turn from the empty board, -1 ends
+};
+
+static const BenchPosition kPositions[] = {
+    { 2, 5, MNKAlgorithm::kParanoid, 0, "2 players, paranoid", { 27, 36, 28, -1 } },
+    { 2, 5, MNKAlgorithm::kParanoid, 0, "2 players, paranoid", { 27, 28, 36, 35, 19, -1 } },
+    { 3, 4, MNKAlgorithm::kParanoid, 0, "3 players, paranoid", { 27, 28, 36, -1 } },
+    { 3, 4, MNKAlgorithm::kMaxN, -1, "3 players, max^n", { 27, 28, 36, -1 } },
+    { 4, 4, MNKAlgorithm::kParanoid, 0, "4 players, paranoid", { 27, 28, 36, 35, -1 } },
+    { 4, 4, MNKAlgorithm::kMaxN, -1, "4 players, max^n", { 27, 28, 36, 35, -1 } },
+};
+static const int kPositionCount = sizeof(kPositions) / sizeof(kPositions[0]);
+
+int main(int argc, char **argv)
+{
+    int depth = 6;
+    unsigned maxThreads = 16;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "-d") == 0 && i + 1 < argc)
+            depth = std::max(2, std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+            maxThreads = static_cast<unsigned>(std::max(1, std::atoi(argv[++i])));
+        else
+        {
+            std::fprintf(stderr, "usage: parallel_bench [-d <depth>] [-t <max threads>]\n");
+            return 2;
+        }
+    }
+    std::printf("%u hardware threads, depth %d\n\n", std::max(1u, std::thread::hardware_concurrency()), depth);
+
+    bool ok = true;
+    std::vector<MNKSearchResult> reference(kPositionCount);
+    double serialSeconds = 0;
+    for (unsigned threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        WorkStealingPool pool(threads);
+        MNKSearch search;
+        search.setThreadPool(&pool);
+
+        std::printf("%2u threads\n", threads);
+        uint64_t totalNodes = 0;
+        double totalSeconds = 0;
+        for (int i = 0; i < kPositionCount; ++i)
+        {
+            const BenchPosition &bench = kPositions[i];
+            MNKPosition position(8, 8, bench.k, bench.players);
+            for (int j = 0; bench.moves[j] >= 0; ++j)
+                position.play(bench.moves[j]);
+
+            const MNKSearchResult result = search.search(position, bench.algorithm, depth + bench.depthOffset);
+            if (threads == 1)
+                reference[i] = result;
+            const bool same = result.move == reference[i].move && result.scores == reference[i].scores;
+            ok &= same;
+            totalNodes += result.nodes;
+            totalSeconds += result.seconds;
+            std::printf("  %-20s %d stones  move %2d  score %4d  %10llu nodes  %9.3f ms  %s\n", bench.name,
+                        position.moves(), result.move, result.scores[position.sideToMove()],
+                        (unsigned long long)result.nodes, result.seconds * 1e3, same ? "ok" : "DIFFERENT");
+        }
+        if (threads == 1)
+            serialSeconds = totalSeconds;
+        const double speedup = totalSeconds > 0 ? serialSeconds / totalSeconds : 0.0;
+        std::printf("  total %llu nodes in %.3f s, %.2f M nodes/s, speedup %.2f, efficiency %.0f%%\n\n",
+                    (unsigned long long)totalNodes, totalSeconds, totalSeconds > 0 ? totalNodes / totalSeconds / 1e6 : 0.0,
+                    speedup, speedup / threads * 100.0);
+    }
+    return ok ? 0 : 1;
+}
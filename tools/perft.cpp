@@ -0,0 +1,170 @@
+//
+// perft: count the leaf nodes of the chess move tree as a move generator check
+//
+//   perft [-d <depth>] [-divide] [<fen>]
+//
+// with no fen every standard reference position is walked to a fixed depth
+// and the counts are checked against the published numbers. with a fen that
+// position is walked to -d plies (default 5), -divide lists the count under
+// each root move, which is how a mismatch is tracked down.
+//
+// every count goes through ChessPosition::generateLegal and makeMove /
+// unmakeMove exactly as the game plays them; only the last ply is counted
+// from the length of the move list instead of being made. speed is reported
+// in millions of leaf nodes per second.
+//
+// exits non-zero if any count is wrong.
+//
+
+#include "../classes/ChessPosition.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+static uint64_t perft(ChessPosition &position, int depth)
+{
+    ChessMoveList list;
+    position.generateLegal(list);
+    if (depth <= 1)
+        return depth == 1 ? static_cast<uint64_t>(list.size) : 1;
+
+    uint64_t nodes = 0;
+    ChessPosition::Undo undo;
+    for (ChessMove m : list)
+    {
+        position.makeMove(m, undo);
+        nodes += perft(position, depth - 1);
+        position.unmakeMove(m, undo);
+    }
+    return nodes;
+}
+
+struct PerftReference
+{
+    const char *name;
+    const char *fen;
+    uint64_t    nodes[7];       // by depth, 0 where the count isn't checked
+    int         depth;          // how deep the default run goes
+};
+
+//
+// the usual reference set: the start position, "kiwipete" and the other
+// positions collected on the chess programming wiki's perft results page
+//
+static const PerftReference kReferences[] = {
+    { "start", "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+      { 1, 20, 400, 8902, 197281, 4865609, 119060324 }, 6 },
+    { "kiwipete", "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+      { 1, 48, 2039, 97862, 4085603, 193690690, 0 }, 5 },
+    { "position 3", "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+      { 1, 14, 191, 2812, 43238, 674624, 11030083 }, 6 },
+    { "position 4", "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+      { 1, 6, 264, 9467, 422333, 15833292, 706045033 }, 5 },
+    { "position 4 mirrored", "r2q1rk1/pP1p2pp/Q4n2/bbp1p3/Np6/1B3NBn/pPPP1PPP/R3K2R b KQ - 0 1",
+      { 1, 6, 264, 9467, 422333, 15833292, 0 }, 5 },
+    { "position 5", "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+      { 1, 44, 1486, 62379, 2103487, 89941194, 0 }, 5 },
+    { "position 6", "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10",
+      { 1, 46, 2079, 89890, 3894594, 164075551, 0 }, 5 },
+};
+
+static int usage()
+{
+    std::fprintf(stderr, "usage: perft [-d <depth>] [-divide] [<fen>]\n");
+    return 2;
+}
+
+int main(int argc, char **argv)
+{
+    int depth = 0;
+    bool divide = false;
+    std::string fen;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "-d") == 0 && i + 1 < argc)
+            depth = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "-divide") == 0)
+            divide = true;
+        else if (argv[i][0] != '-' || argv[i][1] == '\0')
+        {
+            if (!fen.empty())
+                fen += ' ';
+            fen += argv[i];
+        }
+        else
+            return usage();
+    }
+
+    if (!fen.empty())
+    {
+        ChessPosition position;
+        if (!position.setFen(fen))
+        {
+            std::fprintf(stderr, "can't parse fen: %s\n", fen.c_str());
+            return 1;
+        }
+        depth = depth > 0 ? depth : 5;
+        const auto start = std::chrono::steady_clock::now();
+        uint64_t nodes = 0;
+        if (divide)
+        {
+            ChessMoveList list;
+            position.generateLegal(list);
+            ChessPosition::Undo undo;
+            for (ChessMove m : list)
+            {
+                position.makeMove(m, undo);
+                const uint64_t count = perft(position, depth - 1);
+                position.unmakeMove(m, undo);
+                std::printf("%s: %llu\n", ChessPosition::moveToString(m).c_str(), (unsigned long long)count);
+                nodes += count;
+            }
+        }
+        else
+            nodes = perft(position, depth);
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::printf("depth %d: %llu nodes in %.3f s, %.2f Mnps\n", depth, (unsigned long long)nodes, seconds,
+                    seconds > 0 ? nodes / seconds / 1e6 : 0.0);
+        return 0;
+    }
+
+    bool ok = true;
+    uint64_t totalNodes = 0;
+    double totalSeconds = 0;
+    for (const PerftReference &ref : kReferences)
+    {
+        ChessPosition position;
+        if (!position.setFen(ref.fen))
+        {
+            std::printf("%-20s can't parse fen   MISMATCH\n", ref.name);
+            ok = false;
+            continue;
+        }
+        const int refDepth = depth > 0 ? depth : ref.depth;
+        for (int d = 1; d <= refDepth && d < 7; ++d)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            const uint64_t nodes = perft(position, d);
+            const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            const uint64_t expected = ref.nodes[d];
+            const bool match = expected == 0 || nodes == expected;
+            ok &= match;
+            if (d == refDepth)
+            {
+                totalNodes += nodes;
+                totalSeconds += seconds;
+                std::printf("%-20s depth %d %12llu  %8.3f s  %8.2f Mnps   %s\n", ref.name, d, (unsigned long long)nodes,
+                            seconds, seconds > 0 ? nodes / seconds / 1e6 : 0.0, !match ? "MISMATCH" : expected ? "ok" : "unchecked");
+            }
+            else if (!match)
+                std::printf("%-20s depth %d %12llu  expected %llu   MISMATCH\n", ref.name, d, (unsigned long long)nodes,
+                            (unsigned long long)expected);
+        }
+    }
+    std::printf("\ntotal %llu nodes in %.3f s, %.2f Mnps\n", (unsigned long long)totalNodes, totalSeconds,
+                totalSeconds > 0 ? totalNodes / totalSeconds / 1e6 : 0.0);
+    return ok ? 0 : 1;
+}
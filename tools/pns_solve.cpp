@@ -0,0 +1,202 @@
+//
+// pns_solve: prove positions with ProofNumberSearch and report what it took
+//
+//   pns_solve [-f <file>] [-n <node limit>] [-m <table MB>]
+//
+// with -f every line of the file is a position to solve, "-" for stdin:
+//
+//   mnk <width> <height> <k> [cells...]     two player m,n,k
+//   qubic [cells...]                        Qubic, win only
+//
+// the cells are played in turn from the empty board, blank lines and lines
+// starting with # are skipped. m,n,k positions are solved outright (win,
+// draw or loss for the side to move); Qubic positions only have the win
+// proved, since showing one isn't there takes too long.
+//
+// without -f a built-in set runs instead, with known results: the small
+// m,n,k boards from the empty board up to 5x5 with four in a row, and the
+// Qubic forced wins qubic_bench uses.
+//
+// each position prints its result, the move, the nodes, the table memory
+// the proof filled out of what's allocated, and the time to proof. the limit
+// is -n nodes (default 100 million) and the table -m megabytes (default 256).
+//
+// exits non-zero if a built-in position doesn't come out as it should.
+//
+
+#include "../classes/MNKSearch.h"
+#include "../classes/ProofNumberSearch.h"
+#include "../classes/QubicSolver.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+struct KnownPosition
+{
+    const char     *line;
+    ProofValue      value;
+};
+
+static const KnownPosition kKnown[] = {
+    { "mnk 3 3 3", ProofValue::kDraw },
+    { "mnk 4 3 3", ProofValue::kWin },
+    { "mnk 4 4 3", ProofValue::kWin },
+    { "mnk 4 4 4", ProofValue::kDraw },
+    { "mnk 5 4 4", ProofValue::kDraw },
+    { "mnk 5 5 4", ProofValue::kDraw },
+    { "qubic 49 37 21 8 38 1 40 29 18 48 56 20 25 23 26 42 44 3", ProofValue::kWin },
+    { "qubic 60 40 6 5 15 10 48 41 8 28 54 39 59 19 3 38", ProofValue::kWin },
+    { "qubic 26 12 36 63 54 43 30 42 29 46 49 47 2", ProofValue::kWin },
+    { "qubic 29 20 0 25 15 2 44 33 60 9 52 45", ProofValue::kWin },
+    { "qubic 26 54 23 14 24 9 16 33 13 8 2 42 32 58 4 3 38", ProofValue::kWin },
+    { "qubic 54 24 48 49 61 41 0 22 56 43 12 59", ProofValue::kWin },
+    { "qubic 62 31 51 52 18 35 43 1 15 33 0 21 45", ProofValue::kWin },
+    { "qubic 60 47 22 12 14 63 53 24 32 3 15", ProofValue::kWin },
+    { "qubic 59 53 29 5 33 56 34 16 2 38 63", ProofValue::kWin },
+    { "qubic 24 53 39 59 13 33 9 15 61 1 48 12 56 4", ProofValue::kWin },
+    { "qubic 31 54 38 55 49 39 30 26 19 15 40 33", ProofValue::kWin },
+    { "qubic 49 31 0 43 56 57 20 34 23 44 37 63 50 8 42 18 55", ProofValue::kWin },
+    { "qubic 42 21 8 12 30 27 26 56 4 36 54", ProofValue::kWin },
+    { "qubic 58 17 12 28 0 57 16 29 54", ProofValue::kWin },
+};
+
+class Solver
+{
+public:
+    Solver(size_t tableMegabytes, uint64_t nodeLimit) : _tableMegabytes(tableMegabytes), _nodeLimit(nodeLimit) {}
+
+    // solve one line of the file format, false if it doesn't parse
+    bool solve(const std::string &line, ProofResult &result)
+    {
+        std::istringstream in(line);
+        std::string game;
+        in >> game;
+        if (game == "mnk")
+        {
+            int width = 0, height = 0, k = 0;
+            in >> width >> height >> k;
+            if (!in || width < 1 || width > 8 || height < 1 || width * height > MNKPosition::kMaxCells || k < 1)
+                return false;
+            MNKPosition position(width, height, k, 2);
+            int cell;
+            while (in >> cell)
+            {
+                if (cell < 0 || cell >= position.cells() || position.at(cell) >= 0 || position.gameOver())
+                    return false;
+                position.play(cell);
+            }
+            if (!_mnk)
+                _mnk = std::make_unique<ProofNumberSearch<MNKPosition>>(_tableMegabytes);
+            result = _mnk->solve(position, _nodeLimit);
+            return true;
+        }
+        if (game == "qubic")
+        {
+            QubicPosition position;
+            int cell;
+            while (in >> cell)
+            {
+                if (cell < 0 || cell >= QubicPosition::kCells || !(position.empty() & (uint64_t(1) << cell)))
+                    return false;
+                position.play(cell);
+            }
+            if (!_qubic)
+                _qubic = std::make_unique<ProofNumberSearch<QubicPosition>>(_tableMegabytes);
+            result = _qubic->proveWin(position, _nodeLimit);
+            return true;
+        }
+        return false;
+    }
+
+private:
+    size_t                                              _tableMegabytes;
+    uint64_t                                            _nodeLimit;
+    std::unique_ptr<ProofNumberSearch<MNKPosition>>     _mnk;
+    std::unique_ptr<ProofNumberSearch<QubicPosition>>   _qubic;
+};
+
+static void report(const std::string &line, const ProofResult &result, const char *verdict)
+{
+    std::printf("  %-58s %-7s move %2d  %11llu nodes  %7.1f of %.0f MB  %9.3f s  %6.0f k nodes/s  %s\n", line.c_str(),
+                proofValueName(result.value), result.move, (unsigned long long)result.nodes, result.memory / 1048576.0,
+                result.tableSize / 1048576.0, result.seconds, result.seconds > 0 ? result.nodes / result.seconds / 1e3 : 0.0, verdict);
+}
+
+int main(int argc, char **argv)
+{
+    std::string file;
+    uint64_t nodeLimit = 100000000;
+    size_t tableMegabytes = 256;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "-f") == 0 && i + 1 < argc)
+            file = argv[++i];
+        else if (std::strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+            nodeLimit = std::max(1ull, std::strtoull(argv[++i], nullptr, 10));
+        else if (std::strcmp(argv[i], "-m") == 0 && i + 1 < argc)
+            tableMegabytes = static_cast<size_t>(std::max(1, std::atoi(argv[++i])));
+        else
+        {
+            std::fprintf(stderr, "usage: pns_solve [-f <file>] [-n <node limit>] [-m <table MB>]\n");
+            return 2;
+        }
+    }
+
+    Solver solver(tableMegabytes, nodeLimit);
+    bool ok = true;
+    uint64_t totalNodes = 0;
+    double totalSeconds = 0;
+
+    if (file.empty())
+    {
+        for (const KnownPosition &known : kKnown)
+        {
+            ProofResult result;
+            solver.solve(known.line, result);
+            const bool match = result.value == known.value;
+            ok &= match;
+            totalNodes += result.nodes;
+            totalSeconds += result.seconds;
+            report(known.line, result, match ? "ok" : "WRONG");
+        }
+    }
+    else
+    {
+        std::ifstream stream;
+        if (file != "-")
+        {
+            stream.open(file);
+            if (!stream)
+            {
+                std::fprintf(stderr, "can't read %s\n", file.c_str());
+                return 1;
+            }
+        }
+        std::istream &in = file == "-" ? std::cin : stream;
+        std::string line;
+        while (std::getline(in, line))
+        {
+            if (line.empty() || line[0] == '#')
+                continue;
+            ProofResult result;
+            if (!solver.solve(line, result))
+            {
+                std::fprintf(stderr, "can't read position: %s\n", line.c_str());
+                ok = false;
+                continue;
+            }
+            totalNodes += result.nodes;
+            totalSeconds += result.seconds;
+            report(line, result, "");
+        }
+    }
+
+    std::printf("\ntotal %llu nodes in %.3f s\n", (unsigned long long)totalNodes, totalSeconds);
+    return ok ? 0 : 1;
+}
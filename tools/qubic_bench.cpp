@@ -0,0 +1,122 @@
+//
+// qubic_bench: time QubicSolver on forced wins and fixed depth searches
+//
+//   qubic_bench [-d <depth>]
+//
+// the forced-win set is positions (cells played from the empty board, see
+// QubicPosition::playSequence) where the side to move wins by a sequence of
+// threats, with the fewest threats it takes. each one is solved with cleared
+// tables: the win has to be found within that many threats and not within
+// one fewer, and the wins of three threats or less are checked again with a
+// plain alpha-beta search. the positions were picked from random games as
+// the hardest of their length to prove.
+//
+// the fixed depth set runs the alpha-beta search (-d plies, default 5) from
+// a few positions to measure positions per second.
+//
+// exits non-zero if any forced win isn't found at the right length.
+//
+
+#include "../classes/QubicSolver.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+struct ForcedWin
+{
+    const char *cells;
+    int         threats;
+};
+
+static const ForcedWin kForcedWins[] = {
+    { "49 37 21 8 38 1 40 29 18 48 56 20 25 23 26 42 44 3", 1 },
+    { "60 40 6 5 15 10 48 41 8 28 54 39 59 19 3 38", 2 },
+    { "26 12 36 63 54 43 30 42 29 46 49 47 2", 3 },
+    { "29 20 0 25 15 2 44 33 60 9 52 45", 4 },
+    { "26 54 23 14 24 9 16 33 13 8 2 42 32 58 4 3 38", 5 },
+    { "54 24 48 49 61 41 0 22 56 43 12 59", 6 },
+    { "62 31 51 52 18 35 43 1 15 33 0 21 45", 7 },
+    { "60 47 22 12 14 63 53 24 32 3 15", 8 },
+    { "59 53 29 5 33 56 34 16 2 38 63", 9 },
+    { "24 53 39 59 13 33 9 15 61 1 48 12 56 4", 10 },
+    { "31 54 38 55 49 39 30 26 19 15 40 33", 11 },
+    { "49 31 0 43 56 57 20 34 23 44 37 63 50 8 42 18 55", 12 },
+    { "42 21 8 12 30 27 26 56 4 36 54", 13 },
+    { "58 17 12 28 0 57 16 29 54", 14 },
+};
+
+static const char *kDepthPositions[] = {
+    "",
+    "21 42",
+    "0 21 63 42 22 41",
+};
+
+static double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv)
+{
+    int depth = 5;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "-d") == 0 && i + 1 < argc)
+            depth = std::max(1, std::atoi(argv[++i]));
+        else
+        {
+            std::fprintf(stderr, "usage: qubic_bench [-d <depth>]\n");
+            return 2;
+        }
+    }
+
+    QubicSolver solver;
+    bool ok = true;
+
+    std::printf("forced wins\n");
+    for (const ForcedWin &win : kForcedWins)
+    {
+        QubicPosition position;
+        position.playSequence(win.cells);
+
+        // no shorter win first, then the win itself, each from a cleared table
+        solver.clearTables();
+        const bool shorter = win.threats > 1 && solver.findForcedWin(position, win.threats - 1) >= 0;
+        solver.clearTables();
+        solver.resetNodeCount();
+        const auto start = std::chrono::steady_clock::now();
+        const int move = solver.findForcedWin(position, win.threats);
+        const double seconds = secondsSince(start);
+        const uint64_t nodes = solver.nodeCount();
+
+        bool match = move >= 0 && !shorter;
+        if (match && win.threats <= 3)
+            match = solver.search(position, 2 * win.threats + 1) > QubicSolver::kWinScore - 100;
+        ok &= match;
+        std::printf("  %2d threats  move %2d  %10llu nodes  %9.3f ms  %s\n", win.threats, move, (unsigned long long)nodes,
+                    seconds * 1e3, match ? "ok" : "WRONG");
+    }
+
+    std::printf("\nalpha-beta to depth %d\n", depth);
+    uint64_t totalNodes = 0;
+    double totalSeconds = 0;
+    for (const char *cells : kDepthPositions)
+    {
+        QubicPosition position;
+        position.playSequence(cells);
+        solver.clearTables();
+        solver.resetNodeCount();
+        const auto start = std::chrono::steady_clock::now();
+        const int score = solver.search(position, depth);
+        const double seconds = secondsSince(start);
+        totalNodes += solver.nodeCount();
+        totalSeconds += seconds;
+        std::printf("  %2d stones  score %8d  %10llu nodes  %9.3f ms  %8.2f M positions/s\n", position.moves(), score,
+                    (unsigned long long)solver.nodeCount(), seconds * 1e3, seconds > 0 ? solver.nodeCount() / seconds / 1e6 : 0.0);
+    }
+    std::printf("\ntotal %llu positions in %.3f s, %.2f M positions/s\n", (unsigned long long)totalNodes, totalSeconds,
+                totalSeconds > 0 ? totalNodes / totalSeconds / 1e6 : 0.0);
+    return ok ? 0 : 1;
+}
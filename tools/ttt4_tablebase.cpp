@@ -0,0 +1,153 @@
+//
+// ttt4_tablebase: generate the 4x4 tic tac toe tablebase and time probing it
+//
+//   ttt4_tablebase [-o <file>] [-t <threads>] [-b <block bytes>] [-r]
+//
+// solves all 3^16 encodings with TicTacToe4Tablebase::generate on -t
+// threads (default one per hardware thread), writes the table to -o
+// (default tictactoe4.tb, where the game looks for it) in blocks of -b
+// bytes (default 4096), run length coded unless -r, and maps it back.
+// reported: the generation time, the table and file sizes, how many
+// reachable positions are wins, draws and losses for the side to move,
+// the time to open the file and to check every block, the latency of
+// probe() and bestMove() over random reachable positions from the mapped
+// file, and how the decoded block cache did.
+//
+// exits non-zero if the empty board doesn't come out a draw lasting all
+// 16 plies, a block fails its crc, or the file doesn't answer like the
+// generated table.
+//
+
+#include "../classes/TicTacToe4Tablebase.h"
+
+#include <bit>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+static double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv)
+{
+    std::string path = "tictactoe4.tb";
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    uint32_t blockSize = TablebaseFormat::kDefaultBlockSize;
+    bool compress = true;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+            path = argv[++i];
+        else if (std::strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+            threads = static_cast<unsigned>(std::max(1, std::atoi(argv[++i])));
+        else if (std::strcmp(argv[i], "-b") == 0 && i + 1 < argc)
+            blockSize = static_cast<uint32_t>(std::max(256, std::atoi(argv[++i])));
+        else if (std::strcmp(argv[i], "-r") == 0)
+            compress = false;
+        else
+        {
+            std::fprintf(stderr, "usage: ttt4_tablebase [-o <file>] [-t <threads>] [-b <block bytes>] [-r]\n");
+            return 2;
+        }
+    }
+
+    TicTacToe4Tablebase tablebase;
+    auto start = std::chrono::steady_clock::now();
+    tablebase.generate(threads);
+    std::printf("generated %u positions in %.3f s on %u threads\n", TicTacToe4Tablebase::kPositions,
+                secondsSince(start), threads);
+    std::printf("table %zu bytes (%.1f MB), 4 bits a position\n", tablebase.bytes(), tablebase.bytes() / 1048576.0);
+
+    bool ok = true;
+    TicTacToe4Tablebase::Probe empty;
+    ok &= tablebase.probe(0, 0, empty) && empty.value == 0 && empty.plies == 16;
+    std::printf("empty board: value %d, %d plies  %s\n", empty.value, empty.plies, ok ? "ok" : "WRONG");
+
+    // every reachable position, and the ones still being played for the probe timing
+    uint64_t counts[3] = { 0, 0, 0 };
+    std::vector<uint32_t> positions;
+    for (uint32_t x = 0; x < 0x10000; ++x)
+    {
+        const uint16_t free = static_cast<uint16_t>(~x);
+        for (uint32_t o = free;; o = (o - 1) & free)
+        {
+            TicTacToe4Tablebase::Probe probe;
+            if (tablebase.probe(static_cast<uint16_t>(x), static_cast<uint16_t>(o), probe))
+            {
+                ++counts[probe.value + 1];
+                if (probe.plies > 0)
+                    positions.push_back(x << 16 | o);
+            }
+            if (o == 0)
+                break;
+        }
+    }
+    std::printf("reachable: %llu wins, %llu draws, %llu losses for the side to move\n", (unsigned long long)counts[2],
+                (unsigned long long)counts[1], (unsigned long long)counts[0]);
+
+    if (!tablebase.save(path, blockSize, compress))
+    {
+        std::fprintf(stderr, "can't write %s\n", path.c_str());
+        return 1;
+    }
+    TicTacToe4Tablebase loaded;
+    std::string error;
+    start = std::chrono::steady_clock::now();
+    if (!loaded.load(path, error))
+    {
+        std::fprintf(stderr, "%s: %s\n", path.c_str(), error.c_str());
+        return 1;
+    }
+    const double openSeconds = secondsSince(start);
+    const TablebaseReader &file = loaded.file();
+    std::printf("wrote %s: %zu bytes in %u blocks of %u, %.1f%% of the table%s\n", path.c_str(), file.fileSize(),
+                file.blockCount(), blockSize, 100.0 * file.fileSize() / tablebase.bytes(), compress ? "" : " (raw)");
+    std::printf("mapped in %.3f ms\n", openSeconds * 1e3);
+    start = std::chrono::steady_clock::now();
+    const size_t badBlocks = file.verify();
+    std::printf("checked every block in %.3f s, %zu bad\n", secondsSince(start), badBlocks);
+    ok &= badBlocks == 0;
+
+    // a fixed stride through the positions keeps the probes scattered over
+    // the table; each kind runs for about a second whatever it costs
+    const size_t stride = 7919;
+    uint64_t checksum = 0;
+    size_t probes = 0;
+    start = std::chrono::steady_clock::now();
+    for (size_t p = 0; probes % 4096 != 0 || secondsSince(start) < 1.0; ++probes, p = (p + stride) % positions.size())
+    {
+        TicTacToe4Tablebase::Probe probe;
+        loaded.probe(static_cast<uint16_t>(positions[p] >> 16), static_cast<uint16_t>(positions[p]), probe);
+        checksum += static_cast<uint64_t>(probe.plies * 3 + probe.value + 1);
+    }
+    const double probeSeconds = secondsSince(start);
+
+    size_t moves = 0;
+    start = std::chrono::steady_clock::now();
+    for (size_t p = 0; moves % 256 != 0 || secondsSince(start) < 1.0; ++moves, p = (p + stride) % positions.size())
+        checksum += static_cast<uint64_t>(loaded.bestMove(static_cast<uint16_t>(positions[p] >> 16), static_cast<uint16_t>(positions[p])));
+    const double moveSeconds = secondsSince(start);
+    std::printf("probe %.1f ns, best move %.1f ns (checksum %llu)\n", probeSeconds / probes * 1e9,
+                moveSeconds / moves * 1e9, (unsigned long long)checksum);
+    const uint64_t lookups = file.cacheHits() + file.cacheMisses();
+    std::printf("block cache: %llu hits, %llu misses (%.1f%% hit rate)\n", (unsigned long long)file.cacheHits(),
+                (unsigned long long)file.cacheMisses(), lookups ? 100.0 * file.cacheHits() / lookups : 0.0);
+
+    // the loaded table has to answer like the generated one
+    for (size_t p = 0; p < positions.size() && ok; p += 101)
+    {
+        TicTacToe4Tablebase::Probe a, b;
+        tablebase.probe(static_cast<uint16_t>(positions[p] >> 16), static_cast<uint16_t>(positions[p]), a);
+        loaded.probe(static_cast<uint16_t>(positions[p] >> 16), static_cast<uint16_t>(positions[p]), b);
+        ok &= a.value == b.value && a.plies == b.plies;
+    }
+    if (!ok)
+        std::printf("WRONG\n");
+    return ok ? 0 : 1;
+}
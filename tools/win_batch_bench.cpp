@@ -0,0 +1,145 @@
+//
+// win_batch_bench: time BatchWinCheck on many random boards
+//
+//   win_batch_bench [-n <boards>]
+//
+// fills -n boards (default 65536) of each game with a random number of
+// stones, alternating players, and checks them all with evaluate() (the
+// SIMD kernel the build targets, printed first; configure with -DUSE_AVX2=ON
+// or -DUSE_SSE41=ON to get one) and with evaluatePortable(), one board
+// at a time. each is repeated for about half a second and reported in
+// boards per second and line tests per second, a line test being one line
+// against one player's stones.
+//
+// the games: 3x3 tic-tac-toe, 4x4 tic-tac-toe, connect four's 7x6 board,
+// the 8x8 two player m,n,k board with five in a row, and Qubic.
+//
+// exits non-zero if the kernels disagree on any board, or if a 3x3 result
+// doesn't match TicTacToeSolver::hasWin().
+//
+
+#include "../classes/BatchWinCheck.h"
+#include "../classes/QubicSolver.h"
+#include "../classes/TicTacToeSolver.h"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+struct Boards
+{
+    std::vector<uint64_t>   first;
+    std::vector<uint64_t>   second;
+};
+
+static Boards randomBoards(int cells, size_t count, std::mt19937_64 &rng)
+{
+    Boards boards;
+    boards.first.resize(count);
+    boards.second.resize(count);
+    std::vector<int> order(cells);
+    for (size_t i = 0; i < count; ++i)
+    {
+        for (int cell = 0; cell < cells; ++cell)
+            order[cell] = cell;
+        std::shuffle(order.begin(), order.end(), rng);
+        const int stones = static_cast<int>(rng() % (cells + 1));
+        uint64_t masks[2] = { 0, 0 };
+        for (int s = 0; s < stones; ++s)
+            masks[s & 1] |= uint64_t(1) << order[s];
+        boards.first[i] = masks[0];
+        boards.second[i] = masks[1];
+    }
+    return boards;
+}
+
+// seconds per pass over the boards, run for about half a second
+template <typename Kernel>
+static double timePasses(Kernel kernel)
+{
+    const auto start = std::chrono::steady_clock::now();
+    int passes = 0;
+    double seconds = 0;
+    do
+    {
+        kernel();
+        ++passes;
+        seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    } while (seconds < 0.5);
+    return seconds / passes;
+}
+
+int main(int argc, char **argv)
+{
+    size_t count = 65536;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+            count = static_cast<size_t>(std::max(1, std::atoi(argv[++i])));
+        else
+        {
+            std::fprintf(stderr, "usage: win_batch_bench [-n <boards>]\n");
+            return 2;
+        }
+    }
+
+    struct Game
+    {
+        const char     *name;
+        int             cells;
+        BatchWinCheck   check;
+    };
+    const Game games[] = {
+        { "tic-tac-toe 3x3", 9, BatchWinCheck::rows(3, 3, 3) },
+        { "tic-tac-toe 4x4", 16, BatchWinCheck::rows(4, 4, 4) },
+        { "connect four 7x6", 42, BatchWinCheck::rows(7, 6, 4) },
+        { "m,n,k 8x8 k5", 64, BatchWinCheck::rows(8, 8, 5) },
+        { "qubic", 64, BatchWinCheck(QubicPosition::kLines.data(), QubicPosition::kLines.size(), ~uint64_t(0)) },
+    };
+
+    std::printf("%zu boards a game, evaluate() is %s\n\n", count, BatchWinCheck::kernelName());
+    std::mt19937_64 rng(1);
+    bool ok = true;
+    for (const Game &game : games)
+    {
+        const Boards boards = randomBoards(game.cells, count, rng);
+        std::vector<int8_t> batch(count), single(count);
+        const double batchSeconds = timePasses([&]() {
+            game.check.evaluate(boards.first.data(), boards.second.data(), count, batch.data());
+        });
+        const double singleSeconds = timePasses([&]() {
+            game.check.evaluatePortable(boards.first.data(), boards.second.data(), count, single.data());
+        });
+
+        size_t mismatches = 0;
+        size_t counts[4] = {};
+        for (size_t i = 0; i < count; ++i)
+        {
+            mismatches += batch[i] != single[i];
+            ++counts[batch[i] + 1];
+            if (game.cells == 9)
+            {
+                const bool x = TicTacToeSolver::hasWin(static_cast<uint16_t>(boards.first[i]));
+                const bool o = TicTacToeSolver::hasWin(static_cast<uint16_t>(boards.second[i]));
+                const bool full = std::popcount(boards.first[i] | boards.second[i]) == 9;
+                mismatches += batch[i] != (x ? 0 : o ? 1 : full ? BatchWinCheck::kDraw : BatchWinCheck::kPlaying);
+            }
+        }
+        ok &= mismatches == 0;
+
+        const double tests = double(count) * game.check.lineCount() * 2;
+        std::printf("%-18s %3zu lines  %s  %5.1f%% first wins, %5.1f%% second, %5.1f%% drawn, %5.1f%% playing\n",
+                    game.name, game.check.lineCount(), mismatches ? "WRONG" : "ok", 100.0 * counts[1] / count,
+                    100.0 * counts[2] / count, 100.0 * counts[3] / count, 100.0 * counts[0] / count);
+        std::printf("  %-16s %8.1f M boards/s  %6.2f G line tests/s\n", BatchWinCheck::kernelName(),
+                    count / batchSeconds / 1e6, tests / batchSeconds / 1e9);
+        std::printf("  %-16s %8.1f M boards/s  %6.2f G line tests/s\n", "one at a time",
+                    count / singleSeconds / 1e6, tests / singleSeconds / 1e9);
+    }
+    return ok ? 0 : 1;
+}